@@ -0,0 +1,181 @@
+// Interpreter throughput over canned PPC routines, in ns per guest
+// instruction.
+//
+// usage: interpreter_bench [--reps N]
+//
+// Each routine is assembled into a detached interpreter and evaluated through
+// evaluateFunction(), the way TaskCommunicator calls into the game. The run
+// fails if a routine does not return the value it should.
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+#include "dolphin/interpreter/system.hpp"
+
+using namespace Toolbox;
+using namespace Toolbox::Interpreter;
+
+namespace {
+
+    using clock_t_ = std::chrono::steady_clock;
+
+    constexpr u32 s_code_address = 0x80003000;
+
+    constexpr u32 Addi(u32 rd, u32 ra, s16 si) {
+        return (14u << 26) | (rd << 21) | (ra << 16) | static_cast<u16>(si);
+    }
+    constexpr u32 Lis(u32 rd, u16 ui) { return (15u << 26) | (rd << 21) | ui; }
+    constexpr u32 Ori(u32 ra, u32 rs, u16 ui) { return (24u << 26) | (rs << 21) | (ra << 16) | ui; }
+    constexpr u32 Nop() { return Ori(0, 0, 0); }
+    constexpr u32 Lwz(u32 rd, s16 d, u32 ra) {
+        return (32u << 26) | (rd << 21) | (ra << 16) | static_cast<u16>(d);
+    }
+    constexpr u32 Stw(u32 rs, s16 d, u32 ra) {
+        return (36u << 26) | (rs << 21) | (ra << 16) | static_cast<u16>(d);
+    }
+    constexpr u32 X31(u32 d, u32 a, u32 b, u32 xo) {
+        return (31u << 26) | (d << 21) | (a << 16) | (b << 11) | (xo << 1);
+    }
+    constexpr u32 Add(u32 rd, u32 ra, u32 rb) { return X31(rd, ra, rb, 266); }
+    constexpr u32 Xor(u32 ra, u32 rs, u32 rb) { return X31(rs, ra, rb, 316); }
+    constexpr u32 Mr(u32 ra, u32 rs) { return X31(rs, ra, rs, 444); }
+    constexpr u32 Cmpw(u32 ra, u32 rb) { return X31(0, ra, rb, 0); }
+    constexpr u32 Rlwinm(u32 ra, u32 rs, u32 sh, u32 mb, u32 me) {
+        return (21u << 26) | (rs << 21) | (ra << 16) | (sh << 11) | (mb << 6) | (me << 1);
+    }
+    // Displacement in words from the branch itself
+    constexpr u32 Blt(s32 words) { return (16u << 26) | (12 << 21) | ((words * 4) & 0xFFFC); }
+    constexpr u32 Blr() { return 0x4E800020; }
+
+    struct Routine {
+        const char *m_name;
+        std::vector<u32> m_code;
+        int m_calls;
+        double m_instructions_per_call;
+        u32 m_expected_r3;
+    };
+
+    constexpr u32 s_iterations = 200000;
+
+    std::vector<Routine> Routines() {
+        // A loop over arithmetic, a rotate, a store and a load, like the
+        // inner loops of the game's list walks
+        std::vector<u32> mixed = {
+            Addi(4, 0, 0),
+            Addi(6, 0, 0),
+            Lis(5, s_iterations >> 16),
+            Ori(5, 5, s_iterations & 0xFFFF),
+            Lis(7, 0x8010),
+            Addi(4, 4, 1),
+            Add(6, 6, 4),
+            Rlwinm(8, 6, 3, 0, 28),
+            Stw(8, 0, 7),
+            Lwz(9, 0, 7),
+            Xor(6, 6, 9),
+            Cmpw(4, 5),
+            Blt(-7),
+            Mr(3, 6),
+            Blr(),
+        };
+
+        // The same loop shape with nothing but a counter in it, so the
+        // block overhead dominates
+        std::vector<u32> nops = {
+            Addi(4, 0, 0),
+            Addi(6, 0, 0),
+            Lis(5, s_iterations >> 16),
+            Ori(5, 5, s_iterations & 0xFFFF),
+            Lis(7, 0x8010),
+            Addi(4, 4, 1),
+            Nop(),
+            Nop(),
+            Nop(),
+            Nop(),
+            Nop(),
+            Cmpw(4, 5),
+            Blt(-7),
+            Mr(3, 6),
+            Blr(),
+        };
+
+        // A short straight line function called over and over, like a
+        // getter evaluated per scene object
+        std::vector<u32> straight(40, Addi(3, 3, 1));
+        straight.push_back(Blr());
+
+        return {
+            {"mixed loop", mixed, 20, s_iterations * 8.0 + 7, 0xD87AFC20},
+            {"counter loop", nops, 20, s_iterations * 8.0 + 7, 0},
+            {"40 word function", straight, 200000, 41.0, 40},
+        };
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    int reps = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc) {
+            reps = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "usage: %s [--reps N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    for (const Routine &routine : Routines()) {
+        SystemDolphin system = SystemDolphin::CreateDetached();
+
+        std::vector<u32> code(routine.m_code.size());
+        std::transform(routine.m_code.begin(), routine.m_code.end(), code.begin(),
+                       [](u32 inst) { return std::byteswap(inst); });
+        system.writeBytes(reinterpret_cast<const char *>(code.data()), s_code_address,
+                          code.size() * sizeof(u32));
+
+        bool failed = false;
+        system.onException([&](u32 pc, ExceptionCause, const Register::RegisterSnapshot &) {
+            std::fprintf(stderr, "%s: exception at %08X\n", routine.m_name, pc);
+            failed = true;
+        });
+        system.onInvalid(
+            [&](u32 pc, const std::string &reason, const Register::RegisterSnapshot &) {
+                std::fprintf(stderr, "%s: invalid at %08X: %s\n", routine.m_name, pc,
+                             reason.c_str());
+                failed = true;
+            });
+
+        std::vector<double> ns_per_inst;
+        u32 result = 0;
+        for (int r = 0; r < reps; ++r) {
+            auto start = clock_t_::now();
+            for (int c = 0; c < routine.m_calls; ++c) {
+                u32 r3 = 0;
+                system.setStackPointer(0x80200000);
+                result = static_cast<u32>(
+                    system.evaluateFunction(s_code_address, 1, &r3, 0, nullptr).m_gpr[3]);
+            }
+            const double ns =
+                std::chrono::duration<double, std::nano>(clock_t_::now() - start).count();
+            ns_per_inst.push_back(ns / (routine.m_calls * routine.m_instructions_per_call));
+        }
+
+        if (failed || result != routine.m_expected_r3) {
+            std::fprintf(stderr, "%s: returned %08X, expected %08X\n", routine.m_name, result,
+                         routine.m_expected_r3);
+            return 1;
+        }
+
+        std::sort(ns_per_inst.begin(), ns_per_inst.end());
+        const double median = ns_per_inst[ns_per_inst.size() / 2];
+        std::printf("%-20s min %7.2f  median %7.2f ns/inst  %8.1f Minst/s\n", routine.m_name,
+                    ns_per_inst.front(), median, 1000.0 / median);
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+// First scan throughput of the memory scanner kernels over a Dolphin sized
+// image of random bytes.
+//
+// usage: memscan_bench [--reps N] [--seed N]
+//
+// Each case runs MemScan::FindAll() the way MemoryScanner's first scan does
+// and checks the offsets it returns against a scalar walk of the image. The
+// run fails on any mismatch.
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "model/memscankernel.hpp"
+
+using namespace Toolbox;
+using namespace Toolbox::MemScan;
+
+namespace {
+
+    using clock_t_ = std::chrono::steady_clock;
+
+    constexpr u32 s_image_size = 0x1800000;
+
+    struct Samples {
+        const char *m_name;
+        std::vector<double> m_ms;
+
+        void report(size_t bytes, size_t hits) {
+            std::sort(m_ms.begin(), m_ms.end());
+            const double median = m_ms[m_ms.size() / 2];
+            std::printf("%-18s min %8.3f  median %8.3f ms  %8.1f MiB/s  %8zu hits\n", m_name,
+                        m_ms.front(), median,
+                        (double(bytes) / (1024.0 * 1024.0)) / (median / 1000.0), hits);
+        }
+    };
+
+    template <typename _Fn> double TimeMs(_Fn &&fn) {
+        auto start = clock_t_::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(clock_t_::now() - start).count();
+    }
+
+    template <typename T>
+    std::vector<u32> FindAllScalar(const std::vector<u8> &mem, u32 stride,
+                                   const RangePredicate<T> &pred) {
+        std::vector<u32> found;
+        for (u32 ofs = 0; ofs + sizeof(T) <= mem.size(); ofs += stride) {
+            std::array<u8, sizeof(T)> raw;
+            std::memcpy(raw.data(), mem.data() + ofs, sizeof(T));
+            std::reverse(raw.begin(), raw.end());
+            if (pred.test(std::bit_cast<T>(raw))) {
+                found.push_back(ofs);
+            }
+        }
+        return found;
+    }
+
+    template <typename T>
+    bool RunCase(const char *name, const std::vector<u8> &mem, int reps, ScanOperator op, T a,
+                 T b, u32 stride) {
+        const RangePredicate<T> pred = MakeRangePredicate<T>(op, a, b, T());
+
+        Samples samples = {name, {}};
+        std::vector<u32> found;
+        for (int r = 0; r < reps; ++r) {
+            samples.m_ms.push_back(TimeMs([&]() {
+                found = FindAll<T>(mem.data(), static_cast<u32>(mem.size()), 0,
+                                   static_cast<u32>(mem.size()), stride, pred);
+            }));
+        }
+
+        if (found != FindAllScalar<T>(mem, stride, pred)) {
+            std::fprintf(stderr, "%s: results differ from the scalar scan\n", name);
+            return false;
+        }
+
+        samples.report(mem.size(), found.size());
+        return true;
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    int reps = 15;
+    u32 seed = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc) {
+            reps = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = static_cast<u32>(std::strtoul(argv[++i], nullptr, 0));
+        } else {
+            std::fprintf(stderr, "usage: %s [--reps N] [--seed N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<u8> mem(s_image_size);
+    std::mt19937 rng(seed);
+    for (u8 &byte : mem) {
+        byte = static_cast<u8>(rng());
+    }
+
+    bool ok = true;
+    ok &= RunCase<u8>("u8 exact s1", mem, reps, ScanOperator::OP_EXACT, 0x42, 0, 1);
+    ok &= RunCase<u16>("u16 exact s2", mem, reps, ScanOperator::OP_EXACT, 0x4242, 0, 2);
+    ok &= RunCase<u32>("u32 exact s4", mem, reps, ScanOperator::OP_EXACT, 0x42424242, 0, 4);
+    ok &= RunCase<u32>("u32 exact s1", mem, reps, ScanOperator::OP_EXACT, 0x42424242, 0, 1);
+    ok &= RunCase<f32>("f32 between s4", mem, reps, ScanOperator::OP_BETWEEN, 1.0f, 2.0f, 4);
+    ok &= RunCase<f64>("f64 between s8", mem, reps, ScanOperator::OP_BETWEEN, 1.0, 2.0, 8);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+// Time from an archive on disk to a full listing of its nodes, through the
+// mapped path stages are opened with and through a copying stream load.
+//
+// usage: rarc_bench [--reps N] [archive]...
+//
+// Without arguments a synthetic stage (40 folders of 50 files, about 20 MB)
+// is written to the temp directory both raw and Yaz0 compressed. The copying
+// load reads the file, expands it if needed and deserializes it through a
+// std::stringbuf, the way archives were extracted before they were mapped.
+// The run fails if the two loads list different names or sizes.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "rarc/rarc.hpp"
+#include "szs/yaz0.hpp"
+
+using namespace Toolbox;
+using namespace Toolbox::RARC;
+
+namespace {
+
+    using clock_t_ = std::chrono::steady_clock;
+
+    struct Samples {
+        const char *m_name;
+        std::vector<double> m_ms;
+
+        void report() {
+            std::sort(m_ms.begin(), m_ms.end());
+            const double median = m_ms[m_ms.size() / 2];
+            std::printf("  %-10s min %9.3f  median %9.3f ms\n", m_name, m_ms.front(), median);
+        }
+    };
+
+    template <typename _Fn> double TimeMs(_Fn &&fn) {
+        auto start = clock_t_::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(clock_t_::now() - start).count();
+    }
+
+    // Bytes of names and data over every node, so both loads have to touch
+    // what they produced.
+    size_t ListNodes(const ResourceArchive &archive) {
+        size_t total = 0;
+        for (const ResourceArchive::Node &node : archive.getNodes()) {
+            total += node.name.size() + node.data.size();
+        }
+        return total;
+    }
+
+    bool OpenMapped(const fs_path &path, size_t &listed) {
+        auto archive = ResourceArchive::CreateFromArchive(path);
+        if (!archive) {
+            return false;
+        }
+        listed = ListNodes(archive.value());
+        return true;
+    }
+
+    bool OpenCopied(const fs_path &path, size_t &listed) {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<u8> data{std::istreambuf_iterator<char>(in), {}};
+        if (SZS::IsYaz0Compressed(data)) {
+            auto expanded = SZS::Yaz0Decode(data);
+            if (!expanded) {
+                return false;
+            }
+            data = std::move(expanded.value());
+        }
+
+        std::stringbuf buf(std::string(data.begin(), data.end()));
+        Deserializer deserializer(&buf, path.string());
+
+        ResourceArchive archive(path.filename().string());
+        if (!archive.deserialize(deserializer)) {
+            return false;
+        }
+        listed = ListNodes(archive);
+        return true;
+    }
+
+    bool WriteSyntheticStage(const fs_path &dir, std::vector<fs_path> &out) {
+        const fs_path root = dir / "scene";
+        std::filesystem::remove_all(root);
+
+        // Partly repetitive data, so the Yaz0 copy compresses like a stage
+        std::mt19937 rng(1);
+        for (int d = 0; d < 40; ++d) {
+            const fs_path folder = root / ("dir" + std::to_string(d));
+            std::filesystem::create_directories(folder);
+            for (int f = 0; f < 50; ++f) {
+                std::string contents(8192 + rng() % 4096, '\0');
+                for (size_t i = 0; i < contents.size(); ++i) {
+                    contents[i] = (rng() % 4 == 0) ? char(rng()) : char(i / 16);
+                }
+                std::ofstream(folder / ("file" + std::to_string(f) + ".bin"), std::ios::binary)
+                    << contents;
+            }
+        }
+
+        auto archive = ResourceArchive::CreateFromPath(root);
+        if (!archive) {
+            return false;
+        }
+
+        std::stringstream image_stream;
+        Serializer serializer(image_stream.rdbuf());
+        if (!archive.value().serialize(serializer)) {
+            return false;
+        }
+        const std::string image = image_stream.str();
+
+        auto encoded = SZS::Yaz0Encode({reinterpret_cast<const u8 *>(image.data()), image.size()},
+                                       SZS::Yaz0Level::LEVEL_FAST);
+        if (!encoded) {
+            return false;
+        }
+
+        out.push_back(dir / "stage.arc");
+        out.push_back(dir / "stage.szs");
+        std::ofstream(out[0], std::ios::binary) << image;
+        std::ofstream(out[1], std::ios::binary)
+            .write(reinterpret_cast<const char *>(encoded->data()), encoded->size());
+        std::filesystem::remove_all(root);
+        return true;
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    int reps = 15;
+    std::vector<fs_path> inputs;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc) {
+            reps = std::max(1, std::atoi(argv[++i]));
+        } else if (arg.starts_with("--")) {
+            std::fprintf(stderr, "usage: %s [--reps N] [archive]...\n", argv[0]);
+            return 1;
+        } else {
+            inputs.emplace_back(arg);
+        }
+    }
+
+    if (inputs.empty()) {
+        const fs_path dir = std::filesystem::temp_directory_path() / "rarc_bench";
+        std::filesystem::create_directories(dir);
+        if (!WriteSyntheticStage(dir, inputs)) {
+            std::fprintf(stderr, "cannot write the synthetic stage to %s\n", dir.string().c_str());
+            return 1;
+        }
+    }
+
+    for (const fs_path &path : inputs) {
+        Samples copied = {"copied", {}};
+        Samples mapped = {"mapped", {}};
+        size_t copied_bytes = 0;
+        size_t mapped_bytes = 0;
+
+        bool ok = true;
+        for (int r = 0; r < reps && ok; ++r) {
+            copied.m_ms.push_back(TimeMs([&]() { ok &= OpenCopied(path, copied_bytes); }));
+            mapped.m_ms.push_back(TimeMs([&]() { ok &= OpenMapped(path, mapped_bytes); }));
+        }
+
+        if (!ok || copied_bytes != mapped_bytes) {
+            std::fprintf(stderr, "%s: loads disagree (%zu vs %zu bytes listed)\n",
+                         path.string().c_str(), copied_bytes, mapped_bytes);
+            return 1;
+        }
+
+        std::printf("%s (%zu bytes listed)\n", path.string().c_str(), mapped_bytes);
+        copied.report();
+        mapped.report();
+    }
+    return 0;
+}
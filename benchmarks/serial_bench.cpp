@@ -0,0 +1,161 @@
+// Serializer and Deserializer throughput over the in-memory backends
+// against a plain std::stringbuf.
+//
+// usage: serial_bench [--reps N]
+//
+// The stringbuf cases go through the generic std::streambuf path, the way
+// every parser was fed before SpanStreamBuf and GrowableStreamBuf. The run
+// fails if the two backends read a different checksum or write different
+// bytes.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "serial.hpp"
+#include "serialbuf.hpp"
+
+using namespace Toolbox;
+
+namespace {
+
+    using clock_t_ = std::chrono::steady_clock;
+
+    constexpr size_t s_word_count   = 1 << 20;
+    constexpr size_t s_string_count = 100000;
+
+    struct Samples {
+        const char *m_name;
+        std::vector<double> m_ms;
+
+        void report() {
+            std::sort(m_ms.begin(), m_ms.end());
+            std::printf("  %-10s min %8.3f  median %8.3f ms\n", m_name, m_ms.front(),
+                        m_ms[m_ms.size() / 2]);
+        }
+    };
+
+    template <typename _Fn> double TimeMs(_Fn &&fn) {
+        auto start = clock_t_::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(clock_t_::now() - start).count();
+    }
+
+    u64 ReadWords(Deserializer &in) {
+        u64 sum = 0;
+        for (size_t i = 0; i < s_word_count; ++i) {
+            sum += in.read<u32, std::endian::big>();
+        }
+        return sum;
+    }
+
+    u64 ReadStrings(Deserializer &in) {
+        u64 sum = 0;
+        for (size_t i = 0; i < s_string_count; ++i) {
+            sum += in.readCString().size();
+        }
+        return sum;
+    }
+
+    void WriteWords(Serializer &out) {
+        for (size_t i = 0; i < s_word_count; ++i) {
+            out.write<u32, std::endian::big>(static_cast<u32>(i));
+        }
+    }
+
+    // Times `stream` and `memory` alternately, and fails unless both
+    // produce the same result.
+    template <typename _StreamFn, typename _MemoryFn>
+    bool RunCase(const char *name, int reps, _StreamFn &&stream, _MemoryFn &&memory) {
+        Samples stream_samples = {"stringbuf", {}};
+        Samples memory_samples = {"memory", {}};
+
+        decltype(stream()) stream_result = {};
+        decltype(memory()) memory_result = {};
+        for (int r = 0; r < reps; ++r) {
+            stream_samples.m_ms.push_back(TimeMs([&]() { stream_result = stream(); }));
+            memory_samples.m_ms.push_back(TimeMs([&]() { memory_result = memory(); }));
+        }
+
+        if (stream_result != memory_result) {
+            std::fprintf(stderr, "%s: the backends disagree\n", name);
+            return false;
+        }
+
+        std::printf("%s\n", name);
+        stream_samples.report();
+        memory_samples.report();
+        return true;
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    int reps = 11;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc) {
+            reps = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "usage: %s [--reps N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::string words(s_word_count * sizeof(u32), '\0');
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] = static_cast<char>(i * 7);
+    }
+
+    std::string strings;
+    for (size_t i = 0; i < s_string_count; ++i) {
+        strings += "MapObjGeneral" + std::to_string(i);
+        strings.push_back('\0');
+    }
+
+    bool ok = true;
+    ok &= RunCase(
+        "read 1M big-endian u32", reps,
+        [&]() {
+            std::stringbuf buf(words);
+            Deserializer in(&buf);
+            return ReadWords(in);
+        },
+        [&]() {
+            Deserializer in{std::span<const char>(words)};
+            return ReadWords(in);
+        });
+    ok &= RunCase(
+        "readCString x100k", reps,
+        [&]() {
+            std::stringbuf buf(strings);
+            Deserializer in(&buf);
+            return ReadStrings(in);
+        },
+        [&]() {
+            Deserializer in{std::span<const char>(strings)};
+            return ReadStrings(in);
+        });
+    ok &= RunCase(
+        "write 1M big-endian u32", reps,
+        [&]() {
+            std::stringbuf buf(std::ios::out | std::ios::binary);
+            Serializer out(&buf);
+            WriteWords(out);
+            return std::string(buf.view());
+        },
+        [&]() {
+            GrowableStreamBuf buf;
+            Serializer out(&buf);
+            WriteWords(out);
+            return std::string(buf.data().begin(), buf.data().end());
+        });
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,132 @@
+// Game text encoding throughput of the table driven cp932 codec against
+// the ICU converters it replaced.
+//
+// usage: sjis_bench [--reps N]
+//
+// The inputs are 20,000 ASCII object names, as NameRef and getActorPtr()
+// convert them, and 2,000 Japanese message lines. ICU is called through
+// String::asEncoding(), which is what toGameEncoding() and
+// fromGameEncoding() used to forward to. The run fails if the two codecs
+// produce different bytes for any string.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "strutil.hpp"
+
+using namespace Toolbox;
+
+namespace {
+
+    using clock_t_ = std::chrono::steady_clock;
+
+    struct Samples {
+        const char *m_name;
+        std::vector<double> m_ms;
+
+        void report() {
+            std::sort(m_ms.begin(), m_ms.end());
+            std::printf("  %-6s min %8.3f  median %8.3f ms\n", m_name, m_ms.front(),
+                        m_ms[m_ms.size() / 2]);
+        }
+    };
+
+    template <typename _Fn> double TimeMs(_Fn &&fn) {
+        auto start = clock_t_::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(clock_t_::now() - start).count();
+    }
+
+    using converter_t = Result<std::string, String::EncodingError> (*)(std::string_view);
+
+    Result<std::string, String::EncodingError> ICUToGame(std::string_view value) {
+        return String::asEncoding(value, IMGUI_ENCODING, GAME_ENCODING);
+    }
+
+    Result<std::string, String::EncodingError> ICUFromGame(std::string_view value) {
+        return String::asEncoding(value, GAME_ENCODING, IMGUI_ENCODING);
+    }
+
+    bool Convert(const std::vector<std::string> &inputs, converter_t convert,
+                 std::vector<std::string> &out) {
+        out.clear();
+        for (const std::string &input : inputs) {
+            auto result = convert(input);
+            if (!result) {
+                return false;
+            }
+            out.push_back(std::move(result.value()));
+        }
+        return true;
+    }
+
+    bool RunCase(const char *name, const std::vector<std::string> &inputs, int reps,
+                 converter_t icu, converter_t table) {
+        Samples icu_samples   = {"ICU", {}};
+        Samples table_samples = {"table", {}};
+        std::vector<std::string> icu_out;
+        std::vector<std::string> table_out;
+
+        bool ok = true;
+        for (int r = 0; r < reps && ok; ++r) {
+            icu_samples.m_ms.push_back(TimeMs([&]() { ok &= Convert(inputs, icu, icu_out); }));
+            table_samples.m_ms.push_back(
+                TimeMs([&]() { ok &= Convert(inputs, table, table_out); }));
+        }
+
+        if (!ok || icu_out != table_out) {
+            std::fprintf(stderr, "%s: the codecs disagree\n", name);
+            return false;
+        }
+
+        std::printf("%s\n", name);
+        icu_samples.report();
+        table_samples.report();
+        return true;
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    int reps = 9;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc) {
+            reps = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "usage: %s [--reps N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<std::string> ascii;
+    for (int i = 0; i < 20000; ++i) {
+        ascii.push_back("MapObjGeneral_" + std::to_string(i));
+    }
+
+    std::vector<std::string> japanese;
+    for (int i = 0; i < 2000; ++i) {
+        japanese.push_back("マリオ、シャインを" + std::to_string(i) +
+                           "個集めよう！ドルピックタウン");
+    }
+
+    std::vector<std::string> japanese_game;
+    if (!Convert(japanese, ICUToGame, japanese_game)) {
+        std::fprintf(stderr, "ICU cannot convert to %s\n", GAME_ENCODING);
+        return 1;
+    }
+
+    bool ok = true;
+    ok &= RunCase("ASCII to game, 20k", ascii, reps, ICUToGame, String::toGameEncoding);
+    ok &= RunCase("ASCII from game, 20k", ascii, reps, ICUFromGame, String::fromGameEncoding);
+    ok &= RunCase("Japanese to game, 2k", japanese, reps, ICUToGame, String::toGameEncoding);
+    ok &= RunCase("Japanese from game, 2k", japanese_game, reps, ICUFromGame,
+                  String::fromGameEncoding);
+    return ok ? 0 : 1;
+}
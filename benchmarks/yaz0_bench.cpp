@@ -0,0 +1,168 @@
+// Yaz0 encode/decode throughput against the librii codec it replaced.
+//
+// usage: yaz0_bench [--max] [--reps N] <file>...
+//
+// Inputs that are already Yaz0 compressed are expanded first, so a stage
+// archive can be passed directly. Every encoded stream is decoded by both
+// codecs and by the stream decoder, and the run fails on any mismatch.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+#include <librii/SZS.hpp>
+
+#include "szs/yaz0.hpp"
+
+using namespace Toolbox;
+
+namespace {
+
+    using clock_t_ = std::chrono::steady_clock;
+
+    struct Samples {
+        const char *m_name;
+        std::vector<double> m_ms;
+
+        void report(size_t bytes) {
+            std::sort(m_ms.begin(), m_ms.end());
+            const double median = m_ms[m_ms.size() / 2];
+            std::printf("%-24s min %9.3f  median %9.3f ms  %8.1f MiB/s\n", m_name, m_ms.front(),
+                        median, (double(bytes) / (1024.0 * 1024.0)) / (median / 1000.0));
+        }
+    };
+
+    template <typename _Fn> double TimeMs(_Fn &&fn) {
+        auto start = clock_t_::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(clock_t_::now() - start).count();
+    }
+
+    bool ReadInput(const char *path, std::vector<u8> &out) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            std::fprintf(stderr, "cannot open %s\n", path);
+            return false;
+        }
+        std::vector<u8> data{std::istreambuf_iterator<char>(in), {}};
+        if (SZS::IsYaz0Compressed(data)) {
+            auto expanded = SZS::Yaz0Decode(data);
+            if (!expanded) {
+                std::fprintf(stderr, "%s: invalid Yaz0 stream\n", path);
+                return false;
+            }
+            data = std::move(expanded.value());
+        }
+        out.insert(out.end(), data.begin(), data.end());
+        return true;
+    }
+
+    bool StreamDecode(std::span<const u8> src, std::vector<u8> &out, size_t chunk_size) {
+        out.clear();
+        SZS::Yaz0StreamDecoder decoder(
+            [&out](std::span<const u8> block) { out.insert(out.end(), block.begin(), block.end()); });
+        for (size_t i = 0; i < src.size(); i += chunk_size) {
+            if (!decoder.feed(src.subspan(i, std::min(chunk_size, src.size() - i)))) {
+                return false;
+            }
+        }
+        return decoder.isFinished();
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    bool with_max = false;
+    int reps      = 5;
+
+    std::vector<u8> data;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--max") {
+            with_max = true;
+        } else if (arg == "--reps" && i + 1 < argc) {
+            reps = std::max(1, std::atoi(argv[++i]));
+        } else if (!ReadInput(argv[i], data)) {
+            return 1;
+        }
+    }
+
+    if (data.empty()) {
+        std::fprintf(stderr, "usage: %s [--max] [--reps N] <file>...\n", argv[0]);
+        return 1;
+    }
+
+    std::printf("input: %zu bytes, %d reps\n", data.size(), reps);
+
+    Samples librii_enc{"librii encode"}, fast_enc{"yaz0 encode FAST"},
+        default_enc{"yaz0 encode DEFAULT"}, max_enc{"yaz0 encode MAX"};
+    Samples librii_dec{"librii decode"}, yaz0_dec{"yaz0 decode"},
+        stream_dec{"yaz0 stream decode (4K)"};
+
+    std::vector<u8> librii_out, fast_out, default_out, max_out;
+    std::vector<u8> decoded(data.size());
+    std::vector<u8> streamed;
+    streamed.reserve(data.size());
+
+    auto verify = [&](const char *name, std::span<const u8> encoded) {
+        if (SZS::Yaz0Decode(encoded).value_or(std::vector<u8>{}) != data) {
+            std::fprintf(stderr, "%s: yaz0 round trip mismatch\n", name);
+            return false;
+        }
+        std::vector<u8> encoded_copy(encoded.begin(), encoded.end());
+        librii::szs::decode(decoded, encoded_copy);
+        if (decoded != data) {
+            std::fprintf(stderr, "%s: librii round trip mismatch\n", name);
+            return false;
+        }
+        if (!StreamDecode(encoded, streamed, 4096) || streamed != data) {
+            std::fprintf(stderr, "%s: stream round trip mismatch\n", name);
+            return false;
+        }
+        return true;
+    };
+
+    for (int r = 0; r < reps; ++r) {
+        librii_enc.m_ms.push_back(TimeMs([&] { librii_out = librii::szs::encode(data); }));
+        fast_enc.m_ms.push_back(TimeMs(
+            [&] { fast_out = SZS::Yaz0Encode(data, SZS::Yaz0Level::LEVEL_FAST).value(); }));
+        default_enc.m_ms.push_back(TimeMs([&] { default_out = SZS::Yaz0Encode(data).value(); }));
+        if (with_max) {
+            max_enc.m_ms.push_back(TimeMs(
+                [&] { max_out = SZS::Yaz0Encode(data, SZS::Yaz0Level::LEVEL_MAX).value(); }));
+        }
+
+        librii_dec.m_ms.push_back(TimeMs([&] { librii::szs::decode(decoded, librii_out); }));
+        yaz0_dec.m_ms.push_back(TimeMs([&] { (void)SZS::Yaz0Decode(default_out, decoded); }));
+        stream_dec.m_ms.push_back(TimeMs([&] { StreamDecode(default_out, streamed, 4096); }));
+    }
+
+    if (!verify("librii", librii_out) || !verify("FAST", fast_out) ||
+        !verify("DEFAULT", default_out) || (with_max && !verify("MAX", max_out))) {
+        return 1;
+    }
+
+    librii_enc.report(data.size());
+    fast_enc.report(data.size());
+    default_enc.report(data.size());
+    if (with_max) {
+        max_enc.report(data.size());
+    }
+    librii_dec.report(data.size());
+    yaz0_dec.report(data.size());
+    stream_dec.report(data.size());
+
+    std::printf("encoded sizes: librii %zu  FAST %zu  DEFAULT %zu", librii_out.size(),
+                fast_out.size(), default_out.size());
+    if (with_max) {
+        std::printf("  MAX %zu", max_out.size());
+    }
+    std::printf("\n");
+    return 0;
+}
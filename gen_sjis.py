@@ -1,32 +1,96 @@
-# Save this as gen_sjis.py and run it
-def generate_cpp_switch():
-    print("constexpr unsigned short unicode_to_sjis_lookup(char32_t cp) {")
-    print("    if (cp < 0x80) return static_cast<unsigned short>(cp);")
-    print("    switch (cp) {")
-    
-    # Iterate all valid Shift-JIS double-byte characters
-    # Valid lead bytes: 0x81-0x9F, 0xE0-0xEF
-    # Valid trail bytes: 0x40-0x7E, 0x80-0xFC
-    for lead in list(range(0x81, 0xA0)) + list(range(0xE0, 0xF0)):
-        for trail in list(range(0x40, 0x7F)) + list(range(0x80, 0xFD)):
-            if trail == 0x7F: continue
-            
-            sjis_bytes = bytes([lead, trail])
-            try:
-                # Attempt to decode as Shift-JIS
-                char = sjis_bytes.decode('shift_jis')
-                # Get the Unicode codepoint
-                codepoint = ord(char)
-                
-                # Print C++ case
-                # 0x{lead:02X}{trail:02X} creates the combined 16-bit integer
-                print(f"        case 0x{codepoint:X}: return 0x{lead:02X}{trail:02X};")
-            except:
-                pass # Not a valid mapping
-                
-    print("        default: return 0x3F; // '?'")
+# Generates include/sjis_table.hpp, the Shift-JIS (cp932) tables used by
+# String::fromGameEncoding and String::toGameEncoding.
+#
+# Run from the repository root: python gen_sjis.py > include/sjis_table.hpp
+
+LEAD_BYTES = list(range(0x81, 0xA0)) + list(range(0xE0, 0xFD))
+TRAIL_FIRST = 0x40
+TRAIL_LAST = 0xFC
+
+
+def decode(data):
+    try:
+        return ord(data.decode('cp932'))
+    except (UnicodeDecodeError, TypeError):
+        return 0
+
+
+def emit_array(decl, values, per_line=11, nested=False):
+    # Arrays of structs need the outer braces of std::array spelled out
+    print(f"    {decl} = {{{{" if nested else f"    {decl} = {{")
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        print("        " + ", ".join(chunk) + ",")
+    print("    }};" if nested else "    };")
+
+
+def generate_tables():
+    single = []
+    for byte in range(0x80, 0x100):
+        single.append(0 if byte in LEAD_BYTES else decode(bytes([byte])))
+
+    double = []
+    for lead in LEAD_BYTES:
+        for trail in range(TRAIL_FIRST, TRAIL_LAST + 1):
+            double.append(decode(bytes([lead, trail])))
+
+    # The encoder's preferred byte sequence for every code point, which also
+    # settles the NEC/IBM duplicates the decoder maps onto one code point.
+    reverse = []
+    for cp in range(0x80, 0x10000):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        try:
+            encoded = chr(cp).encode('cp932')
+        except UnicodeEncodeError:
+            continue
+        reverse.append((cp, int.from_bytes(encoded, 'big')))
+
+    print("#pragma once")
+    print()
+    print("// Generated by gen_sjis.py, do not edit by hand.")
+    print()
+    print("#include <array>")
+    print()
+    print('#include "core/types.hpp"')
+    print()
+    print("namespace Toolbox::String::SJIS {")
+    print()
+    print(f"    constexpr u8 TRAIL_FIRST     = 0x{TRAIL_FIRST:02X};")
+    print(f"    constexpr u8 TRAIL_LAST      = 0x{TRAIL_LAST:02X};")
+    print(f"    constexpr size_t TRAIL_COUNT = TRAIL_LAST - TRAIL_FIRST + 1;")
+    print()
+    print("    // Lead bytes are 0x81-0x9F and 0xE0-0xFC; returns -1 for any other byte.")
+    print("    constexpr int LeadIndex(u8 byte) {")
+    print("        if (byte >= 0x81 && byte <= 0x9F) {")
+    print("            return byte - 0x81;")
+    print("        }")
+    print("        if (byte >= 0xE0 && byte <= 0xFC) {")
+    print("            return byte - 0xE0 + (0x9F - 0x81 + 1);")
+    print("        }")
+    print("        return -1;")
     print("    }")
-    print("}")
+    print()
+    print("    // Code points of the single bytes 0x80-0xFF; 0 for lead and unmapped bytes.")
+    emit_array(f"constexpr std::array<char16_t, {len(single)}> s_single_to_unicode",
+               [f"0x{v:04X}" for v in single])
+    print()
+    print("    // Code points of the double byte characters, indexed by")
+    print("    // LeadIndex(lead) * TRAIL_COUNT + (trail - TRAIL_FIRST); 0 if unmapped.")
+    emit_array(f"constexpr std::array<char16_t, {len(double)}> s_double_to_unicode",
+               [f"0x{v:04X}" for v in double])
+    print()
+    print("    struct UnicodeMapping {")
+    print("        char16_t m_unicode;")
+    print("        u16 m_sjis;  // Single byte sequences are below 0x100")
+    print("    };")
+    print()
+    print("    // Every non-ASCII code point with a cp932 encoding, sorted by code point.")
+    emit_array(f"constexpr std::array<UnicodeMapping, {len(reverse)}> s_unicode_to_sjis",
+               [f"{{0x{cp:04X}, 0x{sj:04X}}}" for cp, sj in reverse], per_line=5, nested=True)
+    print()
+    print("}  // namespace Toolbox::String::SJIS")
+
 
 if __name__ == "__main__":
-    generate_cpp_switch()
\ No newline at end of file
+    generate_tables()
@@ -36,6 +36,12 @@
 #define TOOLBOX_EXPAND_MACRO(x)    x
 #define TOOLBOX_STRINGIFY_MACRO(x) #x
 
+#if defined(_MSC_VER)
+#define TOOLBOX_FORCE_INLINE __forceinline
+#else
+#define TOOLBOX_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
 #define BIT(x)                       (u64)((u64)1 << (u8)(x))
 #define SIG_BIT(x, width)            (u64)((u64)1 << (u8)((width - 1) - (x)))
 #define GET_BIT(value, x)            (bool)(((value) & (BIT((x)))) >> (u8)(x))
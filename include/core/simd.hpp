@@ -0,0 +1,218 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "core/types.hpp"
+
+// SIMD feature selection. SSE2 is the x86-64 baseline and is used
+// unconditionally. AVX2 code is compiled into every x86 build through
+// TOOLBOX_SIMD_TARGET_AVX2, and is only run when SIMD::HasAVX2() says the
+// CPU supports it. Kernels should always provide a scalar fallback for
+// when neither is available.
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) ||                                 \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TOOLBOX_SIMD_SSE2
+#endif
+
+#if defined(__AVX2__) || defined(_M_X64) || defined(_M_AMD64) ||                                 \
+    ((defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)))
+#define TOOLBOX_SIMD_AVX2
+#endif
+
+// Marks a function as containing AVX2 code. MSVC emits AVX2 intrinsics
+// in any function, so only GCC and Clang need to be told.
+#if defined(TOOLBOX_SIMD_AVX2) && (defined(__GNUC__) || defined(__clang__))
+#define TOOLBOX_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TOOLBOX_SIMD_TARGET_AVX2
+#endif
+
+#if defined(TOOLBOX_SIMD_AVX2)
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(TOOLBOX_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace Toolbox::SIMD {
+
+    // True if the CPU and OS both support AVX2. Checked once per process.
+    inline bool HasAVX2() {
+#if defined(__AVX2__)
+        return true;
+#elif defined(TOOLBOX_SIMD_AVX2) && (defined(__GNUC__) || defined(__clang__))
+        static const bool s_has_avx2 = __builtin_cpu_supports("avx2");
+        return s_has_avx2;
+#elif defined(TOOLBOX_SIMD_AVX2) && defined(_MSC_VER)
+        static const bool s_has_avx2 = []() {
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) {
+                return false;
+            }
+
+            // The OS must save the YMM registers across context switches
+            __cpuid(info, 1);
+            const bool has_osxsave = (info[2] & (1 << 27)) != 0;
+            const bool has_avx     = (info[2] & (1 << 28)) != 0;
+            if (!has_osxsave || !has_avx || (_xgetbv(0) & 0x6) != 0x6) {
+                return false;
+            }
+
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+        }();
+        return s_has_avx2;
+#else
+        return false;
+#endif
+    }
+
+#if defined(TOOLBOX_SIMD_AVX2)
+
+    template <size_t _Width> TOOLBOX_SIMD_TARGET_AVX2 inline __m256i ByteSwapLanes(__m256i v) {
+        if constexpr (_Width == 1) {
+            return v;
+        } else if constexpr (_Width == 2) {
+            const __m256i shuf = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15,
+                                                  14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12,
+                                                  15, 14);
+            return _mm256_shuffle_epi8(v, shuf);
+        } else if constexpr (_Width == 4) {
+            const __m256i shuf = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13,
+                                                  12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14,
+                                                  13, 12);
+            return _mm256_shuffle_epi8(v, shuf);
+        } else {
+            const __m256i shuf = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10,
+                                                  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11,
+                                                  10, 9, 8);
+            return _mm256_shuffle_epi8(v, shuf);
+        }
+    }
+
+#endif
+
+#if defined(TOOLBOX_SIMD_SSE2)
+
+    // SSE2 has no byte shuffle, so wider swaps are built from word shuffles.
+    template <size_t _Width> inline __m128i ByteSwapLanes(__m128i v) {
+        if constexpr (_Width == 1) {
+            return v;
+        } else if constexpr (_Width == 2) {
+            return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        } else if constexpr (_Width == 4) {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            return ByteSwapLanes<2>(v);
+        } else {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+            return ByteSwapLanes<2>(v);
+        }
+    }
+
+#endif
+
+#if defined(TOOLBOX_SIMD_AVX2)
+    // Swaps whole vectors of `n` bytes, returning how many were swapped
+    template <size_t _Width>
+    TOOLBOX_SIMD_TARGET_AVX2 inline size_t ByteSwapBlocksAVX2(u8 *bytes, size_t n) {
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(bytes + i), ByteSwapLanes<_Width>(v));
+        }
+        return i;
+    }
+
+    TOOLBOX_SIMD_TARGET_AVX2 inline size_t CountASCIIBlocksAVX2(const u8 *data, size_t size,
+                                                                bool &found) {
+        size_t i = 0;
+        for (; i + 32 <= size; i += 32) {
+            __m256i v      = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+            const u32 mask = static_cast<u32>(_mm256_movemask_epi8(v));
+            if (mask != 0) {
+                found = true;
+                return i + std::countr_zero(mask);
+            }
+        }
+        return i;
+    }
+#endif
+
+    // Reverses the byte order of `count` packed values of `_Width` bytes in place.
+    // Used to decode blocks of big endian game memory after a bulk copy.
+    template <size_t _Width> inline void ByteSwapArray(void *data, size_t count) {
+        static_assert(_Width == 1 || _Width == 2 || _Width == 4 || _Width == 8,
+                      "Unsupported lane width");
+        if constexpr (_Width == 1) {
+            return;
+        } else {
+            using lane_t = std::conditional_t<_Width == 2, u16,
+                                              std::conditional_t<_Width == 4, u32, u64>>;
+
+            u8 *bytes      = static_cast<u8 *>(data);
+            const size_t n = count * _Width;
+            size_t i       = 0;
+#if defined(TOOLBOX_SIMD_AVX2)
+            if (HasAVX2()) {
+                i = ByteSwapBlocksAVX2<_Width>(bytes, n);
+            }
+#endif
+#if defined(TOOLBOX_SIMD_SSE2)
+            for (; i + 16 <= n; i += 16) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(bytes + i), ByteSwapLanes<_Width>(v));
+            }
+#endif
+            for (; i < n; i += _Width) {
+                lane_t lane;
+                std::memcpy(&lane, bytes + i, _Width);
+                lane = std::byteswap(lane);
+                std::memcpy(bytes + i, &lane, _Width);
+            }
+        }
+    }
+
+    template <typename T> inline void ByteSwapArray(T *data, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        ByteSwapArray<sizeof(T)>(static_cast<void *>(data), count);
+    }
+
+    // Returns the length of the leading run of 7-bit ASCII bytes in `data`.
+    inline size_t CountASCIIPrefix(const u8 *data, size_t size) {
+        size_t i = 0;
+#if defined(TOOLBOX_SIMD_AVX2)
+        if (HasAVX2()) {
+            bool found = false;
+            i          = CountASCIIBlocksAVX2(data, size, found);
+            if (found) {
+                return i;
+            }
+        }
+#endif
+#if defined(TOOLBOX_SIMD_SSE2)
+        for (; i + 16 <= size; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+            const u32 mask = static_cast<u32>(_mm_movemask_epi8(v));
+            if (mask != 0) {
+                return i + std::countr_zero(mask);
+            }
+        }
+#endif
+        for (; i < size; ++i) {
+            if (data[i] & 0x80) {
+                return i;
+            }
+        }
+        return size;
+    }
+
+}  // namespace Toolbox::SIMD
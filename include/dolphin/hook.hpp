@@ -1,13 +1,18 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <expected>
 #include <mutex>
 #include <optional>
 #include <span>
+#include <vector>
 
 #include "core/core.hpp"
 #include "core/error.hpp"
 #include "core/memory.hpp"
+#include "core/simd.hpp"
 #include "image/imagehandle.hpp"
 #include "platform/process.hpp"
 
@@ -17,6 +22,111 @@ using namespace Toolbox;
 
 namespace Toolbox::Dolphin {
 
+    // One piece of a scatter/gather transfer against emulated memory.
+    // `m_address` is a virtual (0x80000000-based) address.
+    struct MemorySpan {
+        u32 m_address = 0;
+        size_t m_size = 0;
+        void *m_data  = nullptr;
+    };
+
+    // A contiguous piece of emulated memory captured into a snapshot arena.
+    struct SnapshotRegion {
+        u32 m_address         = 0;
+        u32 m_size            = 0;
+        size_t m_arena_offset = 0;
+    };
+
+    // One side of the double buffered snapshot. Regions are sorted by
+    // address and never overlap; their bytes are stored back to back in m_arena.
+    struct SnapshotBuffer {
+        std::vector<SnapshotRegion> m_regions;
+        std::vector<u8> m_arena;
+        u32 m_frame  = 0;
+        bool m_valid = false;
+    };
+
+    // Read handle onto the most recently published snapshot. While a handle is
+    // alive the buffer it points at is never recaptured, so every read through
+    // it observes the same game frame. Data is stored raw (big endian).
+    class MemorySnapshot {
+    public:
+        MemorySnapshot() = default;
+        MemorySnapshot(const MemorySnapshot &) = delete;
+        MemorySnapshot(MemorySnapshot &&other) noexcept;
+        ~MemorySnapshot() { release(); }
+
+        MemorySnapshot &operator=(const MemorySnapshot &) = delete;
+        MemorySnapshot &operator=(MemorySnapshot &&other) noexcept;
+
+        [[nodiscard]] bool isValid() const { return m_buffer && m_buffer->m_valid; }
+        [[nodiscard]] u32 getFrame() const { return isValid() ? m_buffer->m_frame : 0; }
+
+        // Returns the captured bytes for [address, address + size), or nullptr
+        // if no single region of the snapshot covers the range.
+        [[nodiscard]] const u8 *data(u32 address, size_t size) const;
+        [[nodiscard]] bool contains(u32 address, size_t size) const {
+            return data(address, size) != nullptr;
+        }
+
+        Result<void> readBytes(char *buf, u32 address, size_t size) const;
+        Result<void> readBatch(std::span<const MemorySpan> spans) const;
+
+        template <typename T> Result<T> read(u32 address) const {
+            static_assert(std::is_standard_layout_v<T>,
+                          "T is not a POD type or data type otherwise.");
+
+            T data;
+            auto result = readBytes(reinterpret_cast<char *>(&data), address, sizeof(T));
+            if (!result) {
+                return std::unexpected(result.error());
+            }
+
+            return *endian_swapped_t<T>(data);
+        }
+
+    private:
+        friend class DolphinHookManager;
+
+        MemorySnapshot(const SnapshotBuffer *buffer, std::atomic<u32> *readers)
+            : m_buffer(buffer), m_readers(readers) {}
+
+        void release();
+
+        const SnapshotBuffer *m_buffer = nullptr;
+        std::atomic<u32> *m_readers    = nullptr;
+    };
+
+    // Pins the mapped memory view so that unhook() cannot unmap it while the
+    // lease is alive. unhook() waits for every lease to drop, so hold one only
+    // for the duration of the work that needs the view.
+    class MemoryViewLease {
+    public:
+        MemoryViewLease() = default;
+        MemoryViewLease(const MemoryViewLease &) = delete;
+        MemoryViewLease(MemoryViewLease &&other) noexcept;
+        ~MemoryViewLease() { release(); }
+
+        MemoryViewLease &operator=(const MemoryViewLease &) = delete;
+        MemoryViewLease &operator=(MemoryViewLease &&other) noexcept;
+
+        [[nodiscard]] bool isValid() const { return m_view != nullptr; }
+        [[nodiscard]] const void *view() const { return m_view; }
+        [[nodiscard]] u32 size() const { return m_size; }
+
+    private:
+        friend class DolphinHookManager;
+
+        MemoryViewLease(std::atomic<u32> *readers, const void *view, u32 size)
+            : m_readers(readers), m_view(view), m_size(size) {}
+
+        void release();
+
+        std::atomic<u32> *m_readers = nullptr;
+        const void *m_view          = nullptr;
+        u32 m_size                  = 0;
+    };
+
     class DolphinHookManager {
     public:
         static DolphinHookManager &instance();
@@ -63,11 +173,13 @@ namespace Toolbox::Dolphin {
 
         bool isProcessRunning() const;
 
-        const Platform::ProcessInformation &getProcess() const { return m_proc_info; }
+        Platform::ProcessInformation getProcess() const;
         Result<void> startProcess(bool wants_hidden = false);
         Result<void> stopProcess();
 
-        bool isHooked() const { return m_mem_view && m_mem_size > 0 && Platform::IsExProcessRunning(m_proc_info); }
+        bool isHooked() const {
+            return m_mem_view.load() && m_mem_size.load() > 0 && isProcessAlive();
+        }
 
         Result<bool> hook();
         Result<bool> unhook();
@@ -75,8 +187,14 @@ namespace Toolbox::Dolphin {
 
         u32 getAddressAsOffset(u32 address) const { return address & 0x7FFFFFFF; }
 
-        void *getMemoryView() const { return isHooked() ? m_mem_view : nullptr; }
-        size_t getMemorySize() const { return isHooked() ? m_mem_size : 0; }
+        void *getMemoryView() const { return isHooked() ? m_mem_view.load() : nullptr; }
+        size_t getMemorySize() const { return isHooked() ? m_mem_size.load() : 0; }
+
+        // Copies every span out of emulated memory. The hook and process are
+        // validated once for the whole batch and every span is bounds checked
+        // before anything is copied, so a failed batch leaves the outputs untouched.
+        // Data is copied raw (big endian).
+        Result<void> readBatch(std::span<const MemorySpan> spans);
 
         Result<void> readBytes(char *buf, u32 address, size_t size);
         Result<void> writeBytes(const char *buf, u32 address, size_t size);
@@ -84,25 +202,153 @@ namespace Toolbox::Dolphin {
         Result<void> readCString(char *buf, size_t buf_len, u32 address);
         Result<void> writeCString(const char *buf, u32 address, size_t buf_len = 0);
 
+        // Opt-in frame snapshots. Registered regions are copied out of emulated
+        // memory at most once per game frame (keyed on the director's QF counter)
+        // into a double buffered arena that readers access without locking.
+        //
+        // Returns a handle used to remove the region again.
+        u32 addSnapshotRegion(u32 address, u32 size);
+        void removeSnapshotRegion(u32 handle);
+
+        // Captures a new snapshot if the game has advanced a frame since the last
+        // one. Returns true if a new snapshot was published. Cheap to call often;
+        // outside of a stage there is no frame counter and every call captures.
+        Result<bool> updateSnapshot();
+
+        [[nodiscard]] MemorySnapshot acquireSnapshot() const;
+
+        // Returns an invalid lease when not hooked.
+        [[nodiscard]] MemoryViewLease leaseMemoryView();
+
         ImageHandle captureXFBAsTexture(int width, int height, u32 xfb_start, int xfb_width,
                                         int xfb_height);
 
     protected:
         bool processGateCheck();
 
+        // Process liveness is cached and only re-queried from the OS once
+        // the cached state is older than s_liveness_interval.
+        bool isProcessAlive() const;
+        void markProcessAlive(bool alive) const;
+
+        Result<void> checkTransferGate(const void *view);
+        bool isRangeMapped(u32 address, size_t size) const;
+
+        std::optional<u32> readGameFrame();
+        void layoutSnapshot(SnapshotBuffer &buffer) const;
+
     private:
+        static constexpr std::chrono::milliseconds s_liveness_interval{250};
+
         fs_path m_dolphin_path;
 
+        // Guards m_proc_info and m_proc_is_spawned. The liveness check reads
+        // them from whichever thread is transferring, so copy them out under
+        // the lock rather than holding it across OS queries.
+        mutable std::mutex m_proc_mutex;
         Platform::ProcessInformation m_proc_info;
         bool m_proc_is_spawned = false;
 
         Platform::MemHandle m_mem_handle{};
-        void *m_mem_view = nullptr;
-        u32 m_mem_size   = 0;
+        std::atomic<void *> m_mem_view = nullptr;
+        std::atomic<u32> m_mem_size    = 0;
 
+        // Transfers in flight against m_mem_view. Transfers only bump this
+        // counter; unhook() waits for it to drain before unmapping the view.
+        std::atomic<u32> m_view_readers = 0;
+
+        mutable std::atomic<bool> m_proc_alive    = false;
+        mutable std::atomic<s64> m_liveness_stamp = 0;
+        mutable std::mutex m_liveness_mutex;
+
+        // Serializes the teardown in processGateCheck(); transfers never take it.
         std::mutex m_memory_mutex;
 
+        // Guards the region list and the capture side of the snapshot. Readers
+        // only touch m_snapshot_front and the per-buffer reader counts.
+        std::mutex m_snapshot_mutex;
+        std::vector<std::pair<u32, SnapshotRegion>> m_snapshot_requests;
+        std::vector<MemorySpan> m_snapshot_spans;
+        u32 m_next_snapshot_handle = 1;
+
+        // Set by anything that makes the published snapshot stale without
+        // advancing the game frame, writes included, so a paused game still
+        // gets recaptured. Atomic so that writeBytes() need not take the lock.
+        std::atomic<bool> m_snapshot_dirty = true;
+
+        std::array<SnapshotBuffer, 2> m_snapshot_buffers;
+        mutable std::array<std::atomic<u32>, 2> m_snapshot_readers = {};
+        std::atomic<u32> m_snapshot_front                          = 0;
+
         std::optional<UUID64> m_owner_window;
     };
 
+    // Collects typed reads so that many values can be fetched with a single
+    // hook validation. Values are decoded from big endian in place by submit().
+    class MemoryReadBatch {
+    public:
+        template <typename T> MemoryReadBatch &read(u32 address, T &out) {
+            return readArray(address, std::addressof(out), 1);
+        }
+
+        template <typename T> MemoryReadBatch &readArray(u32 address, T *out, size_t count) {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                          "T must be an arithmetic or enum type.");
+            m_spans.push_back({address, sizeof(T) * count, out});
+            m_widths.push_back(static_cast<u8>(sizeof(T)));
+            return *this;
+        }
+
+        size_t size() const { return m_spans.size(); }
+        bool empty() const { return m_spans.empty(); }
+
+        // Keeps the capacity so a batch can be rebuilt every frame without allocating.
+        void clear() {
+            m_spans.clear();
+            m_widths.clear();
+        }
+
+        Result<void> submit() const {
+            auto result = DolphinHookManager::instance().readBatch(m_spans);
+            if (!result) {
+                return result;
+            }
+            decode();
+            return {};
+        }
+
+        // Services the batch from a frame snapshot instead of live memory.
+        Result<void> submit(const MemorySnapshot &snapshot) const {
+            auto result = snapshot.readBatch(m_spans);
+            if (!result) {
+                return result;
+            }
+            decode();
+            return {};
+        }
+
+    private:
+        void decode() const {
+            for (size_t i = 0; i < m_spans.size(); ++i) {
+                const MemorySpan &span = m_spans[i];
+                switch (m_widths[i]) {
+                case 2:
+                    SIMD::ByteSwapArray<2>(span.m_data, span.m_size / 2);
+                    break;
+                case 4:
+                    SIMD::ByteSwapArray<4>(span.m_data, span.m_size / 4);
+                    break;
+                case 8:
+                    SIMD::ByteSwapArray<8>(span.m_data, span.m_size / 8);
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+        std::vector<MemorySpan> m_spans;
+        std::vector<u8> m_widths;
+    };
+
 }  // namespace Toolbox::Dolphin
\ No newline at end of file
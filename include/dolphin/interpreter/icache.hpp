@@ -0,0 +1,168 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "core/types.hpp"
+#include "memory.hpp"
+#include "registers.hpp"
+
+namespace Toolbox::Interpreter {
+
+    class SystemDolphin;
+
+    // Forms that SystemDolphin expands inside its block loop rather than
+    // calling through the handler; NONE for everything else.
+    enum class InlineOp : u8 {
+        NONE,
+        ADDI,
+        ADDIS,
+        ORI,
+        ORIS,
+        RLWINM,
+        CMPI,
+        CMPLI,
+        LWZ,
+        LWZU,
+        LBZ,
+        LHZ,
+        STW,
+        STWU,
+        STB,
+        STH,
+        ADD,
+        SUBF,
+        AND,
+        OR,
+        XOR,
+        CMP,
+        CMPL,
+    };
+
+    // An instruction word with its operand fields pulled out and the handler
+    // that executes it, so the opcode tables are walked and the fields are
+    // shifted out once per word rather than once per pass.
+    //
+    // Fields are named after the positions they occupy rather than their
+    // meaning, since each slot is shared by several forms (rD/rS/frD/BO/TO
+    // all live in m_d, for example). Rarely used fields (SPR, CRM, FM, ...)
+    // are still read from m_inst with the FORM_* macros.
+    struct DecodedInstruction {
+        using handler_t = void (SystemDolphin::*)(const DecodedInstruction &op,
+                                                  Register::PC &next_instruction);
+
+        handler_t m_handler = nullptr;
+        u32 m_inst          = 0;
+
+        // LI for b, BD for bc, the rotation mask for the rlw* forms, otherwise
+        // the sign extended low half (SIMM/d). The UIMM forms take the low 16
+        // bits of it.
+        s32 m_imm = 0;
+
+        u8 m_d  = 0;  // bits 21-25
+        u8 m_a  = 0;  // bits 16-20
+        u8 m_b  = 0;  // bits 11-15
+        u8 m_c  = 0;  // bits 6-10
+        u8 m_me = 0;  // bits 1-5
+
+        InlineOp m_inline_op = InlineOp::NONE;
+
+        // Set on anything that may leave the straight line (branches, sc,
+        // rfi and the rest of opcode 19, unknown words).
+        bool m_ends_block = false;
+
+        // Instructions left in the basic block starting here, this one
+        // included. Zero until the block has been built.
+        u16 m_block_length = 0;
+
+        [[nodiscard]] u16 uimm() const { return static_cast<u16>(m_imm); }
+        [[nodiscard]] bool rc() const { return m_inst & 1; }
+        [[nodiscard]] bool lk() const { return m_inst & 1; }
+        [[nodiscard]] bool aa() const { return (m_inst >> 1) & 1; }
+        [[nodiscard]] bool oe() const { return (m_inst >> 10) & 1; }
+        [[nodiscard]] bool l() const { return m_d & 1; }
+        [[nodiscard]] u8 crfD() const { return m_d >> 2; }
+        [[nodiscard]] u8 crfS() const { return m_a >> 2; }
+    };
+
+    // Decoded instructions, cached per 4 KB page of guest memory and linked
+    // into basic blocks so the evaluator only looks an address up when the
+    // straight line ends.
+    //
+    // Pages are marked as code in the storage when first decoded, and writes
+    // made through the storage mark the page stale through invalidatePage().
+    // Memory that may have changed behind the storage's back (a remap, or the
+    // live Dolphin view between calls) is handled by revalidateAll(). Either
+    // way a stale page compares its cached words against memory the next
+    // time a block is fetched from it, and only the entries that differ are
+    // decoded again. Entries are never freed while a page is stale, so a
+    // block that writes to its own page can finish the instruction it is on.
+    class InstructionCache {
+    public:
+        using handler_t = DecodedInstruction::handler_t;
+        using decoder_t = void (*)(u32 inst, DecodedInstruction &out);
+
+        InstructionCache() = default;
+
+        // Copies start cold; the storage they fetch from is not shared.
+        InstructionCache(const InstructionCache &) {}
+        InstructionCache(InstructionCache &&) noexcept = default;
+
+        InstructionCache &operator=(const InstructionCache &) {
+            invalidateAll();
+            return *this;
+        }
+        InstructionCache &operator=(InstructionCache &&) noexcept = default;
+
+        void invalidateAll() { m_pages.clear(); }
+
+        void invalidatePage(u32 page) {
+            if (page < m_pages.size()) {
+                m_pages[page].m_generation = 0;
+            }
+        }
+
+        void revalidateAll() {
+            if (++m_generation == 0) {
+                m_pages.clear();
+                m_generation = 1;
+            }
+        }
+
+        // Returns the first instruction of the basic block at physical offset
+        // `ofs`; the block is the next m_block_length entries. They stay valid
+        // until the next fetch.
+        const DecodedInstruction *fetchBlock(MemoryStorage &storage, u32 ofs, decoder_t decode) {
+            const u32 page  = ofs >> MemoryStorage::s_page_shift;
+            const u32 index = (ofs & MemoryStorage::s_page_mask) >> 2;
+
+            if (page < m_pages.size()) {
+                const Page &cached = m_pages[page];
+                if (cached.m_generation == m_generation) {
+                    const DecodedInstruction *entry = &cached.m_entries[index];
+                    if (entry->m_block_length != 0) {
+                        return entry;
+                    }
+                }
+            }
+            return fetchBlockSlow(storage, page, index, decode);
+        }
+
+    protected:
+        struct Page {
+            std::unique_ptr<DecodedInstruction[]> m_entries;
+            u32 m_generation = 0;
+        };
+
+        static constexpr u32 s_page_entries = MemoryStorage::s_page_size / 4;
+
+        const DecodedInstruction *fetchBlockSlow(MemoryStorage &storage, u32 page, u32 index,
+                                                 decoder_t decode);
+        static void revalidatePage(MemoryStorage &storage, Page &cached, u32 page);
+
+    private:
+        std::vector<Page> m_pages;
+        u32 m_generation = 1;
+    };
+
+}  // namespace Toolbox::Interpreter
@@ -1,29 +1,167 @@
 #pragma once
 
-#include "core/memory.hpp"
-#include "instructions/forms.hpp"
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "core/types.hpp"
 
 using namespace Toolbox;
 
 namespace Toolbox::Interpreter {
 
+    // Guest memory as seen by the interpreter.
+    //
+    // The storage is layered over a base image that is never copied up front.
+    // In copy-on-write mode the base is only read; the first write to a 4 KB
+    // page copies that page into a private overlay, and all later accesses to
+    // it go through the overlay. In copy-on-read mode a page is also copied on
+    // its first read, so a base that keeps changing (the live Dolphin view)
+    // appears frozen from the moment each page is first touched.
+    //
+    // Reads may populate the overlay, so a storage is not safe to share
+    // between threads even for reading.
+    //
+    // Offsets are physical (address & 0x7FFFFFFF). Bounds are the caller's
+    // responsibility, as with Buffer.
     class MemoryStorage {
     public:
+        using code_write_cb = std::function<void(u32 page)>;
+
+        static constexpr u32 s_page_shift = 12;
+        static constexpr u32 s_page_size  = 1u << s_page_shift;
+        static constexpr u32 s_page_mask  = s_page_size - 1;
+
         MemoryStorage() = default;
+        MemoryStorage(const MemoryStorage &other) { copyFrom(other); }
+        MemoryStorage(MemoryStorage &&other) noexcept = default;
+
+        MemoryStorage &operator=(const MemoryStorage &other) {
+            if (this != &other) {
+                copyFrom(other);
+            }
+            return *this;
+        }
+        MemoryStorage &operator=(MemoryStorage &&other) noexcept = default;
+
+        // Zero filled memory. No pages exist until they are written.
+        bool initialize(u32 storage_size = 0x1800000);
+
+        // Reads come from `base` and writes stay private; `base` is never modified
+        // and must outlive the storage (or the next remap).
+        void mapCopyOnWrite(const void *base, u32 size);
+
+        // Like mapCopyOnWrite(), but pages are also copied on their first read.
+        // `base` is kept alive by the storage (and its copies) until the next remap.
+        void mapCopyOnRead(std::shared_ptr<const void> base, u32 size);
+
+        // Reads and writes go straight to `base`.
+        void mapWriteThrough(void *base, u32 size);
+
+        // Takes a private copy of `buf` as the new base image.
+        void assign(const void *buf, u32 size);
+
+        // Drops every private page, reverting to the base image.
+        void discardWrites();
+
+        [[nodiscard]] u32 size() const noexcept { return m_size; }
+        [[nodiscard]] bool isCopyOnWrite() const noexcept { return m_write_base == nullptr; }
+        [[nodiscard]] const void *base() const noexcept { return m_base; }
+        [[nodiscard]] size_t privatePageCount() const noexcept { return m_private_pages; }
 
-        bool initialize(size_t storage_size = 0x1800000) { return m_buffer.alloc(storage_size); }
-        Buffer &buffer() { return m_buffer; }
+        explicit operator bool() const noexcept { return m_size > 0; }
 
-        void process(const PPC::XForm &instr);
-        void process(const PPC::XLForm &instr);
-        void process(const PPC::XForm &instr);
-        void process(const PPC::XForm &instr);
+        // Pages marked as code report every write to the callback so
+        // that instructions decoded from them can be dropped.
+        void onCodeWrite(code_write_cb cb) { m_code_write_cb = std::move(cb); }
+        void markCodePage(u32 page) {
+            if (m_code_pages.empty()) {
+                m_code_pages.resize((static_cast<size_t>(m_size) + s_page_mask) >> s_page_shift);
+            }
+            m_code_pages[page] = true;
+        }
 
+        template <typename T> T get(u32 ofs) const {
+            T value;
+            readBytes(ofs, std::addressof(value), sizeof(T));
+            return value;
+        }
+
+        template <typename T> void set(u32 ofs, const T &value) {
+            writeBytes(ofs, std::addressof(value), sizeof(T));
+        }
+
+        void readBytes(u32 ofs, void *dst, size_t size) const {
+            if ((ofs & s_page_mask) + size <= s_page_size) {
+                std::memcpy(dst, pageForRead(ofs >> s_page_shift) + (ofs & s_page_mask), size);
+                return;
+            }
+            readBytesSlow(ofs, dst, size);
+        }
+
+        void writeBytes(u32 ofs, const void *src, size_t size) {
+            if (!m_code_pages.empty()) {
+                notifyCodeWrite(ofs, size);
+            }
+            if (m_write_base) {
+                std::memcpy(m_write_base + ofs, src, size);
+                return;
+            }
+            if ((ofs & s_page_mask) + size <= s_page_size) {
+                std::memcpy(pageForWrite(ofs >> s_page_shift) + (ofs & s_page_mask), src, size);
+                return;
+            }
+            writeBytesSlow(ofs, src, size);
+        }
+
+        void fill(u32 ofs, u8 value, size_t size);
+
+    protected:
+        const u8 *pageForRead(u32 page) const {
+            if (page < m_pages.size() && m_pages[page]) {
+                return m_pages[page].get();
+            }
+            if (m_copy_on_read) {
+                return capturePage(page);
+            }
+            if (m_base) {
+                return m_base + (static_cast<size_t>(page) << s_page_shift);
+            }
+            return s_zero_page;
+        }
+
+        u8 *pageForWrite(u32 page) { return capturePage(page); }
+        u8 *capturePage(u32 page) const;
+
+        void readBytesSlow(u32 ofs, void *dst, size_t size) const;
+        void writeBytesSlow(u32 ofs, const void *src, size_t size);
+
+        void notifyCodeWrite(u32 ofs, size_t size);
+
+        void copyFrom(const MemoryStorage &other);
+        void reset(const u8 *base, u8 *write_base, u32 size);
 
     private:
+        static const u8 s_zero_page[s_page_size];
+
+        const u8 *m_base    = nullptr;
+        u8 *m_write_base    = nullptr;
+        u32 m_size          = 0;
+        bool m_copy_on_read = false;
+
+        // Keeps the base alive, either an image taken by assign() or a lease on
+        // the mapped view; shared between copies since the base is read-only.
+        std::shared_ptr<const void> m_owned_base;
 
+        // One slot per page of m_size, allocated on the first private write
+        // (or first read, in copy-on-read mode).
+        mutable std::vector<std::unique_ptr<u8[]>> m_pages;
+        mutable size_t m_private_pages = 0;
 
-        Buffer m_buffer;
+        // Owned by whoever registered the callback, so neither is copied.
+        std::vector<u8> m_code_pages;
+        code_write_cb m_code_write_cb;
     };
 
-}  // namespace Toolbox::Interpreter
\ No newline at end of file
+}  // namespace Toolbox::Interpreter
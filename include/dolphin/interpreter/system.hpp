@@ -1,9 +1,9 @@
 #pragma once
 
 #include "core/threaded.hpp"
-#include "dolphin/process.hpp"
-#include "gui/appmain/settings/settings.hpp"
+#include "icache.hpp"
 #include "instructions/forms.hpp"
+#include "memory.hpp"
 #include "processor.hpp"
 #include "registers.hpp"
 
@@ -17,10 +17,9 @@ namespace Toolbox::Interpreter {
 
     class SystemDolphin {
     public:
-        SystemDolphin();
+        friend class ReferenceDispatcher;  // tests/interpreter_reference.hpp
 
-        // Use this when you want to evaluate directly upon Dolphin's memory
-        explicit SystemDolphin(const Dolphin::DolphinCommunicator &);
+        SystemDolphin();
 
         SystemDolphin(const SystemDolphin &);
         SystemDolphin(SystemDolphin &&) noexcept;
@@ -33,12 +32,16 @@ namespace Toolbox::Interpreter {
         Register::RegisterSnapshot evaluateFunction(u32 function_ptr, u8 gpr_argc, u32 *gpr_argv,
                                                     u8 fpr_argc, f64 *fpr_argv);
 
-        Buffer &getMemoryBuffer() { return m_storage; }
+        MemoryStorage &getMemoryStorage() { return m_storage; }
+
+        // Evaluates directly upon `buf`; writes land in it.
         void setMemoryBuffer(void *buf, size_t size) {
-            if (m_storage.buf<void>() == buf)
+            if (m_storage.base() == buf && !m_storage.isCopyOnWrite())
                 return;
-            m_storage.setBuf(buf, static_cast<uint32_t>(size));
-            m_evaluating = false;
+            m_storage.mapWriteThrough(buf, static_cast<u32>(size));
+            m_icache.revalidateAll();
+            m_evaluating  = false;
+            m_leave_block = true;
         }
 
         bool isStackPointerValid() const {
@@ -53,11 +56,27 @@ namespace Toolbox::Interpreter {
         void onException(func_exception_cb cb) { m_system_exception_cb = cb; }
         void onInvalid(func_invalid_cb cb) { m_system_invalid_cb = cb; }
 
+        // Takes a private copy of `buf` to evaluate upon.
         void applyMemory(const void *buf, size_t size) {
-            if (!m_storage) {
-                m_storage.alloc(static_cast<uint32_t>(size));
-            }
-            std::memcpy(m_storage.buf<void>(), buf, size);
+            m_storage.assign(buf, static_cast<u32>(size));
+            m_icache.revalidateAll();
+        }
+
+        // Evaluates upon `buf` without copying it up front. Each page is copied
+        // the first time it is touched, so `buf` may keep changing underneath,
+        // and writes made by the evaluated code never reach it. `buf` is held
+        // until the next remap.
+        void mapMemory(std::shared_ptr<const void> buf, size_t size) {
+            m_storage.mapCopyOnRead(std::move(buf), static_cast<u32>(size));
+            m_icache.revalidateAll();
+        }
+
+        // Drops the mapped memory (and whatever holds it alive) while keeping
+        // the decoded instructions, which are checked against the next mapping
+        // before they run again.
+        void unmapMemory() {
+            m_storage.mapCopyOnWrite(nullptr, 0);
+            m_icache.revalidateAll();
         }
 
         template <typename T> T read(u32 address) const {
@@ -79,23 +98,35 @@ namespace Toolbox::Interpreter {
         }
 
         void readBytes(char *buf, u32 address, size_t size) const {
-            const char *true_address = m_storage.buf<const char>() + (address & 0x7FFFFFFF);
-            memcpy(buf, true_address, size);
+            m_storage.readBytes(address & 0x7FFFFFFF, buf, size);
         }
 
         void writeBytes(const char *buf, u32 address, size_t size) {
-            char *true_address = m_storage.buf<char>() + (address & 0x7FFFFFFF);
-            memcpy(true_address, buf, size);
+            m_storage.writeBytes(address & 0x7FFFFFFF, buf, size);
         }
 
     protected:
         void evalLoop();
-        void evaluateInstruction();
-        Register::PC evaluatePairedSingleSubOp(u32 instr);
-        Register::PC evaluateControlFlowSubOp(u32 instr);
-        Register::PC evaluateFixedSubOp(u32 instr);
-        Register::PC evaluateFloatSingleSubOp(u32 instr);
-        Register::PC evaluateFloatSubOp(u32 instr);
+        void evaluateBlock(const DecodedInstruction *block);
+
+        using handler_t = DecodedInstruction::handler_t;
+
+        // One handler per opcode, specialized in system.cpp. `next_instruction`
+        // arrives as pc + 4; branches overwrite it.
+        template <auto _Op>
+        void execute(const DecodedInstruction &op, Register::PC &next_instruction);
+        void executeNop(const DecodedInstruction &, Register::PC &) {}
+        void executeUnknown(const DecodedInstruction &, Register::PC &);
+
+        static const std::pair<handler_t, InlineOp> s_inline_handlers[];
+
+        static void decodeInstruction(u32 inst, DecodedInstruction &out);
+        static handler_t decodeHandler(u32 inst);
+        static handler_t decodePairedSingleSubOp(u32 inst);
+        static handler_t decodeControlFlowSubOp(u32 inst);
+        static handler_t decodeFixedSubOp(u32 inst);
+        static handler_t decodeFloatSingleSubOp(u32 inst);
+        static handler_t decodeFloatSubOp(u32 inst);
 
         void internalReturnCB() {
             // If the LR matches the sentinel we know we've returned from
@@ -109,12 +140,14 @@ namespace Toolbox::Interpreter {
         void internalExceptionCB(ExceptionCause cause) {
             Register::RegisterSnapshot snapshot = createSnapshot();
             m_evaluating                        = false;
+            m_leave_block                       = true;
             m_system_exception_cb((u32)m_system_proc.m_pc, cause, snapshot);
         }
 
         void internalInvalidCB(const std::string &reason) {
             Register::RegisterSnapshot snapshot = createSnapshot();
             m_evaluating                        = false;
+            m_leave_block                       = true;
             m_system_invalid_cb((u32)m_system_proc.m_pc, reason, snapshot);
         }
 
@@ -151,10 +184,15 @@ namespace Toolbox::Interpreter {
             m_fixed_proc.onInvalid(TOOLBOX_BIND_EVENT_FN(internalInvalidCB));
             m_float_proc.onInvalid(TOOLBOX_BIND_EVENT_FN(internalInvalidCB));
             m_system_proc.onInvalid(TOOLBOX_BIND_EVENT_FN(internalInvalidCB));
+            m_storage.onCodeWrite([this](u32 page) {
+                m_icache.invalidatePage(page);
+                m_leave_block = true;
+            });
         }
 
     private:
-        Buffer m_storage;
+        MemoryStorage m_storage;
+        InstructionCache m_icache;
 
         BranchProcessor m_branch_proc;
         FixedPointProcessor m_fixed_proc;
@@ -164,6 +202,10 @@ namespace Toolbox::Interpreter {
         std::mutex m_eval_mutex;
         bool m_evaluating;
 
+        // Set by anything that must stop the current block early: a raised
+        // exception or a write to a page holding decoded code.
+        bool m_leave_block = false;
+
         func_ret_cb m_system_return_cb          = [](const Register::RegisterSnapshot &) {};
         func_exception_cb m_system_exception_cb = [](u32, ExceptionCause,
                                                      const Register::RegisterSnapshot &) {};
@@ -7,6 +7,7 @@
 
 #include "core/core.hpp"
 #include "core/error.hpp"
+#include "core/simd.hpp"
 #include "core/threaded.hpp"
 #include "core/types.hpp"
 
@@ -56,6 +57,26 @@ namespace Toolbox::Dolphin {
             return {};
         }
 
+        // Reads `count` consecutive values of T starting at `address` with a single
+        // hook validation, decoding them from big endian in bulk.
+        template <typename T> Result<void> readArray(u32 address, T *out, size_t count) {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                          "T must be an arithmetic or enum type.");
+
+            const MemorySpan span = {address, sizeof(T) * count, out};
+            auto result           = DolphinHookManager::instance().readBatch({&span, 1});
+            if (!result) {
+                return std::unexpected(result.error());
+            }
+
+            SIMD::ByteSwapArray(out, count);
+            return {};
+        }
+
+        Result<void> readBatch(std::span<const MemorySpan> spans) {
+            return DolphinHookManager::instance().readBatch(spans);
+        }
+
         Result<void> readBytes(char *buf, u32 address, size_t size) {
             return DolphinHookManager::instance().readBytes(buf, address, size);
         }
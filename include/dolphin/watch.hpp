@@ -55,6 +55,16 @@ namespace Toolbox {
         // notify the listener of changes
         void processWatch();
 
+        // Compares `current_value` (raw, m_watch_size bytes) against the last
+        // value and notifies on change, as processWatch() does after resolving
+        // the address. Used by WatchPlan, which reads many watches at once.
+        // Returns true if the listener was notified.
+        bool processValue(u32 address, const void *current_value);
+
+        // Changes whenever the watch is started or stopped, so a compiled
+        // WatchPlan can tell that its view of the watch is stale.
+        [[nodiscard]] u64 getLayoutEpoch() const { return m_layout_epoch; }
+
         static u32 TracePointerChainToAddress(const std::vector<u32> &pointer_chain);
         static std::vector<u32> ResolvePointerChainAsAddress(const std::vector<u32> &pointer_chain);
 
@@ -77,6 +87,11 @@ namespace Toolbox {
         u32 m_buf_size               = 0;
         bool m_last_value_needs_init = true;
         bool m_is_locked             = false;
+
+        u32 m_snapshot_region  = 0;
+        u32 m_snapshot_address = 0;
+
+        u64 m_layout_epoch = 0;
     };
 
     class MetaWatch : public IUnique {
@@ -126,6 +141,8 @@ namespace Toolbox {
         // notify the listener of changes
         void processWatch() { m_memory_watch.processWatch(); }
 
+        [[nodiscard]] MemoryWatch &getMemoryWatch() { return m_memory_watch; }
+
     private:
         UUID64 m_uuid;
         MemoryWatch m_memory_watch;
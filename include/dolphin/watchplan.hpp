@@ -0,0 +1,114 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "core/types.hpp"
+#include "dolphin/hook.hpp"
+
+namespace Toolbox {
+
+    class MemoryWatch;
+
+    // Evaluates a set of MemoryWatches together, once per refresh tick.
+    //
+    // Compiling the plan merges every pointer chain into a tree, so a prefix
+    // shared by many watches (an actor table, a manager's object list) is
+    // dereferenced once per tick no matter how many watches hang off of it.
+    // Execution resolves the tree one depth at a time with a single batched
+    // read per depth, then sorts the watched ranges and coalesces neighbours
+    // into ranged copies before handing each watch its slice. Pointers and
+    // values are read from the same frame snapshot whenever it covers them.
+    //
+    // The plan holds raw pointers to the watches; it must be recompiled
+    // whenever a watch is added, removed or restarted (see matches()).
+    class WatchPlan {
+    public:
+        WatchPlan() = default;
+        ~WatchPlan() { clear(); }
+
+        WatchPlan(const WatchPlan &)            = delete;
+        WatchPlan &operator=(const WatchPlan &) = delete;
+
+        void compile(std::span<MemoryWatch *const> watches);
+        void clear();
+
+        // True if the plan was compiled from exactly these watches, in this
+        // order, and none of them has been restarted since.
+        [[nodiscard]] bool matches(std::span<MemoryWatch *const> watches) const;
+
+        // Runs one tick. Returns the number of watches that changed.
+        size_t execute(Dolphin::DolphinHookManager &manager);
+
+        [[nodiscard]] size_t size() const { return m_slots.size(); }
+
+        // Bitset over the compiled watch order, rebuilt by every execute().
+        [[nodiscard]] std::span<const u64> changed() const { return m_changed; }
+        [[nodiscard]] bool isChanged(size_t slot) const {
+            return (m_changed[slot / 64] >> (slot % 64)) & 1;
+        }
+
+    protected:
+        // _Source is the hook manager (live memory) or a MemorySnapshot.
+        // Both return false if the source could not serve every read.
+        template <typename _Source>
+        bool resolveNodes(const Dolphin::DolphinHookManager &manager, _Source &source);
+        void buildRanges();
+        template <typename _Source> bool copyRanges(_Source &source);
+        void syncSnapshotRegions(Dolphin::DolphinHookManager &manager);
+
+    private:
+        static constexpr u32 s_invalid_node = 0xFFFFFFFF;
+
+        // Ranges closer than this are copied as one
+        static constexpr u32 s_coalesce_gap = 64;
+
+        // One step of a pointer chain. A root holds the chain's base address;
+        // any other node dereferences its parent and adds its offset.
+        struct Node {
+            u32 m_parent;
+            u32 m_value;
+        };
+
+        struct Slot {
+            MemoryWatch *m_watch;
+            u64 m_epoch;
+            u32 m_node;
+            u32 m_size;
+        };
+
+        struct Range {
+            u32 m_address;
+            u32 m_size;
+            u32 m_offset;  // Into m_staging
+        };
+
+        std::vector<Node> m_nodes;
+
+        // Level d dereferences the nodes at depth d that have children and
+        // resolves their children at depth d + 1. Both index into m_nodes.
+        struct Level {
+            std::vector<u32> m_parents;
+            std::vector<u32> m_children;
+        };
+
+        std::vector<Level> m_levels;
+
+        std::vector<Slot> m_slots;
+
+        // Per tick state, kept to avoid reallocating every refresh
+        std::vector<u32> m_addresses;
+        std::vector<u32> m_loaded;
+        std::vector<Dolphin::MemorySpan> m_spans;
+        std::vector<u32> m_order;
+        std::vector<Range> m_ranges;
+        std::vector<u32> m_slot_range;
+        std::vector<u8> m_staging;
+        std::vector<u64> m_changed;
+
+        std::vector<std::pair<u32, u32>> m_wanted;
+        std::vector<std::pair<u32, u32>> m_snapshot_ranges;
+        std::vector<u32> m_snapshot_handles;
+    };
+
+}  // namespace Toolbox
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "core/threaded.hpp"
+#include "core/types.hpp"
+#include "image/imagehandle.hpp"
+
+namespace Toolbox::Dolphin {
+
+    class DolphinHookManager;
+
+    // Converts `pixel_count` pixels of YUV 4:2:2 (Y0 U Y1 V per pixel pair,
+    // studio range) into full range RGBA8888. `pixel_count` is expected to be
+    // even; a trailing odd pixel is left untouched.
+    void ConvertYUV422ToRGBA8888(const u8 *yuv, u8 *rgba, size_t pixel_count);
+
+    // Streams the game's external framebuffer on a background thread.
+    //
+    // The thread polls the XFB a few times per video field, and only converts
+    // it when the bytes differ from the last frame, so it runs at the game's
+    // frame rate rather than the poll rate. Converted frames land in one of
+    // two pixel stores that are reused for the lifetime of the capture.
+    class XFBCapture : public Threaded<void> {
+    public:
+        struct Source {
+            u32 m_address;
+            int m_width;
+            int m_height;
+        };
+
+        // Finds the XFB in emulated memory, or returns nothing if there is
+        // no game to capture.
+        using locate_cb = std::function<std::optional<Source>(DolphinHookManager &)>;
+
+        XFBCapture() = default;
+        ~XFBCapture() override { tKill(true); }
+
+        void setLocator(locate_cb locator);
+
+        // Uploads the latest frame into `image` if it is newer than the one
+        // last uploaded. The existing texture is reused when the size allows.
+        // `image` is reset while there is nothing to capture. Call this from
+        // the thread that owns the GL context.
+        bool updateTexture(ImageHandle &image);
+
+        // True if a reader asked for a frame recently. The capture thread
+        // idles otherwise, so a hidden preview costs nothing.
+        [[nodiscard]] bool isWanted() const;
+
+    protected:
+        void tRun(void *param) override;
+
+        bool captureFrame(DolphinHookManager &manager);
+        void publishFrame(int width, int height);
+
+    private:
+        static constexpr std::chrono::milliseconds s_poll_interval{8};
+        static constexpr std::chrono::milliseconds s_idle_timeout{500};
+
+        struct Frame {
+            std::vector<u8> m_pixels;
+            int m_width  = 0;
+            int m_height = 0;
+        };
+
+        std::mutex m_locator_mutex;
+        locate_cb m_locator;
+
+        std::atomic<std::chrono::steady_clock::rep> m_last_request = 0;
+
+        // Capture thread only. The previous raw frame is kept to detect
+        // an unchanged XFB without converting it.
+        std::array<std::vector<u8>, 2> m_yuv;
+        u32 m_yuv_current = 0;
+
+        // m_frames[m_front] is owned by the reader; the capture thread writes
+        // the other and swaps under m_frame_mutex.
+        std::mutex m_frame_mutex;
+        std::array<Frame, 2> m_frames;
+        u32 m_front        = 0;
+        u64 m_sequence     = 0;
+        u64 m_uploaded_seq = 0;
+    };
+
+}  // namespace Toolbox::Dolphin
@@ -1,16 +1,25 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <expected>
 #include <functional>
+#include <future>
 #include <mutex>
-#include <queue>
+#include <optional>
+#include <span>
 #include <thread>
+#include <vector>
 
 #include "core/error.hpp"
 #include "core/memory.hpp"
+#include "core/time/timepoint.hpp"
+#include "core/time/timestep.hpp"
 #include "core/types.hpp"
 #include "dolphin/interpreter/system.hpp"
 #include "dolphin/process.hpp"
+#include "dolphin/xfb.hpp"
 #include "gui/appmain/scene/camera.hpp"
 #include "objlib/object.hpp"
 
@@ -19,6 +28,10 @@ using namespace Toolbox::Object;
 
 using namespace Toolbox;
 
+namespace BetterSMS {
+    enum class ETask : u32;
+}
+
 namespace Toolbox::Game {
 
     class TaskCommunicator : public Threaded<void> {
@@ -27,6 +40,24 @@ namespace Toolbox::Game {
 
         using transact_complete_cb = std::function<void(u32)>;
 
+        // Completes once the game has answered a BetterSMS request, with the
+        // word it wrote back (an actor pointer for lookups and creation).
+        using request_future_t = std::future<Result<u32>>;
+
+        // Round trip latencies, in milliseconds
+        struct RequestStats {
+            u64 m_count    = 0;
+            u64 m_failures = 0;
+            f64 m_last_ms  = 0.0;
+            f64 m_min_ms   = 0.0;
+            f64 m_max_ms   = 0.0;
+            f64 m_total_ms = 0.0;
+
+            [[nodiscard]] f64 averageMs() const {
+                return m_count == 0 ? 0.0 : m_total_ms / static_cast<f64>(m_count);
+            }
+        };
+
         // API
 
         bool isSceneLoaded();
@@ -39,17 +70,18 @@ namespace Toolbox::Game {
         Result<void> taskLoadScene(u8 stage, u8 scenario,
                                    transact_complete_cb clone_complete_cb = nullptr);
 
-        Result<void> taskAddSceneObject(RefPtr<ISceneObject> object,
-                                        RefPtr<GroupSceneObject> parent,
-                                        transact_complete_cb clone_complete_cb = nullptr);
+        request_future_t taskAddSceneObject(RefPtr<ISceneObject> object,
+                                            RefPtr<GroupSceneObject> parent,
+                                            transact_complete_cb clone_complete_cb = nullptr);
 
-        Result<void> taskRemoveSceneObject(RefPtr<ISceneObject> object,
-                                           RefPtr<GroupSceneObject> parent,
-                                           transact_complete_cb clone_complete_cb = nullptr);
+        request_future_t taskRemoveSceneObject(RefPtr<ISceneObject> object,
+                                               RefPtr<GroupSceneObject> parent,
+                                               transact_complete_cb clone_complete_cb = nullptr);
 
-        Result<void> taskRenameSceneObject(RefPtr<ISceneObject> object, const std::string &old_name,
-                                           const std::string &new_name,
-                                           transact_complete_cb clone_complete_cb = nullptr);
+        request_future_t taskRenameSceneObject(RefPtr<ISceneObject> object,
+                                               const std::string &old_name,
+                                               const std::string &new_name,
+                                               transact_complete_cb clone_complete_cb = nullptr);
 
         Result<void> taskPlayCameraDemo(std::string_view demo_name,
                                         transact_complete_cb clone_complete_cb = nullptr);
@@ -76,22 +108,84 @@ namespace Toolbox::Game {
 
         ImageHandle captureXFBAsTexture(int width, int height);
 
+        // Streams the XFB into `image` from a background capture, which is
+        // started on first use. Returns true if `image` changed.
+        bool updateXFBTexture(ImageHandle &image);
+
         ScopePtr<Interpreter::SystemDolphin> createInterpreter();
         ScopePtr<Interpreter::SystemDolphin> createInterpreterUnchecked();
 
+        // BetterSMS exchanges, from posting the request to the game's response
+        [[nodiscard]] RequestStats getRequestStats() const;
+
+        // Queued tasks, from submission to completion
+        [[nodiscard]] RequestStats getTaskStats() const;
+
+        void resetRequestStats();
+
     protected:
+        using task_t = std::function<bool(Dolphin::DolphinCommunicator &)>;
+
+        struct PendingTask {
+            task_t m_task;
+            TimePoint m_submitted;
+        };
+
         template <typename _Callable, typename... _Args>
         Result<void, SerialError> submitTask(_Callable task, _Args... args) {
-            m_task_queue.push(std::bind(
-                [task](Dolphin::DolphinCommunicator &communicator, _Args... _args) {
-                    return task(communicator, std::forward<_Args>(_args)...);
-                },
-                std::placeholders::_1, std::forward<_Args>(args)...));
+            {
+                std::scoped_lock lock(m_task_mutex);
+                m_task_queue.push_back(
+                    {std::bind(
+                         [task](Dolphin::DolphinCommunicator &communicator, _Args... _args) {
+                             return task(communicator, std::forward<_Args>(_args)...);
+                         },
+                         std::placeholders::_1, std::forward<_Args>(args)...),
+                     std::chrono::high_resolution_clock::now()});
+            }
+            m_task_cv.notify_one();
             return {};
         }
 
+        struct PendingRequest {
+            BetterSMS::ETask m_task;
+            std::vector<u8> m_payload;
+            transact_complete_cb m_on_complete;
+            std::promise<Result<u32>> m_promise;
+        };
+
+        // Queues a BetterSMS request for the task thread, which packs every
+        // request pending at once into a single exchange with the game.
+        request_future_t submitRequest(BetterSMS::ETask task, std::vector<u8> &&payload,
+                                       transact_complete_cb on_complete = nullptr);
+
         void tRun(void *param) override;
 
+        // Runs every ready task in the queue back to back. Stops at the first
+        // task that asks to be retried, so that tasks still complete in order.
+        // Returns true if a task is waiting to be retried.
+        bool drainTasks(Dolphin::DolphinCommunicator &communicator);
+
+        // Sends every queued request, packing as many as the request and
+        // response buffers allow into each exchange.
+        void drainRequests(Dolphin::DolphinCommunicator &communicator);
+
+        void exchangeRequest(PendingRequest &request);
+        void exchangePackedRequests(std::span<PendingRequest> requests);
+        void completeRequest(PendingRequest &request, Result<u32> result);
+
+        // Posts `task` to BetterSMS, whose request buffer must already be
+        // filled, and waits for the game to respond.
+        bool transactBetterSMS(BetterSMS::ETask task, TimeStep timeout);
+
+        // Blocks the task thread until the posted task is answered. Dolphin
+        // gives no signal for writes to emulated memory, so this is checked
+        // once per interval on the task condition variable, which shutdown
+        // also wakes.
+        bool awaitBetterSMSResponse(TimeStep timeout);
+
+        void recordLatency(RequestStats &stats, TimeStep latency, bool succeeded);
+
         constexpr f32 convertAngleS16ToFloat(s16 angle) {
             return static_cast<f32>(angle) / 182.04445f;
         }
@@ -127,19 +221,40 @@ namespace Toolbox::Game {
 
         bool checkForAcquiredStackFrameAndBuffer();
 
+        static std::optional<XFBCapture::Source> LocateXFB(DolphinHookManager &manager);
+
+        static void ConfigureInterpreter(Interpreter::SystemDolphin &interpreter);
+        bool mapLiveMemory(Interpreter::SystemDolphin &interpreter);
+
+        // Runs the game's name ref search for `name` (game encoded) on the
+        // lookup interpreter and returns the object it found, or 0.
+        u32 evaluateNameRefSearch(const std::string &name);
+
     private:
         Interpreter::SystemDolphin m_game_interpreter;
 
-        std::queue<std::function<bool(Dolphin::DolphinCommunicator &)>> m_task_queue;
+        mutable std::mutex m_task_mutex;
+        std::condition_variable m_task_cv;
+        std::deque<PendingTask> m_task_queue;
+        std::deque<PendingRequest> m_request_queue;
+        std::atomic<std::thread::id> m_task_thread_id;
+
+        mutable std::mutex m_stats_mutex;
+        RequestStats m_request_stats;
+        RequestStats m_task_stats;
+
+        XFBCapture m_xfb_capture;
         std::unordered_map<UUID64, u32> m_actor_address_map;
         u8 mCurrentAreaID;
         u8 mCurrentEpisodeID;
 
         bool m_started = false;
 
-        std::mutex m_mutex;
         std::thread m_thread;
 
+        // Serves getActorPtr(); kept so its decode cache survives between
+        // lookups. Guarded by m_interpreter_mutex.
+        ScopePtr<Interpreter::SystemDolphin> m_lookup_interpreter;
         std::mutex m_interpreter_mutex;
 
         std::atomic<bool> m_hook_flag;
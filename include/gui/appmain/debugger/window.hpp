@@ -1,10 +1,12 @@
 #pragma once
 
 #include <filesystem>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "core/memory.hpp"
@@ -138,10 +140,20 @@ namespace Toolbox::UI {
 
         std::string buildQualifiedId(ModelIndex index) const;
 
+        // Watch values as last fetched from the model. They are refetched and
+        // reformatted only when the model reports that the watch changed.
+        struct WatchPreviewCache {
+            u64 m_change_tick = std::numeric_limits<u64>::max();
+            MetaValue m_value;
+            WatchValueBase m_preview_base = WatchValueBase::BASE_DECIMAL;
+            bool m_preview_valid          = false;
+            std::string m_preview;
+        };
+
         // ----
-        void renderPreview(f32 column_width, const MetaValue &value, WatchValueBase value_base);
+        void renderPreview(f32 column_width, WatchPreviewCache &cache, WatchValueBase value_base);
         void renderPreviewSingle(f32 column_width, const MetaValue &value,
-                                 WatchValueBase value_base);
+                                 const std::string &preview);
         void renderPreviewRGBA(f32 column_width, const MetaValue &value);
         void renderPreviewRGB(f32 column_width, const MetaValue &value);
         void renderPreviewVec3(f32 column_width, const MetaValue &value);
@@ -208,6 +220,7 @@ namespace Toolbox::UI {
         RefPtr<WatchDataModel> m_watch_model;
         RefPtr<WatchDataModelSortFilterProxy> m_watch_proxy_model;
         ModelSelectionManager m_watch_selection_mgr;
+        std::unordered_map<UUID64, WatchPreviewCache> m_watch_preview_cache;
 
         RefPtr<MemScanModel> m_scan_model;
         ModelSelectionManager m_scan_selection_mgr;
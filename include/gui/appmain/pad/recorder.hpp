@@ -146,6 +146,8 @@ namespace Toolbox {
         Result<PadFrameData> readPadFrameDataEMario();
         Result<PadFrameData> readPadFrameDataPiantissimo();
 
+        static PadFrameData DecodePadFrameInputs(const PadFrameInputs &inputs);
+
     private:
         RefPtr<ReplayLinkData> m_link_data;
         std::vector<PadDataLinkInfo> m_pad_datas = {};
@@ -159,6 +161,9 @@ namespace Toolbox {
         u32 m_shadow_mario_ptr         = 0;
         u32 m_piantissimo_ptr          = 0;
 
+        u32 m_pad_snapshot_region = 0;
+        u32 m_pad_snapshot_ptr    = 0;
+
         TimePoint m_last_frame_time;
         bool m_is_replaying_pad = false;
         playback_frame_cb m_playback_frame_cb = nullptr;
@@ -168,6 +173,7 @@ namespace Toolbox {
         u32 m_start_frame                 = 0;
         u32 m_last_frame                  = 0;
         float m_playback_frame            = 0.0f;
+        PadData::Cursor m_playback_cursor = {};
 
         char m_current_link = '*';
         char m_next_link    = '*';
@@ -112,12 +112,12 @@ namespace Toolbox::UI {
         RefPtr<ISceneObject>
         findObjectByJ3DPicking(std::vector<ISceneObject::RenderInfo> renderables, int selection_x,
                                int selection_y, float &intersection_z,
-                               const std::unordered_set<std::string> &exclude_set);
+                               const std::unordered_set<SymbolID> &exclude_set);
 
         RefPtr<ISceneObject>
         findObjectByOBBIntersection(std::vector<ISceneObject::RenderInfo> renderables,
                                     int selection_x, int selection_y, float &intersection_z,
-                                    const std::unordered_set<std::string> &exclude_set);
+                                    const std::unordered_set<SymbolID> &exclude_set);
 
     private:
         u32 m_fbo_id, m_tex_id, m_rbo_id;
@@ -192,6 +192,9 @@ namespace Toolbox::UI {
     protected:
         void initializeModels();
 
+        // Applies the undo memory setting to the history, if it changed.
+        void updateUndoMemoryBudget();
+
         ImGuiID onBuildDockspace() override;
         void onRenderMenuBar() override;
         void onRenderBody(TimeStep delta_time) override;
@@ -332,6 +335,7 @@ namespace Toolbox::UI {
         RefPtr<ModelHistoryAggregate> m_history_aggregate_handler;
         int64_t m_saved_history_frame = -1;
         ImGuiID m_last_focused_id     = 0;
+        s64 m_undo_memory_budget      = -1;  // In MiB, as last applied
 
         ContextMenu<ModelIndex> m_scene_hierarchy_context_menu;
         ContextMenu<ModelIndex> m_table_hierarchy_context_menu;
@@ -370,7 +374,7 @@ namespace Toolbox::UI {
         bool m_is_render_window_open = false;
         Renderer m_renderer;
         std::vector<ISceneObject::RenderInfo> m_renderables = {};
-        ResourceCache m_resource_cache;
+        ResourceCacheLease m_resource_cache;
 
         std::map<UUID64, Transform> m_selection_transforms;
         bool m_gizmo_maniped                  = false;
@@ -64,6 +64,10 @@ namespace Toolbox {
 
         bool m_repack_scenes_on_save         = true;
         bool m_is_template_cache_allowed     = true;
+        s64 m_undo_memory_budget             = 256;  // In MiB
+
+        static constexpr s64 UndoMemoryBudgetMin = 16;
+        static constexpr s64 UndoMemoryBudgetMax = 4096;
 
         bool m_log_to_cout_cerr              = false;
     };
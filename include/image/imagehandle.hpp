@@ -34,6 +34,10 @@ namespace Toolbox {
         // Data should be a valid RED, RGB, or RGBA image as loaded by stbi
         ImageHandle(const Buffer &data, int channels, int dx, int dy);
 
+        // Replaces the pixels with `data`, reusing the texture when the size and
+        // channel count are unchanged. Meant for images that change every frame.
+        void update(std::span<const u8> data, int channels, int dx, int dy);
+
         [[nodiscard]] bool isValid() const noexcept;
         std::pair<int, int> size() const { return {m_image_width, m_image_height}; }
 
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/memory.hpp"
+#include "core/mimedata/mimedata.hpp"
+#include "core/types.hpp"
+
+namespace Toolbox {
+
+    // Storage for the MimeData snapshots recorded by undo history. Snapshots
+    // are split into content-defined chunks addressed by content hash, and
+    // every snapshot holding the same bytes shares the same chunks. Chunk
+    // boundaries follow the bytes rather than fixed offsets, so growing a
+    // string in a large object only costs the chunks around the change, and
+    // a subtree that is removed and restored is stored once.
+    //
+    // The state after an edit is usually stored as a delta against the state
+    // before it: the span of bytes that changed, which for a member edit is
+    // the member's own bytes, plus references to the unchanged chunks.
+    //
+    // Chunks are released when the last snapshot referencing them is
+    // destroyed, so the store must outlive every snapshot it produced.
+    class HistoryChunkStore {
+    public:
+        // Chunk boundaries fall where a rolling hash of the preceding bytes
+        // matches a mask, so chunks average MinChunkSize + 1 KiB.
+        static constexpr size_t MinChunkSize = 256;
+        static constexpr size_t MaxChunkSize = 4096;
+
+        struct Chunk {
+            u64 m_hash;
+            std::vector<u8> m_bytes;
+        };
+
+        using ChunkRef = RefPtr<const Chunk>;
+
+        struct Snapshot {
+            struct Format {
+                std::string m_name;
+                size_t m_size = 0;
+                // The bytes of the format, or for a delta the bytes it was
+                // taken against
+                std::vector<ChunkRef> m_chunks;
+
+                // A delta replaces m_delta_replaced bytes of the chunks at
+                // m_delta_offset with m_delta.
+                bool m_is_delta         = false;
+                size_t m_delta_offset   = 0;
+                size_t m_delta_replaced = 0;
+                std::vector<u8> m_delta;
+            };
+
+            std::vector<Format> m_formats;
+
+            // Bytes held by the snapshot itself, excluding the shared chunks
+            [[nodiscard]] size_t footprint() const;
+        };
+
+        HistoryChunkStore() = default;
+        ~HistoryChunkStore();
+
+        HistoryChunkStore(const HistoryChunkStore &) = delete;
+        HistoryChunkStore(HistoryChunkStore &&)      = delete;
+
+        HistoryChunkStore &operator=(const HistoryChunkStore &) = delete;
+        HistoryChunkStore &operator=(HistoryChunkStore &&)      = delete;
+
+        [[nodiscard]] Snapshot store(const MimeData &data);
+        // Stores each format of `data` as a delta against the same format in
+        // `base` where that is smaller, and in full otherwise.
+        [[nodiscard]] Snapshot store(const MimeData &data, const Snapshot &base);
+        [[nodiscard]] ScopePtr<MimeData> restore(const Snapshot &snapshot) const;
+
+        // Bytes held by live chunks, including their bookkeeping
+        [[nodiscard]] size_t storedBytes() const { return m_stored_bytes; }
+
+    protected:
+        void storeChunks(Snapshot::Format &format, std::span<const u8> bytes);
+        ChunkRef acquire(std::span<const u8> bytes);
+        void release(const Chunk *chunk);
+
+    private:
+        std::unordered_multimap<u64, std::weak_ptr<const Chunk>> m_chunks;
+        size_t m_stored_bytes = 0;
+    };
+
+}  // namespace Toolbox
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "core/types.hpp"
+#include "model/memscanresults.hpp"
+
+namespace Toolbox::MemScan {
+
+    using ScanOperator = MemScanOperator;
+
+    // Bools are scanned as raw bytes, where any non-zero byte is true.
+    template <typename T>
+    using scan_storage_t = std::conditional_t<std::is_same_v<T, bool>, u8, T>;
+
+    template <typename T>
+    inline bool EvaluateOperator(const T &mem_val, const T &a, const T &b, const T &last,
+                                 ScanOperator op) {
+        switch (op) {
+        case ScanOperator::OP_EXACT:
+            return a == mem_val;
+        case ScanOperator::OP_INCREASED_BY:
+            return mem_val == static_cast<T>(last + a);
+        case ScanOperator::OP_DECREASED_BY:
+            return mem_val == static_cast<T>(last - a);
+        case ScanOperator::OP_BETWEEN:
+            return a <= mem_val && mem_val <= b;
+        case ScanOperator::OP_BIGGER_THAN:
+            return mem_val > a;
+        case ScanOperator::OP_SMALLER_THAN:
+            return mem_val < a;
+        case ScanOperator::OP_INCREASED:
+            return mem_val > last;
+        case ScanOperator::OP_DECREASED:
+            return mem_val < last;
+        case ScanOperator::OP_CHANGED:
+            return mem_val != last;
+        case ScanOperator::OP_UNCHANGED:
+            return mem_val == last;
+        case ScanOperator::OP_UNKNOWN_INITIAL:
+            return true;
+        }
+        return false;
+    }
+
+    // Every operator compared against a fixed reference value reduces to
+    // a (possibly inverted) closed range, which is what the vector kernels test.
+    template <typename T> struct RangePredicate {
+        T m_lo       = T();
+        T m_hi       = T();
+        bool m_invert = false;
+        bool m_all    = false;
+        bool m_none   = false;
+
+        bool test(T value) const {
+            if (m_all) {
+                return true;
+            }
+            if (m_none) {
+                return false;
+            }
+            return (m_lo <= value && value <= m_hi) != m_invert;
+        }
+    };
+
+    namespace Detail {
+
+        template <typename T> constexpr T RangeLowest() {
+            if constexpr (std::numeric_limits<T>::has_infinity) {
+                return -std::numeric_limits<T>::infinity();
+            } else {
+                return std::numeric_limits<T>::lowest();
+            }
+        }
+
+        template <typename T> constexpr T RangeHighest() {
+            if constexpr (std::numeric_limits<T>::has_infinity) {
+                return std::numeric_limits<T>::infinity();
+            } else {
+                return std::numeric_limits<T>::max();
+            }
+        }
+
+        template <typename T> RangePredicate<T> Closed(T lo, T hi, bool invert = false) {
+            RangePredicate<T> pred;
+            pred.m_lo     = lo;
+            pred.m_hi     = hi;
+            pred.m_invert = invert;
+            return pred;
+        }
+
+        template <typename T> RangePredicate<T> Nothing() {
+            RangePredicate<T> pred;
+            pred.m_none = true;
+            return pred;
+        }
+
+        template <typename T> RangePredicate<T> Above(T a) {
+            if constexpr (std::is_floating_point_v<T>) {
+                if (std::isnan(a) || a == RangeHighest<T>()) {
+                    return Nothing<T>();
+                }
+                return Closed<T>(std::nextafter(a, RangeHighest<T>()), RangeHighest<T>());
+            } else {
+                if (a == RangeHighest<T>()) {
+                    return Nothing<T>();
+                }
+                return Closed<T>(static_cast<T>(a + 1), RangeHighest<T>());
+            }
+        }
+
+        template <typename T> RangePredicate<T> Below(T a) {
+            if constexpr (std::is_floating_point_v<T>) {
+                if (std::isnan(a) || a == RangeLowest<T>()) {
+                    return Nothing<T>();
+                }
+                return Closed<T>(RangeLowest<T>(), std::nextafter(a, RangeLowest<T>()));
+            } else {
+                if (a == RangeLowest<T>()) {
+                    return Nothing<T>();
+                }
+                return Closed<T>(RangeLowest<T>(), static_cast<T>(a - 1));
+            }
+        }
+
+    }  // namespace Detail
+
+    template <typename T>
+    RangePredicate<scan_storage_t<T>> MakeRangePredicate(ScanOperator op, T a, T b, T last) {
+        using namespace Detail;
+
+        if constexpr (std::is_same_v<T, bool>) {
+            // Only two possible values, so classify both and express
+            // the outcome as a range over the raw byte.
+            const bool if_false = EvaluateOperator<bool>(false, a, b, last, op);
+            const bool if_true  = EvaluateOperator<bool>(true, a, b, last, op);
+            if (if_false && if_true) {
+                RangePredicate<u8> pred;
+                pred.m_all = true;
+                return pred;
+            }
+            if (!if_false && !if_true) {
+                return Nothing<u8>();
+            }
+            return Closed<u8>(0, 0, if_true);
+        } else {
+            switch (op) {
+            case ScanOperator::OP_EXACT:
+                return Closed<T>(a, a);
+            case ScanOperator::OP_INCREASED_BY:
+                return Closed<T>(static_cast<T>(last + a), static_cast<T>(last + a));
+            case ScanOperator::OP_DECREASED_BY:
+                return Closed<T>(static_cast<T>(last - a), static_cast<T>(last - a));
+            case ScanOperator::OP_BETWEEN:
+                if (!(a <= b)) {
+                    return Nothing<T>();
+                }
+                return Closed<T>(a, b);
+            case ScanOperator::OP_BIGGER_THAN:
+                return Above<T>(a);
+            case ScanOperator::OP_SMALLER_THAN:
+                return Below<T>(a);
+            case ScanOperator::OP_INCREASED:
+                return Above<T>(last);
+            case ScanOperator::OP_DECREASED:
+                return Below<T>(last);
+            case ScanOperator::OP_CHANGED:
+                return Closed<T>(last, last, true);
+            case ScanOperator::OP_UNCHANGED:
+                return Closed<T>(last, last);
+            case ScanOperator::OP_UNKNOWN_INITIAL: {
+                RangePredicate<T> pred;
+                pred.m_all = true;
+                return pred;
+            }
+            }
+            return Nothing<T>();
+        }
+    }
+
+    // Scans the big endian memory image `mem` for values of T whose first byte lies in
+    // [begin_ofs, end_ofs) on a `stride` byte grid. The range is split into chunks that
+    // are tested 16-32 bytes at a time and scanned in parallel.
+    //
+    // Returns the matching offsets in ascending order.
+    template <typename T>
+    std::vector<u32> FindAll(const u8 *mem, u32 mem_size, u32 begin_ofs, u32 end_ofs, u32 stride,
+                             const RangePredicate<scan_storage_t<T>> &pred,
+                             std::function<void(double)> prog_setter = {});
+
+    // Re-tests every result of a previous scan against the memory image `mem`.
+    // Results are processed in blocks of consecutive rows: the current values are
+    // gathered into a contiguous array, tested with the vector kernels when the
+    // operator only involves constants, and the blocks are filtered in parallel.
+    //
+    // Returns the surviving addresses in the order of `previous`.
+    template <typename T>
+    std::vector<u32> FilterAll(const u8 *mem, u32 mem_size, const MemScanResultSet &previous,
+                               ScanOperator op, T a, T b,
+                               std::function<void(double)> prog_setter = {});
+
+}  // namespace Toolbox::MemScan
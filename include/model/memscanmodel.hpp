@@ -6,6 +6,8 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -13,6 +15,7 @@
 #include "core/types.hpp"
 #include "fsystem.hpp"
 #include "image/imagehandle.hpp"
+#include "model/memscanresults.hpp"
 #include "model/model.hpp"
 #include "objlib/meta/value.hpp"
 #include "serial.hpp"
@@ -79,26 +82,12 @@ namespace Toolbox {
 
     class MemScanModel : public IDataModel, public ISerializable {
     public:
-        enum class ScanOperator {
-            OP_EXACT,
-            OP_INCREASED_BY,
-            OP_DECREASED_BY,
-            OP_BETWEEN,
-            OP_BIGGER_THAN,
-            OP_SMALLER_THAN,
-            OP_INCREASED,
-            OP_DECREASED,
-            OP_CHANGED,
-            OP_UNCHANGED,
-            OP_UNKNOWN_INITIAL,
-        };
+        using ScanOperator = MemScanOperator;
 
         struct ScanHistoryEntry {
             MetaType m_scan_type = MetaType::UNKNOWN;
             u16 m_scan_size;  // UI doesn't allow scans larger than a u16
-            mutable std::vector<MemScanResult> m_scan_results = {};
-
-            Buffer m_scan_buffer;
+            MemScanResultSet m_scan_results = {};
         };
 
     public:
@@ -196,7 +185,10 @@ namespace Toolbox {
         Result<void, SerialError> serialize(Serializer &out) const override;
         Result<void, SerialError> deserialize(Deserializer &in) override;
 
-        void makeScanIndex(u32 address);
+        // Records a result in the newest scan, keeping the value found
+        // at `address` in `mem_image` for comparison by the next scan.
+        void makeScanIndex(u32 address, const Buffer &mem_image);
+        void makeScanIndexes(std::span<const u32> addresses, const Buffer &mem_image);
 
         bool reserveScan(MetaType scan_type, size_t scan_size, size_t indexes) {
             if (m_history_size >= m_index_map_history.max_size()) {
@@ -204,14 +196,16 @@ namespace Toolbox {
             }
 
             ScanHistoryEntry entry;
-            entry.m_scan_type = scan_type;
-            entry.m_scan_size = scan_size;
+            entry.m_scan_type    = scan_type;
+            entry.m_scan_size    = scan_size;
+            entry.m_scan_results = MemScanResultSet(static_cast<u16>(scan_size));
             entry.m_scan_results.reserve(indexes);
             m_index_map_history[m_history_size++] = std::move(entry);
             return true;
         }
 
-        bool captureMemForCache();
+        // Takes a transient copy of game memory to scan against.
+        bool captureMemory(Buffer &out) const;
 
         const ScanHistoryEntry &getScanHistory() const;
         const ScanHistoryEntry &getScanHistory(size_t i) const;
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "core/types.hpp"
+
+namespace Toolbox {
+
+    enum class MemScanOperator {
+        OP_EXACT,
+        OP_INCREASED_BY,
+        OP_DECREASED_BY,
+        OP_BETWEEN,
+        OP_BIGGER_THAN,
+        OP_SMALLER_THAN,
+        OP_INCREASED,
+        OP_DECREASED,
+        OP_CHANGED,
+        OP_UNCHANGED,
+        OP_UNKNOWN_INITIAL,
+    };
+
+    // Sorted scan results stored as runs of evenly spaced addresses, paired with
+    // the raw (big endian) value that was captured at each address. A history
+    // entry only keeps what survived its scan rather than a copy of all of RAM.
+    class MemScanResultSet {
+    public:
+        MemScanResultSet() = default;
+        MemScanResultSet(u16 value_size) : m_value_size(value_size) {}
+        ~MemScanResultSet() = default;
+
+        [[nodiscard]] size_t size() const { return m_size; }
+        [[nodiscard]] bool empty() const { return m_size == 0; }
+        [[nodiscard]] u16 valueSize() const { return m_value_size; }
+
+        void reserve(size_t results);
+        void clear();
+
+        // Addresses must be pushed in ascending order, anything else is rejected.
+        bool push_back(u32 address, const u8 *value);
+        bool erase(u32 address);
+
+        [[nodiscard]] u32 addressAt(size_t row) const;
+        [[nodiscard]] const u8 *valueAt(size_t row) const;
+        [[nodiscard]] std::optional<size_t> find(u32 address) const;
+
+        // Writes the addresses of rows [row_begin, row_end) to `out`.
+        void gatherAddresses(size_t row_begin, size_t row_end, u32 *out) const;
+
+        // Walks every result in order as fn(row, address, value).
+        template <typename _Fn> void forEach(_Fn &&fn) const {
+            for (size_t i = 0; i < m_runs.size(); ++i) {
+                const Run &run   = m_runs[i];
+                const size_t end = runEnd(i);
+                u32 address      = run.m_address;
+                for (size_t row = run.m_first_row; row < end; ++row) {
+                    fn(row, address, m_values.data() + row * m_value_size);
+                    address += run.m_stride;
+                }
+            }
+        }
+
+        [[nodiscard]] size_t memoryUsage() const {
+            return m_runs.capacity() * sizeof(Run) + m_values.capacity();
+        }
+
+    private:
+        struct Run {
+            u32 m_address;
+            u32 m_stride;
+            size_t m_first_row;
+        };
+
+        size_t runEnd(size_t run) const {
+            return run + 1 < m_runs.size() ? m_runs[run + 1].m_first_row : m_size;
+        }
+
+        size_t runOfRow(size_t row) const;
+
+        std::vector<Run> m_runs = {};
+        std::vector<u8> m_values = {};
+        size_t m_size            = 0;
+        u16 m_value_size         = 0;
+    };
+
+}  // namespace Toolbox
@@ -18,6 +18,7 @@
 #include "core/types.hpp"
 #include "fsystem.hpp"
 #include "image/imagehandle.hpp"
+#include "model/historystore.hpp"
 #include "unique.hpp"
 
 namespace Toolbox {
@@ -212,8 +213,8 @@ namespace Toolbox {
             ModelIndex m_parent;
             int64_t m_row                  = -1;
             int64_t m_column               = -1;
-            ScopePtr<MimeData> m_undo_data = nullptr;
-            ScopePtr<MimeData> m_redo_data = nullptr;
+            HistoryChunkStore::Snapshot m_undo_data;
+            HistoryChunkStore::Snapshot m_redo_data;
             ModelEventFlags m_action_flags                      = ModelEventFlags::EVENT_NONE;
 
             HistoryAction()                                     = default;
@@ -229,6 +230,7 @@ namespace Toolbox {
         struct HistoryFrame {
             std::list<HistoryAction> m_actions;
             TimePoint m_timestamp;
+            size_t m_footprint                                = 0;  // Excluding shared chunks
             bool m_collapsed                                  = false;
 
             HistoryFrame()                                    = default;
@@ -265,11 +267,17 @@ namespace Toolbox {
 
         virtual void resetHistory();
 
+        // Once the recorded history takes more than `bytes`, the oldest
+        // frames are discarded until it fits again.
+        virtual void setMemoryBudget(size_t bytes);
+        [[nodiscard]] virtual size_t getMemoryUsage() const;
+
     protected:
         virtual TimePoint getUndoFrameTimepoint() const;
         virtual TimePoint getRedoFrameTimepoint() const;
 
         bool tryCollapseFrame(HistoryFrame &frame);
+        void enforceMemoryBudget();
 
         void trimHistoryToTimePoint(const TimePoint &point);
         void updateHistory(const ModelIndex &index, int flags);
@@ -282,9 +290,18 @@ namespace Toolbox {
         UUID64 m_uuid;
 
         RefPtr<IDataModel> m_model;
+
+        // Declared ahead of the history so that it outlives every snapshot
+        HistoryChunkStore m_chunk_store;
+        size_t m_memory_budget = size_t(256) << 20;
+
         std::vector<HistoryFrame> m_history;
         int64_t m_history_frame = -1;
 
+        // Frames discarded by the memory budget, which still count towards
+        // getCurrentFrame() so that it keeps identifying the same state
+        int64_t m_evicted_frames = 0;
+
         KeyBind m_undo_keybind;
         KeyBind m_redo_keybind;
         bool m_keybind_used;
@@ -328,6 +345,10 @@ namespace Toolbox {
 
         void resetHistory() override;
 
+        // The budget is split evenly between the handlers
+        void setMemoryBudget(size_t bytes) override;
+        [[nodiscard]] size_t getMemoryUsage() const override;
+
     protected:
         TimePoint getUndoFrameTimepoint() const override;
         TimePoint getRedoFrameTimepoint() const override;
@@ -11,6 +11,7 @@
 
 #include "core/mimedata/mimedata.hpp"
 #include "core/types.hpp"
+#include "dolphin/watchplan.hpp"
 #include "fsystem.hpp"
 #include "image/imagehandle.hpp"
 #include "jsonlib.hpp"
@@ -117,6 +118,7 @@ namespace Toolbox {
         WATCH_DATA_ROLE_LOCK,
         WATCH_DATA_ROLE_SIZE,
         WATCH_DATA_ROLE_VIEW_BASE,
+        WATCH_DATA_ROLE_CHANGE_TICK,
     };
 
     class WatchDataModel : public IDataModel, public ISerializable {
@@ -182,6 +184,12 @@ namespace Toolbox {
                 getData(index, WatchDataRole::WATCH_DATA_ROLE_POINTER_CHAIN));
         }
 
+        // The refresh tick at which the watch's value last changed. Views can
+        // cache anything derived from the value until this moves.
+        [[nodiscard]] u64 getWatchChangeTick(const ModelIndex &index) const {
+            return std::any_cast<u64>(getData(index, WatchDataRole::WATCH_DATA_ROLE_CHANGE_TICK));
+        }
+
         [[nodiscard]] std::any getData(const ModelIndex &index, int role) const override;
         void setData(const ModelIndex &index, std::any data, int role) override;
 
@@ -306,6 +314,9 @@ namespace Toolbox {
 
             WatchValueBase m_value_base;
 
+            // Refresh tick of the last change, from the plan's changed bitset
+            u64 m_change_tick = 0;
+
             bool hasChild(UUID64 uuid) const {
                 if (m_type != Type::GROUP || !m_group) {
                     return false;
@@ -335,6 +346,13 @@ namespace Toolbox {
 
         mutable std::vector<_WatchIndexData> m_index_map;
 
+        // Compiled from the watches in m_index_map order, and recompiled
+        // whenever that set changes. Only touched under m_mutex.
+        WatchPlan m_watch_plan;
+        std::vector<MemoryWatch *> m_plan_watches;
+        std::vector<size_t> m_plan_rows;
+        u64 m_watch_tick = 0;
+
         std::thread m_watch_thread;
         std::atomic<bool> m_running;
 
@@ -406,6 +424,10 @@ namespace Toolbox {
             setData(index, size, WatchDataRole::WATCH_DATA_ROLE_VIEW_BASE);
         }
 
+        [[nodiscard]] u64 getWatchChangeTick(const ModelIndex &index) const {
+            return std::any_cast<u64>(getData(index, WatchDataRole::WATCH_DATA_ROLE_CHANGE_TICK));
+        }
+
         [[nodiscard]] std::any getData(const ModelIndex &index, int role) const override;
         void setData(const ModelIndex &index, std::any data, int role) override;
 
@@ -212,6 +212,8 @@ namespace Toolbox::Object {
             }
         }
 
+        [[nodiscard]] size_t computeGameSize() const { return computeSize(); }
+
         [[nodiscard]] iterator begin() { return m_values.begin(); }
         [[nodiscard]] const_iterator begin() const { return m_values.begin(); }
         [[nodiscard]] const_iterator cbegin() const { return m_values.cbegin(); }
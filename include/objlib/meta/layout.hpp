@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "core/memory.hpp"
+#include "core/types.hpp"
+#include "objlib/symbol.hpp"
+
+namespace Toolbox::Object {
+
+    class MetaMember;
+
+    // Compiled view of the top level members of a scene object. Maps member
+    // name IDs to their slot in the object's member list in constant time,
+    // and records the game data offset and per element stride of every
+    // member in the fixed size prefix of the layout (up to the first string
+    // or dynamically sized array).
+    //
+    // Objects instantiated from the same template wizard share one table.
+    class MemberLayout {
+    public:
+        static constexpr u32 VARIABLE = 0xFFFFFFFF;
+
+        struct Entry {
+            SymbolID m_id;
+            u32 m_index;   // Slot in the object's member list
+            u32 m_offset;  // Byte offset from the first member, or VARIABLE
+            u32 m_stride;  // Game size of one array element, or VARIABLE
+        };
+
+        explicit MemberLayout(const std::vector<RefPtr<MetaMember>> &members);
+
+        // Returns the shared layout for `members`, compiling it on first use.
+        [[nodiscard]] static RefPtr<const MemberLayout>
+        Get(std::string_view type, std::string_view wizard,
+            const std::vector<RefPtr<MetaMember>> &members);
+
+        [[nodiscard]] const Entry *find(SymbolID id) const;
+
+        [[nodiscard]] size_t size() const { return m_entries.size(); }
+        [[nodiscard]] const std::vector<Entry> &entries() const { return m_entries; }
+
+    private:
+        std::vector<Entry> m_entries;
+
+        // Open addressed table of indices into m_entries (+1, 0 is empty)
+        std::vector<u32> m_slots;
+        u32 m_slot_mask = 0;
+    };
+
+}  // namespace Toolbox::Object
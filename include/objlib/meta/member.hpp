@@ -5,10 +5,13 @@
 #include "errors.hpp"
 #include "gameio.hpp"
 #include "objlib/qualname.hpp"
+#include "objlib/symbol.hpp"
 #include "smart_resource.hpp"
 #include "struct.hpp"
 #include "value.hpp"
+#include <charconv>
 #include <expected>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -32,6 +35,26 @@ namespace Toolbox::Object {
         name[scopeidx] = makeNameArrayIndex(std::string_view(name_str), index);
     }
 
+    // Parses the contents of an array specifier the way std::stoi does with
+    // base 0 (decimal, 0x hex or leading 0 octal) without allocating.
+    inline std::optional<size_t> parseArrayIndex(std::string_view index) {
+        int base = 10;
+        if (index.size() > 2 && index[0] == '0' && (index[1] == 'x' || index[1] == 'X')) {
+            base = 16;
+            index.remove_prefix(2);
+        } else if (index.size() > 1 && index[0] == '0') {
+            base = 8;
+            index.remove_prefix(1);
+        }
+
+        size_t value   = 0;
+        auto [ptr, ec] = std::from_chars(index.data(), index.data() + index.size(), value, base);
+        if (ec != std::errc() || ptr != index.data() + index.size()) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
     inline Result<size_t, MetaScopeError> getArrayIndex(const QualifiedName &name,
                                                         size_t scopeidx) {
         auto name_str = name[scopeidx];
@@ -47,8 +70,13 @@ namespace Toolbox::Object {
                                            "Array specifier missing end token `]'");
         }
 
-        auto index = name_str.substr(pos + 1, end - pos - 1);
-        return std::stoi(std::string(index), nullptr, 0);
+        auto index = parseArrayIndex(name_str.substr(pos + 1, end - pos - 1));
+        if (!index) {
+            return make_meta_error<size_t>(name.toString(),
+                                           name.getAbsIndexOf(scopeidx, static_cast<int>(pos)),
+                                           "Array specifier is not a valid index");
+        }
+        return *index;
     }
 
     inline Result<size_t, MetaScopeError> getArrayIndex(std::string_view name) {
@@ -62,8 +90,12 @@ namespace Toolbox::Object {
                                            "Array specifier missing end token `]'");
         }
 
-        auto index = name.substr(pos + 1, end - pos - 1);
-        return std::stoi(std::string(index), nullptr, 0);
+        auto index = parseArrayIndex(name.substr(pos + 1, end - pos - 1));
+        if (!index) {
+            return make_meta_error<size_t>(name, static_cast<int>(pos),
+                                           "Array specifier is not a valid index");
+        }
+        return *index;
     }
 
     inline std::string_view getArrayName(std::string_view name) {
@@ -99,19 +131,22 @@ namespace Toolbox::Object {
         using size_type = std::variant<u32, ReferenceInfo>;
 
         MetaMember(std::string_view name, const MetaValue &value)
-            : m_name(name), m_values(), m_arraysize(static_cast<u32>(1)) {
+            : m_name(name), m_name_id(InternSymbol(name)), m_values(),
+              m_arraysize(static_cast<u32>(1)) {
             auto p = make_referable<MetaValue>(value);
             m_values.emplace_back(std::move(p));
             m_default = make_referable<MetaValue>(value);
         }
         MetaMember(std::string_view name, const MetaStruct &value)
-            : m_name(name), m_values(), m_arraysize(static_cast<u32>(1)) {
+            : m_name(name), m_name_id(InternSymbol(name)), m_values(),
+              m_arraysize(static_cast<u32>(1)) {
             auto p = make_referable<MetaStruct>(value);
             m_values.emplace_back(std::move(p));
             m_default = make_referable<MetaStruct>(value);
         }
         MetaMember(std::string_view name, const MetaEnum &value)
-            : m_name(name), m_values(), m_arraysize(static_cast<u32>(1)) {
+            : m_name(name), m_name_id(InternSymbol(name)), m_values(),
+              m_arraysize(static_cast<u32>(1)) {
             auto p = make_referable<MetaEnum>(value);
             m_values.emplace_back(std::move(p));
             m_default = make_referable<MetaEnum>(value);
@@ -127,7 +162,10 @@ namespace Toolbox::Object {
     protected:
         MetaMember() = default;
 
-        constexpr void setName(const std::string &name) { m_name = name; }
+        void setName(const std::string &name) {
+            m_name    = name;
+            m_name_id = InternSymbol(name);
+        }
         constexpr void setParent(MetaMember *parent, int64_t array_idx) {
             m_parent           = parent;
             m_parent_array_idx = array_idx;
@@ -148,6 +186,7 @@ namespace Toolbox::Object {
             }
 
             m_default = default_;
+            m_edit_stamp.bump();
         }
         void setEnums(const std::vector<RefPtr<MetaEnum>> &enums, RefPtr<MetaEnum> default_) {
             const u32 array_size = arraysize();
@@ -158,6 +197,7 @@ namespace Toolbox::Object {
             }
 
             m_default = default_;
+            m_edit_stamp.bump();
         }
         void setStructs(const std::vector<RefPtr<MetaStruct>> &structs,
                         RefPtr<MetaStruct> default_) {
@@ -169,10 +209,12 @@ namespace Toolbox::Object {
             }
 
             m_default = default_;
+            m_edit_stamp.bump();
         }
 
     public:
         [[nodiscard]] constexpr const std::string &name() const { return m_name; }
+        [[nodiscard]] constexpr SymbolID nameID() const { return m_name_id; }
         [[nodiscard]] constexpr const MetaMember *parent() const { return m_parent; }
 
         [[nodiscard]] QualifiedName qualifiedName() const;
@@ -197,6 +239,10 @@ namespace Toolbox::Object {
             return size;
         }
 
+        // Number of bytes written by gameSerialize, which only covers the
+        // first arraysize() values.
+        [[nodiscard]] size_t computeGameSize() const;
+
         [[nodiscard]] u32 arraysize() const {
             if (std::holds_alternative<ReferenceInfo>(m_arraysize)) {
                 auto vptr = std::get<ReferenceInfo>(m_arraysize);
@@ -287,6 +333,14 @@ namespace Toolbox::Object {
 
         bool operator==(const MetaMember &other) const;
 
+        // Epoch of the most recent edit to this member or any value in it,
+        // compared against GetMetaEditEpoch() snapshots to find edits.
+        [[nodiscard]] u64 lastEditEpoch() const;
+
+        // Reports later edits of this member, and of every value in it, to
+        // `sink`. Values added by syncArray are bound to the same sink.
+        void bindEditSink(const RefPtr<MetaEditSink> &sink);
+
         void updateReferenceToList(const std::vector<RefPtr<MetaMember>> &list);
         void updateParentRefs();
 
@@ -295,6 +349,8 @@ namespace Toolbox::Object {
             if (m_values.size() == asize)
                 return;
 
+            m_edit_stamp.bump();
+
             if (m_values.size() > asize) {
                 m_values.resize(asize);
                 return;
@@ -313,6 +369,10 @@ namespace Toolbox::Object {
                 }
             }
 
+            if (m_edit_stamp.sink()) {
+                bindEditSink(m_edit_stamp.sink());
+            }
+
             updateParentRefs();
         }
 
@@ -333,11 +393,13 @@ namespace Toolbox::Object {
 
     private:
         std::string m_name;
+        SymbolID m_name_id = INVALID_SYMBOL;
         std::vector<value_type> m_values;
         size_type m_arraysize;
         MetaMember::value_type m_default;
         const MetaMember *m_parent = nullptr;
         int64_t m_parent_array_idx = -1;
+        MetaEditStamp m_edit_stamp;
     };
 
     template <>
@@ -11,6 +11,7 @@
 #include "errors.hpp"
 #include "gameio.hpp"
 #include "objlib/qualname.hpp"
+#include "objlib/symbol.hpp"
 #include "smart_resource.hpp"
 
 namespace Toolbox::Object {
@@ -21,7 +22,6 @@ namespace Toolbox::Object {
     public:
         using MemberT      = RefPtr<MetaMember>;
         using GetMemberT   = Result<MemberT, MetaScopeError>;
-        using CacheMemberT = std::unordered_map<std::string, MemberT>;
 
         MetaStruct(std::string_view name) : m_name(name) {}
         MetaStruct(std::string_view name, const std::vector<MemberT> &members);
@@ -40,10 +40,16 @@ namespace Toolbox::Object {
 
         [[nodiscard]] constexpr const std::vector<MemberT> &members() const { return m_members; }
 
+        [[nodiscard]] GetMemberT getMember(SymbolID name) const;
         [[nodiscard]] GetMemberT getMember(std::string_view name) const;
         [[nodiscard]] GetMemberT getMember(const QualifiedName &name) const;
 
+        // Resolves the scopes [begin, end) of a qualified name relative to this struct.
+        [[nodiscard]] GetMemberT getMember(QualifiedName::const_iterator begin,
+                                           QualifiedName::const_iterator end) const;
+
         [[nodiscard]] size_t computeSize() const;
+        [[nodiscard]] size_t computeGameSize() const;
 
         void dump(std::ostream &out, size_t indention, size_t indention_width,
                   bool naked = false) const;
@@ -65,8 +71,6 @@ namespace Toolbox::Object {
     private:
         std::string m_name;
         std::vector<MemberT> m_members = {};
-
-        mutable CacheMemberT m_member_cache;
     };
 
 }  // namespace Toolbox::Object
\ No newline at end of file
@@ -1,14 +1,18 @@
 #pragma once
 
+#include <cstring>
 #include <expected>
 #include <functional>
 #include <glm/glm.hpp>
 #include <magic_enum.hpp>
+#include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <variant>
 
 #include "color.hpp"
+#include "core/memory.hpp"
 #include "core/types.hpp"
 #include "errors.hpp"
 #include "gameio.hpp"
@@ -34,6 +38,97 @@ template <> struct std::formatter<glm::vec4> : std::formatter<string_view> {
 
 namespace Toolbox::Object {
 
+    // Advanced by every value edit. Saves compare member stamps against the
+    // epoch an object was read at to tell if its source bytes still apply.
+    [[nodiscard]] u64 GetMetaEditEpoch();
+    // Returns the new epoch, which doubles as the stamp of the edit.
+    u64 BumpMetaEditEpoch();
+
+    // Told about every edit to the values and members bound to it.
+    class IMetaEditListener {
+    public:
+        virtual ~IMetaEditListener() = default;
+
+        virtual void onMetaEdited() const = 0;
+    };
+
+    // Shared by a listener and the stamps bound to it. The listener detaches
+    // it when destroyed, so values that outlive their owner report nowhere.
+    class MetaEditSink {
+    public:
+        explicit MetaEditSink(const IMetaEditListener *listener) : m_listener(listener) {}
+
+        void notify() const {
+            if (m_listener) {
+                m_listener->onMetaEdited();
+            }
+        }
+
+        void detach() { m_listener = nullptr; }
+
+    private:
+        const IMetaEditListener *m_listener;
+    };
+
+    // The sink a listener binds its values to. Copies start without one, as
+    // the values a copy holds are bound again when it is first measured.
+    class MetaEditBinding {
+    public:
+        MetaEditBinding() = default;
+        MetaEditBinding(const MetaEditBinding &) noexcept {}
+        ~MetaEditBinding() {
+            if (m_sink) {
+                m_sink->detach();
+            }
+        }
+
+        MetaEditBinding &operator=(const MetaEditBinding &) noexcept { return *this; }
+
+        [[nodiscard]] bool isBound() const { return m_sink != nullptr; }
+
+        [[nodiscard]] const RefPtr<MetaEditSink> &sink(const IMetaEditListener *listener) {
+            if (!m_sink) {
+                m_sink = make_referable<MetaEditSink>(listener);
+            }
+            return m_sink;
+        }
+
+    private:
+        RefPtr<MetaEditSink> m_sink;
+    };
+
+    // The epoch of the last edit to a value or member, plus the sink the
+    // edit is reported to. Assigning one value over another counts as an
+    // edit of the target, so the stamp is renewed rather than copied; copy
+    // construction keeps the epoch, as a clone holds the same data as its
+    // source, but not the sink, as the clone has no owner yet.
+    class MetaEditStamp {
+    public:
+        MetaEditStamp() = default;
+        MetaEditStamp(const MetaEditStamp &other) noexcept : m_epoch(other.m_epoch) {}
+
+        MetaEditStamp &operator=(const MetaEditStamp &) noexcept {
+            bump();
+            return *this;
+        }
+
+        [[nodiscard]] u64 epoch() const { return m_epoch; }
+        [[nodiscard]] const RefPtr<MetaEditSink> &sink() const { return m_sink; }
+
+        void bump() {
+            m_epoch = BumpMetaEditEpoch();
+            if (m_sink) {
+                m_sink->notify();
+            }
+        }
+
+        void bind(const RefPtr<MetaEditSink> &sink) { m_sink = sink; }
+
+    private:
+        u64 m_epoch = 0;
+        RefPtr<MetaEditSink> m_sink;
+    };
+
     enum class MetaType : u8 {
         BOOL,
         S8,
@@ -362,83 +457,192 @@ namespace Toolbox::Object {
         }
     }
 
-    template <typename T>
-    [[nodiscard]]
-    inline Result<T, std::string> getBuf(const Buffer &m_value_buf) {
-        T value{};
-        if (Deserializer::BytesToObject(m_value_buf, value, 0).has_value()) {
-            return value;
-        } else {
-            return std::unexpected("Failed to deserialize data into higher type");
+    // Backing bytes of a MetaValue. Every fixed size meta type fits in the
+    // inline block, so only strings and raw byte arrays reach the heap.
+    class MetaValueStorage {
+    public:
+        static constexpr size_t InlineCapacity = 48;
+
+        MetaValueStorage() = default;
+        MetaValueStorage(const MetaValueStorage &other) { assign(other.data(), other.size()); }
+        MetaValueStorage(MetaValueStorage &&other) noexcept { *this = std::move(other); }
+
+        MetaValueStorage &operator=(const MetaValueStorage &other) {
+            if (this != &other) {
+                assign(other.data(), other.size());
+            }
+            return *this;
         }
-    }
 
-    template <>
-    [[nodiscard]]
-    inline Result<std::string, std::string> getBuf(const Buffer &m_value_buf) {
-        std::string out;
-        for (size_t i = 0; i < m_value_buf.size(); ++i) {
-            char ch = m_value_buf.get<char>(static_cast<uint32_t>(i));
-            if (ch == '\0')
-                break;
+        MetaValueStorage &operator=(MetaValueStorage &&other) noexcept {
+            if (this == &other) {
+                return *this;
+            }
+            m_size     = other.m_size;
+            m_capacity = other.m_capacity;
+            m_heap     = std::move(other.m_heap);
+            std::memcpy(m_inline, other.m_inline, InlineCapacity);
+            other.m_size     = 0;
+            other.m_capacity = 0;
+            return *this;
+        }
 
-            out.push_back(ch);
+        [[nodiscard]] size_t size() const noexcept { return m_size; }
+        [[nodiscard]] bool isInline() const noexcept { return m_heap == nullptr; }
+
+        [[nodiscard]] u8 *data() noexcept { return isInline() ? m_inline : m_heap.get(); }
+        [[nodiscard]] const u8 *data() const noexcept {
+            return isInline() ? m_inline : m_heap.get();
+        }
+
+        [[nodiscard]] std::span<const u8> span() const noexcept { return {data(), m_size}; }
+
+        // Keeps the leading bytes, new bytes are zeroed.
+        void resize(size_t size) {
+            if (size <= InlineCapacity) {
+                if (!isInline()) {
+                    std::memcpy(m_inline, m_heap.get(), size);
+                    m_heap.reset();
+                    m_capacity = 0;
+                }
+            } else if (size > m_capacity) {
+                auto heap = std::make_unique<u8[]>(size);
+                std::memcpy(heap.get(), data(), std::min<size_t>(m_size, size));
+                m_heap     = std::move(heap);
+                m_capacity = static_cast<u32>(size);
+            }
+            if (size > m_size) {
+                std::memset(data() + m_size, 0, size - m_size);
+            }
+            m_size = static_cast<u32>(size);
+        }
+
+        void assign(const void *src, size_t size) {
+            resize(size);
+            if (size > 0) {
+                std::memmove(data(), src, size);
+            }
         }
-        return out;
-    }
+
+        bool operator==(const MetaValueStorage &other) const noexcept {
+            return m_size == other.m_size && std::memcmp(data(), other.data(), m_size) == 0;
+        }
+
+    private:
+        alignas(8) u8 m_inline[InlineCapacity] = {};
+        std::unique_ptr<u8[]> m_heap;
+        u32 m_size     = 0;
+        u32 m_capacity = 0;
+    };
+
+    // The inline block plus the heap pointer and the two u32 counters.
+    static_assert(sizeof(MetaValueStorage) == 64);
 
     template <typename T>
-    [[nodiscard]]
-    inline bool setBuf(Buffer &m_value_buf, const T &value) {
-        bool ret = Serializer::ObjectToBytes(value, m_value_buf, 0).has_value();
-        return ret;
+    concept MetaColorType = std::is_base_of_v<Color::BaseColor, T> && requires(T color) {
+        color.m_r;
+        color.m_g;
+        color.m_b;
+    };
+
+    // Colors are not trivially copyable (they carry a vtable), so only
+    // their channels are stored.
+    template <MetaColorType T> constexpr size_t meta_color_channels() {
+        if constexpr (requires(T color) { color.m_a; }) {
+            return 4;
+        } else {
+            return 3;
+        }
     }
 
-    template <>
+    template <typename T>
     [[nodiscard]]
-    inline bool setBuf(Buffer &m_value_buf, const std::string &value) {
-        m_value_buf.resize(static_cast<uint32_t>(value.size() + 1));
-        for (size_t i = 0; i < value.size(); ++i) {
-            m_value_buf.set<char>(static_cast<uint32_t>(i), value[i]);
+    inline Result<T, std::string> getBuf(const MetaValueStorage &storage) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            const char *str = reinterpret_cast<const char *>(storage.data());
+            return std::string(str, strnlen(str, storage.size()));
+        } else if constexpr (std::is_same_v<T, Buffer>) {
+            Buffer out;
+            if (storage.size() > 0) {
+                out.alloc(static_cast<uint32_t>(storage.size()));
+                std::memcpy(out.buf(), storage.data(), storage.size());
+            }
+            return out;
+        } else if constexpr (MetaColorType<T>) {
+            using channel_t           = std::remove_cvref_t<decltype(std::declval<T>().m_r)>;
+            constexpr size_t channels = meta_color_channels<T>();
+            if (storage.size() < sizeof(channel_t) * channels) {
+                return std::unexpected("Stored value is too small for the requested type");
+            }
+            channel_t rgba[channels];
+            std::memcpy(rgba, storage.data(), sizeof(rgba));
+            T color;
+            color.m_r = rgba[0];
+            color.m_g = rgba[1];
+            color.m_b = rgba[2];
+            if constexpr (channels == 4) {
+                color.m_a = rgba[3];
+            }
+            return color;
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            if (storage.size() < sizeof(T)) {
+                return std::unexpected("Stored value is too small for the requested type");
+            }
+            T value;
+            std::memcpy(&value, storage.data(), sizeof(T));
+            return value;
+        } else {
+            return std::unexpected("Unsupported type for MetaValue storage");
         }
-        m_value_buf.set<char>(static_cast<uint32_t>(value.size()), '\0');
-        return true;
     }
 
-    template <>
+    template <typename T>
     [[nodiscard]]
-    inline bool setBuf(Buffer &m_value_buf, const Buffer &value) {
-        value.copyTo(m_value_buf);
-        return true;
+    inline bool setBuf(MetaValueStorage &storage, const T &value) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            storage.resize(value.size() + 1);
+            std::memcpy(storage.data(), value.data(), value.size());
+            storage.data()[value.size()] = '\0';
+            return true;
+        } else if constexpr (std::is_same_v<T, Buffer>) {
+            storage.assign(value.buf(), value.size());
+            return true;
+        } else if constexpr (MetaColorType<T>) {
+            using channel_t           = std::remove_cvref_t<decltype(value.m_r)>;
+            constexpr size_t channels = meta_color_channels<T>();
+            channel_t rgba[channels];
+            rgba[0] = value.m_r;
+            rgba[1] = value.m_g;
+            rgba[2] = value.m_b;
+            if constexpr (channels == 4) {
+                rgba[3] = value.m_a;
+            }
+            storage.assign(rgba, sizeof(rgba));
+            return true;
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            storage.assign(&value, sizeof(T));
+            return true;
+        } else {
+            return false;
+        }
     }
 
     [[nodiscard]]
-    inline bool setBuf(Buffer &m_value_buf, std::string_view value) {
-        m_value_buf.resize(static_cast<uint32_t>(value.size() + 1));
-        for (size_t i = 0; i < value.size(); ++i) {
-            m_value_buf.set<char>(static_cast<uint32_t>(i), value[i]);
-        }
-        m_value_buf.set<char>(static_cast<uint32_t>(value.size()), '\0');
+    inline bool setBuf(MetaValueStorage &storage, std::string_view value) {
+        storage.resize(value.size() + 1);
+        std::memcpy(storage.data(), value.data(), value.size());
+        storage.data()[value.size()] = '\0';
         return true;
     }
 
     class MetaValue : public IGameSerializable {
     public:
-        MetaValue() {
-            m_value_buf.initTo(0);
-            m_type = MetaType::UNKNOWN;
-        }
+        MetaValue() { m_type = MetaType::UNKNOWN; }
 
         template <typename T>
         explicit MetaValue(T value, T v_min = std::numeric_limits<T>::min(),
-                           T v_max = std::numeric_limits<T>::max())
-            : m_value_buf() {
+                           T v_max = std::numeric_limits<T>::max()) {
             m_type = map_to_type_enum<T>::value;
-
-            m_min_buf = Buffer();
-            m_min_buf.setBuf(&m_uint_min, sizeof(m_uint_min));
-            m_max_buf = Buffer();
-            m_max_buf.setBuf(&m_uint_max, sizeof(m_uint_max));
             restoreMinMax();
 
             set<T>(value);
@@ -446,17 +650,11 @@ namespace Toolbox::Object {
             setMax<T>(v_max);
         }
 
-        explicit MetaValue(MetaType type) : m_type(type), m_value_buf() {
-            m_min_buf = Buffer();
-            m_min_buf.setBuf(&m_uint_min, sizeof(m_uint_min));
-            m_max_buf = Buffer();
-            m_max_buf.setBuf(&m_uint_max, sizeof(m_uint_max));
-
-            m_value_buf.alloc(static_cast<uint32_t>(meta_type_size(type)));
-            m_value_buf.initTo(0);
+        explicit MetaValue(MetaType type) : m_type(type) {
+            m_value_buf.resize(meta_type_size(type));
             switch (type) {
             case MetaType::TRANSFORM:
-                m_value_buf.set<Transform>(0, Transform());
+                (void)setBuf(m_value_buf, Transform());
                 break;
             default:
                 break;
@@ -465,46 +663,15 @@ namespace Toolbox::Object {
             restoreMinMax();
         }
 
-        MetaValue(MetaType type, Buffer &&value_buf)
-            : m_type(type), m_value_buf(std::move(value_buf)) {
-            m_min_buf = Buffer();
-            m_min_buf.setBuf(&m_uint_min, sizeof(m_uint_min));
-            m_max_buf = Buffer();
-            m_max_buf.setBuf(&m_uint_max, sizeof(m_uint_max));
-            restoreMinMax();
-        }
-
-        MetaValue(MetaType type, const Buffer &value_buf) : m_type(type), m_value_buf(value_buf) {
-            m_min_buf = Buffer();
-            m_min_buf.setBuf(&m_uint_min, sizeof(m_uint_min));
-            m_max_buf = Buffer();
-            m_max_buf.setBuf(&m_uint_max, sizeof(m_uint_max));
+        MetaValue(MetaType type, const Buffer &value_buf) : m_type(type) {
+            m_value_buf.assign(value_buf.buf(), value_buf.size());
             restoreMinMax();
         }
 
-        MetaValue(const MetaValue &other) {
-            m_type      = other.m_type;
-            m_value_buf = other.m_value_buf;
-            m_min_buf   = Buffer();
-            m_min_buf.setBuf(&m_uint_min, sizeof(m_uint_min));
-            m_max_buf = Buffer();
-            m_max_buf.setBuf(&m_uint_max, sizeof(m_uint_max));
-            m_uint_min = other.m_uint_min;
-            m_uint_max = other.m_uint_max;
-        }
-
-        MetaValue(MetaValue &&other) noexcept {
-            m_type      = other.m_type;
-            m_value_buf = std::move(other.m_value_buf);
-            m_min_buf   = Buffer();
-            m_min_buf.setBuf(&m_uint_min, sizeof(m_uint_min));
-            m_max_buf = Buffer();
-            m_max_buf.setBuf(&m_uint_max, sizeof(m_uint_max));
-            m_uint_min = other.m_uint_min;
-            m_uint_max = other.m_uint_max;
-        }
+        MetaValue(const MetaValue &other)     = default;
+        MetaValue(MetaValue &&other) noexcept = default;
 
-        ~MetaValue() override { m_value_buf.free(); }
+        ~MetaValue() override = default;
 
         MetaValue &operator=(const MetaValue &other)      = default;
         MetaValue &operator=(MetaValue &&other) noexcept = default;
@@ -525,7 +692,15 @@ namespace Toolbox::Object {
 
         [[nodiscard]] size_t computeSize() const;
 
-        [[nodiscard]] const Buffer &buf() const { return m_value_buf; }
+        // Number of bytes written by gameSerialize.
+        [[nodiscard]] size_t computeGameSize() const;
+
+        [[nodiscard]] std::span<const u8> bytes() const { return m_value_buf.span(); }
+
+        [[nodiscard]] u64 lastEditEpoch() const { return m_edit_stamp.epoch(); }
+
+        // Reports later edits of this value to `sink`.
+        void bindEditSink(const RefPtr<MetaEditSink> &sink) { m_edit_stamp.bind(sink); }
 
         template <typename T> [[nodiscard]] Result<T, std::string> min() const {
             return std::unexpected("Unsupported type for min()");
@@ -546,8 +721,11 @@ namespace Toolbox::Object {
         void restoreMinMax();
 
         template <typename T> bool set(const T &value) requires std::is_copy_assignable_v<T> {
+            m_edit_stamp.bump();
             m_type = map_to_type_enum<T>::value;
-            if constexpr (!std::is_integral_v<T> && !std::is_floating_point_v<T>) {
+            // bool has no limits, and asking for them builds an error string
+            if constexpr (std::is_same_v<T, bool> ||
+                          (!std::is_integral_v<T> && !std::is_floating_point_v<T>)) {
                 return setBuf<T>(m_value_buf, value);
             } else {
                 Result<T, std::string> maybe_min = this->min<T>();
@@ -566,7 +744,10 @@ namespace Toolbox::Object {
             }
         }
 
-        bool set(std::string_view value) { return setBuf(m_value_buf, value); }
+        bool set(std::string_view value) {
+            m_edit_stamp.bump();
+            return setBuf(m_value_buf, value);
+        }
 
         // NOTE: This does not change the underlying type, it only attempts
         // to assign the variant value as the existing type, or it returns false.
@@ -585,20 +766,19 @@ namespace Toolbox::Object {
         Result<void, SerialError> gameDeserialize(Deserializer &in) override;
 
     private:
-        Buffer m_value_buf;
-        Buffer m_min_buf;
-        Buffer m_max_buf;
+        MetaValueStorage m_value_buf;
         MetaType m_type = MetaType::UNKNOWN;
+        MetaEditStamp m_edit_stamp;
 
         union {
-            int64_t m_sint_min;
+            int64_t m_sint_min = 0;
             uint64_t m_uint_min;
             float m_float_min;
             double m_double_min;
         };
 
         union {
-            int64_t m_sint_max;
+            int64_t m_sint_max = 0;
             uint64_t m_uint_max;
             float m_float_max;
             double m_double_max;
@@ -3,6 +3,7 @@
 #include "qualname.hpp"
 #include "serial.hpp"
 #include "strutil.hpp"
+#include "symbol.hpp"
 #include <optional>
 #include <string>
 #include <string_view>
@@ -19,14 +20,21 @@ namespace Toolbox::Object {
 
         [[nodiscard]] std::string_view name() const { return m_name; }
         [[nodiscard]] u16 code() const { return m_name_hash; }
+        // Interned form of the name, for comparisons on hot paths.
+        [[nodiscard]] SymbolID nameID() const { return m_name_id; }
+
+        // Number of bytes written by serialize.
+        [[nodiscard]] size_t computeSize() const { return sizeof(u16) * 2 + m_encoded_size; }
 
         Result<void, EncodingError> setName(std::string_view name) {
             auto result = String::toGameEncoding(name);
             if (!result) {
                 return std::unexpected(result.error());
             }
-            m_name_hash = calcKeyCode(result.value());
-            m_name      = name;
+            m_name_hash    = calcKeyCode(result.value());
+            m_name         = name;
+            m_name_id      = InternSymbol(name);
+            m_encoded_size = result.value().size();
             return {};
         }
 
@@ -53,8 +61,10 @@ namespace Toolbox::Object {
                 return make_serial_error<void>(in, str_result.error().m_message[0]);
             }
 
-            m_name      = str_result.value();
-            m_name_hash = calculated_hash;
+            m_name         = str_result.value();
+            m_name_hash    = calculated_hash;
+            m_name_id      = InternSymbol(m_name);
+            m_encoded_size = encoded_name.size();
 
             if (proposed_hash != calculated_hash) {
                 TOOLBOX_WARN_V(
@@ -80,8 +90,10 @@ namespace Toolbox::Object {
         }
 
         NameRef &operator=(const NameRef &other) {
-            m_name_hash = other.m_name_hash;
-            m_name      = other.m_name;
+            m_name_hash    = other.m_name_hash;
+            m_name         = other.m_name;
+            m_name_id      = other.m_name_id;
+            m_encoded_size = other.m_encoded_size;
             return *this;
         }
 
@@ -96,6 +108,7 @@ namespace Toolbox::Object {
         }
 
         bool operator==(const std::string &other) const { return m_name == other; }
+        bool operator==(SymbolID other) const { return m_name_id == other; }
 
         bool operator==(const NameRef &other) const {
             return m_name_hash == other.m_name_hash || m_name == other.m_name;
@@ -104,8 +117,10 @@ namespace Toolbox::Object {
         bool operator!=(const NameRef &other) const { return !(*this == other); }
 
     private:
-        u16 m_name_hash    = calcKeyCode("(null)");
-        std::string m_name = "(null)";
+        u16 m_name_hash       = calcKeyCode("(null)");
+        std::string m_name    = "(null)";
+        SymbolID m_name_id    = INVALID_SYMBOL;
+        size_t m_encoded_size = 6;
     };
 
 }  // namespace Toolbox::Object
\ No newline at end of file
@@ -3,7 +3,9 @@
 #include "core/types.hpp"
 #include "nameref.hpp"
 #include "objlib/errors.hpp"
+#include "objlib/meta/layout.hpp"
 #include "objlib/meta/member.hpp"
+#include "objlib/resourcecache.hpp"
 #include "template.hpp"
 #include "transform.hpp"
 #include "unique.hpp"
@@ -15,9 +17,11 @@
 #include <boundbox.hpp>
 #include <expected>
 #include <filesystem>
+#include <span>
 #include <stacktrace>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -59,21 +63,6 @@ namespace Toolbox::Object {
         return {};
     }
 
-    using model_cache_t    = std::unordered_map<std::string, J3DModelData>;
-    using material_cache_t = std::unordered_map<std::string, J3DMaterialTable>;
-
-    struct ResourceCache {
-        model_cache_t m_model;
-        material_cache_t m_material;
-    };
-
-    namespace {
-        static ResourceCache s_resource_cache;
-    }
-
-    inline ResourceCache &getResourceCache() { return s_resource_cache; }
-    inline void clearResourceCache() { s_resource_cache = ResourceCache(); }
-
     bool IsObjectMonte(ISceneObject *object);
 
     class ObjectRenderController {
@@ -162,6 +151,26 @@ namespace Toolbox::Object {
         static void RemoveSceneRenderCache(const UUID64 &scene);
     };
 
+    // A game file held in memory, such as a mapped scene.bin. Every image
+    // gets a distinct ID so objects can tell which one they were read from.
+    struct SourceImage {
+        std::span<const char> m_data;
+        u64 m_id = 0;
+    };
+
+    [[nodiscard]] u64 NewSourceImageID();
+
+    // The bytes an object was parsed from, which a save can copy back out
+    // verbatim for as long as the object is left unedited.
+    struct SourceRange {
+        u64 m_image_id  = 0;  // 0 if the object was not read from an image
+        size_t m_offset = 0;
+        size_t m_size   = 0;
+        u64 m_epoch     = 0;  // GetMetaEditEpoch() once the object was read
+
+        [[nodiscard]] bool isValid() const { return m_image_id != 0; }
+    };
+
     // A scene object capable of performing in a rendered context and
     // holding modifiable and exotic values
     class ISceneObject : public IGameSerializable, public ISmartResource, public IUnique {
@@ -180,6 +189,9 @@ namespace Toolbox::Object {
         [[nodiscard]] virtual bool isGroupObject() const = 0;
 
         [[nodiscard]] virtual std::string type() const = 0;
+        // Interned type name; compare against InternSymbol results instead
+        // of strings on per-frame paths.
+        [[nodiscard]] virtual SymbolID typeID() const = 0;
 
         [[nodiscard]] virtual NameRef getNameRef() const = 0;
         virtual void setNameRef(NameRef name)            = 0;
@@ -195,11 +207,24 @@ namespace Toolbox::Object {
         [[nodiscard]] virtual std::span<u8> getData() const = 0;
         [[nodiscard]] virtual size_t getDataSize() const    = 0;
 
+        // Marks the cached data size of this object, and of every group
+        // containing it, as stale.
+        virtual void invalidateDataSize() = 0;
+
+        [[nodiscard]] virtual const SourceRange &getSourceRange() const = 0;
+        // Also clears any edits recorded against the previous range.
+        virtual void setSourceRange(const SourceRange &range) = 0;
+        // True if this object, and every child of it, still serializes to
+        // exactly the bytes of its source range.
+        [[nodiscard]] virtual bool isUnchangedSinceRead() const = 0;
+
         [[nodiscard]] virtual const Template &getTemplate() const      = 0;
         [[nodiscard]] virtual const std::string &getWizardName() const = 0;
 
         [[nodiscard]] virtual bool hasMember(const QualifiedName &name) const                   = 0;
         [[nodiscard]] virtual MetaStruct::GetMemberT getMember(const QualifiedName &name) const = 0;
+        // Top level member lookup by interned name, without allocating.
+        [[nodiscard]] virtual MetaStruct::GetMemberT getMember(SymbolID name) const            = 0;
         [[nodiscard]] virtual const std::vector<RefPtr<MetaMember>> &getMembers() const         = 0;
         [[nodiscard]] virtual size_t getMemberOffset(const QualifiedName &name,
                                                      int index) const                           = 0;
@@ -262,7 +287,7 @@ namespace Toolbox::Object {
         virtual bool reassignWizardBasedOnFields() = 0;
     };
 
-    class VirtualSceneObject : public ISceneObject {
+    class VirtualSceneObject : public ISceneObject, public IMetaEditListener {
     public:
         friend class ObjectFactory;
 
@@ -270,7 +295,7 @@ namespace Toolbox::Object {
 
         VirtualSceneObject(const Template &template_) : ISceneObject(), m_nameref() {
             m_template = template_;
-            m_type     = template_.type();
+            setTypeName(template_.type());
 
             auto wizard = template_.getWizard();
             if (!wizard)
@@ -283,7 +308,7 @@ namespace Toolbox::Object {
         VirtualSceneObject(const Template &template_, std::string_view wizard_name)
             : ISceneObject(), m_nameref() {
             m_template = template_;
-            m_type     = template_.type();
+            setTypeName(template_.type());
 
             auto wizard = template_.getWizard(wizard_name);
             if (!wizard) {
@@ -325,9 +350,13 @@ namespace Toolbox::Object {
         [[nodiscard]] bool isGroupObject() const override { return false; }
 
         std::string type() const override { return m_type; }
+        SymbolID typeID() const override { return m_type_id; }
 
         NameRef getNameRef() const override { return m_nameref; }
-        void setNameRef(NameRef nameref) override { m_nameref = nameref; }
+        void setNameRef(NameRef nameref) override {
+            m_nameref = nameref;
+            invalidateDataSize();
+        }
 
         [[nodiscard]] UUID64 getUUID() const override { return m_UUID64; }
 
@@ -342,11 +371,30 @@ namespace Toolbox::Object {
         std::span<u8> getData() const override;
         size_t getDataSize() const override;
 
+        void invalidateDataSize() override { onMetaEdited(); }
+
+        // Member values bound by getDataSize report their edits here.
+        void onMetaEdited() const override {
+            m_data_size_dirty = true;
+            m_source_dirty    = true;
+            if (m_parent) {
+                m_parent->invalidateDataSize();
+            }
+        }
+
+        const SourceRange &getSourceRange() const override { return m_source; }
+        void setSourceRange(const SourceRange &range) override {
+            m_source       = range;
+            m_source_dirty = false;
+        }
+        bool isUnchangedSinceRead() const override;
+
         const Template &getTemplate() const override { return m_template; }
         const std::string &getWizardName() const override { return m_wizard; }
 
         bool hasMember(const QualifiedName &name) const override;
         MetaStruct::GetMemberT getMember(const QualifiedName &name) const override;
+        MetaStruct::GetMemberT getMember(SymbolID name) const override;
         const std::vector<RefPtr<MetaMember>> &getMembers() const override { return m_members; }
         size_t getMemberOffset(const QualifiedName &name, int index) const override;
         size_t getMemberSize(const QualifiedName &name, int index) const override;
@@ -448,6 +496,7 @@ namespace Toolbox::Object {
         ScopePtr<ISmartResource> clone(bool deep) const override {
             auto obj       = make_scoped<VirtualSceneObject>();
             obj->m_type    = m_type;
+            obj->m_type_id = m_type_id;
             obj->m_nameref = m_nameref;
             obj->m_parent  = nullptr;
             obj->m_members.reserve(m_members.size());
@@ -468,16 +517,50 @@ namespace Toolbox::Object {
         }
 
     protected:
+        void setTypeName(std::string_view type) {
+            m_type    = type;
+            m_type_id = InternSymbol(type);
+        }
+
         UUID64 m_UUID64;
         u32 m_sibling_id = 0;
 
         std::string m_type;
+        SymbolID m_type_id = INVALID_SYMBOL;
         NameRef m_nameref;
         std::vector<RefPtr<MetaMember>> m_members;
         mutable std::vector<u8> m_data;
         ISceneObject *m_parent = nullptr;
 
-        mutable MetaStruct::CacheMemberT m_member_cache;
+        // Cached result of getDataSize, valid until invalidated. Computing it
+        // binds every member value to m_edit_binding, so a later edit marks
+        // this object, and each group above it, stale (see onMetaEdited).
+        mutable size_t m_data_size     = 0;
+        mutable bool m_data_size_dirty = true;
+        mutable MetaEditBinding m_edit_binding;
+
+        // A copy starts unbound, and must bind the members it holds itself.
+        [[nodiscard]] bool isDataSizeCached() const {
+            return !m_data_size_dirty && m_edit_binding.isBound();
+        }
+
+        size_t cacheDataSize(size_t size) const {
+            m_data_size       = size;
+            m_data_size_dirty = false;
+            return size;
+        }
+
+        // Bound member values set this when edited. Their edit stamps cover
+        // edits made before getDataSize first bound them.
+        SourceRange m_source;
+        mutable bool m_source_dirty = true;
+
+        // Shared per wizard, swapped for a private one if our members diverge
+        [[nodiscard]] const MemberLayout &memberLayout() const;
+        // Offset of the first member within getData()
+        [[nodiscard]] virtual size_t getMemberDataOffset() const;
+
+        mutable RefPtr<const MemberLayout> m_member_layout;
 
         u32 m_game_ptr = 0;
 
@@ -563,9 +646,21 @@ namespace Toolbox::Object {
         Result<void, SerialError> gameSerialize(Serializer &out) const override;
         Result<void, SerialError> gameDeserialize(Deserializer &in) override;
 
+        // Like gameSerialize, but subtrees left unchanged since they were read
+        // from `source` are copied from it instead of serialized. Each object
+        // written is appended to `written_ranges` with where it now lies in
+        // `out`, for the caller to adopt once the output is in place.
+        Result<void, SerialError>
+        gameSerializeSpliced(Serializer &out, const SourceImage &source,
+                             std::vector<std::pair<ISceneObject *, SourceRange>> &written_ranges,
+                             u64 written_id);
+
+        bool isUnchangedSinceRead() const override;
+
         ScopePtr<ISmartResource> clone(bool deep) const override {
             auto obj       = make_scoped<GroupSceneObject>();
             obj->m_type    = m_type;
+            obj->m_type_id = m_type_id;
             obj->m_nameref = m_nameref;
             obj->m_parent  = nullptr;
             obj->m_members.reserve(m_members.size());
@@ -597,9 +692,21 @@ namespace Toolbox::Object {
         [[nodiscard]] RefPtr<MetaMember> getGroupSizeM() const { return m_group_size; }
 
     protected:
+        size_t getMemberDataOffset() const override;
+
         void setGroupSize(size_t size);
         void updateGroupSize();
 
+        // Parses the group from `in`, which must read from `image`. While
+        // `fan_out_depth` is nonzero, the children are parsed in parallel on
+        // the shared worker pool and stitched back in order.
+        Result<void, SerialError> gameDeserializeFanOut(Deserializer &in,
+                                                        const SourceImage &image,
+                                                        size_t fan_out_depth);
+
+        // Everything between the size marker and the first child
+        Result<void, SerialError> gameSerializeHeader(Serializer &out) const;
+
     private:
         RefPtr<MetaMember> m_group_size;
         mutable std::vector<u8> m_data;
@@ -607,7 +714,7 @@ namespace Toolbox::Object {
         bool m_is_performing                         = true;
     };
 
-    class PhysicalSceneObject : public ISceneObject {
+    class PhysicalSceneObject : public ISceneObject, public IMetaEditListener {
     public:
         friend class ObjectFactory;
 
@@ -669,9 +776,13 @@ namespace Toolbox::Object {
         [[nodiscard]] bool isGroupObject() const override { return false; }
 
         std::string type() const override { return std::string(m_type.name()); }
+        SymbolID typeID() const override { return m_type.nameID(); }
 
         NameRef getNameRef() const override { return m_nameref; }
-        void setNameRef(NameRef nameref) override { m_nameref = nameref; }
+        void setNameRef(NameRef nameref) override {
+            m_nameref = nameref;
+            invalidateDataSize();
+        }
 
         [[nodiscard]] UUID64 getUUID() const override { return m_UUID64; }
 
@@ -686,11 +797,30 @@ namespace Toolbox::Object {
         std::span<u8> getData() const override;
         size_t getDataSize() const override;
 
+        void invalidateDataSize() override { onMetaEdited(); }
+
+        // Member values bound by getDataSize report their edits here.
+        void onMetaEdited() const override {
+            m_data_size_dirty = true;
+            m_source_dirty    = true;
+            if (m_parent) {
+                m_parent->invalidateDataSize();
+            }
+        }
+
+        const SourceRange &getSourceRange() const override { return m_source; }
+        void setSourceRange(const SourceRange &range) override {
+            m_source       = range;
+            m_source_dirty = false;
+        }
+        bool isUnchangedSinceRead() const override;
+
         const Template &getTemplate() const override { return m_template; }
         const std::string &getWizardName() const override { return m_wizard; }
 
         bool hasMember(const QualifiedName &name) const override;
         MetaStruct::GetMemberT getMember(const QualifiedName &name) const override;
+        MetaStruct::GetMemberT getMember(SymbolID name) const override;
         const std::vector<RefPtr<MetaMember>> &getMembers() const override { return m_members; }
         size_t getMemberOffset(const QualifiedName &name, int index) const override;
         size_t getMemberSize(const QualifiedName &name, int index) const override;
@@ -758,7 +888,9 @@ namespace Toolbox::Object {
                 return {};
             }
 
-            auto transform_value_ptr = getMember("Transform").value();
+            static const SymbolID s_transform_id = InternSymbol("Transform");
+
+            auto transform_value_ptr = getMember(s_transform_id).value();
             if (transform_value_ptr) {
                 auto result = setMetaValue<Transform>(transform_value_ptr, 0, transform);
                 if (!result) {
@@ -869,11 +1001,36 @@ namespace Toolbox::Object {
         mutable std::vector<u8> m_data;
         ISceneObject *m_parent = nullptr;
 
-        mutable MetaStruct::CacheMemberT m_member_cache;
+        // Cached result of getDataSize, see VirtualSceneObject
+        mutable size_t m_data_size     = 0;
+        mutable bool m_data_size_dirty = true;
+        mutable MetaEditBinding m_edit_binding;
+
+        [[nodiscard]] bool isDataSizeCached() const {
+            return !m_data_size_dirty && m_edit_binding.isBound();
+        }
+
+        size_t cacheDataSize(size_t size) const {
+            m_data_size       = size;
+            m_data_size_dirty = false;
+            return size;
+        }
+
+        // See VirtualSceneObject
+        SourceRange m_source;
+        mutable bool m_source_dirty = true;
+
+        [[nodiscard]] const MemberLayout &memberLayout() const;
+
+        mutable RefPtr<const MemberLayout> m_member_layout;
 
         std::optional<Transform> m_transform;
         RefPtr<J3DModelData> m_model_data;
 
+        // Shared model data still being parsed; the object draws nothing
+        // until performScene finds it ready and finishes the render setup.
+        ResourceCache::ModelRequest m_pending_model;
+
         bool m_is_performing = true;
 
         u32 m_game_ptr = 0;
@@ -900,11 +1057,25 @@ namespace Toolbox::Object {
                                std::optional<UUID64> obj_uuid = std::nullopt);
         static create_t create(project_io_tag, Deserializer &in, bool include_custom,
                                std::optional<UUID64> obj_uuid = std::nullopt);
+        // Parses the object at `offset` of a contiguous game image such as a
+        // mapped scene.bin, fanning groups out to worker threads down to
+        // `fan_out_depth` levels. Render data is not loaded here, as this may
+        // run off the render thread; pass the finished hierarchy to
+        // loadDeferredRenderData() to load it. Every object parsed records its
+        // SourceRange within the image.
+        static create_t create(game_io_tag, const SourceImage &image, size_t offset,
+                               std::string_view file_path, bool include_custom,
+                               size_t fan_out_depth);
+        // Loads the render data create() skipped for `root` and every object
+        // below it, in file order. Objects were already synced when parsed.
+        static void loadDeferredRenderData(RefPtr<ISceneObject> root);
         static create_ret_t create(const Template &template_, std::string_view wizard_name,
                                    const fs_path &resource_path,
                                    std::optional<UUID64> obj_uuid = std::nullopt);
 
     protected:
+        friend class GroupSceneObject;
+
         static bool isGroupObject(std::string_view type);
         static bool isGroupObject(Deserializer &in);
         static bool isPhysicalObject(std::string_view type);
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <J3D/Data/J3DModelData.hpp>
+#include <J3D/Material/J3DMaterialTable.hpp>
+#include <J3D/Texture/J3DTextureLoader.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "core/memory.hpp"
+#include "fsystem.hpp"
+
+namespace Toolbox::Object {
+
+    class ResourceCache;
+
+    // Held by every open scene. The cache drops its entries once the last
+    // lease is released, so closing all scenes frees the parsed data while
+    // scenes that are open together keep sharing it.
+    class ResourceCacheLease {
+    public:
+        ResourceCacheLease() = default;
+        ResourceCacheLease(const ResourceCacheLease &) = delete;
+        ResourceCacheLease(ResourceCacheLease &&other) noexcept
+            : m_cache(std::exchange(other.m_cache, nullptr)) {}
+        ~ResourceCacheLease() { release(); }
+
+        ResourceCacheLease &operator=(const ResourceCacheLease &) = delete;
+        ResourceCacheLease &operator=(ResourceCacheLease &&other) noexcept {
+            if (this != &other) {
+                release();
+                m_cache = std::exchange(other.m_cache, nullptr);
+            }
+            return *this;
+        }
+
+        [[nodiscard]] bool valid() const { return m_cache != nullptr; }
+        [[nodiscard]] ResourceCache &operator*() const { return *m_cache; }
+        [[nodiscard]] ResourceCache *operator->() const { return m_cache; }
+
+        void release();
+
+    private:
+        friend class ResourceCache;
+
+        explicit ResourceCacheLease(ResourceCache *cache) : m_cache(cache) {}
+
+        ResourceCache *m_cache = nullptr;
+    };
+
+    // Parsed J3D resources shared between scene objects.
+    //
+    // Entries are keyed by resolved path and modification time, so a file
+    // edited on disk is parsed again on its next request. Cached data is
+    // handed out as-is to every requester and must be treated as immutable;
+    // objects that recolor materials or swap textures load their own copy.
+    //
+    // The J3D loaders may create GL objects, so they only ever run on the
+    // calling thread, which must be the render thread. The worker pool just
+    // reads model files into memory ahead of them.
+    class ResourceCache {
+    public:
+        using source_t        = RefPtr<std::vector<u8>>;
+        using source_future_t = std::shared_future<source_t>;
+
+        // A model whose file is being read on the worker pool, or that was
+        // already parsed when it was requested.
+        struct ModelRequest {
+            std::string m_key;
+            source_future_t m_source;
+            RefPtr<J3DModelData> m_model;
+
+            [[nodiscard]] bool valid() const { return m_model || m_source.valid(); }
+            [[nodiscard]] bool ready() const {
+                return m_model ||
+                       (m_source.valid() &&
+                        m_source.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+            }
+        };
+
+        ResourceCache();
+        ResourceCache(const ResourceCache &) = delete;
+        ResourceCache(ResourceCache &&)      = delete;
+        ~ResourceCache();
+
+        ResourceCache &operator=(const ResourceCache &) = delete;
+        ResourceCache &operator=(ResourceCache &&)      = delete;
+
+        // Queues the model file for reading on the worker pool. Once the
+        // request is ready, loadModel() parses it.
+        [[nodiscard]] ModelRequest requestModel(const fs_path &path);
+
+        // Returns the model the request carries or the cache holds, or
+        // parses it from the request's source. The request keeps its source
+        // alive, so a clear() in between only costs a parse. Yields nullptr
+        // if the file is missing.
+        [[nodiscard]] RefPtr<J3DModelData> loadModel(const ModelRequest &request);
+
+        [[nodiscard]] RefPtr<J3DMaterialTable> loadMaterialTable(const fs_path &path,
+                                                                 RefPtr<J3DModelData> model_data);
+        [[nodiscard]] RefPtr<J3DTexture> loadTexture(const fs_path &path, std::string_view name);
+
+        // Drops every entry. Objects keep whatever data they already hold,
+        // and loads in flight still complete for their requesters.
+        void clear();
+
+        [[nodiscard]] ResourceCacheLease lease();
+
+    protected:
+        friend class ResourceCacheLease;
+
+        [[nodiscard]] static std::string makeKey(const fs_path &path);
+
+        void releaseLease();
+        // Expects m_cache_mutex to be held
+        void clearEntries();
+
+        void enqueue(std::function<void()> job);
+        void workerRun(std::stop_token stop);
+
+    private:
+        std::mutex m_cache_mutex;
+        std::unordered_map<std::string, source_future_t> m_sources;
+        std::unordered_map<std::string, RefPtr<J3DModelData>> m_models;
+        std::unordered_map<std::string, RefPtr<J3DMaterialTable>> m_materials;
+        std::unordered_map<std::string, RefPtr<J3DTexture>> m_textures;
+        size_t m_lease_count = 0;
+
+        std::mutex m_queue_mutex;
+        std::condition_variable_any m_queue_cv;
+        std::deque<std::function<void()>> m_queue;
+        std::vector<std::jthread> m_workers;
+    };
+
+    [[nodiscard]] ResourceCache &getResourceCache();
+
+}  // namespace Toolbox::Object
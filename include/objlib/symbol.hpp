@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string_view>
+
+#include "core/types.hpp"
+
+namespace Toolbox::Object {
+
+    // Process wide table of interned names. Interned strings are never
+    // released, so an ID and the view returned by GetSymbolName stay valid
+    // for the lifetime of the program.
+    using SymbolID = u32;
+
+    constexpr SymbolID INVALID_SYMBOL = 0;
+
+    [[nodiscard]] SymbolID InternSymbol(std::string_view name);
+
+    // Looks up a name without interning it (and without allocating).
+    // Returns INVALID_SYMBOL if the name was never interned.
+    [[nodiscard]] SymbolID FindSymbol(std::string_view name);
+
+    [[nodiscard]] std::string_view GetSymbolName(SymbolID id);
+
+}  // namespace Toolbox::Object
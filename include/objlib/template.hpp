@@ -61,6 +61,7 @@ namespace Toolbox::Object {
     class Template : public ISerializable {
     public:
         friend class TemplateFactory;
+        friend class TemplateImage;
 
         using json_t = nlohmann::ordered_json;
 
@@ -142,8 +143,6 @@ namespace Toolbox::Object {
         Result<void, JSONError> loadWizards(const json_t &wizards, const json_t &render_infos);
 
         static void threadLoadTemplate(const std::string &type, bool is_custom);
-        static void threadLoadTemplateBlob(const std::string &type, const json_t &the_json,
-                                           bool is_custom);
 
     private:
         std::string m_type;
@@ -167,9 +166,6 @@ namespace Toolbox::Object {
 
         static ScopePtr<TemplateRenderInfo> findRenderInfo(const std::string &obj_field);
 
-        static Result<void, FSError> loadFromCacheBlob(bool is_custom);
-        static Result<void, FSError> saveToCacheBlob(bool is_custom);
-
         static bool isCacheMode();
         static void setCacheMode(bool mode);
     };
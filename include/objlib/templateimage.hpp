@@ -0,0 +1,110 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/error.hpp"
+#include "core/memory.hpp"
+#include "core/types.hpp"
+#include "fsystem.hpp"
+#include "objlib/template.hpp"
+#include "platform/mappedfile.hpp"
+#include "serial.hpp"
+
+namespace Toolbox::Object {
+
+    // Every object template compiled into one binary file. Startup maps it
+    // instead of parsing hundreds of JSON documents; the image is read in
+    // place, and a Template is only decoded the first time its type is
+    // requested.
+    //
+    // The image holds nothing but offsets relative to its start: a header,
+    // the entry table sorted by (custom, type), the string table, and the
+    // encoded templates. Values are stored in host byte order, as the image
+    // is a local cache that is rebuilt whenever it does not validate.
+    class TemplateImage {
+    public:
+        static constexpr u32 MAGIC   = 0x49544254;  // "TBTI"
+        static constexpr u32 VERSION = 1;
+
+        struct Header {
+            u32 m_magic;
+            u32 m_version;
+            u32 m_entry_count;
+            u32 m_strings_size;
+        };
+
+        struct Entry {
+            // Identity of the JSON file the template was compiled from
+            u64 m_source_hash;
+            s64 m_source_mtime;
+            u64 m_source_size;
+
+            u32 m_type_offset;  // Into the string table
+            u32 m_type_size;
+            u32 m_data_offset;  // From the start of the image
+            u32 m_data_size;
+            u8 m_is_custom;
+            u8 m_padding[7];
+        };
+
+        static_assert(sizeof(Header) == 16);
+        static_assert(sizeof(Entry) == 48);
+
+        // A template JSON file as found on disk
+        struct Source {
+            std::string m_type;
+            fs_path m_path;
+            bool m_is_custom;
+            u64 m_size;
+            s64 m_mtime;
+        };
+
+        TemplateImage()                      = default;
+        TemplateImage(const TemplateImage &) = delete;
+        TemplateImage(TemplateImage &&)      = delete;
+
+        TemplateImage &operator=(const TemplateImage &) = delete;
+        TemplateImage &operator=(TemplateImage &&)      = delete;
+
+        [[nodiscard]] static Result<RefPtr<TemplateImage>, FSError> Open(const fs_path &path);
+
+        // Compiles `sources` into a new image at `path`. Templates whose JSON
+        // is unchanged since `previous` was built are copied from it, and the
+        // rest are parsed in parallel. `previous` is released before the file
+        // is replaced, as a mapped file cannot be replaced on every platform.
+        [[nodiscard]] static Result<void, FSError> Build(const fs_path &path,
+                                                         std::span<const Source> sources,
+                                                         RefPtr<TemplateImage> previous);
+
+        // Lists the template JSON files under `directory`.
+        static void CollectSources(const fs_path &directory, bool is_custom,
+                                   std::vector<Source> &out);
+
+        // True if every source matches an entry by size and modification
+        // time, and the image holds nothing else.
+        [[nodiscard]] bool isUpToDate(std::span<const Source> sources) const;
+
+        [[nodiscard]] std::span<const Entry> entries() const { return m_entries; }
+        [[nodiscard]] std::string_view type(const Entry &entry) const;
+        [[nodiscard]] const Entry *find(std::string_view type, bool is_custom) const;
+
+        [[nodiscard]] Result<Template, SerialError> load(const Entry &entry) const;
+
+    protected:
+        [[nodiscard]] static Result<void, SerialError> EncodeTemplate(const Template &template_,
+                                                                      Serializer &out);
+        [[nodiscard]] static Result<Template, SerialError>
+        DecodeTemplate(std::string_view type, std::span<const char> data);
+
+        [[nodiscard]] const Entry *findSource(const Source &source) const;
+
+    private:
+        RefPtr<Platform::MappedFile> m_file;
+        std::span<const Entry> m_entries;
+        std::span<const char> m_strings;
+    };
+
+}  // namespace Toolbox::Object
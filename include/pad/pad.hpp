@@ -1,6 +1,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <functional>
 #include <iostream>
 #include <string>
@@ -40,8 +41,20 @@ namespace Toolbox {
         TRIM_BOTH,
     };
 
+    // The inputs held on a single frame. Inputs past the end of their
+    // recorded chunks read as neutral.
+    struct PadFrameInputs {
+        f32 m_analog_magnitude = 0.0f;
+        s16 m_analog_direction = 0;
+        PadButtons m_buttons   = PadButtons::BUTTON_NONE;
+        u8 m_trigger_l         = 0;
+        u8 m_trigger_r         = 0;
+    };
+
     class PadData : public ISerializable {
     public:
+        class Cursor;
+
         PadData()                = default;
         PadData(const PadData &) = default;
         PadData(PadData &&)      = default;
@@ -89,6 +102,11 @@ namespace Toolbox {
         u32 getPadTriggerRStartFrame(size_t index) const;
         size_t getPadTriggerRIndex(u32 start_frame) const;
 
+        // Decodes every input held on `frame`
+        PadFrameInputs sampleFrame(u32 frame) const;
+
+        Cursor cursor(u32 frame = 0) const;
+
         // These add a chunk of data to the info list
         size_t addPadAnalogMagnitudeInput(u32 start_frame, u32 frames_held, float magnitude);
 
@@ -176,6 +194,21 @@ namespace Toolbox {
         }
 
     private:
+        enum PadChannel : size_t {
+            CHANNEL_ANALOG_MAGNITUDE,
+            CHANNEL_ANALOG_DIRECTION,
+            CHANNEL_BUTTONS,
+            CHANNEL_TRIGGER_L,
+            CHANNEL_TRIGGER_R,
+            CHANNEL_COUNT,
+        };
+
+        // The frame each chunk of a channel ends on (exclusive). Every edit
+        // updates it before returning, so reading it never writes.
+        const std::vector<u32> &getFrameEnds(PadChannel channel) const;
+        void rebuildFrameIndex();
+        void extendFrameIndex(PadChannel channel, u32 frames_held);
+
         std::string m_metatag = "MARIO RECORDv0.2";
 
         u32 m_frame_count                                   = 0;
@@ -184,6 +217,29 @@ namespace Toolbox {
         std::vector<PadInputInfo<PadButtons>> m_buttons     = {};
         std::vector<PadInputInfo<u8>> m_trigger_l           = {};
         std::vector<PadInputInfo<u8>> m_trigger_r           = {};
+
+        std::array<std::vector<u32>, CHANNEL_COUNT> m_frame_ends = {};
+        u64 m_generation                                           = 0;
+    };
+
+    // Steps through the inputs a frame at a time. Moving forward walks past
+    // the chunks in between, so playing a recording through is linear; a
+    // backward seek, or an edit to the data, falls back to a binary search.
+    class PadData::Cursor {
+    public:
+        Cursor() = default;
+
+        void seek(const PadData &data, u32 frame);
+        void next(const PadData &data) { seek(data, m_frame + 1); }
+
+        [[nodiscard]] u32 frame() const noexcept { return m_frame; }
+        [[nodiscard]] PadFrameInputs inputs(const PadData &data) const;
+
+    private:
+        const PadData *m_data = nullptr;
+        u64 m_generation      = 0;
+        u32 m_frame           = 0;
+        std::array<size_t, PadData::CHANNEL_COUNT> m_indices = {};
     };
 
 }  // namespace Toolbox
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <span>
+
+#include "core/core.hpp"
+#include "core/error.hpp"
+#include "core/memory.hpp"
+#include "fsystem.hpp"
+
+namespace Toolbox::Platform {
+
+    // Read-only view of a whole file mapped into the address space. Pages are
+    // faulted in on access, so large archives can be opened without reading
+    // them up front.
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile &) = delete;
+        MappedFile(MappedFile &&)      = delete;
+        ~MappedFile();
+
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile &operator=(MappedFile &&)      = delete;
+
+        static Result<RefPtr<MappedFile>, FSError> Open(const fs_path &path);
+
+        [[nodiscard]] const char *data() const { return static_cast<const char *>(m_data); }
+        [[nodiscard]] size_t size() const { return m_size; }
+        [[nodiscard]] std::span<const char> span() const { return {data(), m_size}; }
+
+    private:
+        void *m_data  = nullptr;
+        size_t m_size = 0;
+
+#ifdef TOOLBOX_PLATFORM_WINDOWS
+        void *m_mapping = nullptr;
+#endif
+    };
+
+}  // namespace Toolbox::Platform
@@ -5,11 +5,13 @@
 #include "fsystem.hpp"
 #include "serial.hpp"
 #include "smart_resource.hpp"
+#include <algorithm>
 #include <array>
 #include <expected>
 #include <filesystem>
 #include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Toolbox::RARC {
@@ -48,6 +50,52 @@ namespace Toolbox::RARC {
         std::vector<Node> nodes;
     };
 
+    // Contents of a file node. Nodes loaded from an archive view a buffer
+    // shared with the rest of the archive (the mapped file, or its decoded
+    // Yaz0 payload) and only take a private copy once they are modified.
+    class NodeData {
+    public:
+        using const_iterator = const char *;
+
+        NodeData() = default;
+        NodeData(std::vector<char> data) : m_owned(std::move(data)) {}
+        NodeData(RefPtr<const void> backing, std::span<const char> view)
+            : m_backing(std::move(backing)), m_view(view) {}
+
+        [[nodiscard]] bool isView() const { return m_backing != nullptr; }
+
+        [[nodiscard]] const char *data() const { return isView() ? m_view.data() : m_owned.data(); }
+        [[nodiscard]] size_t size() const { return isView() ? m_view.size() : m_owned.size(); }
+        [[nodiscard]] bool empty() const { return size() == 0; }
+
+        [[nodiscard]] const_iterator begin() const { return data(); }
+        [[nodiscard]] const_iterator end() const { return data() + size(); }
+
+        [[nodiscard]] std::span<const char> span() const { return {data(), size()}; }
+
+        // Detaches from the shared buffer, copying the viewed bytes if needed.
+        std::vector<char> &materialize() {
+            if (isView()) {
+                m_owned.assign(m_view.begin(), m_view.end());
+                m_view = {};
+                m_backing.reset();
+            }
+            return m_owned;
+        }
+
+        bool operator==(const NodeData &rhs) const {
+            if (data() == rhs.data() && size() == rhs.size()) {
+                return true;
+            }
+            return std::ranges::equal(span(), rhs.span());
+        }
+
+    private:
+        RefPtr<const void> m_backing;
+        std::span<const char> m_view;
+        std::vector<char> m_owned;
+    };
+
     class ResourceArchive : public ISerializable, public ISmartResource {
     public:
         static constexpr size_t MAX_DIR_SIZE =
@@ -67,7 +115,7 @@ namespace Toolbox::RARC {
             std::string name;
 
             FolderInfo folder;
-            std::vector<char> data;
+            NodeData data;
 
             bool is_folder() const { return (flags & DIRECTORY) != 0; }
 
@@ -80,7 +128,9 @@ namespace Toolbox::RARC {
     public:
         explicit ResourceArchive(std::string_view name) : m_name(name) {}
         ResourceArchive(std::string_view name, std::vector<Node> nodes)
-            : m_name(name), m_nodes(nodes) {}
+            : m_name(name), m_nodes(nodes) {
+            rebuildIndex();
+        }
         ~ResourceArchive() = default;
 
     protected:
@@ -92,11 +142,16 @@ namespace Toolbox::RARC {
 
         static Result<ResourceArchive, FSError> CreateFromPath(const fs_path &root);
 
+        // Opens a .arc or .szs file without copying its contents. File nodes
+        // view the mapped file (or the decoded Yaz0 payload) until edited.
+        static Result<ResourceArchive, BaseError> CreateFromArchive(const fs_path &archive_path);
+
     public:
         [[nodiscard]] bool isMatchingOutput() const { return m_keep_matching; }
         void setMatchingOutput(bool matching) { m_keep_matching = matching; }
 
         [[nodiscard]] std::string_view name() const { return m_name; }
+        // Call reindex() after restructuring or renaming nodes through this.
         [[nodiscard]] std::vector<Node> &getNodes() { return m_nodes; }
         [[nodiscard]] const std::vector<Node> &getNodes() const { return m_nodes; }
 
@@ -105,6 +160,10 @@ namespace Toolbox::RARC {
         [[nodiscard]] const_node_it begin() const { return m_nodes.begin(); }
         [[nodiscard]] const_node_it end() const { return m_nodes.end(); }
 
+        void reindex() { rebuildIndex(); }
+
+        // Lookups are answered from an index of names, IDs and full paths,
+        // which every structural edit of the archive keeps in sync.
         [[nodiscard]] node_it findNode(std::string_view name);
         [[nodiscard]] const_node_it findNode(std::string_view name) const;
         [[nodiscard]] node_it findNode(s32 id);
@@ -138,12 +197,46 @@ namespace Toolbox::RARC {
     protected:
         Result<void> recalculateIDs();
 
+        Result<void, SerialError> deserializeFrom(Deserializer &in, std::span<const char> image,
+                                                  RefPtr<const void> backing);
+
+        // First node in order that carries a key, and how many nodes carry it
+        struct IndexEntry {
+            size_t first;
+            size_t count;
+        };
+
+        // Keys of a run of nodes, taken before the run is erased or replaced
+        struct IndexKeys {
+            std::vector<std::string> paths;
+            std::vector<std::string> names;
+            std::vector<s32> ids;
+        };
+
+        void rebuildIndex();
+        void rebuildIdIndex();
+
+        // Edits update the index in place: the keys of the nodes that made up
+        // [first, old_last) are dropped, later nodes are shifted to their new
+        // positions, and the nodes now in [first, new_last) are added.
+        IndexKeys collectIndexKeys(size_t first, size_t last) const;
+        void spliceIndex(size_t first, const IndexKeys &removed, size_t old_last,
+                         size_t new_last);
+
+        node_it toMutableIt(const_node_it it) {
+            return m_nodes.begin() + std::distance(m_nodes.cbegin(), it);
+        }
+
     private:
         std::string m_name        = "(null)";
         std::vector<Node> m_nodes = {};
 
         bool m_ids_synced    = true;
         bool m_keep_matching = true;
+
+        std::unordered_map<std::string, IndexEntry> m_path_index;
+        std::unordered_map<std::string, IndexEntry> m_name_index;
+        std::unordered_map<s32, IndexEntry> m_id_index;
     };
 
     struct ResourceArchiveNodeHasher {
@@ -9,6 +9,7 @@
 
 #include "bmg/bmg.hpp"
 #include "objlib/object.hpp"
+#include "platform/mappedfile.hpp"
 #include "rail/rail.hpp"
 #include "raildata.hpp"
 #include "smart_resource.hpp"
@@ -56,6 +57,24 @@ namespace Toolbox::Scene {
         ScopePtr<ISmartResource> clone(bool deep) const override;
 
     private:
+        // An object file as it was last read or written. Saves copy the
+        // objects left unedited since straight out of it.
+        struct ObjectFileSource {
+            RefPtr<Platform::MappedFile> m_file;
+            u64 m_image_id = 0;
+
+            [[nodiscard]] Object::SourceImage image() const {
+                if (!m_file) {
+                    return {};
+                }
+                return {m_file->span(), m_image_id};
+            }
+        };
+
+        static Result<void, SerialError> saveObjectFile(const fs_path &path,
+                                                        const ObjectHierarchy &hierarchy,
+                                                        ObjectFileSource &source);
+
         std::optional<fs_path> m_root_path = {};
 
         RefPtr<ObjectHierarchy> m_map_objects;
@@ -63,6 +82,9 @@ namespace Toolbox::Scene {
         RefPtr<RailData> m_rail_info;
         
         RefPtr<BMG::MessageData> m_message_data;
+
+        ObjectFileSource m_map_source;
+        ObjectFileSource m_table_source;
     };
 
 }  // namespace Toolbox
\ No newline at end of file
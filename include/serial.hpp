@@ -2,7 +2,9 @@
 
 #include "core/error.hpp"
 #include "core/memory.hpp"
+#include "core/simd.hpp"
 #include "core/types.hpp"
+#include "serialbuf.hpp"
 #include <bit>
 #include <expected>
 #include <format>
@@ -49,6 +51,9 @@ namespace Toolbox {
         Serializer(std::streambuf *out) : m_out(out) {}
         Serializer(std::streambuf *out, std::string_view file_path)
             : m_out(out), m_file_path(file_path) {}
+        Serializer(GrowableStreamBuf *out) : m_out(out), m_growable_buf(out) {}
+        Serializer(GrowableStreamBuf *out, std::string_view file_path)
+            : m_out(out), m_growable_buf(out), m_file_path(file_path) {}
         Serializer(const Serializer &) = default;
         Serializer(Serializer &&)      = default;
 
@@ -64,8 +69,8 @@ namespace Toolbox {
 
                 Result<void, SerialError> result;
 
-                std::stringstream strstream;
-                Serializer sout(strstream.rdbuf());
+                GrowableStreamBuf outbuf;
+                Serializer sout(&outbuf);
 
                 // Write padding bytes
                 for (size_t i = 0; i < offset; ++i) {
@@ -86,7 +91,7 @@ namespace Toolbox {
                 size_t objsize = static_cast<size_t>(endpos - startpos);
 
                 buf_out.resize((uint32_t)objsize);
-                strstream.read(buf_out.buf<char>(), objsize);
+                std::memcpy(buf_out.buf<char>(), outbuf.data().data(), objsize);
 
                 return result;
             } else if constexpr (std::is_standard_layout_v<_S>) {
@@ -154,10 +159,39 @@ namespace Toolbox {
         }
 
         Serializer &writeBytes(std::span<const char> bytes) {
+            if (m_growable_buf) {
+                if (!m_out.good()) {
+                    m_out.setstate(std::ios::failbit);
+                    return *this;
+                }
+                m_growable_buf->write(bytes.data(), bytes.size());
+                return *this;
+            }
             m_out.write(bytes.data(), bytes.size());
             return *this;
         }
 
+        // Writes `values` in one pass, swapping them in batches when the
+        // requested byte order is not native.
+        template <typename T, std::endian E = std::endian::native>
+        Serializer &writeArray(std::span<const T> values) {
+            static_assert(std::is_arithmetic_v<T>, "writeArray requires an arithmetic type");
+            if constexpr (E == std::endian::native || sizeof(T) == 1) {
+                writeBytes(std::span(reinterpret_cast<const char *>(values.data()),
+                                     values.size_bytes()));
+            } else {
+                constexpr size_t batch_size = 256;
+                T batch[batch_size];
+                for (size_t i = 0; i < values.size(); i += batch_size) {
+                    const size_t count = std::min(batch_size, values.size() - i);
+                    std::memcpy(batch, values.data() + i, count * sizeof(T));
+                    SIMD::ByteSwapArray(batch, count);
+                    writeBytes(std::span(reinterpret_cast<const char *>(batch), count * sizeof(T)));
+                }
+            }
+            return *this;
+        }
+
         Serializer &padTo(std::size_t alignment, std::span<const char> fill) {
             std::size_t pos = tell();
             std::size_t pad = (alignment - (pos % alignment));
@@ -190,9 +224,18 @@ namespace Toolbox {
 
         Serializer &seek(std::streampos pos) { return seek(pos, std::ios::cur); }
 
-        std::streampos tell() { return m_out.tellp(); }
+        std::streampos tell() {
+            if (m_growable_buf) {
+                return m_out.fail() ? std::streampos(-1)
+                                    : std::streampos(m_growable_buf->tell());
+            }
+            return m_out.tellp();
+        }
 
         size_t size() {
+            if (m_growable_buf) {
+                return m_growable_buf->size();
+            }
             auto pos = tell();
             seek(0, std::ios::end);
             auto size = static_cast<size_t>(tell());
@@ -210,6 +253,7 @@ namespace Toolbox {
 
     private:
         std::ostream m_out;
+        GrowableStreamBuf *m_growable_buf = nullptr;
         std::stack<std::streampos> m_breakpoints;
         std::string m_file_path = "[unknown path]";
     };
@@ -226,6 +270,19 @@ namespace Toolbox {
         Deserializer(std::streambuf *in) : m_in(in) {}
         Deserializer(std::streambuf *in, std::string_view file_path)
             : m_in(in), m_file_path(file_path) {}
+        Deserializer(SpanStreamBuf *in) : m_in(in), m_span_buf(in) {}
+        Deserializer(SpanStreamBuf *in, std::string_view file_path)
+            : m_in(in), m_span_buf(in), m_file_path(file_path) {}
+
+        // Reads directly from `data`, which must outlive the Deserializer
+        explicit Deserializer(std::span<const char> data,
+                              std::string_view file_path = "[unknown path]")
+            : m_owned_buf(make_scoped<SpanStreamBuf>(data)), m_in(m_owned_buf.get()),
+              m_span_buf(m_owned_buf.get()), m_file_path(file_path) {}
+        explicit Deserializer(std::span<const u8> data,
+                              std::string_view file_path = "[unknown path]")
+            : Deserializer(std::span(reinterpret_cast<const char *>(data.data()), data.size()),
+                           file_path) {}
         Deserializer(const Deserializer &) = default;
         Deserializer(Deserializer &&)      = default;
 
@@ -236,10 +293,8 @@ namespace Toolbox {
         static Result<void, SerialError> BytesToObject(const Buffer &serial_data, _S &obj,
                                                        size_t offset = 0) {
             if constexpr (std::is_base_of_v<ISerializable, _S>) {
-                std::stringstream str_in(
-                    std::string(serial_data.buf<char>() + offset, serial_data.size() - offset));
-
-                Deserializer in(str_in.rdbuf());
+                Deserializer in(std::span<const char>(serial_data.buf<char>() + offset,
+                                                      serial_data.size() - offset));
                 return obj.deserialize(in);
             } else if constexpr (std::is_standard_layout_v<_S>) {
                 obj = *reinterpret_cast<const _S *>(serial_data.buf<char>() + offset);
@@ -306,6 +361,10 @@ namespace Toolbox {
 
         std::string readCString(size_t limit = std::string::npos) {
             std::string str;
+            if (m_span_buf) {
+                readCStringFast(str, limit);
+                return str;
+            }
             if (limit != std::string::npos) {
                 str.reserve(limit);
             }
@@ -323,6 +382,10 @@ namespace Toolbox {
         }
 
         Deserializer &readCString(std::string &str, size_t limit = std::string::npos) {
+            if (m_span_buf) {
+                readCStringFast(str, limit);
+                return *this;
+            }
             if (limit != std::string::npos) {
                 str.reserve(limit);
             }
@@ -340,10 +403,35 @@ namespace Toolbox {
         }
 
         Deserializer &readBytes(std::span<char> bytes) {
+            if (m_span_buf) {
+                if (!m_in.good()) {
+                    m_in.setstate(std::ios::failbit);
+                    return *this;
+                }
+                const size_t count = std::min(bytes.size(), m_span_buf->remaining());
+                std::memcpy(bytes.data(), m_span_buf->current(), count);
+                m_span_buf->advance(count);
+                if (count < bytes.size()) {
+                    m_in.setstate(std::ios::eofbit | std::ios::failbit);
+                }
+                return *this;
+            }
             m_in.read(bytes.data(), bytes.size());
             return *this;
         }
 
+        // Reads `values.size()` elements in one pass, swapping them in place
+        // when the requested byte order is not native.
+        template <typename T, std::endian E = std::endian::native>
+        Deserializer &readArray(std::span<T> values) {
+            static_assert(std::is_arithmetic_v<T>, "readArray requires an arithmetic type");
+            readBytes(std::span(reinterpret_cast<char *>(values.data()), values.size_bytes()));
+            if constexpr (E != std::endian::native && sizeof(T) > 1) {
+                SIMD::ByteSwapArray(values.data(), values.size());
+            }
+            return *this;
+        }
+
         Deserializer &alignTo(size_t alignment) {
             return seek((static_cast<size_t>(tell()) + alignment - 1) & ~(alignment - 1),
                         std::ios::beg);
@@ -356,9 +444,17 @@ namespace Toolbox {
 
         Deserializer &seek(std::streampos pos) { return seek(pos, std::ios::cur); }
 
-        std::streampos tell() { return m_in.tellg(); }
+        std::streampos tell() {
+            if (m_span_buf) {
+                return m_in.fail() ? std::streampos(-1) : std::streampos(m_span_buf->tell());
+            }
+            return m_in.tellg();
+        }
 
         size_t size() {
+            if (m_span_buf) {
+                return m_span_buf->size();
+            }
             auto pos = tell();
             seek(0, std::ios::end);
             auto size = static_cast<size_t>(tell());
@@ -367,6 +463,9 @@ namespace Toolbox {
         }
 
         size_t remaining() {
+            if (m_span_buf) {
+                return m_span_buf->remaining();
+            }
             auto pos = tell();
             seek(0, std::ios::end);
             auto size = static_cast<size_t>(tell());
@@ -382,8 +481,13 @@ namespace Toolbox {
         void pushBreakpoint();
         Result<void, SerialError> popBreakpoint();
 
+    protected:
+        void readCStringFast(std::string &str, size_t limit);
+
     private:
+        ScopePtr<SpanStreamBuf> m_owned_buf;
         std::istream m_in;
+        SpanStreamBuf *m_span_buf = nullptr;
         std::stack<std::streampos> m_breakpoints;
         std::string m_file_path = "[unknown path]";
     };
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <span>
+#include <streambuf>
+#include <vector>
+
+#include "core/types.hpp"
+
+namespace Toolbox {
+
+    // Read-only stream buffer over contiguous memory. Deserializer copies
+    // straight out of it rather than through the virtual stream interface,
+    // while stream() keeps working for parsers that want an std::istream.
+    class SpanStreamBuf : public std::streambuf {
+    public:
+        explicit SpanStreamBuf(std::span<const char> data) {
+            char *begin = const_cast<char *>(data.data());
+            setg(begin, begin, begin + data.size());
+        }
+
+        SpanStreamBuf(const SpanStreamBuf &) = delete;
+        SpanStreamBuf &operator=(const SpanStreamBuf &) = delete;
+
+        [[nodiscard]] const char *current() const { return gptr(); }
+        [[nodiscard]] size_t tell() const { return static_cast<size_t>(gptr() - eback()); }
+        [[nodiscard]] size_t size() const { return static_cast<size_t>(egptr() - eback()); }
+        [[nodiscard]] size_t remaining() const { return static_cast<size_t>(egptr() - gptr()); }
+
+        // Caller guarantees that `count` <= remaining()
+        void advance(size_t count) { setg(eback(), gptr() + count, egptr()); }
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                         std::ios_base::openmode which) override;
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+    };
+
+    // Write-only stream buffer over memory that grows as it is written.
+    // Seeking back to patch earlier bytes is allowed anywhere up to the
+    // furthest byte written, like std::stringbuf.
+    class GrowableStreamBuf : public std::streambuf {
+    public:
+        GrowableStreamBuf() = default;
+        explicit GrowableStreamBuf(size_t reserve) { grow(reserve); }
+
+        GrowableStreamBuf(const GrowableStreamBuf &) = delete;
+        GrowableStreamBuf &operator=(const GrowableStreamBuf &) = delete;
+
+        [[nodiscard]] size_t tell() const { return static_cast<size_t>(pptr() - pbase()); }
+        [[nodiscard]] size_t size() const { return std::max(m_high_water, tell()); }
+        [[nodiscard]] std::span<const char> data() const { return {m_storage.data(), size()}; }
+
+        void write(const char *bytes, size_t count) {
+            if (static_cast<size_t>(epptr() - pptr()) < count) {
+                grow(tell() + count);
+            }
+            std::memcpy(pptr(), bytes, count);
+            advance(count);
+        }
+
+    protected:
+        int_type overflow(int_type ch) override;
+        std::streamsize xsputn(const char *s, std::streamsize count) override;
+
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                         std::ios_base::openmode which) override;
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+    private:
+        void advance(size_t count) {
+            if (count <= static_cast<size_t>(INT_MAX)) {
+                pbump(static_cast<int>(count));
+            } else {
+                setPutPosition(tell() + count);
+            }
+        }
+
+        void grow(size_t min_capacity);
+        void setPutPosition(size_t pos);
+
+        std::vector<char> m_storage;
+        size_t m_high_water = 0;
+    };
+
+}  // namespace Toolbox
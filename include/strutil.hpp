@@ -204,12 +204,18 @@ namespace Toolbox::String {
 
 #endif
 
+    // Table driven cp932 codec generated by gen_sjis.py. Like the ICU
+    // converters it replaces, characters without a mapping are substituted
+    // (U+FFFD and '?' respectively) rather than rejected.
+    std::string SJISToUTF8(std::string_view value);
+    std::string UTF8ToSJIS(std::string_view value);
+
     inline Result<std::string, EncodingError> fromGameEncoding(std::string_view value) {
-        return asEncoding(value, GAME_ENCODING, IMGUI_ENCODING);
+        return SJISToUTF8(value);
     }
 
     inline Result<std::string, EncodingError> toGameEncoding(std::string_view value) {
-        return asEncoding(value, IMGUI_ENCODING, GAME_ENCODING);
+        return UTF8ToSJIS(value);
     }
 
     inline std::vector<std::string_view> splitLines(std::string_view s) {
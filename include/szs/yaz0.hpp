@@ -0,0 +1,85 @@
+#pragma once
+
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "core/error.hpp"
+#include "core/types.hpp"
+
+namespace Toolbox::SZS {
+
+    constexpr size_t YAZ0_HEADER_SIZE = 0x10;
+    constexpr size_t YAZ0_WINDOW_SIZE = 0x1000;
+    constexpr size_t YAZ0_MIN_MATCH   = 3;
+    constexpr size_t YAZ0_MAX_MATCH   = 0x111;
+
+    enum class Yaz0Level {
+        // Shallow hash chains and greedy parsing.
+        LEVEL_FAST,
+        // Deeper hash chains with one step of lazy matching.
+        LEVEL_DEFAULT,
+        // Exhaustive match search with an optimal parse of each block.
+        LEVEL_MAX,
+    };
+
+    bool IsYaz0Compressed(std::span<const u8> data);
+
+    // Returns the decompressed size stored in the header, or 0 if `data` is not Yaz0.
+    u32 GetYaz0ExpandedSize(std::span<const u8> data);
+
+    // Upper bound for the encoded size of `src_size` bytes (all literals).
+    size_t GetYaz0WorstEncodingSize(size_t src_size);
+
+    // Decodes `src` directly into `dst`, which may be a mapped file or a buffer
+    // shorter than the expanded size (to peek at the head of an archive, say).
+    //
+    // Returns the number of bytes written to `dst`.
+    Result<size_t> Yaz0Decode(std::span<const u8> src, std::span<u8> dst);
+    Result<std::vector<u8>> Yaz0Decode(std::span<const u8> src);
+
+    // Input is split into fixed blocks that are matched in parallel; each
+    // block may still reference the full window preceding it, so splitting
+    // does not cost any compression ratio.
+    Result<std::vector<u8>> Yaz0Encode(std::span<const u8> src,
+                                       Yaz0Level level = Yaz0Level::LEVEL_DEFAULT);
+
+    // Incremental decoder for sources that arrive in chunks. Output is handed
+    // to the sink as it is produced, so only the sliding window is retained.
+    class Yaz0StreamDecoder {
+    public:
+        using sink_t = std::function<void(std::span<const u8>)>;
+
+        explicit Yaz0StreamDecoder(sink_t sink) : m_sink(std::move(sink)) {}
+
+        Result<void> feed(std::span<const u8> chunk);
+
+        [[nodiscard]] bool isFinished() const {
+            return m_has_header && m_decoded_size == m_expanded_size;
+        }
+
+        [[nodiscard]] u32 getExpandedSize() const { return m_expanded_size; }
+        [[nodiscard]] size_t getDecodedSize() const { return m_decoded_size; }
+
+    private:
+        Result<void> decodeAvailable();
+        void flush();
+
+        sink_t m_sink;
+
+        std::vector<u8> m_input;
+        size_t m_input_pos = 0;
+
+        // Unflushed output followed by at most one window of flushed history
+        std::vector<u8> m_history;
+        size_t m_history_flushed = 0;
+
+        bool m_has_header     = false;
+        u32 m_expanded_size   = 0;
+        size_t m_decoded_size = 0;
+
+        u8 m_flags      = 0;
+        u8 m_flag_count = 0;
+    };
+
+}  // namespace Toolbox::SZS
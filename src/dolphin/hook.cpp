@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstring>
 #include <mutex>
 #include <string>
 #include <string_view>
@@ -28,17 +31,14 @@ namespace Toolbox::Dolphin {
     public:
         void setExpectedWindowCount(size_t windows) { m_expected_windows = windows; }
 
-    protected:
-        void tRun(void* param) override {
-            Platform::ProcessInformation *proc_info =
-                static_cast<Platform::ProcessInformation *>(param);
-            if (!proc_info) {
-                return;
-            }
+        // Held by value; the manager may reset its own copy while this runs.
+        void setProcess(const Platform::ProcessInformation &process) { m_process = process; }
 
+    protected:
+        void tRun(void *param) override {
             while (!tIsSignalKill()) {
                 std::vector<Platform::LowWindow> windows =
-                    Platform::FindWindowsOfProcess(*proc_info);
+                    Platform::FindWindowsOfProcess(m_process);
                 if (windows.size() >= m_expected_windows) {
                     for (Platform::LowWindow window : windows) {
                         Platform::HideWindow(window);
@@ -51,10 +51,27 @@ namespace Toolbox::Dolphin {
 
     private:
         size_t m_expected_windows = 1;
+        Platform::ProcessInformation m_process;
     };
 
     static ScopePtr<HideWindowsThread> s_hide_windows_thr;
 
+    // Pins the mapped view for the duration of a transfer so unhook() cannot
+    // unmap it underneath a reader. Transfers never block each other.
+    class ScopedViewLease {
+    public:
+        explicit ScopedViewLease(std::atomic<u32> &readers) : m_readers(readers) {
+            m_readers.fetch_add(1);
+        }
+        ~ScopedViewLease() { m_readers.fetch_sub(1); }
+
+        ScopedViewLease(const ScopedViewLease &)            = delete;
+        ScopedViewLease &operator=(const ScopedViewLease &) = delete;
+
+    private:
+        std::atomic<u32> &m_readers;
+    };
+
 #ifdef TOOLBOX_PLATFORM_WINDOWS
 #include <tlhelp32.h>
 #include <Windows.h>
@@ -162,13 +179,23 @@ namespace Toolbox::Dolphin {
     }
 
     DolphinHookManager::~DolphinHookManager() {
-        if (isProcessRunning() && m_proc_is_spawned) {
+        bool is_spawned;
+        {
+            std::unique_lock lock(m_proc_mutex);
+            is_spawned = m_proc_is_spawned;
+        }
+        if (is_spawned && isProcessRunning()) {
             stopProcess();
         }
     }
 
     bool DolphinHookManager::isProcessRunning() const {
-        return Platform::IsExProcessRunning(m_proc_info);
+        return Platform::IsExProcessRunning(getProcess());
+    }
+
+    Platform::ProcessInformation DolphinHookManager::getProcess() const {
+        std::unique_lock lock(m_proc_mutex);
+        return m_proc_info;
     }
 
     Result<void> DolphinHookManager::startProcess(bool wants_hidden) {
@@ -207,38 +234,47 @@ namespace Toolbox::Dolphin {
             return std::unexpected(process_result.error());
         }
 
-        m_proc_is_spawned = true;
-        m_proc_info = process_result.value();
+        {
+            std::unique_lock lock(m_proc_mutex);
+            m_proc_is_spawned = true;
+            m_proc_info       = process_result.value();
+        }
         if (wants_hidden) {
             s_hide_windows_thr = make_scoped<HideWindowsThread>();
             s_hide_windows_thr->setExpectedWindowCount(10);  // Opens 11 but being safe. Potentially rewrite this logic?
-            s_hide_windows_thr->tStart(true, &m_proc_info);
+            s_hide_windows_thr->setProcess(process_result.value());
+            s_hide_windows_thr->tStart(true, nullptr);
         }
 
         return {};
     }
 
     Result<void> DolphinHookManager::stopProcess() {
-        auto process_result = Platform::KillExProcess(m_proc_info, 100);
+        auto process_result = Platform::KillExProcess(getProcess(), 100);
         if (!process_result) {
             return std::unexpected(process_result.error());
         }
 
-        m_proc_is_spawned = false;
-        m_proc_info  = Platform::ProcessInformation{};
+        {
+            std::unique_lock lock(m_proc_mutex);
+            m_proc_is_spawned = false;
+            m_proc_info       = Platform::ProcessInformation{};
+        }
         m_mem_handle = NULL_MEMHANDLE;
         m_mem_view   = nullptr;
+        markProcessAlive(false);
         return {};
     }
 
     Result<bool> DolphinHookManager::hook() {
-        if (m_mem_view) {
+        if (m_mem_view.load()) {
             return {};
         }
 
         constexpr Platform::ProcessID sentinel = std::numeric_limits<Platform::ProcessID>::max();
 
-        if (!IsExProcessRunning(m_proc_info)) {
+        Platform::ProcessInformation process = getProcess();
+        if (!IsExProcessRunning(process)) {
             Platform::ProcessID pid                   = sentinel;
             std::vector<std::string> target_processes = {"Dolphin", "DolphinQt2", "DolphinWx"};
 
@@ -246,7 +282,10 @@ namespace Toolbox::Dolphin {
             for (auto &proc_name : target_processes) {
                 Result<Platform::ProcessInformation> proc_info = Platform::GetExProcess(proc_name); 
                 if (proc_info.has_value()) {
-                    m_proc_info = proc_info.value();
+                    process = proc_info.value();
+
+                    std::unique_lock lock(m_proc_mutex);
+                    m_proc_info = process;
                     break;
                 } else {
                     //TOOLBOX_DEBUG_LOG_V("{}", proc_info.error().m_message[0]);
@@ -255,7 +294,7 @@ namespace Toolbox::Dolphin {
             };
         }
 
-        std::string dolphin_memory_name = std::format("dolphin-emu.{}", m_proc_info.m_process_id);
+        std::string dolphin_memory_name = std::format("dolphin-emu.{}", process.m_process_id);
 
         auto handle_result = OpenProcessMemory(dolphin_memory_name);
         if (!handle_result || handle_result.value() == NULL_MEMHANDLE) {
@@ -271,11 +310,12 @@ namespace Toolbox::Dolphin {
             return std::unexpected(view_result.error());
         }
 
-        m_mem_view = view_result.value();
         m_mem_size = 0x1800000;
+        m_mem_view = view_result.value();
+        markProcessAlive(true);
 
         TOOLBOX_INFO_V("DOLPHIN: Successfully hooked to process! (Name={}, PID={}, View={})",
-                       m_proc_info.m_process_name, m_proc_info.m_process_id, m_mem_view);
+                       process.m_process_name, process.m_process_id, m_mem_view.load());
 
         char magic[4];
         readBytes(magic, 0x80000000, 4);
@@ -296,17 +336,29 @@ namespace Toolbox::Dolphin {
     }
 
     Result<bool> DolphinHookManager::unhook() {
-        if (!m_mem_view) {
+        void *mem_view = m_mem_view.exchange(nullptr);
+        if (!mem_view) {
             return {};
         }
 
-        auto view_result = CloseMemoryView(m_mem_view);
+        // New transfers now see a null view; wait out the ones already in flight.
+        while (m_view_readers.load() != 0) {
+            std::this_thread::yield();
+        }
+
+        {
+            // Whatever the snapshot holds belongs to the old session.
+            std::unique_lock lock(m_snapshot_mutex);
+            m_snapshot_dirty = true;
+        }
+
+        auto view_result = CloseMemoryView(mem_view);
         if (!view_result) {
             return std::unexpected(view_result.error());
         }
-        m_mem_view = nullptr;
 
-        std::string dolphin_memory_name = std::format("dolphin-emu.{}", m_proc_info.m_process_id);
+        std::string dolphin_memory_name =
+            std::format("dolphin-emu.{}", getProcess().m_process_id);
         auto handle_result = CloseProcessMemory(m_mem_handle, dolphin_memory_name.data());
         if (!handle_result) {
             return std::unexpected(view_result.error());
@@ -316,7 +368,7 @@ namespace Toolbox::Dolphin {
     }
 
     Result<bool> DolphinHookManager::refresh() {
-        if (!Platform::IsExProcessRunning(m_proc_info)) {
+        if (!Platform::IsExProcessRunning(getProcess())) {
             auto unhook_result = unhook();
             if (!unhook_result) {
                 return std::unexpected(unhook_result.error());
@@ -340,71 +392,74 @@ namespace Toolbox::Dolphin {
         return hook();
     }
 
-    Result<void> DolphinHookManager::readBytes(char *buf, u32 address, size_t size) {
-        std::unique_lock lock(m_memory_mutex);
-        if (!m_mem_view) {
-            return make_error<void>("SHARED_MEMORY",
-                                    "Tried to read bytes without a memory handle!");
-        }
+    Result<void> DolphinHookManager::readBatch(std::span<const MemorySpan> spans) {
+        ScopedViewLease lease(m_view_readers);
 
-        u32 true_address = address & 0x7FFFFFFF;
-        if (true_address >= m_mem_size) {
-            return make_error<void>("SHARED_MEMORY",
-                                    "Tried to read bytes to a protected memory region!");
+        const char *view = static_cast<const char *>(m_mem_view.load());
+        auto gate_result = checkTransferGate(view);
+        if (!gate_result) {
+            return gate_result;
         }
 
-        if (!processGateCheck()) {
-            return make_error<void>("SHARED_MEMORY", "Application was shutdown externally!");
+        for (const MemorySpan &span : spans) {
+            if (!isRangeMapped(span.m_address, span.m_size)) {
+                return make_error<void>(
+                    "SHARED_MEMORY",
+                    std::format("Tried to read bytes to a protected memory region! ({:08X}, {})",
+                                span.m_address, span.m_size));
+            }
         }
 
-        const char *addr_buf = static_cast<const char *>(m_mem_view) + true_address;
-        memcpy(buf, addr_buf, size);
+        for (const MemorySpan &span : spans) {
+            std::memcpy(span.m_data, view + getAddressAsOffset(span.m_address), span.m_size);
+        }
         return {};
     }
 
+    Result<void> DolphinHookManager::readBytes(char *buf, u32 address, size_t size) {
+        const MemorySpan span = {address, size, buf};
+        return readBatch({&span, 1});
+    }
+
     Result<void> DolphinHookManager::writeBytes(const char *buf, u32 address, size_t size) {
-        std::unique_lock lock(m_memory_mutex);
-        if (!m_mem_view) {
-            return make_error<void>("SHARED_MEMORY",
-                                    "Tried to write bytes without a memory handle!");
+        ScopedViewLease lease(m_view_readers);
+
+        char *view       = static_cast<char *>(m_mem_view.load());
+        auto gate_result = checkTransferGate(view);
+        if (!gate_result) {
+            return gate_result;
         }
 
-        u32 true_address = address & 0x7FFFFFFF;
-        if (true_address >= m_mem_size) {
+        if (!isRangeMapped(address, size)) {
             return make_error<void>("SHARED_MEMORY",
                                     "Tried to write bytes to a protected memory region!");
         }
 
-        if (!processGateCheck()) {
-            return make_error<void>("SHARED_MEMORY", "Application was shutdown externally!");
-        }
-
-        char *addr_buf = static_cast<char *>(m_mem_view) + true_address;
-        memcpy(addr_buf, buf, size);
+        std::memcpy(view + getAddressAsOffset(address), buf, size);
+        m_snapshot_dirty.store(true);
         return {};
     }
 
     Result<void> DolphinHookManager::readCString(char *buf, size_t buf_len, u32 address) {
-        std::unique_lock lock(m_memory_mutex);
-        if (!m_mem_view) {
-            return make_error<void>("SHARED_MEMORY",
-                                    "Tried to read bytes without a memory handle!");
+        ScopedViewLease lease(m_view_readers);
+
+        const char *view = static_cast<const char *>(m_mem_view.load());
+        auto gate_result = checkTransferGate(view);
+        if (!gate_result) {
+            return gate_result;
         }
 
-        u32 true_address = address & 0x7FFFFFFF;
-        if (true_address >= m_mem_size) {
+        u32 true_address = getAddressAsOffset(address);
+        if (!isRangeMapped(address, 1)) {
             return make_error<void>("SHARED_MEMORY",
                                     "Tried to read bytes to a protected memory region!");
         }
 
-        if (!processGateCheck()) {
-            return make_error<void>("SHARED_MEMORY", "Application was shutdown externally!");
-        }
-
-        const char *addr_buf = static_cast<const char *>(m_mem_view) + true_address;
+        const u32 mem_size   = m_mem_size.load();
+        const char *addr_buf = view + true_address;
 
         size_t i = 0;
-        while (true_address + i < m_mem_size && i < buf_len) {
+        while (true_address + i < mem_size && i < buf_len) {
             if (addr_buf[i] == '\0') {
                 buf[i] = '\0';
                 return {};
@@ -418,58 +473,370 @@ namespace Toolbox::Dolphin {
     }
 
     Result<void> DolphinHookManager::writeCString(const char *buf, u32 address, size_t buf_len) {
-        std::unique_lock lock(m_memory_mutex);
-        if (!m_mem_view) {
-            return make_error<void>("SHARED_MEMORY",
-                                    "Tried to read bytes without a memory handle!");
-        }
+        ScopedViewLease lease(m_view_readers);
 
-        u32 true_address = address & 0x7FFFFFFF;
-        if (true_address >= m_mem_size) {
-            return make_error<void>("SHARED_MEMORY",
-                                    "Tried to read bytes to a protected memory region!");
+        char *view       = static_cast<char *>(m_mem_view.load());
+        auto gate_result = checkTransferGate(view);
+        if (!gate_result) {
+            return gate_result;
         }
 
-        if (!processGateCheck()) {
+        u32 true_address = getAddressAsOffset(address);
+        if (!isRangeMapped(address, 1)) {
             return make_error<void>("SHARED_MEMORY",
-                                    "Application was shutdown externally!");
+                                    "Tried to read bytes to a protected memory region!");
         }
 
-        char *addr_buf = static_cast<char *>(m_mem_view) + true_address;
+        const u32 mem_size = m_mem_size.load();
+        char *addr_buf     = view + true_address;
 
         size_t i = 0;
-        while (true_address + i < m_mem_size && (buf_len == 0 || i < buf_len)) {
+        while (true_address + i < mem_size && (buf_len == 0 || i < buf_len)) {
             if (buf[i] == '\0') {
-                addr_buf[i] = '\0';
-                return {};
+                break;
             }
             addr_buf[i] = buf[i];
             i += 1;
         }
 
         addr_buf[i] = '\0';
+        m_snapshot_dirty.store(true);
         return {};
     }
 
     bool DolphinHookManager::processGateCheck() {
-        if (m_proc_is_spawned) {
-            if (!Platform::IsFastProcessRunning(m_proc_info)) {
-                m_proc_is_spawned = false;
-                m_proc_info       = Platform::ProcessInformation{};
-                m_mem_handle      = NULL_MEMHANDLE;
-                m_mem_view        = nullptr;
-                return false;
+        if (isProcessAlive()) {
+            return true;
+        }
+
+        std::unique_lock lock(m_memory_mutex);
+        {
+            std::unique_lock proc_lock(m_proc_mutex);
+            m_proc_is_spawned = false;
+            m_proc_info       = Platform::ProcessInformation{};
+        }
+        m_mem_handle = NULL_MEMHANDLE;
+        m_mem_view   = nullptr;
+        return false;
+    }
+
+    bool DolphinHookManager::isProcessAlive() const {
+        const s64 now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+        if (now - m_liveness_stamp.load() < s_liveness_interval.count()) {
+            return m_proc_alive.load();
+        }
+
+        // Only one caller pays for the OS query, the rest keep the cached state.
+        std::unique_lock lock(m_liveness_mutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+            Platform::ProcessInformation process;
+            bool is_spawned;
+            {
+                std::unique_lock proc_lock(m_proc_mutex);
+                process    = m_proc_info;
+                is_spawned = m_proc_is_spawned;
             }
-        } else {
-            if (!Platform::IsExProcessRunning(m_proc_info)) {
-                m_proc_is_spawned = false;
-                m_proc_info       = Platform::ProcessInformation{};
-                m_mem_handle      = NULL_MEMHANDLE;
-                m_mem_view        = nullptr;
-                return false;
+
+            const bool alive = is_spawned ? Platform::IsFastProcessRunning(process)
+                                          : Platform::IsExProcessRunning(process);
+            m_proc_alive.store(alive);
+            m_liveness_stamp.store(now);
+        }
+        return m_proc_alive.load();
+    }
+
+    void DolphinHookManager::markProcessAlive(bool alive) const {
+        m_proc_alive.store(alive);
+        m_liveness_stamp.store(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+    }
+
+    Result<void> DolphinHookManager::checkTransferGate(const void *view) {
+        if (!view) {
+            return make_error<void>("SHARED_MEMORY",
+                                    "Tried to access memory without a memory handle!");
+        }
+
+        if (!processGateCheck()) {
+            return make_error<void>("SHARED_MEMORY", "Application was shutdown externally!");
+        }
+
+        return {};
+    }
+
+    bool DolphinHookManager::isRangeMapped(u32 address, size_t size) const {
+        const u32 true_address = getAddressAsOffset(address);
+        const u32 mem_size     = m_mem_size.load();
+        return true_address < mem_size && size <= mem_size - true_address;
+    }
+
+    MemorySnapshot::MemorySnapshot(MemorySnapshot &&other) noexcept
+        : m_buffer(other.m_buffer), m_readers(other.m_readers) {
+        other.m_buffer  = nullptr;
+        other.m_readers = nullptr;
+    }
+
+    MemorySnapshot &MemorySnapshot::operator=(MemorySnapshot &&other) noexcept {
+        if (this != &other) {
+            release();
+            m_buffer        = other.m_buffer;
+            m_readers       = other.m_readers;
+            other.m_buffer  = nullptr;
+            other.m_readers = nullptr;
+        }
+        return *this;
+    }
+
+    void MemorySnapshot::release() {
+        if (m_readers) {
+            m_readers->fetch_sub(1);
+        }
+        m_buffer  = nullptr;
+        m_readers = nullptr;
+    }
+
+    MemoryViewLease::MemoryViewLease(MemoryViewLease &&other) noexcept
+        : m_readers(other.m_readers), m_view(other.m_view), m_size(other.m_size) {
+        other.m_readers = nullptr;
+        other.m_view    = nullptr;
+        other.m_size    = 0;
+    }
+
+    MemoryViewLease &MemoryViewLease::operator=(MemoryViewLease &&other) noexcept {
+        if (this != &other) {
+            release();
+            m_readers       = other.m_readers;
+            m_view          = other.m_view;
+            m_size          = other.m_size;
+            other.m_readers = nullptr;
+            other.m_view    = nullptr;
+            other.m_size    = 0;
+        }
+        return *this;
+    }
+
+    void MemoryViewLease::release() {
+        if (m_readers) {
+            m_readers->fetch_sub(1);
+        }
+        m_readers = nullptr;
+        m_view    = nullptr;
+        m_size    = 0;
+    }
+
+    const u8 *MemorySnapshot::data(u32 address, size_t size) const {
+        if (!isValid()) {
+            return nullptr;
+        }
+
+        const u32 true_address                     = address & 0x7FFFFFFF;
+        const std::vector<SnapshotRegion> &regions = m_buffer->m_regions;
+
+        // Regions never overlap, so only the last one starting at or
+        // before the address can contain it.
+        auto it = std::upper_bound(
+            regions.begin(), regions.end(), true_address,
+            [](u32 addr, const SnapshotRegion &region) { return addr < region.m_address; });
+        if (it == regions.begin()) {
+            return nullptr;
+        }
+        --it;
+
+        const u32 region_ofs = true_address - it->m_address;
+        if (region_ofs > it->m_size || size > it->m_size - region_ofs) {
+            return nullptr;
+        }
+        return m_buffer->m_arena.data() + it->m_arena_offset + region_ofs;
+    }
+
+    Result<void> MemorySnapshot::readBytes(char *buf, u32 address, size_t size) const {
+        const u8 *src = data(address, size);
+        if (!src) {
+            return make_error<void>(
+                "SNAPSHOT", std::format("Address range ({:08X}, {}) is not part of the snapshot!",
+                                        address, size));
+        }
+        std::memcpy(buf, src, size);
+        return {};
+    }
+
+    Result<void> MemorySnapshot::readBatch(std::span<const MemorySpan> spans) const {
+        for (const MemorySpan &span : spans) {
+            if (!contains(span.m_address, span.m_size)) {
+                return make_error<void>(
+                    "SNAPSHOT",
+                    std::format("Address range ({:08X}, {}) is not part of the snapshot!",
+                                span.m_address, span.m_size));
             }
         }
+
+        for (const MemorySpan &span : spans) {
+            std::memcpy(span.m_data, data(span.m_address, span.m_size), span.m_size);
+        }
+        return {};
+    }
+
+    u32 DolphinHookManager::addSnapshotRegion(u32 address, u32 size) {
+        std::unique_lock lock(m_snapshot_mutex);
+
+        const u32 handle = m_next_snapshot_handle++;
+        m_snapshot_requests.emplace_back(handle, SnapshotRegion{address & 0x7FFFFFFF, size, 0});
+        m_snapshot_dirty = true;
+        return handle;
+    }
+
+    void DolphinHookManager::removeSnapshotRegion(u32 handle) {
+        std::unique_lock lock(m_snapshot_mutex);
+
+        std::erase_if(m_snapshot_requests,
+                      [handle](const auto &request) { return request.first == handle; });
+        m_snapshot_dirty = true;
+    }
+
+    Result<bool> DolphinHookManager::updateSnapshot() {
+        // Someone else is already capturing, which serves this caller just as well.
+        std::unique_lock lock(m_snapshot_mutex, std::try_to_lock);
+        if (!lock.owns_lock() || m_snapshot_requests.empty()) {
+            return false;
+        }
+
+        const u32 front                = m_snapshot_front.load();
+        const SnapshotBuffer &current  = m_snapshot_buffers[front];
+        const std::optional<u32> frame = readGameFrame();
+        if (frame && current.m_valid && current.m_frame == frame.value() && !m_snapshot_dirty) {
+            return false;
+        }
+
+        // A reader still holds the previous frame; retry on the next poll
+        // rather than overwrite data it may be reading.
+        const u32 back = front ^ 1;
+        if (m_snapshot_readers[back].load() != 0) {
+            return false;
+        }
+
+        // Cleared before copying, so a write that lands mid-capture marks
+        // the snapshot dirty again instead of being lost.
+        m_snapshot_dirty.store(false);
+
+        SnapshotBuffer &buffer = m_snapshot_buffers[back];
+        layoutSnapshot(buffer);
+
+        m_snapshot_spans.clear();
+        for (const SnapshotRegion &region : buffer.m_regions) {
+            m_snapshot_spans.push_back({region.m_address | 0x80000000, region.m_size,
+                                        buffer.m_arena.data() + region.m_arena_offset});
+        }
+
+        auto read_result = readBatch(m_snapshot_spans);
+        if (!read_result) {
+            m_snapshot_dirty.store(true);
+            return std::unexpected(read_result.error());
+        }
+
+        // The game moved on while we were copying, so the capture may mix
+        // two frames. Leave the previous snapshot published and try again.
+        if (frame && readGameFrame() != frame) {
+            m_snapshot_dirty.store(true);
+            return false;
+        }
+
+        buffer.m_frame = frame.value_or(0);
+        buffer.m_valid = true;
+        m_snapshot_front.store(back);
         return true;
     }
 
+    MemorySnapshot DolphinHookManager::acquireSnapshot() const {
+        while (true) {
+            const u32 front = m_snapshot_front.load();
+            m_snapshot_readers[front].fetch_add(1);
+
+            // The capture side may have flipped buffers between the load and
+            // the pin; only a pin on the still-published buffer is safe.
+            if (m_snapshot_front.load() == front) {
+                return MemorySnapshot(&m_snapshot_buffers[front], &m_snapshot_readers[front]);
+            }
+            m_snapshot_readers[front].fetch_sub(1);
+        }
+    }
+
+    MemoryViewLease DolphinHookManager::leaseMemoryView() {
+        // Same protocol as ScopedViewLease: pin first, then look at the view,
+        // so that unhook() either sees the pin or we see the null view.
+        m_view_readers.fetch_add(1);
+
+        const void *view = m_mem_view.load();
+        const u32 size   = m_mem_size.load();
+        if (!view || size == 0 || !processGateCheck()) {
+            m_view_readers.fetch_sub(1);
+            return {};
+        }
+        return MemoryViewLease(&m_view_readers, view, size);
+    }
+
+    std::optional<u32> DolphinHookManager::readGameFrame() {
+        constexpr u32 application_addr = 0x803E9700;
+        constexpr u8 c_mar_director_id = 5;
+
+        u32 director_ptr = 0;
+        u8 director_type = 0;
+
+        const MemorySpan application_spans[] = {
+            {application_addr + 0x4, sizeof(director_ptr), &director_ptr},
+            {application_addr + 0x8, sizeof(director_type), &director_type},
+        };
+        if (!readBatch(application_spans) || director_type != c_mar_director_id) {
+            return std::nullopt;
+        }
+
+        u32 director_qf       = 0;
+        const MemorySpan span = {std::byteswap(director_ptr) + 0x5C, sizeof(director_qf),
+                                 &director_qf};
+        if (!readBatch({&span, 1})) {
+            return std::nullopt;
+        }
+        return std::byteswap(director_qf);
+    }
+
+    void DolphinHookManager::layoutSnapshot(SnapshotBuffer &buffer) const {
+        buffer.m_regions.clear();
+        for (const auto &[handle, region] : m_snapshot_requests) {
+            if (isRangeMapped(region.m_address, region.m_size) && region.m_size > 0) {
+                buffer.m_regions.push_back(region);
+            }
+        }
+
+        std::sort(buffer.m_regions.begin(), buffer.m_regions.end(),
+                  [](const SnapshotRegion &a, const SnapshotRegion &b) {
+                      return a.m_address < b.m_address;
+                  });
+
+        // Merge overlapping and touching regions so each one costs a single copy.
+        size_t merged = 0;
+        for (size_t i = 0; i < buffer.m_regions.size(); ++i) {
+            const SnapshotRegion &region = buffer.m_regions[i];
+            if (merged > 0) {
+                SnapshotRegion &last = buffer.m_regions[merged - 1];
+                const u32 last_end   = last.m_address + last.m_size;
+                if (region.m_address <= last_end) {
+                    last.m_size = std::max(last_end, region.m_address + region.m_size) -
+                                  last.m_address;
+                    continue;
+                }
+            }
+            buffer.m_regions[merged++] = region;
+        }
+        buffer.m_regions.resize(merged);
+
+        size_t arena_size = 0;
+        for (SnapshotRegion &region : buffer.m_regions) {
+            region.m_arena_offset = arena_size;
+            arena_size += region.m_size;
+        }
+        buffer.m_arena.resize(arena_size);
+    }
+
 }  // namespace Toolbox::Dolphin
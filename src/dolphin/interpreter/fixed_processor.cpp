@@ -10,26 +10,10 @@
 
 #include "dolphin/interpreter/processor.hpp"
 
-// Used in implementations of rlwimi, rlwinm, and rlwnm
-inline u32 MakeRotationMask(u32 mb, u32 me) {
-    // first make 001111111111111 part
-    const u32 begin = 0xFFFFFFFF >> mb;
-    // then make 000000000001111 part, which is used to flip the bits of the first one
-    const u32 end = 0x7FFFFFFF >> me;
-    // do the bitflip
-    const u32 mask = begin ^ end;
-
-    // and invert if backwards
-    if (me < mb)
-        return ~mask;
-
-    return mask;
-}
-
 namespace Toolbox::Interpreter {
 
     // Memory
-    void FixedPointProcessor::lbz(u8 rt, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::lbz(u8 rt, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(PROC_INVALID_MSG(FixedPointProcessor, lbz, "Invalid registers detected!"));
             return;
@@ -42,7 +26,7 @@ namespace Toolbox::Interpreter {
         m_gpr[rt] = storage.get<u8>(destination);
     }
 
-    void FixedPointProcessor::lbzu(u8 rt, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::lbzu(u8 rt, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lbzu, "Invalid registers detected!"));
@@ -57,7 +41,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += d;
     }
 
-    void FixedPointProcessor::lbzx(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lbzx(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lbzx, "Invalid registers detected!"));
@@ -81,7 +65,7 @@ namespace Toolbox::Interpreter {
         m_gpr[rt] = storage.get<u8>(destination);
     }
 
-    void FixedPointProcessor::lbzux(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lbzux(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lbzux, "Invalid registers detected!"));
@@ -106,7 +90,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += m_gpr[rb];
     }
 
-    void FixedPointProcessor::lhz(u8 rt, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::lhz(u8 rt, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(PROC_INVALID_MSG(FixedPointProcessor, lhz, "Invalid registers detected!"));
             return;
@@ -119,7 +103,7 @@ namespace Toolbox::Interpreter {
         m_gpr[rt] = std::byteswap<u16>(storage.get<u16>(destination));
     }
 
-    void FixedPointProcessor::lhzu(u8 rt, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::lhzu(u8 rt, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lhzu, "Invalid registers detected!"));
@@ -134,7 +118,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += d;
     }
 
-    void FixedPointProcessor::lhzx(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lhzx(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lhzx, "Invalid registers detected!"));
@@ -158,7 +142,7 @@ namespace Toolbox::Interpreter {
         m_gpr[rt] = std::byteswap<u16>(storage.get<u16>(destination));
     }
 
-    void FixedPointProcessor::lhzux(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lhzux(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lhzux, "Invalid registers detected!"));
@@ -183,7 +167,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += m_gpr[rb];
     }
 
-    void FixedPointProcessor::lha(u8 rt, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::lha(u8 rt, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(PROC_INVALID_MSG(FixedPointProcessor, lha, "Invalid registers detected!"));
             return;
@@ -196,7 +180,7 @@ namespace Toolbox::Interpreter {
         m_gpr[rt] = storage.get<bs16>(destination);
     }
 
-    void FixedPointProcessor::lhau(u8 rt, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::lhau(u8 rt, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lhau, "Invalid registers detected!"));
@@ -211,7 +195,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += d;
     }
 
-    void FixedPointProcessor::lhax(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lhax(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lhax, "Invalid registers detected!"));
@@ -225,7 +209,7 @@ namespace Toolbox::Interpreter {
         m_gpr[rt] = storage.get<bs16>(destination);
     }
 
-    void FixedPointProcessor::lhaux(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lhaux(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lhaux, "Invalid registers detected!"));
@@ -240,7 +224,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += m_gpr[rb];
     }
 
-    void FixedPointProcessor::lwz(u8 rt, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::lwz(u8 rt, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(PROC_INVALID_MSG(FixedPointProcessor, lwz, "Invalid registers detected!"));
             return;
@@ -253,7 +237,7 @@ namespace Toolbox::Interpreter {
         m_gpr[rt] = std::byteswap<u32>(storage.get<u32>(destination));
     }
 
-    void FixedPointProcessor::lwzu(u8 rt, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::lwzu(u8 rt, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lwzu, "Invalid registers detected!"));
@@ -268,7 +252,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += d;
     }
 
-    void FixedPointProcessor::lwzx(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lwzx(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lwzx, "Invalid registers detected!"));
@@ -292,7 +276,7 @@ namespace Toolbox::Interpreter {
         m_gpr[rt] = std::byteswap<u32>(storage.get<u32>(destination));
     }
 
-    void FixedPointProcessor::lwzux(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lwzux(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lwzux, "Invalid registers detected!"));
@@ -317,7 +301,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += m_gpr[rb];
     }
 
-    void FixedPointProcessor::stb(u8 rs, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::stb(u8 rs, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra)) {
             m_invalid_cb(PROC_INVALID_MSG(FixedPointProcessor, stb, "Invalid registers detected!"));
             return;
@@ -330,7 +314,7 @@ namespace Toolbox::Interpreter {
         storage.set<u8>(destination, static_cast<u8>(m_gpr[rs]));
     }
 
-    void FixedPointProcessor::stbu(u8 rs, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::stbu(u8 rs, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stbu, "Invalid registers detected!"));
@@ -345,7 +329,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += d;
     }
 
-    void FixedPointProcessor::stbx(u8 rs, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::stbx(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stbx, "Invalid registers detected!"));
@@ -369,7 +353,7 @@ namespace Toolbox::Interpreter {
         storage.set<u8>(destination, static_cast<u8>(m_gpr[rs]));
     }
 
-    void FixedPointProcessor::stbux(u8 rs, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::stbux(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stbux, "Invalid registers detected!"));
@@ -394,7 +378,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += m_gpr[rb];
     }
 
-    void FixedPointProcessor::sth(u8 rs, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::sth(u8 rs, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra)) {
             m_invalid_cb(PROC_INVALID_MSG(FixedPointProcessor, sth, "Invalid registers detected!"));
             return;
@@ -407,7 +391,7 @@ namespace Toolbox::Interpreter {
         storage.set<bu16>(destination, static_cast<u16>(m_gpr[rs]));
     }
 
-    void FixedPointProcessor::sthu(u8 rs, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::sthu(u8 rs, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, sthu, "Invalid registers detected!"));
@@ -422,7 +406,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += d;
     }
 
-    void FixedPointProcessor::sthx(u8 rs, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::sthx(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, sthx, "Invalid registers detected!"));
@@ -446,7 +430,7 @@ namespace Toolbox::Interpreter {
         storage.set<bu16>(destination, static_cast<u16>(m_gpr[rs]));
     }
 
-    void FixedPointProcessor::sthux(u8 rs, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::sthux(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, sthux, "Invalid registers detected!"));
@@ -471,7 +455,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += m_gpr[rb];
     }
 
-    void FixedPointProcessor::stw(u8 rs, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::stw(u8 rs, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra)) {
             m_invalid_cb(PROC_INVALID_MSG(FixedPointProcessor, stw, "Invalid registers detected!"));
             return;
@@ -484,7 +468,7 @@ namespace Toolbox::Interpreter {
         storage.set<bu32>(destination, static_cast<u32>(m_gpr[rs]));
     }
 
-    void FixedPointProcessor::stwu(u8 rs, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::stwu(u8 rs, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stwu, "Invalid registers detected!"));
@@ -499,7 +483,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += d;
     }
 
-    void FixedPointProcessor::stwx(u8 rs, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::stwx(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stwx, "Invalid registers detected!"));
@@ -523,7 +507,7 @@ namespace Toolbox::Interpreter {
         storage.set<bu32>(destination, static_cast<u32>(m_gpr[rs]));
     }
 
-    void FixedPointProcessor::stwux(u8 rs, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::stwux(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stwux, "Invalid registers detected!"));
@@ -548,7 +532,7 @@ namespace Toolbox::Interpreter {
         m_gpr[ra] += m_gpr[rb];
     }
 
-    void FixedPointProcessor::lhbrx(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lhbrx(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lhbrx, "Invalid registers detected!"));
@@ -571,7 +555,7 @@ namespace Toolbox::Interpreter {
         }
         m_gpr[rt] = storage.get<u16>(destination);
     }
-    void FixedPointProcessor::lwbrx(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lwbrx(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lwbrx, "Invalid registers detected!"));
@@ -595,7 +579,7 @@ namespace Toolbox::Interpreter {
         m_gpr[rt] = storage.get<u32>(destination);
     }
 
-    void FixedPointProcessor::sthbrx(u8 rs, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::sthbrx(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, sthbrx, "Invalid registers detected!"));
@@ -608,7 +592,7 @@ namespace Toolbox::Interpreter {
         }
         storage.set<u16>(destination, static_cast<u16>(m_gpr[rs]));
     }
-    void FixedPointProcessor::stwbrx(u8 rs, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::stwbrx(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stwbrx, "Invalid registers detected!"));
@@ -622,7 +606,7 @@ namespace Toolbox::Interpreter {
         storage.set<u32>(destination, static_cast<u32>(m_gpr[rs]));
     }
 
-    void FixedPointProcessor::lmw(u8 rt, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::lmw(u8 rt, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(PROC_INVALID_MSG(FixedPointProcessor, lmw, "Invalid registers detected!"));
             return;
@@ -650,7 +634,7 @@ namespace Toolbox::Interpreter {
             destination += 4;
         }
     }
-    void FixedPointProcessor::stmw(u8 rs, s16 d, u8 ra, Buffer &storage) {
+    void FixedPointProcessor::stmw(u8 rs, s16 d, u8 ra, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stmw, "Invalid registers detected!"));
@@ -680,7 +664,7 @@ namespace Toolbox::Interpreter {
         }
     }
 
-    void FixedPointProcessor::lswi(u8 rt, u8 ra, u8 nb, Buffer &storage) {
+    void FixedPointProcessor::lswi(u8 rt, u8 ra, u8 nb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lswi, "Invalid registers detected!"));
@@ -717,7 +701,7 @@ namespace Toolbox::Interpreter {
         }
     }
 
-    void FixedPointProcessor::lswx(u8 rt, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::lswx(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rt) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, lswx, "Invalid registers detected!"));
@@ -755,7 +739,7 @@ namespace Toolbox::Interpreter {
         }
     }
 
-    void FixedPointProcessor::stswi(u8 rs, u8 ra, u8 nb, Buffer &storage) {
+    void FixedPointProcessor::stswi(u8 rs, u8 ra, u8 nb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stswi, "Invalid registers detected!"));
@@ -778,7 +762,7 @@ namespace Toolbox::Interpreter {
                 return;
             }
             if (nb < 4) {
-                memcpy(storage.buf<u8>() + destination, &m_gpr[rs++ % 32], nb);
+                storage.writeBytes(destination, &m_gpr[rs++ % 32], nb);
                 destination += 4;
                 nb = 0;
             } else {
@@ -790,7 +774,7 @@ namespace Toolbox::Interpreter {
         }
     }
 
-    void FixedPointProcessor::stswx(u8 rs, u8 ra, u8 rb, Buffer &storage) {
+    void FixedPointProcessor::stswx(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {
         if (!IsRegValid(rs) || !IsRegValid(ra) || !IsRegValid(rb)) {
             m_invalid_cb(
                 PROC_INVALID_MSG(FixedPointProcessor, stswx, "Invalid registers detected!"));
@@ -814,7 +798,7 @@ namespace Toolbox::Interpreter {
                 return;
             }
             if (nb < 4) {
-                memcpy(storage.buf<u8>() + destination, &m_gpr[rs++ % 32], nb);
+                storage.writeBytes(destination, &m_gpr[rs++ % 32], nb);
                 destination += 4;
                 nb = 0;
             } else {
@@ -1653,7 +1637,7 @@ namespace Toolbox::Interpreter {
 
     // External control
 
-    void FixedPointProcessor::eciwx(u8 rt, u8 ra, u8 rb, Buffer &storage) { m_gpr[rt] = 0; }
-    void FixedPointProcessor::ecowx(u8 rs, u8 ra, u8 rb, Buffer &storage) {}
+    void FixedPointProcessor::eciwx(u8 rt, u8 ra, u8 rb, MemoryStorage &storage) { m_gpr[rt] = 0; }
+    void FixedPointProcessor::ecowx(u8 rs, u8 ra, u8 rb, MemoryStorage &storage) {}
 
 }  // namespace Toolbox::Interpreter
\ No newline at end of file
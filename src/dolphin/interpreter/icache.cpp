@@ -0,0 +1,74 @@
+#include <bit>
+
+#include "dolphin/interpreter/icache.hpp"
+
+namespace Toolbox::Interpreter {
+
+    const DecodedInstruction *InstructionCache::fetchBlockSlow(MemoryStorage &storage, u32 page,
+                                                               u32 index, decoder_t decode) {
+        if (page >= m_pages.size()) {
+            m_pages.resize(page + 1);
+        }
+
+        Page &cached = m_pages[page];
+        if (!cached.m_entries) {
+            cached.m_entries = std::make_unique<DecodedInstruction[]>(s_page_entries);
+        } else if (cached.m_generation != m_generation) {
+            revalidatePage(storage, cached, page);
+        }
+        cached.m_generation = m_generation;
+        storage.markCodePage(page);
+
+        // Decode forward to the end of the straight line, the end of the page,
+        // or the start of a block that is already built, whichever is first.
+        DecodedInstruction *entries = cached.m_entries.get();
+        const u32 page_ofs          = page << MemoryStorage::s_page_shift;
+
+        u32 end  = index;
+        u16 tail = 0;
+        for (; end < s_page_entries; ++end) {
+            DecodedInstruction &entry = entries[end];
+            if (entry.m_block_length != 0) {
+                tail = entry.m_block_length;
+                break;
+            }
+            if (!entry.m_handler) {
+                entry.m_inst = std::byteswap(storage.get<u32>(page_ofs + (end << 2)));
+                decode(entry.m_inst, entry);
+            }
+            if (entry.m_ends_block) {
+                ++end;
+                break;
+            }
+        }
+
+        u16 length = tail;
+        for (u32 i = end; i-- > index;) {
+            entries[i].m_block_length = ++length;
+        }
+        return &entries[index];
+    }
+
+    void InstructionCache::revalidatePage(MemoryStorage &storage, Page &cached, u32 page) {
+        u32 words[s_page_entries];
+        storage.readBytes(page << MemoryStorage::s_page_shift, words, sizeof(words));
+
+        bool changed = false;
+        for (u32 i = 0; i < s_page_entries; ++i) {
+            DecodedInstruction &entry = cached.m_entries[i];
+            if (entry.m_handler && std::byteswap(words[i]) != entry.m_inst) {
+                entry.m_handler = nullptr;
+                changed         = true;
+            }
+        }
+
+        // Blocks are rebuilt from scratch, since a changed word may now end
+        // (or no longer end) the straight line it sat in.
+        if (changed) {
+            for (u32 i = 0; i < s_page_entries; ++i) {
+                cached.m_entries[i].m_block_length = 0;
+            }
+        }
+    }
+
+}  // namespace Toolbox::Interpreter
@@ -0,0 +1,155 @@
+#include <algorithm>
+
+#include "dolphin/interpreter/memory.hpp"
+
+namespace Toolbox::Interpreter {
+
+    const u8 MemoryStorage::s_zero_page[MemoryStorage::s_page_size] = {};
+
+    bool MemoryStorage::initialize(u32 storage_size) {
+        if (storage_size == 0) {
+            return false;
+        }
+        reset(nullptr, nullptr, storage_size);
+        return true;
+    }
+
+    void MemoryStorage::mapCopyOnWrite(const void *base, u32 size) {
+        reset(static_cast<const u8 *>(base), nullptr, size);
+    }
+
+    void MemoryStorage::mapCopyOnRead(std::shared_ptr<const void> base, u32 size) {
+        reset(static_cast<const u8 *>(base.get()), nullptr, size);
+        m_owned_base   = std::move(base);
+        m_copy_on_read = true;
+    }
+
+    void MemoryStorage::mapWriteThrough(void *base, u32 size) {
+        if (m_write_base == base && m_size == size) {
+            return;
+        }
+        reset(static_cast<const u8 *>(base), static_cast<u8 *>(base), size);
+    }
+
+    void MemoryStorage::assign(const void *buf, u32 size) {
+        std::shared_ptr<u8[]> image(new u8[size]);
+        std::memcpy(image.get(), buf, size);
+
+        reset(image.get(), nullptr, size);
+        m_owned_base = std::move(image);
+    }
+
+    void MemoryStorage::discardWrites() {
+        m_pages.clear();
+        m_private_pages = 0;
+    }
+
+    void MemoryStorage::fill(u32 ofs, u8 value, size_t size) {
+        if (!m_code_pages.empty()) {
+            notifyCodeWrite(ofs, size);
+        }
+        if (m_write_base) {
+            std::memset(m_write_base + ofs, value, size);
+            return;
+        }
+
+        while (size > 0) {
+            const u32 page_ofs = ofs & s_page_mask;
+            const size_t chunk = std::min<size_t>(size, s_page_size - page_ofs);
+            std::memset(pageForWrite(ofs >> s_page_shift) + page_ofs, value, chunk);
+            ofs += static_cast<u32>(chunk);
+            size -= chunk;
+        }
+    }
+
+    u8 *MemoryStorage::capturePage(u32 page) const {
+        if (m_pages.empty()) {
+            m_pages.resize((static_cast<size_t>(m_size) + s_page_mask) >> s_page_shift);
+        }
+
+        std::unique_ptr<u8[]> &slot = m_pages[page];
+        if (!slot) {
+            // The last page may hang over the end of the base image.
+            const size_t page_start = static_cast<size_t>(page) << s_page_shift;
+            const size_t available  = std::min<size_t>(s_page_size, m_size - page_start);
+
+            slot = std::make_unique<u8[]>(s_page_size);
+            if (m_base) {
+                std::memcpy(slot.get(), m_base + page_start, available);
+            }
+            m_private_pages += 1;
+        }
+        return slot.get();
+    }
+
+    void MemoryStorage::readBytesSlow(u32 ofs, void *dst, size_t size) const {
+        u8 *out = static_cast<u8 *>(dst);
+        while (size > 0) {
+            const u32 page_ofs = ofs & s_page_mask;
+            const size_t chunk = std::min<size_t>(size, s_page_size - page_ofs);
+            std::memcpy(out, pageForRead(ofs >> s_page_shift) + page_ofs, chunk);
+            out += chunk;
+            ofs += static_cast<u32>(chunk);
+            size -= chunk;
+        }
+    }
+
+    void MemoryStorage::writeBytesSlow(u32 ofs, const void *src, size_t size) {
+        const u8 *in = static_cast<const u8 *>(src);
+        while (size > 0) {
+            const u32 page_ofs = ofs & s_page_mask;
+            const size_t chunk = std::min<size_t>(size, s_page_size - page_ofs);
+            std::memcpy(pageForWrite(ofs >> s_page_shift) + page_ofs, in, chunk);
+            in += chunk;
+            ofs += static_cast<u32>(chunk);
+            size -= chunk;
+        }
+    }
+
+    void MemoryStorage::notifyCodeWrite(u32 ofs, size_t size) {
+        if (size == 0) {
+            return;
+        }
+
+        const u32 first = ofs >> s_page_shift;
+        const u32 last  = static_cast<u32>((ofs + size - 1) >> s_page_shift);
+        for (u32 page = first; page <= last && page < m_code_pages.size(); ++page) {
+            if (m_code_pages[page]) {
+                m_code_pages[page] = false;
+                if (m_code_write_cb) {
+                    m_code_write_cb(page);
+                }
+            }
+        }
+    }
+
+    void MemoryStorage::copyFrom(const MemoryStorage &other) {
+        m_base          = other.m_base;
+        m_write_base    = other.m_write_base;
+        m_size          = other.m_size;
+        m_owned_base    = other.m_owned_base;
+        m_copy_on_read  = other.m_copy_on_read;
+        m_private_pages = other.m_private_pages;
+
+        m_pages.clear();
+        m_pages.resize(other.m_pages.size());
+        for (size_t i = 0; i < other.m_pages.size(); ++i) {
+            if (other.m_pages[i]) {
+                m_pages[i] = std::make_unique<u8[]>(s_page_size);
+                std::memcpy(m_pages[i].get(), other.m_pages[i].get(), s_page_size);
+            }
+        }
+    }
+
+    void MemoryStorage::reset(const u8 *base, u8 *write_base, u32 size) {
+        m_base          = base;
+        m_write_base    = write_base;
+        m_size          = size;
+        m_copy_on_read  = false;
+        m_owned_base    = nullptr;
+        m_private_pages = 0;
+        m_pages.clear();
+        m_code_pages.clear();
+    }
+
+}  // namespace Toolbox::Interpreter
@@ -1,21 +1,31 @@
+#include <bit>
+
 #include "dolphin/interpreter/system.hpp"
 #include "dolphin/interpreter/instructions/forms.hpp"
-#include "dolphin/process.hpp"
 
-#include "gui/appmain/application.hpp"
 #include "core/log.hpp"
 
-using namespace Toolbox::Dolphin;
-
 namespace Toolbox::Interpreter {
+
+    namespace {
+
+        // Physical address of a d(rA) access, wrapped the same way as in the
+        // processors.
+        s32 DataAddress(Register::GPR base, s32 d) {
+            return static_cast<s32>(base + d - 0x80000000) & 0x7FFFFFFF;
+        }
+
+    }  // namespace
+
     SystemDolphin SystemDolphin::CreateDetached() {
         SystemDolphin &&interpreter = SystemDolphin();
-        interpreter.m_storage.alloc(0x1800000);
+        interpreter.m_storage.initialize(0x1800000);
         return interpreter;
     }
 
     SystemDolphin &SystemDolphin::operator=(SystemDolphin &&other) noexcept {
         m_storage             = std::move(other.m_storage);
+        m_icache              = std::move(other.m_icache);
         m_branch_proc         = std::move(other.m_branch_proc);
         m_fixed_proc          = std::move(other.m_fixed_proc);
         m_float_proc          = std::move(other.m_float_proc);
@@ -34,13 +44,6 @@ namespace Toolbox::Interpreter {
 
     SystemDolphin::SystemDolphin() : m_evaluating(false) { bindCallbacks(); }
 
-    SystemDolphin::SystemDolphin(const Dolphin::DolphinCommunicator &communicator)
-        : m_evaluating(false) {
-        bindCallbacks();
-        m_storage.setBuf(communicator.manager().getMemoryView(),
-                         communicator.manager().getMemorySize());
-    }
-
     SystemDolphin::SystemDolphin(const SystemDolphin &other)
         : m_storage(other.m_storage), m_branch_proc(other.m_branch_proc),
           m_fixed_proc(other.m_fixed_proc), m_float_proc(other.m_float_proc),
@@ -52,10 +55,10 @@ namespace Toolbox::Interpreter {
     }
 
     SystemDolphin::SystemDolphin(SystemDolphin &&other) noexcept
-        : m_storage(other.m_storage), m_branch_proc(other.m_branch_proc),
-          m_fixed_proc(other.m_fixed_proc), m_float_proc(other.m_float_proc),
-          m_system_proc(other.m_system_proc), m_evaluating(false),
-          m_system_return_cb(other.m_system_return_cb),
+        : m_storage(std::move(other.m_storage)), m_icache(std::move(other.m_icache)),
+          m_branch_proc(other.m_branch_proc), m_fixed_proc(other.m_fixed_proc),
+          m_float_proc(other.m_float_proc), m_system_proc(other.m_system_proc),
+          m_evaluating(false), m_system_return_cb(other.m_system_return_cb),
           m_system_exception_cb(other.m_system_exception_cb),
           m_system_invalid_cb(other.m_system_invalid_cb) {
         bindCallbacks();
@@ -76,957 +79,2194 @@ namespace Toolbox::Interpreter {
             m_float_proc.m_fpr[fpr_arg + 1].fill(fpr_argv[fpr_arg]);
         }
 
-        m_evaluating = true;
-
-        evalLoop();
-
-        return createSnapshot();
-    }
-
-    void SystemDolphin::evalLoop() {
-        while (m_evaluating) {
-            if (m_system_proc.m_pc == (0xdeadbeef & ~0b11)) {
-                m_evaluating = false;
+        // Dolphin keeps running between calls when evaluating upon its live
+        // view, and those writes never pass through the storage.
+        if (!m_storage.isCopyOnWrite()) {
+            m_icache.revalidateAll();
+        }
+
+        m_evaluating = true;
+
+        evalLoop();
+
+        return createSnapshot();
+    }
+
+    void SystemDolphin::executeUnknown(const DecodedInstruction &, Register::PC &) {
+        internalInvalidCB(
+            PROC_INVALID_MSG(SystemDolphin, unknown, "Attempted to evaluate unknown instruction!"));
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_TWI>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.twi(op.m_d, op.m_a, op.m_imm);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_MULLI>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.mulli(op.m_d, op.m_a, op.m_imm);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_SUBFIC>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.subfic(op.m_d, op.m_a, op.m_imm);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_CMPLI>(const DecodedInstruction &op,
+                                                                       Register::PC &) {
+        if (op.l()) {
+            m_fixed_proc.cmpli(op.crfD(), op.l(), op.m_a, op.uimm(), m_branch_proc.m_cr);
+            return;
+        }
+        m_branch_proc.m_cr.cmp(op.crfD(), static_cast<u32>(m_fixed_proc.m_gpr[op.m_a]),
+                               static_cast<u32>(op.uimm()), m_fixed_proc.m_xer);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_CMPI>(const DecodedInstruction &op,
+                                                                      Register::PC &) {
+        if (op.l()) {
+            m_fixed_proc.cmpi(op.crfD(), op.l(), op.m_a, op.m_imm, m_branch_proc.m_cr);
+            return;
+        }
+        m_branch_proc.m_cr.cmp(op.crfD(), static_cast<s32>(m_fixed_proc.m_gpr[op.m_a]), op.m_imm,
+                               m_fixed_proc.m_xer);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_ADDIC>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.addic(op.m_d, op.m_a, op.m_imm, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_ADDI>(const DecodedInstruction &op,
+                                                                      Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s16 si       = static_cast<s16>(op.m_imm);
+        gpr[op.m_d]        = (op.m_a == 0 ? si : gpr[op.m_a] + si) & 0xFFFFFFFF;
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_ADDIS>(const DecodedInstruction &op,
+                                                                       Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s16 si       = static_cast<s16>(op.m_imm);
+        gpr[op.m_d]        = ((op.m_a == 0 ? si : gpr[op.m_a] + si) << 16) & 0xFFFFFFFF;
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_BC>(const DecodedInstruction &op,
+                                               Register::PC &next_instruction) {
+        next_instruction -= 4;
+        m_branch_proc.bc(op.m_imm, op.m_d, op.m_a, op.aa(), op.lk(), next_instruction);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_SC>(const DecodedInstruction &op, Register::PC &) {
+        m_system_proc.sc(FORM_LEV(op.m_inst));
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_B>(const DecodedInstruction &op,
+                                              Register::PC &next_instruction) {
+        next_instruction -= 4;
+        m_branch_proc.b(op.m_imm, op.aa(), op.lk(), next_instruction);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_RLWIMI>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.rlwimi(op.m_a, op.m_d, op.m_b, op.m_c, op.m_me, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void
+    SystemDolphin::execute<Opcode::OP_RLWINM>(const DecodedInstruction &op, Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        gpr[op.m_a] = std::rotl<u32>(static_cast<u32>(gpr[op.m_d]), op.m_b) & op.m_imm;
+        if (op.rc()) {
+            m_branch_proc.m_cr.cmp(0, static_cast<s32>(gpr[op.m_a]), 0, m_fixed_proc.m_xer);
+        }
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_RLWNM>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.rlwnm(op.m_a, op.m_d, op.m_b, op.m_c, op.m_me, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_ORI>(const DecodedInstruction &op,
+                                                                     Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        gpr[op.m_a]        = (gpr[op.m_d] | op.uimm()) & 0xFFFFFFFF;
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_ORIS>(const DecodedInstruction &op,
+                                                                      Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        gpr[op.m_a]        = (gpr[op.m_d] | (static_cast<u64>(op.uimm()) << 16)) & 0xFFFFFFFF;
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_XORI>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.xori(op.m_a, op.m_d, op.uimm());
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_XORIS>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.xoris(op.m_a, op.m_d, op.uimm());
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_ANDI>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.andi(op.m_a, op.m_d, op.uimm(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_ANDIS>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.andis(op.m_a, op.m_d, op.uimm(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_LWZ>(const DecodedInstruction &op,
+                                                                     Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s32 address  = DataAddress(gpr[op.m_a], op.m_imm);
+        if (!MemoryContainsPAddress(m_storage, address)) {
+            m_fixed_proc.m_exception_cb(ExceptionCause::EXCEPTION_DSI);
+            return;
+        }
+        gpr[op.m_d] = std::byteswap(m_storage.get<u32>(address));
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_LWZU>(const DecodedInstruction &op,
+                                                                      Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s32 address  = DataAddress(gpr[op.m_a], op.m_imm);
+        if (!MemoryContainsPAddress(m_storage, address)) {
+            m_fixed_proc.m_exception_cb(ExceptionCause::EXCEPTION_DSI);
+            return;
+        }
+        gpr[op.m_d] = std::byteswap(m_storage.get<u32>(address));
+        gpr[op.m_a] += static_cast<s16>(op.m_imm);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_LBZ>(const DecodedInstruction &op,
+                                                                     Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s32 address  = DataAddress(gpr[op.m_a], op.m_imm);
+        if (!MemoryContainsPAddress(m_storage, address)) {
+            m_fixed_proc.m_exception_cb(ExceptionCause::EXCEPTION_DSI);
+            return;
+        }
+        gpr[op.m_d] = m_storage.get<u8>(address);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_LBZU>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.lbzu(op.m_d, op.m_imm, op.m_a, m_storage);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_STW>(const DecodedInstruction &op,
+                                                                     Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s32 address  = DataAddress(gpr[op.m_a], op.m_imm);
+        if (!MemoryContainsPAddress(m_storage, address)) {
+            m_fixed_proc.m_exception_cb(ExceptionCause::EXCEPTION_DSI);
+            return;
+        }
+        m_storage.set<bu32>(address, static_cast<u32>(gpr[op.m_d]));
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_STWU>(const DecodedInstruction &op,
+                                                                      Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s32 address  = DataAddress(gpr[op.m_a], op.m_imm);
+        if (!MemoryContainsPAddress(m_storage, address)) {
+            m_fixed_proc.m_exception_cb(ExceptionCause::EXCEPTION_DSI);
+            return;
+        }
+        m_storage.set<bu32>(address, static_cast<u32>(gpr[op.m_d]));
+        gpr[op.m_a] += static_cast<s16>(op.m_imm);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_STB>(const DecodedInstruction &op,
+                                                                     Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s32 address  = DataAddress(gpr[op.m_a], op.m_imm);
+        if (!MemoryContainsPAddress(m_storage, address)) {
+            m_fixed_proc.m_exception_cb(ExceptionCause::EXCEPTION_DSI);
+            return;
+        }
+        m_storage.set<u8>(address, static_cast<u8>(gpr[op.m_d]));
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_STBU>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.stbu(op.m_d, op.m_imm, op.m_a, m_storage);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_LHZ>(const DecodedInstruction &op,
+                                                                     Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s32 address  = DataAddress(gpr[op.m_a], op.m_imm);
+        if (!MemoryContainsPAddress(m_storage, address)) {
+            m_fixed_proc.m_exception_cb(ExceptionCause::EXCEPTION_DSI);
+            return;
+        }
+        gpr[op.m_d] = std::byteswap(m_storage.get<u16>(address));
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_LHZU>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.lhzu(op.m_d, op.m_imm, op.m_a, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_LHA>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.lha(op.m_d, op.m_imm, op.m_a, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_LHAU>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.lhau(op.m_d, op.m_imm, op.m_a, m_storage);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void SystemDolphin::execute<Opcode::OP_STH>(const DecodedInstruction &op,
+                                                                     Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const s32 address  = DataAddress(gpr[op.m_a], op.m_imm);
+        if (!MemoryContainsPAddress(m_storage, address)) {
+            m_fixed_proc.m_exception_cb(ExceptionCause::EXCEPTION_DSI);
+            return;
+        }
+        m_storage.set<bu16>(address, static_cast<u16>(gpr[op.m_d]));
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_STHU>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.sthu(op.m_d, op.m_imm, op.m_a, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_LMW>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.lmw(op.m_d, op.m_imm, op.m_a, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_STMW>(const DecodedInstruction &op, Register::PC &) {
+        m_fixed_proc.stmw(op.m_d, op.m_imm, op.m_a, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_LFS>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.lfs(op.m_d, op.m_imm, op.m_a, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_LFSU>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.lfsu(op.m_d, op.m_imm, op.m_a, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_LFD>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.lfd(op.m_d, op.m_imm, op.m_a, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_LFDU>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.lfdu(op.m_d, op.m_imm, op.m_a, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_STFS>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.stfs(op.m_d, op.m_imm, op.m_a, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_STFSU>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.stfsu(op.m_d, op.m_imm, op.m_a, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_STFD>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.stfd(op.m_d, op.m_imm, op.m_a, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_STFDU>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.stfdu(op.m_d, op.m_imm, op.m_a, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_PSQ_L>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.ps_l(op.m_d, op.m_imm, FORM_I(op.m_inst), op.m_a, FORM_W(op.m_inst),
+                          m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_PSQ_LU>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.ps_lu(op.m_d, op.m_imm, FORM_I(op.m_inst), op.m_a, FORM_W(op.m_inst),
+                           m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_PSQ_ST>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.ps_st(op.m_d, op.m_imm, FORM_I(op.m_inst), op.m_a, FORM_W(op.m_inst),
+                           m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<Opcode::OP_PSQ_STU>(const DecodedInstruction &op, Register::PC &) {
+        m_float_proc.ps_stu(op.m_d, op.m_imm, FORM_I(op.m_inst), op.m_a, FORM_W(op.m_inst),
+                            m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PSQ_LX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.ps_lx(op.m_d, FORM_IX(op.m_inst), op.m_a, op.m_b, FORM_WX(op.m_inst),
+                           m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PSQ_STX>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.ps_stx(op.m_d, FORM_IX(op.m_inst), op.m_a, op.m_b, FORM_WX(op.m_inst),
+                            m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_SUM0>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.ps_sum0(op.m_d, op.m_a, op.m_c, op.m_b, op.m_c, m_branch_proc.m_cr,
+                             m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_SUM1>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.ps_sum1(op.m_d, op.m_a, op.m_c, op.m_b, op.m_c, m_branch_proc.m_cr,
+                             m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MULS0>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.ps_muls0(op.m_d, op.m_a, op.m_c, op.m_c, m_branch_proc.m_cr,
+                              m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MULS1>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.ps_muls1(op.m_d, op.m_a, op.m_c, op.m_c, m_branch_proc.m_cr,
+                              m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MADDS0>(const DecodedInstruction &op,
+                                                            Register::PC &) {
+        m_float_proc.ps_madds1(op.m_d, op.m_a, op.m_c, op.m_b, op.m_c, m_branch_proc.m_cr,
+                               m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MADDS1>(const DecodedInstruction &op,
+                                                            Register::PC &) {
+        m_float_proc.ps_madds1(op.m_d, op.m_a, op.m_c, op.m_b, op.m_c, m_branch_proc.m_cr,
+                               m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_DIV>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.ps_div(op.m_d, op.m_a, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_SUB>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.ps_sub(op.m_d, op.m_a, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_ADD>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.ps_add(op.m_d, op.m_a, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_SEL>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.ps_sel(op.m_d, op.m_a, op.m_c, op.m_b, op.m_c, m_branch_proc.m_cr,
+                            m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_RES>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.ps_res(op.m_d, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MUL>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.ps_mul(op.m_d, op.m_a, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_RSQRTE>(const DecodedInstruction &op,
+                                                            Register::PC &) {
+        m_float_proc.ps_rsqrte(op.m_d, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                               m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MSUB>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.ps_msub(op.m_d, op.m_a, op.m_c, op.m_b, op.m_c, m_branch_proc.m_cr,
+                             m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MADD>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.ps_madd(op.m_d, op.m_a, op.m_c, op.m_b, op.m_c, m_branch_proc.m_cr,
+                             m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_NMSUB>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.ps_nmsub(op.m_d, op.m_a, op.m_c, op.m_b, op.m_c, m_branch_proc.m_cr,
+                              m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_NMADD>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.ps_nmadd(op.m_d, op.m_a, op.m_c, op.m_b, op.m_c, m_branch_proc.m_cr,
+                              m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PSQ_LUX>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.ps_lux(op.m_d, FORM_IX(op.m_inst), op.m_a, op.m_b, FORM_WX(op.m_inst),
+                            m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PSQ_STUX>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.ps_stux(op.m_d, FORM_IX(op.m_inst), op.m_a, op.m_b, FORM_WX(op.m_inst),
+                             m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_CMPU0>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.ps_cmpu0(op.crfD(), op.m_a, op.m_b, m_branch_proc.m_cr, m_system_proc.m_msr,
+                              m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_CMPO0>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.ps_cmpo0(op.crfD(), op.m_a, op.m_b, m_branch_proc.m_cr, m_system_proc.m_msr,
+                              m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_NEG>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.ps_neg(op.m_d, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_CMPU1>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.ps_cmpu1(op.crfD(), op.m_a, op.m_b, m_branch_proc.m_cr, m_system_proc.m_msr,
+                              m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MR>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.ps_mr(op.m_d, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_CMPO1>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.ps_cmpo1(op.crfD(), op.m_a, op.m_b, m_branch_proc.m_cr, m_system_proc.m_msr,
+                              m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_NABS>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.ps_nabs(op.m_d, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                             m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_ABS>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.ps_abs(op.m_d, op.m_b, op.m_c, m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MERGE00>(const DecodedInstruction &op,
+                                                             Register::PC &) {
+        m_float_proc.ps_merge00(op.m_d, op.m_a, op.m_b, op.m_c, m_branch_proc.m_cr,
+                                m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MERGE01>(const DecodedInstruction &op,
+                                                             Register::PC &) {
+        m_float_proc.ps_merge01(op.m_d, op.m_a, op.m_b, op.m_c, m_branch_proc.m_cr,
+                                m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MERGE10>(const DecodedInstruction &op,
+                                                             Register::PC &) {
+        m_float_proc.ps_merge10(op.m_d, op.m_a, op.m_b, op.m_c, m_branch_proc.m_cr,
+                                m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode4::PS_MERGE11>(const DecodedInstruction &op,
+                                                             Register::PC &) {
+        m_float_proc.ps_merge11(op.m_d, op.m_a, op.m_b, op.m_c, m_branch_proc.m_cr,
+                                m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::MCRF>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_branch_proc.mcrf(op.m_d, op.m_a);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::BCLR>(const DecodedInstruction &op,
+                                                        Register::PC &next_instruction) {
+        next_instruction -= 4;
+        m_branch_proc.bclr(op.m_d, op.m_a, op.lk(), next_instruction);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::CRNOR>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_branch_proc.crnor(op.m_d, op.m_a, op.m_b);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::RFI>(const DecodedInstruction &, Register::PC &) {
+        m_system_proc.rfi();
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::CRANDC>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_branch_proc.crandc(op.m_d, op.m_a, op.m_b);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::ISYNC>(const DecodedInstruction &,
+                                                         Register::PC &) {
+        m_system_proc.sync((SyncType)0);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::CRXOR>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_branch_proc.crxor(op.m_d, op.m_a, op.m_b);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::CRNAND>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_branch_proc.crnand(op.m_d, op.m_a, op.m_b);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::CRAND>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_branch_proc.crand(op.m_d, op.m_a, op.m_b);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::CREQV>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_branch_proc.creqv(op.m_d, op.m_a, op.m_b);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::CRORC>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_branch_proc.crorc(op.m_d, op.m_a, op.m_b);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::CROR>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_branch_proc.cror(op.m_d, op.m_a, op.m_b);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode19::BCCTR>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_branch_proc.bcctr(op.m_d, op.m_a, op.lk(), m_system_proc.m_pc);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void
+    SystemDolphin::execute<TableSubOpcode31::ADD>(const DecodedInstruction &op, Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const u64 result   = gpr[op.m_a] + gpr[op.m_b];
+        gpr[op.m_d]        = result & 0xFFFFFFFF;
+        if (op.oe() && result > 0xFFFFFFFF) {
+            XER_SET_OV(m_fixed_proc.m_xer, true);
+            XER_SET_SO(m_fixed_proc.m_xer, true);
+        }
+        if (op.rc()) {
+            m_branch_proc.m_cr.cmp(0, static_cast<s32>(gpr[op.m_d]), 0, m_fixed_proc.m_xer);
+        }
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::ADDC>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.addc(op.m_d, op.m_a, op.m_b, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::ADDE>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.adde(op.m_d, op.m_a, op.m_b, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::ADDME>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.addme(op.m_d, op.m_a, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::ADDZE>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.addze(op.m_d, op.m_a, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::DIVW>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.divw(op.m_d, op.m_a, op.m_b, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::DIVWU>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.divwu(op.m_d, op.m_a, op.m_b, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MULHW>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.mullhw(op.m_d, op.m_a, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MULHWU>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_fixed_proc.mullhwu(op.m_d, op.m_a, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MULLW>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.mullw(op.m_d, op.m_a, op.m_b, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void
+    SystemDolphin::execute<TableSubOpcode31::SUBF>(const DecodedInstruction &op, Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        const u64 result   = ~gpr[op.m_a] + gpr[op.m_b] + 1;
+        gpr[op.m_d]        = result & 0xFFFFFFFF;
+        if (op.oe() && result > 0xFFFFFFFF) {
+            XER_SET_OV(m_fixed_proc.m_xer, true);
+            XER_SET_SO(m_fixed_proc.m_xer, true);
+        }
+        if (op.rc()) {
+            m_branch_proc.m_cr.cmp(0, static_cast<s32>(gpr[op.m_d]), 0, m_fixed_proc.m_xer);
+        }
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::SUBFC>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.subfc(op.m_d, op.m_a, op.m_b, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::SUBFE>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.subfe(op.m_d, op.m_a, op.m_b, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::SUBFME>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_fixed_proc.subfme(op.m_d, op.m_a, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::SUBFZE>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_fixed_proc.subfze(op.m_d, op.m_a, op.oe(), op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void
+    SystemDolphin::execute<TableSubOpcode31::AND>(const DecodedInstruction &op, Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        gpr[op.m_a]        = (gpr[op.m_d] & gpr[op.m_b]) & 0xFFFFFFFF;
+        if (op.rc()) {
+            m_branch_proc.m_cr.cmp(0, static_cast<s32>(gpr[op.m_a]), 0, m_fixed_proc.m_xer);
+        }
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::ANDC>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.andc(op.m_a, op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void
+    SystemDolphin::execute<TableSubOpcode31::OR>(const DecodedInstruction &op, Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        gpr[op.m_a]        = (gpr[op.m_d] | gpr[op.m_b]) & 0xFFFFFFFF;
+        if (op.rc()) {
+            m_branch_proc.m_cr.cmp(0, static_cast<s32>(gpr[op.m_a]), 0, m_fixed_proc.m_xer);
+        }
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::NOR>(const DecodedInstruction &op,
+                                                       Register::PC &) {
+        m_fixed_proc.nor_(op.m_a, op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void
+    SystemDolphin::execute<TableSubOpcode31::XOR>(const DecodedInstruction &op, Register::PC &) {
+        Register::GPR *gpr = m_fixed_proc.m_gpr;
+        gpr[op.m_a]        = (gpr[op.m_d] ^ gpr[op.m_b]) & 0xFFFFFFFF;
+        if (op.rc()) {
+            m_branch_proc.m_cr.cmp(0, static_cast<s32>(gpr[op.m_a]), 0, m_fixed_proc.m_xer);
+        }
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::ORC>(const DecodedInstruction &op,
+                                                       Register::PC &) {
+        m_fixed_proc.orc(op.m_a, op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::NAND>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.nand_(op.m_a, op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::EQV>(const DecodedInstruction &op,
+                                                       Register::PC &) {
+        m_fixed_proc.eqv_(op.m_a, op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void
+    SystemDolphin::execute<TableSubOpcode31::CMP>(const DecodedInstruction &op, Register::PC &) {
+        if (op.l()) {
+            m_fixed_proc.cmp(op.crfD(), op.l(), op.m_a, op.m_b, m_branch_proc.m_cr);
+            return;
+        }
+        const Register::GPR *gpr = m_fixed_proc.m_gpr;
+        m_branch_proc.m_cr.cmp(op.crfD(), static_cast<s32>(gpr[op.m_a]),
+                               static_cast<s32>(gpr[op.m_b]), m_fixed_proc.m_xer);
+    }
+
+    template <>
+    TOOLBOX_FORCE_INLINE void
+    SystemDolphin::execute<TableSubOpcode31::CMPL>(const DecodedInstruction &op, Register::PC &) {
+        if (op.l()) {
+            m_fixed_proc.cmpl(op.crfD(), op.l(), op.m_a, op.m_b, m_branch_proc.m_cr);
+            return;
+        }
+        const Register::GPR *gpr = m_fixed_proc.m_gpr;
+        m_branch_proc.m_cr.cmp(op.crfD(), static_cast<u32>(gpr[op.m_a]),
+                               static_cast<u32>(gpr[op.m_b]), m_fixed_proc.m_xer);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::CNTLZW>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_fixed_proc.cntlzw(op.m_a, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::EXTSH>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.extsh(op.m_a, op.m_d, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::EXTSB>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.extsb(op.m_a, op.m_d, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::SRW>(const DecodedInstruction &op,
+                                                       Register::PC &) {
+        m_fixed_proc.srw(op.m_a, op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::SRAW>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.sraw(op.m_a, op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::SRAWI>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.srawi(op.m_a, op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::SLW>(const DecodedInstruction &op,
+                                                       Register::PC &) {
+        m_fixed_proc.slw(op.m_a, op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::DCBST>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_system_proc.dcbst(op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::DCBF>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_system_proc.dcbf(op.m_a, op.m_b, op.l(), m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::DCBTST>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_system_proc.dcbtst(op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::DCBT>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_system_proc.dcbst(op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::DCBI>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_system_proc.dcbi(op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::DCBA>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_system_proc.dcbz(op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LWZX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.lwzx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LWZUX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.lwzux(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LHZX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.lhzx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LHZUX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.lhzux(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LHAX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.lhax(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LHAUX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.lhaux(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LBZX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.lbzx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LBZUX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.lbzux(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LWBRX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.lwbrx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LHBRX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.lhbrx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LWARX>(const DecodedInstruction &,
+                                                         Register::PC &) {
+        internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, lwarx,
+                                           "Attempted to evaluate unknown instruction!"));
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LSWX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.lswx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LSWI>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.lswi(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STWX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.stwx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STWUX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.stwux(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STHX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.sthx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STHUX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.sthux(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STBX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.stbx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STBUX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.stbux(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STWBRX>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_fixed_proc.stwbrx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STHBRX>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_fixed_proc.sthbrx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STSWX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.stswx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STSWI>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.stswi(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LFSX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.lfsx(op.m_d, op.m_a, op.m_b, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LFSUX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.lfsux(op.m_d, op.m_a, op.m_b, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LFDX>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.lfdx(op.m_d, op.m_a, op.m_b, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::LFDUX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.lfdux(op.m_d, op.m_a, op.m_b, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STFSX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.stfsx(op.m_d, op.m_a, op.m_b, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STFSUX>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.stfsux(op.m_d, op.m_a, op.m_b, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STFDX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.stfdx(op.m_d, op.m_a, op.m_b, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STFDUX>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.stfdux(op.m_d, op.m_a, op.m_b, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::STFIWX>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.stfiwx(op.m_d, op.m_a, op.m_b, m_fixed_proc.m_gpr, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MFCR>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.mfcr(op.m_d, m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MFMSR>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.mfmsr(op.m_d, m_system_proc.m_msr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MTCRF>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.mtcrf(FORM_CRM(op.m_inst), op.m_d, m_branch_proc.m_cr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MTMSR>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.mtmsr(op.m_d, m_system_proc.m_msr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MTSR>(const DecodedInstruction &,
+                                                        Register::PC &) {
+        internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, mtsr,
+                                           "Attempted to evaluate unknown instruction!"));
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MTSRIN>(const DecodedInstruction &,
+                                                          Register::PC &) {
+        internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, mtsrin,
+                                           "Attempted to evaluate unknown instruction!"));
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MFSPR>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.mfspr((Register::SPRType)FORM_SPR(op.m_inst), op.m_d, m_branch_proc.m_lr,
+                           m_branch_proc.m_ctr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MTSPR>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.mtspr((Register::SPRType)FORM_SPR(op.m_inst), op.m_d, m_branch_proc.m_lr,
+                           m_branch_proc.m_ctr);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MFTB>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_fixed_proc.mftb(op.m_d, FORM_TBR(op.m_inst), m_system_proc.m_tb);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MCRXR>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.mcrxr(m_branch_proc.m_cr, op.crfD());
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MFSR>(const DecodedInstruction &,
+                                                        Register::PC &) {
+        internalInvalidCB(
+            PROC_INVALID_MSG(SystemDolphin, mfsr, "Attempted to evaluate unknown instruction!"));
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::MFSRIN>(const DecodedInstruction &,
+                                                          Register::PC &) {
+        internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, mfsrin,
+                                           "Attempted to evaluate unknown instruction!"));
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::TW>(const DecodedInstruction &op,
+                                                      Register::PC &) {
+        m_fixed_proc.tw(op.m_d, op.m_a, op.m_b);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::SYNC>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_system_proc.sync((SyncType)FORM_I(op.m_inst));
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::ICBI>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_system_proc.icbi(op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::ECIWX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.eciwx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::ECOWX>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_fixed_proc.ecowx(op.m_d, op.m_a, op.m_b, m_storage);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::EIEIO>(const DecodedInstruction &,
+                                                         Register::PC &) {
+        m_system_proc.eieio();
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::TLBIE>(const DecodedInstruction &,
+                                                         Register::PC &) {
+        internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, tlbie,
+                                           "Attempted to evaluate unknown instruction!"));
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode31::TLBSYNC>(const DecodedInstruction &,
+                                                           Register::PC &) {
+        internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, tlbsync,
+                                           "Attempted to evaluate unknown instruction!"));
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode59::FDIVS>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fdivs(op.m_d, op.m_a, op.m_c, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode59::FSUBS>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fsubs(op.m_d, op.m_a, op.m_c, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode59::FADDS>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fadds(op.m_d, op.m_a, op.m_c, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode59::FRES>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.fres(op.m_d, op.m_a, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                          m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode59::FMULS>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fmuls(op.m_d, op.m_a, op.m_c, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode59::FMSUBS>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.fmsubs(op.m_d, op.m_a, op.m_c, op.m_b, op.rc(), m_branch_proc.m_cr,
+                            m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode59::FMADDS>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.fmadds(op.m_d, op.m_a, op.m_c, op.m_b, op.rc(), m_branch_proc.m_cr,
+                            m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode59::FNMSUBS>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.fnmsubs(op.m_d, op.m_a, op.m_c, op.m_b, op.rc(), m_branch_proc.m_cr,
+                             m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode59::FNMADDS>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.fnmadds(op.m_d, op.m_a, op.m_c, op.m_b, op.rc(), m_branch_proc.m_cr,
+                             m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FDIV>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.fdiv(op.m_d, op.m_a, op.m_c, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                          m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FSUB>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.fsub(op.m_d, op.m_a, op.m_c, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                          m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FADD>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.fadd(op.m_d, op.m_a, op.m_c, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                          m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FSEL>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.fsel(op.m_d, op.m_a, op.m_c, op.m_b, op.rc(), m_branch_proc.m_cr,
+                          m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FMUL>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.fmul(op.m_d, op.m_a, op.m_c, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                          m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FRSQRTE>(const DecodedInstruction &op,
+                                                           Register::PC &) {
+        m_float_proc.frsqrte(op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                             m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FMSUB>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fmsub(op.m_d, op.m_a, op.m_c, op.m_b, op.rc(), m_branch_proc.m_cr,
+                           m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FMADD>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fmadd(op.m_d, op.m_a, op.m_c, op.m_b, op.rc(), m_branch_proc.m_cr,
+                           m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FNMSUB>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.fnmsub(op.m_d, op.m_a, op.m_c, op.m_b, op.rc(), m_branch_proc.m_cr,
+                            m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FNMADD>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.fnmadd(op.m_d, op.m_a, op.m_c, op.m_b, op.rc(), m_branch_proc.m_cr,
+                            m_system_proc.m_msr, m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FCMPU>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fcmpu(op.crfD(), op.m_a, op.m_b, m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FRSP>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.frsp(op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                          m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FCTIW>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fctiw(op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FCTIWZ>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.fctiwz(op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FCMPO>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fcmpo(op.crfD(), op.m_a, op.m_b, m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::MTFSB1>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.mtfsb1(op.m_d, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FNEG>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.fneg(op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                          m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::MCRFS>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.mcrfs(op.m_d, op.m_a, m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::MTFSB0>(const DecodedInstruction &op,
+                                                          Register::PC &) {
+        m_float_proc.mtfsb0(op.m_d, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                            m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FMR>(const DecodedInstruction &op,
+                                                       Register::PC &) {
+        m_float_proc.fmr(op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                         m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FNABS>(const DecodedInstruction &op,
+                                                         Register::PC &) {
+        m_float_proc.fnabs(op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                           m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::FABS>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.fabs(op.m_d, op.m_b, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                          m_system_proc.m_srr1);
+    }
+
+    template <>
+    void SystemDolphin::execute<TableSubOpcode63::MFFS>(const DecodedInstruction &op,
+                                                        Register::PC &) {
+        m_float_proc.mffs(op.m_d, op.rc(), m_branch_proc.m_cr, m_system_proc.m_msr,
+                          m_system_proc.m_srr1);
+    }
+
+    void SystemDolphin::evalLoop() {
+        while (m_evaluating) {
+            const u32 pc = static_cast<u32>(m_system_proc.m_pc);
+            if (pc == (0xdeadbeef & ~0b11)) {
+                m_evaluating = false;
+                break;
+            }
+            if (!MemoryContainsVAddress(m_storage, pc)) {
+                internalExceptionCB(ExceptionCause::EXCEPTION_ISI);
+                break;
+            }
+            evaluateBlock(
+                m_icache.fetchBlock(m_storage, pc & 0x7FFFFFFF, &SystemDolphin::decodeInstruction));
+        }
+    }
+
+    // Runs the straight line starting at the PC. Only the last instruction of
+    // a block can branch, so every other one is followed by pc + 4, and the
+    // sentinel and range checks are left to evalLoop() between blocks. The
+    // most common integer and load/store forms are expanded in place rather
+    // than called through their handler, and the PC registers are only
+    // stored ahead of instructions that can observe them or raise.
+    void SystemDolphin::evaluateBlock(const DecodedInstruction *block) {
+        const DecodedInstruction *last = block + block->m_block_length - 1;
+
+        Register::PC pc      = m_system_proc.m_pc;
+        Register::PC last_pc = m_system_proc.m_last_pc;
+        m_leave_block        = false;
+        for (const DecodedInstruction *op = block; op != last; ++op) {
+            Register::PC next_instruction = pc + 4;
+            switch (op->m_inline_op) {
+            case InlineOp::ADDI:
+                execute<Opcode::OP_ADDI>(*op, next_instruction);
+                break;
+            case InlineOp::ADDIS:
+                execute<Opcode::OP_ADDIS>(*op, next_instruction);
+                break;
+            case InlineOp::ORI:
+                execute<Opcode::OP_ORI>(*op, next_instruction);
+                break;
+            case InlineOp::ORIS:
+                execute<Opcode::OP_ORIS>(*op, next_instruction);
+                break;
+            case InlineOp::RLWINM:
+                execute<Opcode::OP_RLWINM>(*op, next_instruction);
+                break;
+            case InlineOp::CMPI:
+                execute<Opcode::OP_CMPI>(*op, next_instruction);
+                break;
+            case InlineOp::CMPLI:
+                execute<Opcode::OP_CMPLI>(*op, next_instruction);
+                break;
+            case InlineOp::ADD:
+                execute<TableSubOpcode31::ADD>(*op, next_instruction);
+                break;
+            case InlineOp::SUBF:
+                execute<TableSubOpcode31::SUBF>(*op, next_instruction);
+                break;
+            case InlineOp::AND:
+                execute<TableSubOpcode31::AND>(*op, next_instruction);
+                break;
+            case InlineOp::OR:
+                execute<TableSubOpcode31::OR>(*op, next_instruction);
+                break;
+            case InlineOp::XOR:
+                execute<TableSubOpcode31::XOR>(*op, next_instruction);
+                break;
+            case InlineOp::CMP:
+                execute<TableSubOpcode31::CMP>(*op, next_instruction);
+                break;
+            case InlineOp::CMPL:
+                execute<TableSubOpcode31::CMPL>(*op, next_instruction);
+                break;
+            default:
+                m_system_proc.m_last_pc = last_pc;
+                m_system_proc.m_pc      = pc;
+                switch (op->m_inline_op) {
+                case InlineOp::LWZ:
+                    execute<Opcode::OP_LWZ>(*op, next_instruction);
+                    break;
+                case InlineOp::LWZU:
+                    execute<Opcode::OP_LWZU>(*op, next_instruction);
+                    break;
+                case InlineOp::LBZ:
+                    execute<Opcode::OP_LBZ>(*op, next_instruction);
+                    break;
+                case InlineOp::LHZ:
+                    execute<Opcode::OP_LHZ>(*op, next_instruction);
+                    break;
+                case InlineOp::STW:
+                    execute<Opcode::OP_STW>(*op, next_instruction);
+                    break;
+                case InlineOp::STWU:
+                    execute<Opcode::OP_STWU>(*op, next_instruction);
+                    break;
+                case InlineOp::STB:
+                    execute<Opcode::OP_STB>(*op, next_instruction);
+                    break;
+                case InlineOp::STH:
+                    execute<Opcode::OP_STH>(*op, next_instruction);
+                    break;
+                default:
+                    (this->*op->m_handler)(*op, next_instruction);
+                    break;
+                }
+                if (m_leave_block) {
+                    m_system_proc.m_last_pc = pc;
+                    m_system_proc.m_pc      = pc + 4;
+                    return;
+                }
+                break;
+            }
+            last_pc = pc;
+            pc += 4;
+        }
+
+        Register::PC next_instruction = pc + 4;
+        m_system_proc.m_last_pc       = last_pc;
+        m_system_proc.m_pc            = pc;
+        (this->*last->m_handler)(*last, next_instruction);
+
+        m_system_proc.m_last_pc = pc;
+        m_system_proc.m_pc      = next_instruction;
+    }
+
+    const std::pair<SystemDolphin::handler_t, InlineOp> SystemDolphin::s_inline_handlers[] = {
+        {&SystemDolphin::execute<Opcode::OP_ADDI>, InlineOp::ADDI},
+        {&SystemDolphin::execute<Opcode::OP_ADDIS>, InlineOp::ADDIS},
+        {&SystemDolphin::execute<Opcode::OP_ORI>, InlineOp::ORI},
+        {&SystemDolphin::execute<Opcode::OP_ORIS>, InlineOp::ORIS},
+        {&SystemDolphin::execute<Opcode::OP_RLWINM>, InlineOp::RLWINM},
+        {&SystemDolphin::execute<Opcode::OP_CMPI>, InlineOp::CMPI},
+        {&SystemDolphin::execute<Opcode::OP_CMPLI>, InlineOp::CMPLI},
+        {&SystemDolphin::execute<Opcode::OP_LWZ>, InlineOp::LWZ},
+        {&SystemDolphin::execute<Opcode::OP_LWZU>, InlineOp::LWZU},
+        {&SystemDolphin::execute<Opcode::OP_LBZ>, InlineOp::LBZ},
+        {&SystemDolphin::execute<Opcode::OP_LHZ>, InlineOp::LHZ},
+        {&SystemDolphin::execute<Opcode::OP_STW>, InlineOp::STW},
+        {&SystemDolphin::execute<Opcode::OP_STWU>, InlineOp::STWU},
+        {&SystemDolphin::execute<Opcode::OP_STB>, InlineOp::STB},
+        {&SystemDolphin::execute<Opcode::OP_STH>, InlineOp::STH},
+        {&SystemDolphin::execute<TableSubOpcode31::ADD>, InlineOp::ADD},
+        {&SystemDolphin::execute<TableSubOpcode31::SUBF>, InlineOp::SUBF},
+        {&SystemDolphin::execute<TableSubOpcode31::AND>, InlineOp::AND},
+        {&SystemDolphin::execute<TableSubOpcode31::OR>, InlineOp::OR},
+        {&SystemDolphin::execute<TableSubOpcode31::XOR>, InlineOp::XOR},
+        {&SystemDolphin::execute<TableSubOpcode31::CMP>, InlineOp::CMP},
+        {&SystemDolphin::execute<TableSubOpcode31::CMPL>, InlineOp::CMPL},
+    };
+
+    void SystemDolphin::decodeInstruction(u32 inst, DecodedInstruction &out) {
+        const Opcode opcode = FORM_OPCD(inst);
+
+        out.m_handler = decodeHandler(inst);
+        out.m_inst    = inst;
+        out.m_d       = FORM_RD(inst);
+        out.m_a       = FORM_RA(inst);
+        out.m_b       = FORM_RB(inst);
+        out.m_c       = FORM_RC(inst);
+        out.m_me      = static_cast<u8>(FORM_ME(inst));
+
+        switch (opcode) {
+        case Opcode::OP_B:
+            out.m_imm = FORM_LI(inst);
+            break;
+        case Opcode::OP_BC:
+            out.m_imm = FORM_BD(inst);
+            break;
+        case Opcode::OP_RLWIMI:
+        case Opcode::OP_RLWINM:
+        case Opcode::OP_RLWNM:
+            out.m_imm = static_cast<s32>(MakeRotationMask(out.m_c, out.m_me));
+            break;
+        default:
+            out.m_imm = FORM_SI(inst);
+            break;
+        }
+
+        out.m_inline_op = InlineOp::NONE;
+        for (const auto &[handler, inline_op] : s_inline_handlers) {
+            if (out.m_handler == handler) {
+                out.m_inline_op = inline_op;
                 break;
             }
-            evaluateInstruction();
         }
-    }
-
-    void SystemDolphin::evaluateInstruction() {
-        DolphinCommunicator &communicator = MainApplication::instance().getDolphinCommunicator();
 
-        u32 inst      = read<u32>((u32)m_system_proc.m_pc);
-        Opcode opcode = FORM_OPCD(inst);
-
-        Register::PC next_instruction = m_system_proc.m_pc + 4;
+        out.m_ends_block = opcode == Opcode::OP_BC || opcode == Opcode::OP_SC ||
+                           opcode == Opcode::OP_B || opcode == Opcode::OP_CONTROL_FLOW ||
+                           out.m_handler == &SystemDolphin::executeUnknown;
+    }
 
+    SystemDolphin::handler_t SystemDolphin::decodeHandler(u32 inst) {
+        const Opcode opcode = FORM_OPCD(inst);
         switch (opcode) {
         case Opcode::OP_TWI:
-            m_fixed_proc.twi(FORM_TO(inst), FORM_RA(inst), FORM_SI(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_TWI>;
         case Opcode::OP_PAIRED_SINGLE:
-            evaluatePairedSingleSubOp(inst);
-            break;
+            return decodePairedSingleSubOp(inst);
         case Opcode::OP_MULLI:
-            m_fixed_proc.mulli(FORM_TO(inst), FORM_RA(inst), FORM_SI(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_MULLI>;
         case Opcode::OP_SUBFIC:
-            m_fixed_proc.subfic(FORM_TO(inst), FORM_RA(inst), FORM_SI(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_SUBFIC>;
         case Opcode::OP_CMPLI:
-            m_fixed_proc.cmpli(FORM_CRFD(inst), FORM_L(inst), FORM_RA(inst), FORM_UI(inst),
-                               m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_CMPLI>;
         case Opcode::OP_CMPI:
-            m_fixed_proc.cmpi(FORM_CRFD(inst), FORM_L(inst), FORM_RA(inst), FORM_SI(inst),
-                              m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_CMPI>;
         case Opcode::OP_ADDIC:
         case Opcode::OP_ADDIC_RC:
-            m_fixed_proc.addic(FORM_RS(inst), FORM_RA(inst), FORM_SI(inst), FORM_Rc(inst),
-                               m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_ADDIC>;
         case Opcode::OP_ADDI:
-            m_fixed_proc.addi(FORM_RS(inst), FORM_RA(inst), FORM_SI(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_ADDI>;
         case Opcode::OP_ADDIS:
-            m_fixed_proc.addis(FORM_RS(inst), FORM_RA(inst), FORM_SI(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_ADDIS>;
         case Opcode::OP_BC:
-            next_instruction -= 4;
-            m_branch_proc.bc(FORM_BD(inst), FORM_BO(inst), FORM_BI(inst), FORM_AA(inst),
-                             FORM_LK(inst), next_instruction);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_BC>;
         case Opcode::OP_SC:
-            m_system_proc.sc(FORM_LEV(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_SC>;
         case Opcode::OP_B:
-            next_instruction -= 4;
-            m_branch_proc.b(FORM_LI(inst), FORM_AA(inst), FORM_LK(inst), next_instruction);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_B>;
         case Opcode::OP_CONTROL_FLOW:
-            next_instruction = evaluateControlFlowSubOp(inst);
-            break;
+            return decodeControlFlowSubOp(inst);
         case Opcode::OP_RLWIMI:
-            m_fixed_proc.rlwimi(FORM_RA(inst), FORM_RS(inst), FORM_SH(inst), FORM_MB(inst),
-                                FORM_ME(inst), FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_RLWIMI>;
         case Opcode::OP_RLWINM:
-            m_fixed_proc.rlwinm(FORM_RA(inst), FORM_RS(inst), FORM_SH(inst), FORM_MB(inst),
-                                FORM_ME(inst), FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_RLWINM>;
         case Opcode::OP_RLWNM:
-            m_fixed_proc.rlwnm(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_MB(inst),
-                               FORM_ME(inst), FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_RLWNM>;
         case Opcode::OP_ORI:
-            m_fixed_proc.ori(FORM_RA(inst), FORM_RS(inst), FORM_UI(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_ORI>;
         case Opcode::OP_ORIS:
-            m_fixed_proc.oris(FORM_RA(inst), FORM_RS(inst), FORM_UI(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_ORIS>;
         case Opcode::OP_XORI:
-            m_fixed_proc.xori(FORM_RA(inst), FORM_RS(inst), FORM_UI(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_XORI>;
         case Opcode::OP_XORIS:
-            m_fixed_proc.xoris(FORM_RA(inst), FORM_RS(inst), FORM_UI(inst));
-            break;
+            return &SystemDolphin::execute<Opcode::OP_XORIS>;
         case Opcode::OP_ANDI:
-            m_fixed_proc.andi(FORM_RA(inst), FORM_RS(inst), FORM_UI(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_ANDI>;
         case Opcode::OP_ANDIS:
-            m_fixed_proc.andis(FORM_RA(inst), FORM_RS(inst), FORM_UI(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_ANDIS>;
         case Opcode::OP_FIXED:
-            next_instruction = evaluateFixedSubOp(inst);
-            break;
+            return decodeFixedSubOp(inst);
         case Opcode::OP_LWZ:
-            m_fixed_proc.lwz(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LWZ>;
         case Opcode::OP_LWZU:
-            m_fixed_proc.lwzu(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LWZU>;
         case Opcode::OP_LBZ:
-            m_fixed_proc.lbz(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LBZ>;
         case Opcode::OP_LBZU:
-            m_fixed_proc.lbzu(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LBZU>;
         case Opcode::OP_STW:
-            m_fixed_proc.stw(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STW>;
         case Opcode::OP_STWU:
-            m_fixed_proc.stwu(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STWU>;
         case Opcode::OP_STB:
-            m_fixed_proc.stb(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STB>;
         case Opcode::OP_STBU:
-            m_fixed_proc.stbu(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STBU>;
         case Opcode::OP_LHZ:
-            m_fixed_proc.lhz(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LHZ>;
         case Opcode::OP_LHZU:
-            m_fixed_proc.lhzu(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LHZU>;
         case Opcode::OP_LHA:
-            m_fixed_proc.lha(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LHA>;
         case Opcode::OP_LHAU:
-            m_fixed_proc.lhau(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LHAU>;
         case Opcode::OP_STH:
-            m_fixed_proc.sth(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STH>;
         case Opcode::OP_STHU:
-            m_fixed_proc.sthu(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STHU>;
         case Opcode::OP_LMW:
-            m_fixed_proc.lmw(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LMW>;
         case Opcode::OP_STMW:
-            m_fixed_proc.stmw(FORM_RS(inst), FORM_D(inst), FORM_RA(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STMW>;
         case Opcode::OP_LFS:
-            m_float_proc.lfs(FORM_FS(inst), FORM_D(inst), FORM_RA(inst), m_fixed_proc.m_gpr,
-                             m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LFS>;
         case Opcode::OP_LFSU:
-            m_float_proc.lfsu(FORM_FS(inst), FORM_D(inst), FORM_RA(inst), m_fixed_proc.m_gpr,
-                              m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LFSU>;
         case Opcode::OP_LFD:
-            m_float_proc.lfd(FORM_FS(inst), FORM_D(inst), FORM_RA(inst), m_fixed_proc.m_gpr,
-                             m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LFD>;
         case Opcode::OP_LFDU:
-            m_float_proc.lfdu(FORM_FS(inst), FORM_D(inst), FORM_RA(inst), m_fixed_proc.m_gpr,
-                              m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_LFDU>;
         case Opcode::OP_STFS:
-            m_float_proc.stfs(FORM_FS(inst), FORM_D(inst), FORM_RA(inst), m_fixed_proc.m_gpr,
-                              m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STFS>;
         case Opcode::OP_STFSU:
-            m_float_proc.stfsu(FORM_FS(inst), FORM_D(inst), FORM_RA(inst), m_fixed_proc.m_gpr,
-                               m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STFSU>;
         case Opcode::OP_STFD:
-            m_float_proc.stfd(FORM_FS(inst), FORM_D(inst), FORM_RA(inst), m_fixed_proc.m_gpr,
-                              m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STFD>;
         case Opcode::OP_STFDU:
-            m_float_proc.stfdu(FORM_FS(inst), FORM_D(inst), FORM_RA(inst), m_fixed_proc.m_gpr,
-                               m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_STFDU>;
         case Opcode::OP_PSQ_L:
-            m_float_proc.ps_l(FORM_FS(inst), FORM_D(inst), FORM_I(inst), FORM_RA(inst),
-                              FORM_W(inst), m_fixed_proc.m_gpr, m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_PSQ_L>;
         case Opcode::OP_PSQ_LU:
-            m_float_proc.ps_lu(FORM_FS(inst), FORM_D(inst), FORM_I(inst), FORM_RA(inst),
-                               FORM_W(inst), m_fixed_proc.m_gpr, m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_PSQ_LU>;
         case Opcode::OP_FS_MATH:
-            next_instruction = evaluateFloatSingleSubOp(inst);
-            break;
+            return decodeFloatSingleSubOp(inst);
         case Opcode::OP_PSQ_ST:
-            m_float_proc.ps_st(FORM_FS(inst), FORM_D(inst), FORM_I(inst), FORM_RA(inst),
-                               FORM_W(inst), m_fixed_proc.m_gpr, m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_PSQ_ST>;
         case Opcode::OP_PSQ_STU:
-            m_float_proc.ps_stu(FORM_FS(inst), FORM_D(inst), FORM_I(inst), FORM_RA(inst),
-                                FORM_W(inst), m_fixed_proc.m_gpr, m_storage);
-            break;
+            return &SystemDolphin::execute<Opcode::OP_PSQ_STU>;
         case Opcode::OP_FLOAT:
-            next_instruction = evaluateFloatSubOp(inst);
-            break;
+            return decodeFloatSubOp(inst);
         default:
-            internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, unknown,
-                                               "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::executeUnknown;
         }
-
-        m_system_proc.m_last_pc = m_system_proc.m_pc;
-        m_system_proc.m_pc      = next_instruction;
     }
 
-    Register::PC SystemDolphin::evaluatePairedSingleSubOp(u32 inst) {
-        // Some ps instructions use 5 bits and others use 10.
-        TableSubOpcode4 sub_op_5  = (TableSubOpcode4)FORM_XO_5(inst);
-        TableSubOpcode4 sub_op_10 = (TableSubOpcode4)FORM_XO_10(inst);
-
+    SystemDolphin::handler_t SystemDolphin::decodePairedSingleSubOp(u32 inst) {
+        const TableSubOpcode4 sub_op_5  = (TableSubOpcode4)FORM_XO_5(inst);
+        const TableSubOpcode4 sub_op_10 = (TableSubOpcode4)FORM_XO_10(inst);
         switch (sub_op_5) {
         case TableSubOpcode4::PSQ_LX:
-            m_float_proc.ps_lx(FORM_FS(inst), FORM_IX(inst), FORM_RA(inst), FORM_RB(inst),
-                               FORM_WX(inst), m_fixed_proc.m_gpr, m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PSQ_LX>;
         case TableSubOpcode4::PSQ_STX:
-            m_float_proc.ps_stx(FORM_FS(inst), FORM_IX(inst), FORM_RA(inst), FORM_RB(inst),
-                                FORM_WX(inst), m_fixed_proc.m_gpr, m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PSQ_STX>;
         case TableSubOpcode4::PS_SUM0:
-            m_float_proc.ps_sum0(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                 FORM_RC(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                 m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_SUM0>;
         case TableSubOpcode4::PS_SUM1:
-            m_float_proc.ps_sum1(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                 FORM_RC(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                 m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_SUM1>;
         case TableSubOpcode4::PS_MULS0:
-            m_float_proc.ps_muls0(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_RC(inst),
-                                  m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_MULS0>;
         case TableSubOpcode4::PS_MULS1:
-            m_float_proc.ps_muls1(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_RC(inst),
-                                  m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_MULS1>;
         case TableSubOpcode4::PS_MADDS0:
-            m_float_proc.ps_madds1(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                   FORM_RC(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                   m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_MADDS0>;
         case TableSubOpcode4::PS_MADDS1:
-            m_float_proc.ps_madds1(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                   FORM_RC(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                   m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_MADDS1>;
         case TableSubOpcode4::PS_DIV:
-            m_float_proc.ps_div(FORM_FS(inst), FORM_FA(inst), FORM_FB(inst), FORM_RC(inst),
-                                m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_DIV>;
         case TableSubOpcode4::PS_SUB:
-            m_float_proc.ps_sub(FORM_FS(inst), FORM_FA(inst), FORM_FB(inst), FORM_RC(inst),
-                                m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_SUB>;
         case TableSubOpcode4::PS_ADD:
-            m_float_proc.ps_add(FORM_FS(inst), FORM_FA(inst), FORM_FB(inst), FORM_RC(inst),
-                                m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_ADD>;
         case TableSubOpcode4::PS_SEL:
-            m_float_proc.ps_sel(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                FORM_RC(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_SEL>;
         case TableSubOpcode4::PS_RES:
-            m_float_proc.ps_res(FORM_FS(inst), FORM_FB(inst), FORM_RC(inst), m_branch_proc.m_cr,
-                                m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_RES>;
         case TableSubOpcode4::PS_MUL:
-            m_float_proc.ps_mul(FORM_FS(inst), FORM_FA(inst), FORM_FB(inst), FORM_RC(inst),
-                                m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_MUL>;
         case TableSubOpcode4::PS_RSQRTE:
-            m_float_proc.ps_rsqrte(FORM_FS(inst), FORM_FB(inst), FORM_RC(inst), m_branch_proc.m_cr,
-                                   m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_RSQRTE>;
         case TableSubOpcode4::PS_MSUB:
-            m_float_proc.ps_msub(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                 FORM_RC(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                 m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_MSUB>;
         case TableSubOpcode4::PS_MADD:
-            m_float_proc.ps_madd(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                 FORM_RC(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                 m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_MADD>;
         case TableSubOpcode4::PS_NMSUB:
-            m_float_proc.ps_nmsub(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                  FORM_RC(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                  m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_NMSUB>;
         case TableSubOpcode4::PS_NMADD:
-            m_float_proc.ps_nmadd(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                  FORM_RC(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                  m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PS_NMADD>;
         case TableSubOpcode4::PSQ_LUX:
-            m_float_proc.ps_lux(FORM_FS(inst), FORM_IX(inst), FORM_RA(inst), FORM_RB(inst),
-                                FORM_WX(inst), m_fixed_proc.m_gpr, m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PSQ_LUX>;
         case TableSubOpcode4::PSQ_STUX:
-            m_float_proc.ps_stux(FORM_FS(inst), FORM_IX(inst), FORM_RA(inst), FORM_RB(inst),
-                                 FORM_WX(inst), m_fixed_proc.m_gpr, m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode4::PSQ_STUX>;
         default:
             switch (sub_op_10) {
             case TableSubOpcode4::PS_CMPU0:
-                m_float_proc.ps_cmpu0(FORM_CRFD(inst), FORM_FA(inst), FORM_FB(inst),
-                                      m_branch_proc.m_cr, m_system_proc.m_msr,
-                                      m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_CMPU0>;
             case TableSubOpcode4::PS_CMPO0:
-                m_float_proc.ps_cmpo0(FORM_CRFD(inst), FORM_FA(inst), FORM_FB(inst),
-                                      m_branch_proc.m_cr, m_system_proc.m_msr,
-                                      m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_CMPO0>;
             case TableSubOpcode4::PSQ_LUX:
-                m_float_proc.ps_lux(FORM_FS(inst), FORM_IX(inst), FORM_RA(inst), FORM_RB(inst),
-                                    FORM_WX(inst), m_fixed_proc.m_gpr, m_storage);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PSQ_LUX>;
             case TableSubOpcode4::PS_NEG:
-                m_float_proc.ps_neg(FORM_FS(inst), FORM_FB(inst), FORM_RC(inst), m_branch_proc.m_cr,
-                                    m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_NEG>;
             case TableSubOpcode4::PS_CMPU1:
-                m_float_proc.ps_cmpu1(FORM_CRFD(inst), FORM_FA(inst), FORM_FB(inst),
-                                      m_branch_proc.m_cr, m_system_proc.m_msr,
-                                      m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_CMPU1>;
             case TableSubOpcode4::PS_MR:
-                m_float_proc.ps_mr(FORM_FS(inst), FORM_FB(inst), FORM_RC(inst), m_branch_proc.m_cr,
-                                   m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_MR>;
             case TableSubOpcode4::PS_CMPO1:
-                m_float_proc.ps_cmpo1(FORM_CRFD(inst), FORM_FA(inst), FORM_FB(inst),
-                                      m_branch_proc.m_cr, m_system_proc.m_msr,
-                                      m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_CMPO1>;
             case TableSubOpcode4::PS_NABS:
-                m_float_proc.ps_nabs(FORM_FS(inst), FORM_FB(inst), FORM_RC(inst),
-                                     m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_NABS>;
             case TableSubOpcode4::PS_ABS:
-                m_float_proc.ps_abs(FORM_FS(inst), FORM_FB(inst), FORM_RC(inst), m_branch_proc.m_cr,
-                                    m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_ABS>;
             case TableSubOpcode4::PS_MERGE00:
-                m_float_proc.ps_merge00(FORM_FS(inst), FORM_FA(inst), FORM_FB(inst), FORM_RC(inst),
-                                        m_branch_proc.m_cr, m_system_proc.m_msr,
-                                        m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_MERGE00>;
             case TableSubOpcode4::PS_MERGE01:
-                m_float_proc.ps_merge01(FORM_FS(inst), FORM_FA(inst), FORM_FB(inst), FORM_RC(inst),
-                                        m_branch_proc.m_cr, m_system_proc.m_msr,
-                                        m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_MERGE01>;
             case TableSubOpcode4::PS_MERGE10:
-                m_float_proc.ps_merge10(FORM_FS(inst), FORM_FA(inst), FORM_FB(inst), FORM_RC(inst),
-                                        m_branch_proc.m_cr, m_system_proc.m_msr,
-                                        m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_MERGE10>;
             case TableSubOpcode4::PS_MERGE11:
-                m_float_proc.ps_merge11(FORM_FS(inst), FORM_FA(inst), FORM_FB(inst), FORM_RC(inst),
-                                        m_branch_proc.m_cr, m_system_proc.m_msr,
-                                        m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode4::PS_MERGE11>;
             case TableSubOpcode4::DCBZ_L:
-                break;
+                return &SystemDolphin::executeNop;
             default:
-                internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, unknown,
-                                                   "Attempted to evaluate unknown instruction!"));
-                break;
+                return &SystemDolphin::executeUnknown;
             }
-            break;
         }
-        return m_system_proc.m_pc + 4;
     }
 
-    Register::PC SystemDolphin::evaluateControlFlowSubOp(u32 inst) {
-        Register::PC next_instruction = m_system_proc.m_pc + 4;
-
-        TableSubOpcode19 sub_op = (TableSubOpcode19)FORM_XO_10(inst);
+    SystemDolphin::handler_t SystemDolphin::decodeControlFlowSubOp(u32 inst) {
+        const TableSubOpcode19 sub_op = (TableSubOpcode19)FORM_XO_10(inst);
         switch (sub_op) {
         case TableSubOpcode19::MCRF:
-            m_branch_proc.mcrf(FORM_CRBD(inst), FORM_CRBA(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::MCRF>;
         case TableSubOpcode19::BCLR:
-            next_instruction -= 4;
-            m_branch_proc.bclr(FORM_BO(inst), FORM_BI(inst), FORM_LK(inst), next_instruction);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::BCLR>;
         case TableSubOpcode19::CRNOR:
-            m_branch_proc.crnor(FORM_CRBD(inst), FORM_CRBA(inst), FORM_CRBB(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::CRNOR>;
         case TableSubOpcode19::RFI:
-            m_system_proc.rfi();
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::RFI>;
         case TableSubOpcode19::CRANDC:
-            m_branch_proc.crandc(FORM_CRBD(inst), FORM_CRBA(inst), FORM_CRBB(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::CRANDC>;
         case TableSubOpcode19::ISYNC:
-            m_system_proc.sync((SyncType)0);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::ISYNC>;
         case TableSubOpcode19::CRXOR:
-            m_branch_proc.crxor(FORM_CRBD(inst), FORM_CRBA(inst), FORM_CRBB(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::CRXOR>;
         case TableSubOpcode19::CRNAND:
-            m_branch_proc.crnand(FORM_CRBD(inst), FORM_CRBA(inst), FORM_CRBB(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::CRNAND>;
         case TableSubOpcode19::CRAND:
-            m_branch_proc.crand(FORM_CRBD(inst), FORM_CRBA(inst), FORM_CRBB(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::CRAND>;
         case TableSubOpcode19::CREQV:
-            m_branch_proc.creqv(FORM_CRBD(inst), FORM_CRBA(inst), FORM_CRBB(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::CREQV>;
         case TableSubOpcode19::CRORC:
-            m_branch_proc.crorc(FORM_CRBD(inst), FORM_CRBA(inst), FORM_CRBB(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::CRORC>;
         case TableSubOpcode19::CROR:
-            m_branch_proc.cror(FORM_CRBD(inst), FORM_CRBA(inst), FORM_CRBB(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::CROR>;
         case TableSubOpcode19::BCCTR:
-            m_branch_proc.bcctr(FORM_BO(inst), FORM_BI(inst), FORM_LK(inst), m_system_proc.m_pc);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode19::BCCTR>;
         default:
-            internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, unknown,
-                                               "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::executeUnknown;
         }
-
-        return next_instruction;
     }
 
-    Register::PC SystemDolphin::evaluateFixedSubOp(u32 inst) {
-        TableSubOpcode31 sub_op = (TableSubOpcode31)FORM_XO_10(inst);
+    SystemDolphin::handler_t SystemDolphin::decodeFixedSubOp(u32 inst) {
+        const TableSubOpcode31 sub_op = (TableSubOpcode31)FORM_XO_10(inst);
         switch (sub_op) {
         case TableSubOpcode31::ADD:
         case TableSubOpcode31::ADDO:
-            m_fixed_proc.add(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_OE(inst),
-                             FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ADD>;
         case TableSubOpcode31::ADDC:
         case TableSubOpcode31::ADDCO:
-            m_fixed_proc.addc(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_OE(inst),
-                              FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ADDC>;
         case TableSubOpcode31::ADDE:
         case TableSubOpcode31::ADDEO:
-            m_fixed_proc.adde(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_OE(inst),
-                              FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ADDE>;
         case TableSubOpcode31::ADDME:
         case TableSubOpcode31::ADDMEO:
-            m_fixed_proc.addme(FORM_RS(inst), FORM_RA(inst), FORM_OE(inst), FORM_Rc(inst),
-                               m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ADDME>;
         case TableSubOpcode31::ADDZE:
         case TableSubOpcode31::ADDZEO:
-            m_fixed_proc.addze(FORM_RS(inst), FORM_RA(inst), FORM_OE(inst), FORM_Rc(inst),
-                               m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ADDZE>;
         case TableSubOpcode31::DIVW:
         case TableSubOpcode31::DIVWO:
-            m_fixed_proc.divw(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_OE(inst),
-                              FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::DIVW>;
         case TableSubOpcode31::DIVWU:
         case TableSubOpcode31::DIVWUO:
-            m_fixed_proc.divwu(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_OE(inst),
-                               FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::DIVWU>;
         case TableSubOpcode31::MULHW:
-            m_fixed_proc.mullhw(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_Rc(inst),
-                                m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MULHW>;
         case TableSubOpcode31::MULHWU:
-            m_fixed_proc.mullhwu(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_Rc(inst),
-                                 m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MULHWU>;
         case TableSubOpcode31::MULLW:
         case TableSubOpcode31::MULLWO:
-            m_fixed_proc.mullw(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_OE(inst),
-                               FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MULLW>;
         case TableSubOpcode31::NEG:
         case TableSubOpcode31::NEGO:
-            break;
+            return &SystemDolphin::executeNop;
         case TableSubOpcode31::SUBF:
         case TableSubOpcode31::SUBFO:
-            m_fixed_proc.subf(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_OE(inst),
-                              FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SUBF>;
         case TableSubOpcode31::SUBFC:
         case TableSubOpcode31::SUBFCO:
-            m_fixed_proc.subfc(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_OE(inst),
-                               FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SUBFC>;
         case TableSubOpcode31::SUBFE:
         case TableSubOpcode31::SUBFEO:
-            m_fixed_proc.subfe(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), FORM_OE(inst),
-                               FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SUBFE>;
         case TableSubOpcode31::SUBFME:
         case TableSubOpcode31::SUBFMEO:
-            m_fixed_proc.subfme(FORM_RS(inst), FORM_RA(inst), FORM_OE(inst), FORM_Rc(inst),
-                                m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SUBFME>;
         case TableSubOpcode31::SUBFZE:
         case TableSubOpcode31::SUBFZEO:
-            m_fixed_proc.subfze(FORM_RS(inst), FORM_RA(inst), FORM_OE(inst), FORM_Rc(inst),
-                                m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SUBFZE>;
         case TableSubOpcode31::AND:
-            m_fixed_proc.and_(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::AND>;
         case TableSubOpcode31::ANDC:
-            m_fixed_proc.andc(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ANDC>;
         case TableSubOpcode31::OR:
-            m_fixed_proc.or_(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                             m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::OR>;
         case TableSubOpcode31::NOR:
-            m_fixed_proc.nor_(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::NOR>;
         case TableSubOpcode31::XOR:
-            m_fixed_proc.xor_(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::XOR>;
         case TableSubOpcode31::ORC:
-            m_fixed_proc.orc(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                             m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ORC>;
         case TableSubOpcode31::NAND:
-            m_fixed_proc.nand_(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                               m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::NAND>;
         case TableSubOpcode31::EQV:
-            m_fixed_proc.eqv_(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::EQV>;
         case TableSubOpcode31::CMP:
-            m_fixed_proc.cmp(FORM_CRFD(inst), FORM_L(inst), FORM_RA(inst), FORM_RB(inst),
-                             m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::CMP>;
         case TableSubOpcode31::CMPL:
-            m_fixed_proc.cmpl(FORM_CRFD(inst), FORM_L(inst), FORM_RA(inst), FORM_RB(inst),
-                              m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::CMPL>;
         case TableSubOpcode31::CNTLZW:
-            m_fixed_proc.cntlzw(FORM_RA(inst), FORM_RB(inst), FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::CNTLZW>;
         case TableSubOpcode31::EXTSH:
-            m_fixed_proc.extsh(FORM_RA(inst), FORM_RS(inst), FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::EXTSH>;
         case TableSubOpcode31::EXTSB:
-            m_fixed_proc.extsb(FORM_RA(inst), FORM_RS(inst), FORM_Rc(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::EXTSB>;
         case TableSubOpcode31::SRW:
-            m_fixed_proc.srw(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                             m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SRW>;
         case TableSubOpcode31::SRAW:
-            m_fixed_proc.sraw(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SRAW>;
         case TableSubOpcode31::SRAWI:
-            m_fixed_proc.srawi(FORM_RA(inst), FORM_RS(inst), FORM_SH(inst), FORM_Rc(inst),
-                               m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SRAWI>;
         case TableSubOpcode31::SLW:
-            m_fixed_proc.slw(FORM_RA(inst), FORM_RS(inst), FORM_RB(inst), FORM_Rc(inst),
-                             m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SLW>;
         case TableSubOpcode31::DCBST:
-            m_system_proc.dcbst(FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::DCBST>;
         case TableSubOpcode31::DCBF:
-            m_system_proc.dcbf(FORM_RA(inst), FORM_RB(inst), FORM_L(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::DCBF>;
         case TableSubOpcode31::DCBTST:
-            m_system_proc.dcbtst(FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::DCBTST>;
         case TableSubOpcode31::DCBT:
-            m_system_proc.dcbst(FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::DCBT>;
         case TableSubOpcode31::DCBI:
-            m_system_proc.dcbi(FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::DCBI>;
         case TableSubOpcode31::DCBA:
         case TableSubOpcode31::DCBZ:
-            m_system_proc.dcbz(FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::DCBA>;
         case TableSubOpcode31::LWZX:
-            m_fixed_proc.lwzx(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LWZX>;
         case TableSubOpcode31::LWZUX:
-            m_fixed_proc.lwzux(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LWZUX>;
         case TableSubOpcode31::LHZX:
-            m_fixed_proc.lhzx(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LHZX>;
         case TableSubOpcode31::LHZUX:
-            m_fixed_proc.lhzux(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LHZUX>;
         case TableSubOpcode31::LHAX:
-            m_fixed_proc.lhax(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LHAX>;
         case TableSubOpcode31::LHAUX:
-            m_fixed_proc.lhaux(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LHAUX>;
         case TableSubOpcode31::LBZX:
-            m_fixed_proc.lbzx(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LBZX>;
         case TableSubOpcode31::LBZUX:
-            m_fixed_proc.lbzux(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LBZUX>;
         case TableSubOpcode31::LWBRX:
-            m_fixed_proc.lwbrx(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LWBRX>;
         case TableSubOpcode31::LHBRX:
-            m_fixed_proc.lhbrx(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LHBRX>;
         case TableSubOpcode31::STWCXD:
-            break;
+            return &SystemDolphin::executeNop;
         case TableSubOpcode31::LWARX:
-            internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, lwarx,
-                                               "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LWARX>;
         case TableSubOpcode31::LSWX:
-            m_fixed_proc.lswx(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LSWX>;
         case TableSubOpcode31::LSWI:
-            m_fixed_proc.lswi(FORM_RD(inst), FORM_RA(inst), FORM_NB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LSWI>;
         case TableSubOpcode31::STWX:
-            m_fixed_proc.stwx(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STWX>;
         case TableSubOpcode31::STWUX:
-            m_fixed_proc.stwux(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STWUX>;
         case TableSubOpcode31::STHX:
-            m_fixed_proc.sthx(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STHX>;
         case TableSubOpcode31::STHUX:
-            m_fixed_proc.sthux(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STHUX>;
         case TableSubOpcode31::STBX:
-            m_fixed_proc.stbx(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STBX>;
         case TableSubOpcode31::STBUX:
-            m_fixed_proc.stbux(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STBUX>;
         case TableSubOpcode31::STWBRX:
-            m_fixed_proc.stwbrx(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STWBRX>;
         case TableSubOpcode31::STHBRX:
-            m_fixed_proc.sthbrx(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STHBRX>;
         case TableSubOpcode31::STSWX:
-            m_fixed_proc.stswx(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STSWX>;
         case TableSubOpcode31::STSWI:
-            m_fixed_proc.stswi(FORM_RS(inst), FORM_RA(inst), FORM_NB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STSWI>;
         case TableSubOpcode31::LFSX:
-            m_float_proc.lfsx(FORM_FS(inst), FORM_RA(inst), FORM_RB(inst), m_fixed_proc.m_gpr,
-                              m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LFSX>;
         case TableSubOpcode31::LFSUX:
-            m_float_proc.lfsux(FORM_FS(inst), FORM_RA(inst), FORM_RB(inst), m_fixed_proc.m_gpr,
-                               m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LFSUX>;
         case TableSubOpcode31::LFDX:
-            m_float_proc.lfdx(FORM_FS(inst), FORM_RA(inst), FORM_RB(inst), m_fixed_proc.m_gpr,
-                              m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LFDX>;
         case TableSubOpcode31::LFDUX:
-            m_float_proc.lfdux(FORM_FS(inst), FORM_RA(inst), FORM_RB(inst), m_fixed_proc.m_gpr,
-                               m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::LFDUX>;
         case TableSubOpcode31::STFSX:
-            m_float_proc.stfsx(FORM_FS(inst), FORM_RA(inst), FORM_RB(inst), m_fixed_proc.m_gpr,
-                               m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STFSX>;
         case TableSubOpcode31::STFSUX:
-            m_float_proc.stfsux(FORM_FS(inst), FORM_RA(inst), FORM_RB(inst), m_fixed_proc.m_gpr,
-                                m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STFSUX>;
         case TableSubOpcode31::STFDX:
-            m_float_proc.stfdx(FORM_FS(inst), FORM_RA(inst), FORM_RB(inst), m_fixed_proc.m_gpr,
-                               m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STFDX>;
         case TableSubOpcode31::STFDUX:
-            m_float_proc.stfdux(FORM_FS(inst), FORM_RA(inst), FORM_RB(inst), m_fixed_proc.m_gpr,
-                                m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STFDUX>;
         case TableSubOpcode31::STFIWX:
-            m_float_proc.stfiwx(FORM_FS(inst), FORM_RA(inst), FORM_RB(inst), m_fixed_proc.m_gpr,
-                                m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::STFIWX>;
         case TableSubOpcode31::MFCR:
-            m_fixed_proc.mfcr(FORM_RS(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MFCR>;
         case TableSubOpcode31::MFMSR:
-            m_fixed_proc.mfmsr(FORM_RS(inst), m_system_proc.m_msr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MFMSR>;
         case TableSubOpcode31::MTCRF:
-            m_fixed_proc.mtcrf(FORM_CRM(inst), FORM_RS(inst), m_branch_proc.m_cr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MTCRF>;
         case TableSubOpcode31::MTMSR:
-            m_fixed_proc.mtmsr(FORM_RS(inst), m_system_proc.m_msr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MTMSR>;
         case TableSubOpcode31::MTSR:
-            internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, mtsr,
-                                               "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MTSR>;
         case TableSubOpcode31::MTSRIN:
-            internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, mtsrin,
-                                               "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MTSRIN>;
         case TableSubOpcode31::MFSPR:
-            m_fixed_proc.mfspr((Register::SPRType)FORM_SPR(inst), FORM_RD(inst), m_branch_proc.m_lr,
-                               m_branch_proc.m_ctr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MFSPR>;
         case TableSubOpcode31::MTSPR:
-            m_fixed_proc.mtspr((Register::SPRType)FORM_SPR(inst), FORM_RS(inst), m_branch_proc.m_lr,
-                               m_branch_proc.m_ctr);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MTSPR>;
         case TableSubOpcode31::MFTB:
-            m_fixed_proc.mftb(FORM_RD(inst), FORM_TBR(inst), m_system_proc.m_tb);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MFTB>;
         case TableSubOpcode31::MCRXR:
-            m_fixed_proc.mcrxr(m_branch_proc.m_cr, FORM_CRFD(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MCRXR>;
         case TableSubOpcode31::MFSR:
-            internalInvalidCB(
-                PROC_INVALID_MSG(SystemDolphin, mfsr, "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MFSR>;
         case TableSubOpcode31::MFSRIN:
-            internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, mfsrin,
-                                               "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::MFSRIN>;
         case TableSubOpcode31::TW:
-            m_fixed_proc.tw(FORM_TO(inst), FORM_RA(inst), FORM_RB(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::TW>;
         case TableSubOpcode31::SYNC:
-            m_system_proc.sync((SyncType)FORM_I(inst));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::SYNC>;
         case TableSubOpcode31::ICBI:
-            m_system_proc.icbi(FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ICBI>;
         case TableSubOpcode31::ECIWX:
-            m_fixed_proc.eciwx(FORM_RD(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ECIWX>;
         case TableSubOpcode31::ECOWX:
-            m_fixed_proc.ecowx(FORM_RS(inst), FORM_RA(inst), FORM_RB(inst), m_storage);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::ECOWX>;
         case TableSubOpcode31::EIEIO:
-            m_system_proc.eieio();
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::EIEIO>;
         case TableSubOpcode31::TLBIE:
-            internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, tlbie,
-                                               "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::TLBIE>;
         case TableSubOpcode31::TLBSYNC:
-            internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, tlbsync,
-                                               "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::execute<TableSubOpcode31::TLBSYNC>;
         }
-        return m_system_proc.m_pc + 4;
+        return &SystemDolphin::executeNop;
     }
 
-    Register::PC SystemDolphin::evaluateFloatSingleSubOp(u32 inst) {
-        TableSubOpcode59 sub_op = (TableSubOpcode59)FORM_XO_5(inst);
+    SystemDolphin::handler_t SystemDolphin::decodeFloatSingleSubOp(u32 inst) {
+        const TableSubOpcode59 sub_op = (TableSubOpcode59)FORM_XO_5(inst);
         switch (sub_op) {
         case TableSubOpcode59::FDIVS:
-            m_float_proc.fdivs(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_Rc(inst),
-                               m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode59::FDIVS>;
         case TableSubOpcode59::FSUBS:
-            m_float_proc.fsubs(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_Rc(inst),
-                               m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode59::FSUBS>;
         case TableSubOpcode59::FADDS:
-            m_float_proc.fadds(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_Rc(inst),
-                               m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode59::FADDS>;
         case TableSubOpcode59::FRES:
-            m_float_proc.fres(FORM_FS(inst), FORM_FA(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                              m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode59::FRES>;
         case TableSubOpcode59::FMULS:
-            m_float_proc.fmuls(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_Rc(inst),
-                               m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode59::FMULS>;
         case TableSubOpcode59::FMSUBS:
-            m_float_proc.fmsubs(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                FORM_Rc(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode59::FMSUBS>;
         case TableSubOpcode59::FMADDS:
-            m_float_proc.fmadds(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                FORM_Rc(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode59::FMADDS>;
         case TableSubOpcode59::FNMSUBS:
-            m_float_proc.fnmsubs(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                 FORM_Rc(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                 m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode59::FNMSUBS>;
         case TableSubOpcode59::FNMADDS:
-            m_float_proc.fnmadds(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                 FORM_Rc(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                 m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode59::FNMADDS>;
         default:
-            internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, unknown,
-                                               "Attempted to evaluate unknown instruction!"));
-            break;
+            return &SystemDolphin::executeUnknown;
         }
-        return m_system_proc.m_pc + 4;
     }
 
-    Register::PC SystemDolphin::evaluateFloatSubOp(u32 inst) {
-        TableSubOpcode63 sub_op_5  = (TableSubOpcode63)FORM_XO_5(inst);
-        TableSubOpcode63 sub_op_10 = (TableSubOpcode63)FORM_XO_10(inst);
+    SystemDolphin::handler_t SystemDolphin::decodeFloatSubOp(u32 inst) {
+        const TableSubOpcode63 sub_op_5  = (TableSubOpcode63)FORM_XO_5(inst);
+        const TableSubOpcode63 sub_op_10 = (TableSubOpcode63)FORM_XO_10(inst);
         switch (sub_op_5) {
         case TableSubOpcode63::FDIV:
-            m_float_proc.fdiv(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FDIV>;
         case TableSubOpcode63::FSUB:
-            m_float_proc.fsub(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FSUB>;
         case TableSubOpcode63::FADD:
-            m_float_proc.fadd(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FADD>;
         case TableSubOpcode63::FSEL:
-            m_float_proc.fsel(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                              FORM_Rc(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                              m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FSEL>;
         case TableSubOpcode63::FMUL:
-            m_float_proc.fmul(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_Rc(inst),
-                              m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FMUL>;
         case TableSubOpcode63::FRSQRTE:
-            m_float_proc.frsqrte(FORM_FS(inst), FORM_FB(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                 m_system_proc.m_msr, m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FRSQRTE>;
         case TableSubOpcode63::FMSUB:
-            m_float_proc.fmsub(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                               FORM_Rc(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                               m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FMSUB>;
         case TableSubOpcode63::FMADD:
-            m_float_proc.fmadd(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                               FORM_Rc(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                               m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FMADD>;
         case TableSubOpcode63::FNMSUB:
-            m_float_proc.fnmsub(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                FORM_Rc(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FNMSUB>;
         case TableSubOpcode63::FNMADD:
-            m_float_proc.fnmadd(FORM_FS(inst), FORM_FA(inst), FORM_FC(inst), FORM_FB(inst),
-                                FORM_Rc(inst), m_branch_proc.m_cr, m_system_proc.m_msr,
-                                m_system_proc.m_srr1);
-            break;
+            return &SystemDolphin::execute<TableSubOpcode63::FNMADD>;
         default:
             switch (sub_op_10) {
             case TableSubOpcode63::FCMPU:
-                m_float_proc.fcmpu(FORM_CRFD(inst), FORM_FA(inst), FORM_FB(inst),
-                                   m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::FCMPU>;
             case TableSubOpcode63::FRSP:
-                m_float_proc.frsp(FORM_FS(inst), FORM_FB(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                  m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::FRSP>;
             case TableSubOpcode63::FCTIW:
-                m_float_proc.fctiw(FORM_FS(inst), FORM_FB(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                   m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::FCTIW>;
             case TableSubOpcode63::FCTIWZ:
-                m_float_proc.fctiwz(FORM_FS(inst), FORM_FB(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                    m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::FCTIWZ>;
             case TableSubOpcode63::FCMPO:
-                m_float_proc.fcmpo(FORM_CRFD(inst), FORM_FA(inst), FORM_FB(inst),
-                                   m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::FCMPO>;
             case TableSubOpcode63::MTFSB1:
-                m_float_proc.mtfsb1(FORM_CRBD(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                    m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::MTFSB1>;
             case TableSubOpcode63::FNEG:
-                m_float_proc.fneg(FORM_FS(inst), FORM_FB(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                  m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::FNEG>;
             case TableSubOpcode63::MCRFS:
-                m_float_proc.mcrfs(FORM_CRBD(inst), FORM_CRBA(inst), m_branch_proc.m_cr,
-                                   m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::MCRFS>;
             case TableSubOpcode63::MTFSB0:
-                m_float_proc.mtfsb0(FORM_CRBD(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                    m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::MTFSB0>;
             case TableSubOpcode63::FMR:
-                m_float_proc.fmr(FORM_FS(inst), FORM_FB(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                 m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::FMR>;
             case TableSubOpcode63::MTFSFI:
-                break;
+                return &SystemDolphin::executeNop;
             case TableSubOpcode63::FNABS:
-                m_float_proc.fnabs(FORM_FS(inst), FORM_FB(inst), FORM_Rc(inst),
-                                   m_branch_proc.m_cr, m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::FNABS>;
             case TableSubOpcode63::FABS:
-                m_float_proc.fabs(FORM_FS(inst), FORM_FB(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                  m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::FABS>;
             case TableSubOpcode63::MFFS:
-                m_float_proc.mffs(FORM_FS(inst), FORM_Rc(inst), m_branch_proc.m_cr,
-                                  m_system_proc.m_msr, m_system_proc.m_srr1);
-                break;
+                return &SystemDolphin::execute<TableSubOpcode63::MFFS>;
             case TableSubOpcode63::MTFS:
             default:
-                internalInvalidCB(PROC_INVALID_MSG(SystemDolphin, unknown,
-                                                   "Attempted to evaluate unknown instruction!"));
-                break;
+                return &SystemDolphin::executeUnknown;
             }
         }
-        return m_system_proc.m_pc + 4;
     }
 
 }  // namespace Toolbox::Interpreter
\ No newline at end of file
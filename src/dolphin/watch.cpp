@@ -68,12 +68,12 @@ namespace Toolbox {
             return glm::vec3();
         }
 
-        glm::vec3 value = {};
-        value.x         = communicator.read<f32>(address + 0).value_or(0.0f);
-        value.y         = communicator.read<f32>(address + 4).value_or(0.0f);
-        value.z         = communicator.read<f32>(address + 8).value_or(0.0f);
+        f32 raw[3] = {};
+        if (!communicator.readArray<f32>(address, raw, 3)) {
+            return glm::vec3();
+        }
 
-        return value;
+        return glm::vec3(raw[0], raw[1], raw[2]);
     }
 
     static Transform readTransformFromMem(u32 address) {
@@ -91,16 +91,17 @@ namespace Toolbox {
             return Transform();
         }
 
-        Transform value       = {};
-        value.m_translation.x = communicator.read<f32>(address).value_or(0.0f);
-        value.m_translation.y = communicator.read<f32>(address + 0x04).value_or(0.0f);
-        value.m_translation.z = communicator.read<f32>(address + 0x08).value_or(0.0f);
-        value.m_rotation.x    = communicator.read<f32>(address + 0x14).value_or(0.0f);
-        value.m_rotation.y    = communicator.read<f32>(address + 0x18).value_or(0.0f);
-        value.m_rotation.z    = communicator.read<f32>(address + 0x1C).value_or(0.0f);
-        value.m_scale.x       = communicator.read<f32>(address + 0x20).value_or(0.0f);
-        value.m_scale.y       = communicator.read<f32>(address + 0x24).value_or(0.0f);
-        value.m_scale.z       = communicator.read<f32>(address + 0x28).value_or(0.0f);
+        // Translation, rotation and scale are laid out in one block,
+        // with a gap of two words after the translation.
+        f32 raw[11] = {};
+        if (!communicator.readArray<f32>(address, raw, 11)) {
+            return Transform();
+        }
+
+        Transform value     = {};
+        value.m_translation = glm::vec3(raw[0], raw[1], raw[2]);
+        value.m_rotation    = glm::vec3(raw[5], raw[6], raw[7]);
+        value.m_scale       = glm::vec3(raw[8], raw[9], raw[10]);
 
         return value;
     }
@@ -120,23 +121,24 @@ namespace Toolbox {
             return glm::mat3x4();
         }
 
+        f32 raw[12] = {};
+        if (!communicator.readArray<f32>(address, raw, 12)) {
+            return glm::mat3x4();
+        }
+
         glm::mat3x4 value = {};
-        value[0][0]       = communicator.read<f32>(address + 0).value_or(0.0f);
-        value[0][1]       = communicator.read<f32>(address + 4).value_or(0.0f);
-        value[0][2]       = communicator.read<f32>(address + 8).value_or(0.0f);
-        value[0][3]       = communicator.read<f32>(address + 12).value_or(0.0f);
-        value[1][0]       = communicator.read<f32>(address + 16).value_or(0.0f);
-        value[1][1]       = communicator.read<f32>(address + 20).value_or(0.0f);
-        value[1][2]       = communicator.read<f32>(address + 24).value_or(0.0f);
-        value[1][3]       = communicator.read<f32>(address + 28).value_or(0.0f);
-        value[2][0]       = communicator.read<f32>(address + 32).value_or(0.0f);
-        value[2][1]       = communicator.read<f32>(address + 36).value_or(0.0f);
-        value[2][2]       = communicator.read<f32>(address + 40).value_or(0.0f);
-        value[2][3]       = communicator.read<f32>(address + 44).value_or(0.0f);
+        for (int i = 0; i < 12; ++i) {
+            value[i / 4][i % 4] = raw[i];
+        }
 
         return value;
     }
 
+    static u64 NextLayoutEpoch() {
+        static std::atomic<u64> s_next_epoch = 1;
+        return s_next_epoch.fetch_add(1);
+    }
+
     bool MemoryWatch::startWatch(u32 address, u32 size) {
         if (m_last_value_buf) {
             return false;
@@ -155,6 +157,7 @@ namespace Toolbox {
         m_buf_size              = m_watch_size;
         m_last_value_buf        = new u8[m_buf_size];
         m_last_value_needs_init = true;
+        m_layout_epoch          = NextLayoutEpoch();
         return true;
     }
 
@@ -176,14 +179,22 @@ namespace Toolbox {
         m_buf_size              = m_watch_size;
         m_last_value_buf        = new u8[m_buf_size];
         m_last_value_needs_init = true;
+        m_layout_epoch          = NextLayoutEpoch();
         return true;
     }
 
     void MemoryWatch::stopWatch() {
         m_watch_address = 0;
         m_watch_size    = 0;
+        m_layout_epoch  = NextLayoutEpoch();
 
         m_last_value_buf = nullptr;
+
+        if (m_snapshot_region != 0) {
+            DolphinHookManager::instance().removeSnapshotRegion(m_snapshot_region);
+            m_snapshot_region  = 0;
+            m_snapshot_address = 0;
+        }
     }
 
     void MemoryWatch::processWatch() {
@@ -208,23 +219,55 @@ namespace Toolbox {
             return;
         }
 
-        void *current_value_buf = (u8 *)mem_view + true_address;
+        // Keep the frame snapshot following the watched range (pointer chains can move).
+        if (m_snapshot_region == 0 || m_snapshot_address != m_watch_address) {
+            if (m_snapshot_region != 0) {
+                manager.removeSnapshotRegion(m_snapshot_region);
+            }
+            m_snapshot_region  = manager.addSnapshotRegion(m_watch_address, m_watch_size);
+            m_snapshot_address = m_watch_address;
+        }
+
+        // Prefer the snapshot so multi-word values never tear across frames;
+        // until it has captured this range, fall back to live memory.
+        MemorySnapshot snapshot = manager.acquireSnapshot();
+        const void *current_value_buf = (u8 *)mem_view + true_address;
+        if (const u8 *snapshot_buf = snapshot.data(m_watch_address, m_watch_size)) {
+            current_value_buf = snapshot_buf;
+        }
+
+        processValue(m_watch_address, current_value_buf);
+    }
+
+    bool MemoryWatch::processValue(u32 address, const void *current_value) {
+        if (m_watch_size == 0) {
+            return false;
+        }
+
+        m_watch_address = address;
+
+        void *current_value_buf = const_cast<void *>(current_value);
+
         if (m_last_value_needs_init) {
             notify(m_last_value_buf, current_value_buf, m_watch_size);
             memcpy(m_last_value_buf, current_value_buf, m_watch_size);
             m_last_value_needs_init = false;
-            return;
+            return true;
         }
 
         // Check if the value has changed and signal a notification if it has
-        if (memcmp(m_last_value_buf, current_value_buf, m_watch_size) != 0) {
-            notify(m_last_value_buf, current_value_buf, m_watch_size);
-            if (!isLocked()) {
-                memcpy(m_last_value_buf, current_value_buf, m_watch_size);
-            } else {
-                memcpy(current_value_buf, m_last_value_buf, m_watch_size);
-            }
+        if (memcmp(m_last_value_buf, current_value_buf, m_watch_size) == 0) {
+            return false;
         }
+
+        notify(m_last_value_buf, current_value_buf, m_watch_size);
+        if (!isLocked()) {
+            memcpy(m_last_value_buf, current_value_buf, m_watch_size);
+        } else {
+            DolphinHookManager::instance().writeBytes(static_cast<const char *>(m_last_value_buf),
+                                                      m_watch_address, m_watch_size);
+        }
+        return true;
     }
 
     u32 MemoryWatch::TracePointerChainToAddress(const std::vector<u32> &pointer_chain) {
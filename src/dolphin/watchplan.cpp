@@ -0,0 +1,296 @@
+#include "dolphin/watchplan.hpp"
+#include "dolphin/watch.hpp"
+
+#include "core/simd.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+using namespace Toolbox::Dolphin;
+
+namespace Toolbox {
+
+    static bool IsRangeMapped(const DolphinHookManager &manager, u32 address, size_t size) {
+        if (address == 0) {
+            return false;
+        }
+        const u32 true_address = manager.getAddressAsOffset(address);
+        const size_t mem_size  = manager.getMemorySize();
+        return true_address < mem_size && size <= mem_size - true_address;
+    }
+
+    void WatchPlan::compile(std::span<MemoryWatch *const> watches) {
+        clear();
+
+        // (parent, value) -> node, where roots use s_invalid_node as parent
+        std::map<std::pair<u32, u32>, u32> node_lookup;
+        std::vector<u32> node_depth;
+        std::vector<bool> node_is_parent;
+
+        auto intern = [&](u32 parent, u32 value) -> u32 {
+            auto [it, inserted] =
+                node_lookup.try_emplace({parent, value}, static_cast<u32>(m_nodes.size()));
+            if (inserted) {
+                const u32 depth = parent == s_invalid_node ? 0 : node_depth[parent] + 1;
+                m_nodes.push_back({parent, value});
+                node_depth.push_back(depth);
+                node_is_parent.push_back(false);
+                if (depth > 0) {
+                    if (m_levels.size() < depth) {
+                        m_levels.resize(depth);
+                    }
+                    Level &level = m_levels[depth - 1];
+                    if (!node_is_parent[parent]) {
+                        node_is_parent[parent] = true;
+                        level.m_parents.push_back(parent);
+                    }
+                    level.m_children.push_back(static_cast<u32>(m_nodes.size() - 1));
+                }
+            }
+            return it->second;
+        };
+
+        m_slots.reserve(watches.size());
+        for (MemoryWatch *watch : watches) {
+            Slot slot = {watch, watch->getLayoutEpoch(), s_invalid_node, watch->getWatchSize()};
+
+            const std::vector<u32> chain = watch->getPointerChain();
+            if (slot.m_size != 0 && !chain.empty() && chain[0] != 0) {
+                u32 node = intern(s_invalid_node, chain[0]);
+                if (watch->isWatchPointer()) {
+                    for (size_t i = 1; i < chain.size(); ++i) {
+                        node = intern(node, chain[i]);
+                    }
+                }
+                slot.m_node = node;
+            }
+
+            m_slots.push_back(slot);
+        }
+
+        m_addresses.resize(m_nodes.size());
+        m_loaded.resize(m_nodes.size());
+        m_slot_range.resize(m_slots.size());
+        m_changed.resize((m_slots.size() + 63) / 64);
+    }
+
+    void WatchPlan::clear() {
+        for (u32 handle : m_snapshot_handles) {
+            DolphinHookManager::instance().removeSnapshotRegion(handle);
+        }
+        m_snapshot_handles.clear();
+        m_snapshot_ranges.clear();
+
+        m_nodes.clear();
+        m_levels.clear();
+        m_slots.clear();
+        m_changed.clear();
+    }
+
+    bool WatchPlan::matches(std::span<MemoryWatch *const> watches) const {
+        if (watches.size() != m_slots.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < watches.size(); ++i) {
+            if (m_slots[i].m_watch != watches[i] ||
+                m_slots[i].m_epoch != watches[i]->getLayoutEpoch()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t WatchPlan::execute(DolphinHookManager &manager) {
+        std::fill(m_changed.begin(), m_changed.end(), 0);
+        if (m_slots.empty() || !manager.isHooked()) {
+            return 0;
+        }
+
+        // Chains and values come from the same source, so that a chain is
+        // never applied to data from another frame. The snapshot is used
+        // when it holds every pointer and value this tick needs; until it
+        // has captured the current layout, the whole tick is read live.
+        bool copied = false;
+        {
+            MemorySnapshot snapshot = manager.acquireSnapshot();
+            if (snapshot.isValid() && resolveNodes(manager, snapshot)) {
+                buildRanges();
+                copied = copyRanges(snapshot);
+            }
+        }
+
+        if (!copied) {
+            resolveNodes(manager, manager);
+            buildRanges();
+        }
+
+        syncSnapshotRegions(manager);
+
+        if (!copied && !copyRanges(manager)) {
+            return 0;
+        }
+
+        if (m_ranges.empty()) {
+            return 0;
+        }
+
+        size_t changed_count = 0;
+        for (u32 slot_index : m_order) {
+            const Slot &slot    = m_slots[slot_index];
+            const Range &range  = m_ranges[m_slot_range[slot_index]];
+            const u32 address   = m_addresses[slot.m_node];
+            const u8 *value_buf = m_staging.data() + range.m_offset + (address - range.m_address);
+
+            if (slot.m_watch->processValue(address, value_buf)) {
+                m_changed[slot_index / 64] |= u64(1) << (slot_index % 64);
+                changed_count += 1;
+            }
+        }
+        return changed_count;
+    }
+
+    template <typename _Source>
+    bool WatchPlan::resolveNodes(const DolphinHookManager &manager, _Source &source) {
+        // Roots are absolute; every other node is filled in by its level
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            m_addresses[i] = m_nodes[i].m_parent == s_invalid_node ? m_nodes[i].m_value : 0;
+        }
+
+        bool complete = true;
+        for (const Level &level : m_levels) {
+            m_spans.clear();
+            for (u32 parent : level.m_parents) {
+                m_loaded[parent] = 0;
+                if (IsRangeMapped(manager, m_addresses[parent], sizeof(u32))) {
+                    m_spans.push_back({m_addresses[parent], sizeof(u32), &m_loaded[parent]});
+                }
+            }
+
+            if (!m_spans.empty()) {
+                if (source.readBatch(m_spans)) {
+                    for (const MemorySpan &span : m_spans) {
+                        SIMD::ByteSwapArray(static_cast<u32 *>(span.m_data), 1);
+                    }
+                } else {
+                    // The hook went away mid-tick, or the snapshot lacks a
+                    // pointer; leave this level unresolved
+                    for (u32 parent : level.m_parents) {
+                        m_loaded[parent] = 0;
+                    }
+                    complete = false;
+                }
+            }
+
+            // A null pointer leaves the rest of the chain unresolved
+            for (u32 child : level.m_children) {
+                const u32 pointer = m_loaded[m_nodes[child].m_parent];
+                m_addresses[child] = pointer != 0 ? pointer + m_nodes[child].m_value : 0;
+            }
+        }
+        return complete;
+    }
+
+    void WatchPlan::buildRanges() {
+        m_order.clear();
+        m_ranges.clear();
+
+        const DolphinHookManager &manager = DolphinHookManager::instance();
+        for (u32 i = 0; i < m_slots.size(); ++i) {
+            const Slot &slot = m_slots[i];
+            if (slot.m_node == s_invalid_node) {
+                continue;
+            }
+            if (IsRangeMapped(manager, m_addresses[slot.m_node], slot.m_size)) {
+                m_order.push_back(i);
+            }
+        }
+
+        std::sort(m_order.begin(), m_order.end(), [this](u32 a, u32 b) {
+            return m_addresses[m_slots[a].m_node] < m_addresses[m_slots[b].m_node];
+        });
+
+        u32 staging_size = 0;
+        for (u32 slot_index : m_order) {
+            const u32 start = m_addresses[m_slots[slot_index].m_node];
+            const u32 end   = start + m_slots[slot_index].m_size;
+
+            if (!m_ranges.empty()) {
+                Range &last        = m_ranges.back();
+                const u32 last_end = last.m_address + last.m_size;
+                if (start <= last_end + s_coalesce_gap) {
+                    if (end > last_end) {
+                        staging_size += end - last_end;
+                        last.m_size = end - last.m_address;
+                    }
+                    m_slot_range[slot_index] = static_cast<u32>(m_ranges.size() - 1);
+                    continue;
+                }
+            }
+
+            m_ranges.push_back({start, end - start, staging_size});
+            m_slot_range[slot_index] = static_cast<u32>(m_ranges.size() - 1);
+            staging_size += end - start;
+        }
+
+        if (m_staging.size() < staging_size) {
+            m_staging.resize(staging_size);
+        }
+    }
+
+    template <typename _Source> bool WatchPlan::copyRanges(_Source &source) {
+        m_spans.clear();
+        for (const Range &range : m_ranges) {
+            m_spans.push_back({range.m_address, range.m_size, m_staging.data() + range.m_offset});
+        }
+        return m_spans.empty() || source.readBatch(m_spans);
+    }
+
+    void WatchPlan::syncSnapshotRegions(DolphinHookManager &manager) {
+        // The snapshot has to hold the pointers along every chain as well as
+        // the values, or execute() could not resolve from it alone
+        m_wanted.clear();
+        for (const Level &level : m_levels) {
+            for (u32 parent : level.m_parents) {
+                if (IsRangeMapped(manager, m_addresses[parent], sizeof(u32))) {
+                    m_wanted.emplace_back(m_addresses[parent], u32(sizeof(u32)));
+                }
+            }
+        }
+        for (const Range &range : m_ranges) {
+            m_wanted.emplace_back(range.m_address, range.m_size);
+        }
+
+        std::sort(m_wanted.begin(), m_wanted.end());
+
+        size_t merged = 0;
+        for (size_t i = 0; i < m_wanted.size(); ++i) {
+            const auto [address, size] = m_wanted[i];
+            if (merged > 0) {
+                auto &last         = m_wanted[merged - 1];
+                const u32 last_end = last.first + last.second;
+                if (address <= last_end + s_coalesce_gap) {
+                    last.second = std::max(last_end, address + size) - last.first;
+                    continue;
+                }
+            }
+            m_wanted[merged++] = m_wanted[i];
+        }
+        m_wanted.resize(merged);
+
+        if (m_wanted == m_snapshot_ranges) {
+            return;
+        }
+
+        for (u32 handle : m_snapshot_handles) {
+            manager.removeSnapshotRegion(handle);
+        }
+        m_snapshot_handles.clear();
+
+        for (const auto &[address, size] : m_wanted) {
+            m_snapshot_handles.push_back(manager.addSnapshotRegion(address, size));
+        }
+        m_snapshot_ranges.swap(m_wanted);
+    }
+
+}  // namespace Toolbox
@@ -0,0 +1,314 @@
+#include "dolphin/xfb.hpp"
+#include "dolphin/hook.hpp"
+
+#include "core/simd.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace Toolbox::Dolphin {
+
+    // The conversion is done in single precision so that every path agrees
+    // bit for bit. The luma and chroma are truncated to integers after range
+    // expansion, as the original double precision converter did, but the
+    // narrower green sum can land on the other side of an integer: 90 of the
+    // 2^24 inputs come out one lower in G (Y=0 U=216 V=40 gives 18, not 19).
+    static constexpr f32 s_r_from_v = 1.402f;
+    static constexpr f32 s_g_from_u = 0.344136f;
+    static constexpr f32 s_g_from_v = 0.714136f;
+    static constexpr f32 s_b_from_u = 1.772f;
+
+    static inline f32 ExpandLuma(u8 y) {
+        return static_cast<f32>(static_cast<int>(static_cast<f32>((y - 16) * 255) / 219.0f));
+    }
+
+    static inline f32 ExpandChroma(u8 c) {
+        return static_cast<f32>(static_cast<int>(static_cast<f32>((c - 128) * 255) / 224.0f));
+    }
+
+    static inline u8 ClampChannel(f32 value) {
+        return static_cast<u8>(std::clamp(static_cast<int>(value), 0, 255));
+    }
+
+    static void ConvertPairsScalar(const u8 *yuv, u8 *rgba, size_t pairs) {
+        for (size_t i = 0; i < pairs; ++i, yuv += 4, rgba += 8) {
+            const f32 y0 = ExpandLuma(yuv[0]);
+            const f32 y1 = ExpandLuma(yuv[2]);
+            const f32 u  = ExpandChroma(yuv[1]);
+            const f32 v  = ExpandChroma(yuv[3]);
+
+            const f32 r_off = s_r_from_v * v;
+            const f32 g_off = s_g_from_u * u + s_g_from_v * v;
+            const f32 b_off = s_b_from_u * u;
+
+            rgba[0] = ClampChannel(y0 + r_off);
+            rgba[1] = ClampChannel(y0 - g_off);
+            rgba[2] = ClampChannel(y0 + b_off);
+            rgba[3] = 0xFF;
+            rgba[4] = ClampChannel(y1 + r_off);
+            rgba[5] = ClampChannel(y1 - g_off);
+            rgba[6] = ClampChannel(y1 + b_off);
+            rgba[7] = 0xFF;
+        }
+    }
+
+#if defined(TOOLBOX_SIMD_AVX2)
+
+    namespace AVX2 {
+
+        TOOLBOX_SIMD_TARGET_AVX2 static inline __m256 ExpandLanes(__m256i x, __m256i bias,
+                                                                  __m256 div) {
+            const __m256 scaled = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(x, bias)),
+                                                _mm256_set1_ps(255.0f));
+            return _mm256_cvtepi32_ps(_mm256_cvttps_epi32(_mm256_div_ps(scaled, div)));
+        }
+
+        // Interleaves the even and odd pixels of each pair back into pixel order
+        // and saturates them to bytes, leaving 8 pixels in the low half of each
+        // 128-bit lane.
+        TOOLBOX_SIMD_TARGET_AVX2 static inline __m256i PackChannel(__m256 even, __m256 odd) {
+            const __m256i e = _mm256_cvttps_epi32(even);
+            const __m256i o = _mm256_cvttps_epi32(odd);
+            const __m256i w =
+                _mm256_packs_epi32(_mm256_unpacklo_epi32(e, o), _mm256_unpackhi_epi32(e, o));
+            return _mm256_packus_epi16(w, w);
+        }
+
+        // 16 pixels per iteration. Every step stays within its 128-bit lane, so
+        // each lane converts 8 pixels exactly like the SSE2 kernel would.
+        TOOLBOX_SIMD_TARGET_AVX2 static size_t ConvertPairs(const u8 *yuv, u8 *rgba,
+                                                            size_t pairs) {
+            const __m256i low_byte  = _mm256_set1_epi16(0x00FF);
+            const __m256i low_word  = _mm256_set1_epi32(0xFFFF);
+            const __m256i luma_bias = _mm256_set1_epi32(16);
+            const __m256i chr_bias  = _mm256_set1_epi32(128);
+            const __m256 luma_div   = _mm256_set1_ps(219.0f);
+            const __m256 chr_div    = _mm256_set1_ps(224.0f);
+            const __m256i alpha     = _mm256_set1_epi8(static_cast<char>(0xFF));
+
+            size_t i = 0;
+            for (; i + 8 <= pairs; i += 8) {
+                const __m256i in =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(yuv + i * 4));
+
+                const __m256i luma   = _mm256_and_si256(in, low_byte);
+                const __m256i chroma = _mm256_srli_epi16(in, 8);
+
+                const __m256 y0 =
+                    ExpandLanes(_mm256_and_si256(luma, low_word), luma_bias, luma_div);
+                const __m256 y1 = ExpandLanes(_mm256_srli_epi32(luma, 16), luma_bias, luma_div);
+                const __m256 u =
+                    ExpandLanes(_mm256_and_si256(chroma, low_word), chr_bias, chr_div);
+                const __m256 v  = ExpandLanes(_mm256_srli_epi32(chroma, 16), chr_bias, chr_div);
+
+                const __m256 r_off = _mm256_mul_ps(_mm256_set1_ps(s_r_from_v), v);
+                const __m256 g_off = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(s_g_from_u), u),
+                                                   _mm256_mul_ps(_mm256_set1_ps(s_g_from_v), v));
+                const __m256 b_off = _mm256_mul_ps(_mm256_set1_ps(s_b_from_u), u);
+
+                const __m256i r = PackChannel(_mm256_add_ps(y0, r_off), _mm256_add_ps(y1, r_off));
+                const __m256i g = PackChannel(_mm256_sub_ps(y0, g_off), _mm256_sub_ps(y1, g_off));
+                const __m256i b = PackChannel(_mm256_add_ps(y0, b_off), _mm256_add_ps(y1, b_off));
+
+                const __m256i rg = _mm256_unpacklo_epi8(r, g);
+                const __m256i ba = _mm256_unpacklo_epi8(b, alpha);
+                const __m256i lo = _mm256_unpacklo_epi16(rg, ba);
+                const __m256i hi = _mm256_unpackhi_epi16(rg, ba);
+
+                u8 *out = rgba + i * 8;
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                                    _mm256_permute2x128_si256(lo, hi, 0x20));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 32),
+                                    _mm256_permute2x128_si256(lo, hi, 0x31));
+            }
+            return i;
+        }
+
+    }  // namespace AVX2
+
+#endif
+
+#if defined(TOOLBOX_SIMD_SSE2)
+
+    namespace SSE2 {
+
+        static inline __m128 ExpandLanes(__m128i x, __m128i bias, __m128 div) {
+            const __m128 scaled =
+                _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(x, bias)), _mm_set1_ps(255.0f));
+            return _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_div_ps(scaled, div)));
+        }
+
+        // Interleaves the even and odd pixels of each pair back into pixel order
+        // and saturates them to bytes, leaving 8 pixels in the low half.
+        static inline __m128i PackChannel(__m128 even, __m128 odd) {
+            const __m128i e = _mm_cvttps_epi32(even);
+            const __m128i o = _mm_cvttps_epi32(odd);
+            const __m128i w = _mm_packs_epi32(_mm_unpacklo_epi32(e, o), _mm_unpackhi_epi32(e, o));
+            return _mm_packus_epi16(w, w);
+        }
+
+        // 8 pixels per iteration
+        static size_t ConvertPairs(const u8 *yuv, u8 *rgba, size_t pairs) {
+            const __m128i low_byte  = _mm_set1_epi16(0x00FF);
+            const __m128i low_word  = _mm_set1_epi32(0xFFFF);
+            const __m128i luma_bias = _mm_set1_epi32(16);
+            const __m128i chr_bias  = _mm_set1_epi32(128);
+            const __m128 luma_div   = _mm_set1_ps(219.0f);
+            const __m128 chr_div    = _mm_set1_ps(224.0f);
+            const __m128i alpha     = _mm_set1_epi8(static_cast<char>(0xFF));
+
+            size_t i = 0;
+            for (; i + 4 <= pairs; i += 4) {
+                const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(yuv + i * 4));
+
+                const __m128i luma   = _mm_and_si128(in, low_byte);
+                const __m128i chroma = _mm_srli_epi16(in, 8);
+
+                const __m128 y0 = ExpandLanes(_mm_and_si128(luma, low_word), luma_bias, luma_div);
+                const __m128 y1 = ExpandLanes(_mm_srli_epi32(luma, 16), luma_bias, luma_div);
+                const __m128 u  = ExpandLanes(_mm_and_si128(chroma, low_word), chr_bias, chr_div);
+                const __m128 v  = ExpandLanes(_mm_srli_epi32(chroma, 16), chr_bias, chr_div);
+
+                const __m128 r_off = _mm_mul_ps(_mm_set1_ps(s_r_from_v), v);
+                const __m128 g_off = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(s_g_from_u), u),
+                                                _mm_mul_ps(_mm_set1_ps(s_g_from_v), v));
+                const __m128 b_off = _mm_mul_ps(_mm_set1_ps(s_b_from_u), u);
+
+                const __m128i r = PackChannel(_mm_add_ps(y0, r_off), _mm_add_ps(y1, r_off));
+                const __m128i g = PackChannel(_mm_sub_ps(y0, g_off), _mm_sub_ps(y1, g_off));
+                const __m128i b = PackChannel(_mm_add_ps(y0, b_off), _mm_add_ps(y1, b_off));
+
+                const __m128i rg = _mm_unpacklo_epi8(r, g);
+                const __m128i ba = _mm_unpacklo_epi8(b, alpha);
+
+                u8 *out = rgba + i * 8;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_unpacklo_epi16(rg, ba));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 16), _mm_unpackhi_epi16(rg, ba));
+            }
+            return i;
+        }
+
+    }  // namespace SSE2
+
+#endif
+
+    void ConvertYUV422ToRGBA8888(const u8 *yuv, u8 *rgba, size_t pixel_count) {
+        const size_t pairs = pixel_count / 2;
+        size_t done        = 0;
+
+#if defined(TOOLBOX_SIMD_AVX2)
+        if (SIMD::HasAVX2()) {
+            done = AVX2::ConvertPairs(yuv, rgba, pairs);
+        }
+#endif
+#if defined(TOOLBOX_SIMD_SSE2)
+        done += SSE2::ConvertPairs(yuv + done * 4, rgba + done * 8, pairs - done);
+#endif
+
+        ConvertPairsScalar(yuv + done * 4, rgba + done * 8, pairs - done);
+    }
+
+    void XFBCapture::setLocator(locate_cb locator) {
+        std::scoped_lock lock(m_locator_mutex);
+        m_locator = std::move(locator);
+    }
+
+    bool XFBCapture::updateTexture(ImageHandle &image) {
+        m_last_request.store(std::chrono::steady_clock::now().time_since_epoch().count());
+
+        std::scoped_lock lock(m_frame_mutex);
+        if (m_sequence == m_uploaded_seq) {
+            return false;
+        }
+        m_uploaded_seq = m_sequence;
+
+        const Frame &frame = m_frames[m_front];
+        if (frame.m_width == 0 || frame.m_height == 0) {
+            image = ImageHandle();
+            return true;
+        }
+
+        image.update(frame.m_pixels, 4, frame.m_width, frame.m_height);
+        return true;
+    }
+
+    bool XFBCapture::isWanted() const {
+        const auto last = std::chrono::steady_clock::time_point(
+            std::chrono::steady_clock::duration(m_last_request.load()));
+        return std::chrono::steady_clock::now() - last < s_idle_timeout;
+    }
+
+    void XFBCapture::tRun(void *param) {
+        DolphinHookManager &manager = DolphinHookManager::instance();
+
+        bool had_frame = true;
+        while (!tIsSignalKill()) {
+            const auto poll_start = std::chrono::steady_clock::now();
+
+            const bool has_frame = isWanted() && captureFrame(manager);
+            if (!has_frame && had_frame) {
+                // Let the reader drop its texture once the game goes away
+                m_yuv[m_yuv_current].clear();
+                publishFrame(0, 0);
+            }
+            had_frame = has_frame;
+
+            std::this_thread::sleep_until(poll_start + s_poll_interval);
+        }
+    }
+
+    bool XFBCapture::captureFrame(DolphinHookManager &manager) {
+        if (!manager.isHooked()) {
+            return false;
+        }
+
+        std::optional<Source> source;
+        {
+            std::scoped_lock lock(m_locator_mutex);
+            if (m_locator) {
+                source = m_locator(manager);
+            }
+        }
+
+        if (!source || source->m_address == 0 || source->m_width <= 0 || source->m_height <= 0) {
+            return false;
+        }
+
+        const size_t pixel_count = static_cast<size_t>(source->m_width) * source->m_height;
+
+        std::vector<u8> &previous = m_yuv[m_yuv_current];
+        std::vector<u8> &next     = m_yuv[m_yuv_current ^ 1];
+        next.resize(pixel_count * 2);
+
+        auto result = manager.readBytes(reinterpret_cast<char *>(next.data()), source->m_address,
+                                        next.size());
+        if (!result) {
+            return false;
+        }
+
+        if (next == previous) {
+            return true;
+        }
+        m_yuv_current ^= 1;
+
+        // The reader only ever touches the front frame, so the back one can be
+        // converted into without holding the lock.
+        Frame &back = m_frames[m_front ^ 1];
+        back.m_pixels.resize(pixel_count * 4);
+        ConvertYUV422ToRGBA8888(next.data(), back.m_pixels.data(), pixel_count);
+
+        publishFrame(source->m_width, source->m_height);
+        return true;
+    }
+
+    void XFBCapture::publishFrame(int width, int height) {
+        std::scoped_lock lock(m_frame_mutex);
+        Frame &back   = m_frames[m_front ^ 1];
+        back.m_width  = width;
+        back.m_height = height;
+        m_front ^= 1;
+        m_sequence += 1;
+    }
+
+}  // namespace Toolbox::Dolphin
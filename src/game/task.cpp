@@ -2,8 +2,10 @@
 
 #include <gcm.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <iterator>
 #include <mutex>
 #include <thread>
 
@@ -24,7 +26,7 @@ using namespace Toolbox;
 
 namespace BetterSMS {
 
-    enum class ETask {
+    enum class ETask : u32 {
         NONE                  = 0,
         GET_NAMEREF_PTR       = 1,
         CREATE_NAMEREF        = 2,
@@ -33,6 +35,8 @@ namespace BetterSMS {
         PLAY_CAMERA_DEMO      = 5,
         UPDATE_SCENE_ARCHIVE  = 6,
         CHANGE_SCENE          = 7,
+        // Several of the tasks above packed into one request buffer
+        BATCH = 8,
     };
 
     namespace _impl {
@@ -41,6 +45,24 @@ namespace BetterSMS {
         static u32 s_response_buffer_p_addr     = 0x800002E8;
         static const u32 s_request_buffer_size  = 0x10000;
         static const u32 s_response_buffer_size = 0x100;
+
+        // Builds that understand ETask::BATCH advertise it here. Older builds
+        // leave the word zeroed, and requests are then sent one at a time.
+        static u32 s_capabilities_addr      = 0x800002EC;
+        static const u32 s_capability_batch = 1 << 0;
+
+        // A batch is a big endian u32 count followed by one entry per task:
+        // u32 task, u32 payload size, then the payload padded to 4 bytes. The
+        // game answers each entry with a s32 status and a u32 result word.
+        static const u32 s_batch_header_size   = 4;
+        static const u32 s_batch_entry_header  = 8;
+        static const u32 s_batch_response_size = 8;
+        static const u32 s_batch_max_entries =
+            (s_response_buffer_size - 4) / s_batch_response_size;
+
+        static constexpr u32 batchEntrySize(size_t payload_size) {
+            return s_batch_entry_header + ((static_cast<u32>(payload_size) + 3) & ~3u);
+        }
     }  // namespace _impl
 
     static bool isBetterSMSBusy() {
@@ -49,6 +71,12 @@ namespace BetterSMS {
                (u32)ETask::NONE;
     }
 
+    static bool isBatchSupported() {
+        DolphinCommunicator &communicator = MainApplication::instance().getDolphinCommunicator();
+        return (communicator.read<u32>(_impl::s_capabilities_addr).value_or(0) &
+                _impl::s_capability_batch) != 0;
+    }
+
     // Interface functions
     static Result<Buffer, std::string> getResponseBuffer() {
         DolphinCommunicator &communicator = MainApplication::instance().getDolphinCommunicator();
@@ -95,30 +123,17 @@ namespace BetterSMS {
         communicator.write<u32>(_impl::s_requested_task_addr, static_cast<u32>(task));
     }
 
-    static bool waitForResponse(std::optional<TimeStep> timeout) {
+    // True once the game has answered the posted task, successfully or not
+    static Result<bool, std::string> hasResponded() {
         DolphinCommunicator &communicator = MainApplication::instance().getDolphinCommunicator();
-        TimePoint start_time              = std::chrono::high_resolution_clock::now();
-        while (true) {
-            if (timeout.has_value()) {
-                TimeStep elapsed_time(start_time, std::chrono::high_resolution_clock::now());
-                if (elapsed_time >= timeout.value()) {
-                    return false;
-                }
-            }
 
-            u32 response_buffer_ptr =
-                communicator.read<u32>(_impl::s_response_buffer_p_addr).value_or(0);
-            if (response_buffer_ptr == 0) {
-                return false;
-            }
-
-            u8 state = communicator.read<u8>(response_buffer_ptr).value_or(-1);
-            if (state != 0) {
-                return true;
-            }
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        u32 response_buffer_ptr =
+            communicator.read<u32>(_impl::s_response_buffer_p_addr).value_or(0);
+        if (response_buffer_ptr == 0) {
+            return std::unexpected("Response buffer pointer is null!");
         }
+
+        return communicator.read<u8>(response_buffer_ptr).value_or(-1) != 0;
     }
 
 }  // namespace BetterSMS
@@ -131,6 +146,12 @@ namespace Toolbox::Game {
             std::string formatter = fpr_val < 0.0 ? "{:9.9g}" : "{:10.10g}";
             return std::format("{:10.09g}", fpr_val);
         }
+
+        TaskCommunicator::request_future_t CompletedRequest(Result<u32> result) {
+            std::promise<Result<u32>> promise;
+            promise.set_value(std::move(result));
+            return promise.get_future();
+        }
     }  // namespace
 
     static std::vector<std::string>
@@ -159,6 +180,7 @@ namespace Toolbox::Game {
     }
 
     void TaskCommunicator::tRun(void *param) {
+        m_task_thread_id   = std::this_thread::get_id();
         m_game_interpreter = Interpreter::SystemDolphin();
 
         m_game_interpreter.onException([](u32 bad_instr_ptr, Interpreter::ExceptionCause cause,
@@ -193,18 +215,326 @@ namespace Toolbox::Game {
             checkForAcquiredStackFrameAndBuffer();
 
             // Dismiss tasks if disconnected to avoid errors
-            while (!m_task_queue.empty() && !communicator.tIsKilled()) {
-                std::unique_lock<std::mutex> lk(m_mutex);
-                std::function<bool(DolphinCommunicator &)> task = m_task_queue.front();
-                if (task(communicator)) {
-                    m_task_queue.pop();
+            const bool retry_pending = !communicator.tIsKilled() && drainTasks(communicator);
+            drainRequests(communicator);
+
+            // Sleep until new work arrives. A task waiting on the game is
+            // retried at the refresh rate instead, and the wait is bounded
+            // either way so that the hook state above stays fresh.
+            std::unique_lock<std::mutex> lock(m_task_mutex);
+            m_task_cv.wait_for(lock, std::chrono::milliseconds(communicator.getRefreshRate()),
+                               [&]() {
+                                   return tIsSignalKill() || !m_request_queue.empty() ||
+                                          (!retry_pending && !m_task_queue.empty());
+                               });
+        }
+
+        // Nothing will answer requests queued after this point
+        std::deque<PendingRequest> abandoned;
+        {
+            std::scoped_lock lock(m_task_mutex);
+            abandoned.swap(m_request_queue);
+            m_task_thread_id = std::thread::id();
+        }
+        for (PendingRequest &request : abandoned) {
+            completeRequest(request, make_error<u32>("TASK", "Task communicator was stopped!"));
+        }
+
+        m_task_cv.notify_all();
+        m_xfb_capture.tKill(true);
+    }
+
+    TaskCommunicator::request_future_t
+    TaskCommunicator::submitRequest(BetterSMS::ETask task, std::vector<u8> &&payload,
+                                    transact_complete_cb on_complete) {
+        PendingRequest request = {task, std::move(payload), std::move(on_complete), {}};
+        request_future_t future = request.m_promise.get_future();
+
+        if (request.m_payload.size() > BetterSMS::_impl::s_request_buffer_size) {
+            completeRequest(
+                request, make_error<u32>("TASK", "Request is too large for the BetterSMS buffer!"));
+            return future;
+        }
+
+        // A task running on the task thread would otherwise wait on itself
+        if (std::this_thread::get_id() == m_task_thread_id.load()) {
+            exchangeRequest(request);
+            return future;
+        }
+
+        {
+            std::scoped_lock lock(m_task_mutex);
+            if (!tIsAlive() || m_task_thread_id.load() == std::thread::id()) {
+                completeRequest(request,
+                                make_error<u32>("TASK", "Task communicator isn't running!"));
+                return future;
+            }
+            m_request_queue.push_back(std::move(request));
+        }
+        m_task_cv.notify_one();
+        return future;
+    }
+
+    void TaskCommunicator::drainRequests(DolphinCommunicator &communicator) {
+        std::deque<PendingRequest> pending;
+        {
+            std::scoped_lock lock(m_task_mutex);
+            pending.swap(m_request_queue);
+        }
+
+        if (pending.empty()) {
+            return;
+        }
+
+        const bool can_pack = communicator.manager().isHooked() && BetterSMS::isBatchSupported();
+
+        while (!pending.empty()) {
+            if (tIsSignalKill() || communicator.tIsKilled() ||
+                !communicator.manager().isHooked()) {
+                for (PendingRequest &request : pending) {
+                    completeRequest(request, make_error<u32>("TASK", "Dolphin isn't hooked!"));
                 }
-                std::this_thread::sleep_for(
-                    std::chrono::milliseconds(communicator.getRefreshRate()));
+                return;
             }
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(communicator.getRefreshRate()));
+            size_t count = 1;
+            if (can_pack) {
+                u32 packed_size = BetterSMS::_impl::s_batch_header_size +
+                                  BetterSMS::_impl::batchEntrySize(pending[0].m_payload.size());
+                while (count < pending.size() && count < BetterSMS::_impl::s_batch_max_entries) {
+                    const u32 entry_size =
+                        BetterSMS::_impl::batchEntrySize(pending[count].m_payload.size());
+                    if (packed_size + entry_size > BetterSMS::_impl::s_request_buffer_size) {
+                        break;
+                    }
+                    packed_size += entry_size;
+                    count += 1;
+                }
+            }
+
+            if (count == 1) {
+                exchangeRequest(pending.front());
+            } else {
+                std::vector<PendingRequest> batch;
+                batch.reserve(count);
+                std::move(pending.begin(), pending.begin() + count, std::back_inserter(batch));
+                exchangePackedRequests(batch);
+            }
+
+            pending.erase(pending.begin(), pending.begin() + count);
+        }
+    }
+
+    void TaskCommunicator::exchangeRequest(PendingRequest &request) {
+        if (BetterSMS::isBetterSMSBusy()) {
+            completeRequest(request, make_error<u32>("TASK", "BetterSMS is busy!"));
+            return;
+        }
+
+        Result<Buffer, std::string> maybe_request_buffer = BetterSMS::getRequestBuffer();
+        if (!maybe_request_buffer) {
+            completeRequest(request, make_error<u32>("TASK", maybe_request_buffer.error()));
+            return;
+        }
+
+        Buffer request_buffer = std::move(maybe_request_buffer.value());
+        request_buffer.initTo('\0');
+        std::memcpy(request_buffer.buf<u8>(), request.m_payload.data(), request.m_payload.size());
+
+        if (!transactBetterSMS(request.m_task, TimeStep(5.0))) {
+            completeRequest(request,
+                            make_error<u32>("TASK", "Timed out waiting for a BetterSMS response!"));
+            return;
         }
+
+        Result<Buffer, std::string> maybe_response_buffer = BetterSMS::getResponseBuffer();
+        if (!maybe_response_buffer) {
+            completeRequest(request, make_error<u32>("TASK", maybe_response_buffer.error()));
+            return;
+        }
+
+        Buffer response_buffer = std::move(maybe_response_buffer.value());
+        u32 result             = std::byteswap(response_buffer.get<u32>(0));
+
+        request_buffer.initTo('\0');
+        response_buffer.initTo('\0');
+
+        completeRequest(request, result);
+    }
+
+    void TaskCommunicator::exchangePackedRequests(std::span<PendingRequest> requests) {
+        auto fail_all = [&](const std::string &reason) {
+            for (PendingRequest &request : requests) {
+                completeRequest(request, make_error<u32>("TASK", reason));
+            }
+        };
+
+        if (BetterSMS::isBetterSMSBusy()) {
+            fail_all("BetterSMS is busy!");
+            return;
+        }
+
+        Result<Buffer, std::string> maybe_request_buffer = BetterSMS::getRequestBuffer();
+        if (!maybe_request_buffer) {
+            fail_all(maybe_request_buffer.error());
+            return;
+        }
+
+        Buffer request_buffer = std::move(maybe_request_buffer.value());
+        request_buffer.initTo('\0');
+        request_buffer.set<u32>(0, std::byteswap(static_cast<u32>(requests.size())));
+
+        u32 offset = BetterSMS::_impl::s_batch_header_size;
+        for (const PendingRequest &request : requests) {
+            const u32 payload_size = static_cast<u32>(request.m_payload.size());
+            request_buffer.set<u32>(offset, std::byteswap(static_cast<u32>(request.m_task)));
+            request_buffer.set<u32>(offset + 4, std::byteswap(payload_size));
+            std::memcpy(request_buffer.buf<u8>() + offset + BetterSMS::_impl::s_batch_entry_header,
+                        request.m_payload.data(), payload_size);
+            offset += BetterSMS::_impl::batchEntrySize(payload_size);
+        }
+
+        if (!transactBetterSMS(BetterSMS::ETask::BATCH, TimeStep(5.0))) {
+            fail_all("Timed out waiting for a BetterSMS response!");
+            return;
+        }
+
+        Result<Buffer, std::string> maybe_response_buffer = BetterSMS::getResponseBuffer();
+        if (!maybe_response_buffer) {
+            fail_all(maybe_response_buffer.error());
+            return;
+        }
+
+        Buffer response_buffer = std::move(maybe_response_buffer.value());
+        for (size_t i = 0; i < requests.size(); ++i) {
+            const u32 entry_offset = static_cast<u32>(i) * BetterSMS::_impl::s_batch_response_size;
+            const s32 status       = std::byteswap(response_buffer.get<s32>(entry_offset));
+            const u32 result       = std::byteswap(response_buffer.get<u32>(entry_offset + 4));
+            if (status != 0) {
+                completeRequest(requests[i],
+                                make_error<u32>("TASK", std::format("BetterSMS rejected task {} ({})",
+                                                                    magic_enum::enum_name(
+                                                                        requests[i].m_task),
+                                                                    status)));
+            } else {
+                completeRequest(requests[i], result);
+            }
+        }
+
+        request_buffer.initTo('\0');
+        response_buffer.initTo('\0');
+    }
+
+    void TaskCommunicator::completeRequest(PendingRequest &request, Result<u32> result) {
+        if (result && request.m_on_complete) {
+            request.m_on_complete(result.value());
+        }
+        request.m_promise.set_value(std::move(result));
+    }
+
+    bool TaskCommunicator::drainTasks(DolphinCommunicator &communicator) {
+        std::deque<PendingTask> batch;
+        {
+            std::scoped_lock lock(m_task_mutex);
+            if (m_task_queue.empty()) {
+                return false;
+            }
+            batch.swap(m_task_queue);
+        }
+
+        while (!batch.empty() && !tIsSignalKill()) {
+            PendingTask &pending = batch.front();
+            if (!pending.m_task(communicator)) {
+                break;
+            }
+
+            recordLatency(m_task_stats,
+                          TimeStep(pending.m_submitted, std::chrono::high_resolution_clock::now()),
+                          true);
+            batch.pop_front();
+        }
+
+        const bool retry_pending = !batch.empty();
+
+        {
+            std::scoped_lock lock(m_task_mutex);
+
+            // Anything submitted while the batch ran goes after what is left of it
+            std::move(m_task_queue.begin(), m_task_queue.end(), std::back_inserter(batch));
+            m_task_queue.swap(batch);
+        }
+
+        return retry_pending;
+    }
+
+    bool TaskCommunicator::transactBetterSMS(BetterSMS::ETask task, TimeStep timeout) {
+        TimePoint start_time = std::chrono::high_resolution_clock::now();
+
+        BetterSMS::setRequestTaskAndFinalize(task);
+        const bool responded = awaitBetterSMSResponse(timeout);
+
+        recordLatency(m_request_stats,
+                      TimeStep(start_time, std::chrono::high_resolution_clock::now()), responded);
+        return responded;
+    }
+
+    bool TaskCommunicator::awaitBetterSMSResponse(TimeStep timeout) {
+        TimePoint start_time = std::chrono::high_resolution_clock::now();
+
+        std::unique_lock<std::mutex> lock(m_task_mutex);
+        while (!tIsSignalKill()) {
+            Result<bool, std::string> responded = BetterSMS::hasResponded();
+            if (!responded) {
+                TOOLBOX_ERROR_V("[TASK] {}", responded.error());
+                return false;
+            }
+
+            if (responded.value()) {
+                return true;
+            }
+
+            TimeStep elapsed_time(start_time, std::chrono::high_resolution_clock::now());
+            if (elapsed_time >= timeout) {
+                return false;
+            }
+
+            m_task_cv.wait_for(lock, std::chrono::milliseconds(1),
+                               [this]() { return tIsSignalKill(); });
+        }
+
+        return false;
+    }
+
+    void TaskCommunicator::recordLatency(RequestStats &stats, TimeStep latency, bool succeeded) {
+        std::scoped_lock lock(m_stats_mutex);
+
+        if (!succeeded) {
+            stats.m_failures += 1;
+            return;
+        }
+
+        const f64 latency_ms = latency.milliseconds();
+        stats.m_min_ms       = stats.m_count == 0 ? latency_ms : std::min(stats.m_min_ms, latency_ms);
+        stats.m_max_ms       = std::max(stats.m_max_ms, latency_ms);
+        stats.m_last_ms      = latency_ms;
+        stats.m_total_ms += latency_ms;
+        stats.m_count += 1;
+    }
+
+    TaskCommunicator::RequestStats TaskCommunicator::getRequestStats() const {
+        std::scoped_lock lock(m_stats_mutex);
+        return m_request_stats;
+    }
+
+    TaskCommunicator::RequestStats TaskCommunicator::getTaskStats() const {
+        std::scoped_lock lock(m_stats_mutex);
+        return m_task_stats;
+    }
+
+    void TaskCommunicator::resetRequestStats() {
+        std::scoped_lock lock(m_stats_mutex);
+        m_request_stats = {};
+        m_task_stats    = {};
     }
 
     u32 TaskCommunicator::allocGameMemory(u32 heap_ptr, u32 size, u32 alignment) {
@@ -463,33 +793,12 @@ namespace Toolbox::Game {
             return 0;
         }
 
-        auto dolphin_interpreter = createInterpreterUnchecked();
-        if (!dolphin_interpreter) {
-            return 0;
-        }
-
         auto result = String::toGameEncoding(actor->getNameRef().name());
         if (!result) {
             return 0;
         }
 
-        constexpr u32 request_buffer_address = 0x80000FA0;
-
-        Buffer &interpreter_buf = dolphin_interpreter->getMemoryBuffer();
-
-        std::memset(interpreter_buf.buf<u8>() + (request_buffer_address - 0x80000000), '\0', 0x200);
-
-        std::string actor_name = result.value();
-        std::strncpy(interpreter_buf.buf<char>() + (request_buffer_address - 0x80000000),
-                     actor_name.c_str(), actor_name.size());
-
-        u32 namerefgen_addr = dolphin_interpreter->read<u32>(0x8040E408);
-        u32 rootref_addr    = dolphin_interpreter->read<u32>(namerefgen_addr + 0x4);
-
-        u32 argv[2]   = {rootref_addr, request_buffer_address};
-        auto snapshot = dolphin_interpreter->evaluateFunction(0x80198d0c, 2, argv, 0, nullptr);
-
-        return static_cast<u32>(snapshot.m_gpr[3]);
+        return evaluateNameRefSearch(result.value());
 #else
         if (!isSceneLoaded() || BetterSMS::isBetterSMSBusy()) {
             return 0;
@@ -507,9 +816,7 @@ namespace Toolbox::Game {
         std::string actor_name = String::toGameEncoding(actor->getNameRef().name()).value_or("");
         std::strncpy(request_buffer.buf<char>(), actor_name.data(), actor_name.size());
 
-        BetterSMS::setRequestTaskAndFinalize(BetterSMS::ETask::GET_NAMEREF_PTR);
-
-        if (BetterSMS::waitForResponse(TimeStep(5.0))) {
+        if (transactBetterSMS(BetterSMS::ETask::GET_NAMEREF_PTR, TimeStep(5.0))) {
             Result<Buffer, std::string> maybe_response_buffer = BetterSMS::getResponseBuffer();
             if (!maybe_response_buffer) {
                 TOOLBOX_ERROR_V("[TASK] {}", maybe_response_buffer.error());
@@ -531,65 +838,25 @@ namespace Toolbox::Game {
     }
 
     u32 TaskCommunicator::getActorPtr(const std::string &name) {
-        if (!isSceneLoaded() || BetterSMS::isBetterSMSBusy()) {
+        if (!isSceneLoaded()) {
             return 0;
         }
 
 #ifdef TOOLBOX_USE_INTERPRETER
-        auto dolphin_interpreter = createInterpreterUnchecked();
-        if (!dolphin_interpreter) {
-            return 0;
-        }
-
-        constexpr u32 request_buffer_address = 0x80000FA0;
-
-        Buffer &interpreter_buf = dolphin_interpreter->getMemoryBuffer();
-
-        std::memset(interpreter_buf.buf<u8>() + (request_buffer_address - 0x80000000), '\0', 0x200);
-
-        std::strncpy(interpreter_buf.buf<char>() + (request_buffer_address - 0x80000000),
-                     name.c_str(), name.size());
-
-        u32 namerefgen_addr = dolphin_interpreter->read<u32>(0x8040E408);
-        u32 rootref_addr    = dolphin_interpreter->read<u32>(namerefgen_addr + 0x4);
-
-        u32 argv[2]   = {rootref_addr, request_buffer_address};
-        auto snapshot = dolphin_interpreter->evaluateFunction(0x80198D0C, 2, argv, 0, nullptr);
-
-        return static_cast<u32>(snapshot.m_gpr[3]);
+        return evaluateNameRefSearch(name);
 #else
-        Result<Buffer, std::string> maybe_request_buffer = BetterSMS::getRequestBuffer();
-        if (!maybe_request_buffer) {
-            TOOLBOX_ERROR_V("[TASK] {}", maybe_request_buffer.error());
-            return 0;
-        }
-
-        Buffer request_buffer = std::move(maybe_request_buffer.value());
-        std::memset(request_buffer.buf<u8>(), '\0', BetterSMS::_impl::s_request_buffer_size);
-
         std::string actor_name = String::toGameEncoding(name).value_or("");
-        std::strncpy(request_buffer.buf<char>(), actor_name.data(), actor_name.size());
-
-        BetterSMS::setRequestTaskAndFinalize(BetterSMS::ETask::GET_NAMEREF_PTR);
-
-        if (BetterSMS::waitForResponse(TimeStep(5.0))) {
-            Result<Buffer, std::string> maybe_response_buffer = BetterSMS::getResponseBuffer();
-            if (!maybe_response_buffer) {
-                TOOLBOX_ERROR_V("[TASK] {}", maybe_response_buffer.error());
-                return 0;
-            }
+        std::vector<u8> payload(actor_name.begin(), actor_name.end());
+        payload.push_back('\0');
 
-            Buffer response_buffer = std::move(maybe_response_buffer.value());
-            u32 actor_ptr          = std::byteswap(response_buffer.get<u32>(0));
-
-            request_buffer.initTo('\0');
-            response_buffer.initTo('\0');
-
-            return actor_ptr;
+        Result<u32> actor_ptr =
+            submitRequest(BetterSMS::ETask::GET_NAMEREF_PTR, std::move(payload)).get();
+        if (!actor_ptr) {
+            UI::LogError(actor_ptr.error());
+            return 0;
         }
 
-        TOOLBOX_ERROR("[TASK] Timeout waiting for actor pointer response!");
-        return 0;
+        return actor_ptr.value();
 #endif
     }
 
@@ -630,47 +897,59 @@ namespace Toolbox::Game {
             return false;
         }
 
-        auto game_stage_result = communicator.read<u8>(application_addr + 0xE);
-        if (!game_stage_result) {
-            UI::LogError(game_stage_result.error());
-            return false;
-        }
+        u32 mar_director_address = 0;
+        u8 director_type         = 0;
+        u8 game_stage            = 0;
+        u8 game_scenario         = 0;
 
-        auto game_scenario_result = communicator.read<u8>(application_addr + 0xF);
-        if (!game_scenario_result) {
-            UI::LogError(game_scenario_result.error());
+        MemoryReadBatch application_batch;
+        application_batch.read(application_addr + 0x4, mar_director_address)
+            .read(application_addr + 0x8, director_type)
+            .read(application_addr + 0xE, game_stage)
+            .read(application_addr + 0xF, game_scenario);
+
+        auto application_result = application_batch.submit();
+        if (!application_result) {
+            UI::LogError(application_result.error());
             return false;
         }
 
-        u8 game_stage    = game_stage_result.value();
-        u8 game_scenario = game_scenario_result.value();
-
         // The game stage is not what we want, tell the game to reload is possible
         if (game_stage != stage || game_scenario != scenario) {
             return false;
         }
 
         // The mar director ain't directing
-        if (communicator.read<u8>(application_addr + 0x8).value() != c_mar_director_id) {
+        if (director_type != c_mar_director_id) {
             return false;
         }
 
-        u32 mar_director_address = communicator.read<u32>(application_addr + 0x4).value();
+        u32 mar_director_frames     = 0;
+        u8 mar_director_state       = 0;
+        u8 mar_game_stage_result    = 0;
+        u8 mar_game_scenario_result = 0;
 
-        u8 mar_game_stage_result    = communicator.read<u8>(mar_director_address + 0x7C).value();
-        u8 mar_game_scenario_result = communicator.read<u8>(mar_director_address + 0x7D).value();
+        MemoryReadBatch director_batch;
+        director_batch.read(mar_director_address + 0x5C, mar_director_frames)
+            .read(mar_director_address + 0x64, mar_director_state)
+            .read(mar_director_address + 0x7C, mar_game_stage_result)
+            .read(mar_director_address + 0x7D, mar_game_scenario_result);
+
+        auto director_result = director_batch.submit();
+        if (!director_result) {
+            UI::LogError(director_result.error());
+            return false;
+        }
 
         // The game stage is not what we want, tell the game to reload is possible
         if (mar_game_stage_result != stage || mar_game_scenario_result != game_scenario) {
             return false;
         }
 
-        u16 mar_director_frames = communicator.read<u32>(mar_director_address + 0x5C).value();
-        if (mar_director_frames == 0) {
+        if (static_cast<u16>(mar_director_frames) == 0) {
             return false;
         }
 
-        u8 mar_director_state = communicator.read<u8>(mar_director_address + 0x64).value();
         if (mar_director_state != 4) {
             return false;
         }
@@ -821,9 +1100,7 @@ namespace Toolbox::Game {
                 request_buffer.set<u8>(0, stage);
                 request_buffer.set<u8>(1, scenario);
 
-                BetterSMS::setRequestTaskAndFinalize(BetterSMS::ETask::CHANGE_SCENE);
-
-                if (BetterSMS::waitForResponse(TimeStep(5.0))) {
+                if (transactBetterSMS(BetterSMS::ETask::CHANGE_SCENE, TimeStep(5.0))) {
                     Result<Buffer, std::string> maybe_response_buffer =
                         BetterSMS::getResponseBuffer();
                     if (!maybe_response_buffer) {
@@ -845,20 +1122,21 @@ namespace Toolbox::Game {
             stage, scenario, clone_complete_cb);
     }
 
-    Result<void> TaskCommunicator::taskAddSceneObject(RefPtr<ISceneObject> object,
-                                                      RefPtr<GroupSceneObject> parent,
-                                                      transact_complete_cb clone_complete_cb) {
+    TaskCommunicator::request_future_t
+    TaskCommunicator::taskAddSceneObject(RefPtr<ISceneObject> object,
+                                         RefPtr<GroupSceneObject> parent,
+                                         transact_complete_cb clone_complete_cb) {
 #ifdef TOOLBOX_USE_INTERPRETER
         u32 parent_ptr = getActorPtr(parent);
         if (parent_ptr == 0) {
-            return make_error<void>(
+            return CompletedRequest(make_error<u32>(
                 "GAME TASK",
-                "Failed to add object to game scene since parent isn't in game scene!");
+                "Failed to add object to game scene since parent isn't in game scene!"));
         }
 
         if (parent->type() != "IdxGroup") {
-            return make_error<void>(
-                "GAME TASK", "Failed to add object to game scene since parent isn't IdxGroup!");
+            return CompletedRequest(make_error<u32>(
+                "GAME TASK", "Failed to add object to game scene since parent isn't IdxGroup!"));
         }
 
         DolphinCommunicator &communicator = GUIApplication::instance().getDolphinCommunicator();
@@ -866,15 +1144,15 @@ namespace Toolbox::Game {
         // Get cached buffer ptr
         u32 buffer_ptr = communicator.read<u32>(0x800001C4).value();
         if (buffer_ptr == 0) {
-            return make_error<void>(
-                "GAME TASK", "Failed to add object to game scene (Claimed buffer doesn't exist)!");
+            return CompletedRequest(make_error<u32>(
+                "GAME TASK", "Failed to add object to game scene (Claimed buffer doesn't exist)!"));
         }
 
         std::span<u8> obj_data = object->getData();
         if (obj_data.size() > (0x10000 - 0x100)) {
-            return make_error<void>(
+            return CompletedRequest(make_error<u32>(
                 "GAME TASK",
-                "Failed to add object to game scene (Obj data is too large for buffer)!");
+                "Failed to add object to game scene (Obj data is too large for buffer)!"));
         }
 
         communicator.writeBytes(reinterpret_cast<const char *>(obj_data.data()), buffer_ptr + 0x100,
@@ -910,9 +1188,9 @@ namespace Toolbox::Game {
 
         u32 nameref_ptr = static_cast<u32>(gen_snapshot.m_gpr[3]);
         if (nameref_ptr == 0) {
-            return make_error<void>(
+            return CompletedRequest(make_error<u32>(
                 "GAME TASK",
-                "Failed to add object to game scene (Call to genObject returned nullptr)!");
+                "Failed to add object to game scene (Call to genObject returned nullptr)!"));
         }
 
         // Here we insert our generated object pointer into the perform list
@@ -920,8 +1198,8 @@ namespace Toolbox::Game {
         u32 parent_perform_list = parent_ptr + 0x10;
         u32 new_it = listInsert(parent_perform_list, listEnd(parent_perform_list), nameref_ptr);
         if (new_it == 0) {
-            return make_error<void>(
-                "GAME TASK", "Failed to add object to game scene (Parent insertion failed)!");
+            return CompletedRequest(make_error<u32>(
+                "GAME TASK", "Failed to add object to game scene (Parent insertion failed)!"));
         }
 
         u32 vtable_ptr = communicator.read<u32>(nameref_ptr).value();
@@ -945,89 +1223,66 @@ namespace Toolbox::Game {
         }
 
         // Object is initialized successfully
-        return {};
+        object->setGamePtr(nameref_ptr);
+        return CompletedRequest(nameref_ptr);
 #else
-
-        Result<Buffer, std::string> maybe_request_buffer = BetterSMS::getRequestBuffer();
-        if (!maybe_request_buffer) {
-            return make_error<void>("TASK", maybe_request_buffer.error());
-        }
-
-        Buffer request_buffer = std::move(maybe_request_buffer.value());
-        std::memset(request_buffer.buf<u8>(), '\0', BetterSMS::_impl::s_request_buffer_size);
-
         std::string parent_type = String::toGameEncoding(parent->type()).value_or("");
-        std::strncpy(request_buffer.buf<char>(), parent_type.data(),
-                     std::min<size_t>(parent_type.size(), 0x7F));
-
         std::string parent_name = String::toGameEncoding(parent->getNameRef().name()).value_or("");
-        std::strncpy(request_buffer.buf<char>() + 0x80, parent_name.data(),
-                     std::min<size_t>(parent_name.size(), 0x17F));
 
         std::span<u8> obj_data = object->getData();
-        if (obj_data.size() > (int64_t)(request_buffer.size() - 0x200)) {
-            return make_error<void>(
-                "TASK",
-                "Failed to add object to game scene (Obj data is too large for buffer)!");
-        }
-
-        std::memcpy(request_buffer.buf<char>() + 0x200, obj_data.data(), obj_data.size());
-
-        BetterSMS::setRequestTaskAndFinalize(BetterSMS::ETask::CREATE_NAMEREF);
-
-        if (BetterSMS::waitForResponse(TimeStep(5.0))) {
-            Result<Buffer, std::string> maybe_response_buffer = BetterSMS::getResponseBuffer();
-            if (!maybe_response_buffer) {
-                return make_error<void>("TASK", maybe_response_buffer.error());
-            }
-
-            Buffer response_buffer = std::move(maybe_response_buffer.value());
-            u32 actor_ptr          = std::byteswap(response_buffer.get<u32>(0));
-
-            request_buffer.initTo('\0');
-            response_buffer.initTo('\0');
-
-            object->setGamePtr(actor_ptr);
-            return {};
-        }
-
-        return make_error<void>(
-            "TASK", "Timed out while adding object to game scene!");
+        if (obj_data.size() > BetterSMS::_impl::s_request_buffer_size - 0x200) {
+            return CompletedRequest(make_error<u32>(
+                "TASK", "Failed to add object to game scene (Obj data is too large for buffer)!"));
+        }
+
+        std::vector<u8> payload(0x200 + obj_data.size(), '\0');
+        std::memcpy(payload.data(), parent_type.data(), std::min<size_t>(parent_type.size(), 0x7F));
+        std::memcpy(payload.data() + 0x80, parent_name.data(),
+                    std::min<size_t>(parent_name.size(), 0x17F));
+        std::memcpy(payload.data() + 0x200, obj_data.data(), obj_data.size());
+
+        return submitRequest(BetterSMS::ETask::CREATE_NAMEREF, std::move(payload),
+                             [object, clone_complete_cb](u32 actor_ptr) {
+                                 object->setGamePtr(actor_ptr);
+                                 if (clone_complete_cb)
+                                     clone_complete_cb(actor_ptr);
+                             });
 #endif
     }
 
-    Result<void> TaskCommunicator::taskRemoveSceneObject(RefPtr<ISceneObject> object,
-                                                         RefPtr<GroupSceneObject> parent,
-                                                         transact_complete_cb clone_complete_cb) {
+    TaskCommunicator::request_future_t
+    TaskCommunicator::taskRemoveSceneObject(RefPtr<ISceneObject> object,
+                                            RefPtr<GroupSceneObject> parent,
+                                            transact_complete_cb clone_complete_cb) {
         if (!isSceneLoaded()) {
             mCurrentAreaID = 0xFF;
             mCurrentEpisodeID = 0xFF;
-            return make_error<void>(
-                "GAME TASK", "Failed to remove object from game scene (Scene isn't loaded)!");
+            return CompletedRequest(make_error<u32>(
+                "GAME TASK", "Failed to remove object from game scene (Scene isn't loaded)!"));
         }
 
         u32 obj_ptr = getActorPtr(object);
         if (obj_ptr == 0) {
-            return {};
+            return CompletedRequest(0u);
         }
 
         u32 parent_ptr = getActorPtr(parent);
         if (parent_ptr == 0) {
-            return make_error<void>(
-                "GAME TASK", "Failed to remove object from game scene (Parent doesn't exist)!");
+            return CompletedRequest(make_error<u32>(
+                "GAME TASK", "Failed to remove object from game scene (Parent doesn't exist)!"));
         }
 
 #ifdef TOOLBOX_USE_INTERPRETER
         if (parent->type() != "IdxGroup") {
-            return make_error<void>(
-                "GAME TASK", "Failed to remove object from game scene (Parent isn't IdxGroup)!");
+            return CompletedRequest(make_error<u32>(
+                "GAME TASK", "Failed to remove object from game scene (Parent isn't IdxGroup)!"));
         }
 
         auto obj_game_key_result = String::toGameEncoding(object->getNameRef().name());
         if (!obj_game_key_result) {
-            return make_error<void>(
+            return CompletedRequest(make_error<u32>(
                 "GAME TASK",
-                "Failed to remove object from game scene (Failed to encode object name)!");
+                "Failed to remove object from game scene (Failed to encode object name)!"));
         }
 
         std::string obj_game_key = obj_game_key_result.value();
@@ -1077,94 +1332,60 @@ namespace Toolbox::Game {
                 }
             }
         });
+
+        // TODO: Call delete on object pointer using game interpreter
+
+        return CompletedRequest(obj_ptr);
 #else
-        // Remove the object from the parent list
-        Result<Buffer, std::string> maybe_request_buffer = BetterSMS::getRequestBuffer();
-        if (!maybe_request_buffer) {
-            return make_error<void>("TASK", maybe_request_buffer.error());
-        }
-        Buffer request_buffer = std::move(maybe_request_buffer.value());
-        request_buffer.initTo('\0');
         std::string parent_type = String::toGameEncoding(parent->type()).value_or("");
-        std::strncpy(request_buffer.buf<char>(), parent_type.data(),
-                     std::min<size_t>(parent_type.size(), 0x7F));
         std::string parent_name = String::toGameEncoding(parent->getNameRef().name()).value_or("");
-        std::strncpy(request_buffer.buf<char>() + 0x80, parent_name.data(),
-                     std::min<size_t>(parent_name.size(), 0x17F));
-        std::string obj_name = String::toGameEncoding(object->getNameRef().name()).value_or("");
-        std::strncpy(request_buffer.buf<char>() + 0x200, obj_name.data(),
-                     std::min<size_t>(obj_name.size(), 0x17F));
-        BetterSMS::setRequestTaskAndFinalize(BetterSMS::ETask::DELETE_NAMEREF);
-        if (BetterSMS::waitForResponse(TimeStep(5.0))) {
-            Result<Buffer, std::string> maybe_response_buffer = BetterSMS::getResponseBuffer();
-            if (!maybe_response_buffer) {
-                return make_error<void>("TASK", maybe_response_buffer.error());
-            }
-            request_buffer.initTo('\0');
-            maybe_response_buffer.value().initTo('\0');
-        } else {
-            return make_error<void>("TASK", "Timed out while removing object from game scene!");
-        }
-#endif
+        std::string obj_name    = String::toGameEncoding(object->getNameRef().name()).value_or("");
 
-        // TODO: Call delete on object pointer using game interpreter
+        std::vector<u8> payload(0x380, '\0');
+        std::memcpy(payload.data(), parent_type.data(), std::min<size_t>(parent_type.size(), 0x7F));
+        std::memcpy(payload.data() + 0x80, parent_name.data(),
+                    std::min<size_t>(parent_name.size(), 0x17F));
+        std::memcpy(payload.data() + 0x200, obj_name.data(),
+                    std::min<size_t>(obj_name.size(), 0x17F));
 
-        return {};
+        return submitRequest(BetterSMS::ETask::DELETE_NAMEREF, std::move(payload),
+                             std::move(clone_complete_cb));
+#endif
     }
 
-    Result<void> TaskCommunicator::taskRenameSceneObject(RefPtr<ISceneObject> object,
-                                                         const std::string &old_name,
-                                                         const std::string &new_name,
-                                                         transact_complete_cb clone_complete_cb) {
+    TaskCommunicator::request_future_t
+    TaskCommunicator::taskRenameSceneObject(RefPtr<ISceneObject> object,
+                                            const std::string &old_name,
+                                            const std::string &new_name,
+                                            transact_complete_cb clone_complete_cb) {
         if (!isSceneLoaded()) {
             mCurrentAreaID    = 0xFF;
             mCurrentEpisodeID = 0xFF;
-            return make_error<void>("GAME TASK",
-                                    "Failed to rename object in game scene (Scene isn't loaded)!");
+            return CompletedRequest(make_error<u32>(
+                "GAME TASK", "Failed to rename object in game scene (Scene isn't loaded)!"));
         }
 
         u32 obj_ptr = getActorPtr(object);
         if (obj_ptr == 0) {
-            return make_error<void>(
-                "GAME TASK", "Failed to rename object in game scene (Object doesn't exist)!");
+            return CompletedRequest(make_error<u32>(
+                "GAME TASK", "Failed to rename object in game scene (Object doesn't exist)!"));
         }
 
-        // Remove the object from the parent list
-        Result<Buffer, std::string> maybe_request_buffer = BetterSMS::getRequestBuffer();
-        if (!maybe_request_buffer) {
-            return make_error<void>("TASK", maybe_request_buffer.error());
-        }
-
-        Buffer request_buffer = std::move(maybe_request_buffer.value());
-        request_buffer.initTo('\0');
-
-        std::string obj_type = String::toGameEncoding(object->type()).value_or("");
+        std::string obj_type      = String::toGameEncoding(object->type()).value_or("");
         std::string old_game_name = String::toGameEncoding(old_name).value_or("");
         std::string new_game_name = String::toGameEncoding(new_name).value_or("");
-        u16 new_keycode           = NameRef::calcKeyCode(new_game_name);
-
-        std::strncpy(request_buffer.buf<char>(), obj_type.data(),
-                     std::min<size_t>(obj_type.size(), 0x7F));
-        std::strncpy(request_buffer.buf<char>() + 0x80, old_game_name.data(),
-                     std::min<size_t>(old_game_name.size(), 0x17F));
-        std::strncpy(request_buffer.buf<char>() + 0x200, new_game_name.data(),
-                     std::min<size_t>(new_game_name.size(), 0x17F));
-        *(u16 *)(request_buffer.buf<char>() + 0x380) = std::byteswap(new_keycode);
-
-        BetterSMS::setRequestTaskAndFinalize(BetterSMS::ETask::SET_NAMEREF_PARAMETER);
-
-        if (BetterSMS::waitForResponse(TimeStep(5.0))) {
-            Result<Buffer, std::string> maybe_response_buffer = BetterSMS::getResponseBuffer();
-            if (!maybe_response_buffer) {
-                return make_error<void>("TASK", maybe_response_buffer.error());
-            }
-            request_buffer.initTo('\0');
-            maybe_response_buffer.value().initTo('\0');
-        } else {
-            return make_error<void>("TASK", "Timed out while removing object from game scene!");
-        }
-
-        return {};
+        u16 new_keycode           = std::byteswap(NameRef::calcKeyCode(new_game_name));
+
+        std::vector<u8> payload(0x382, '\0');
+        std::memcpy(payload.data(), obj_type.data(), std::min<size_t>(obj_type.size(), 0x7F));
+        std::memcpy(payload.data() + 0x80, old_game_name.data(),
+                    std::min<size_t>(old_game_name.size(), 0x17F));
+        std::memcpy(payload.data() + 0x200, new_game_name.data(),
+                    std::min<size_t>(new_game_name.size(), 0x17F));
+        std::memcpy(payload.data() + 0x380, &new_keycode, sizeof(new_keycode));
+
+        return submitRequest(BetterSMS::ETask::SET_NAMEREF_PARAMETER, std::move(payload),
+                             std::move(clone_complete_cb));
     }
 
     Result<void> TaskCommunicator::taskPlayCameraDemo(std::string_view demo_name,
@@ -1567,14 +1788,49 @@ namespace Toolbox::Game {
             return ImageHandle();
         }
 
+        std::optional<XFBCapture::Source> source = LocateXFB(communicator.manager());
+        if (!source) {
+            return ImageHandle();
+        }
+
+        return communicator.manager().captureXFBAsTexture(width, height, source->m_address,
+                                                          source->m_width, source->m_height);
+    }
+
+    bool TaskCommunicator::updateXFBTexture(ImageHandle &image) {
+        if (!m_xfb_capture.tIsAlive() && !tIsSignalKill()) {
+            m_xfb_capture.setLocator(&TaskCommunicator::LocateXFB);
+            m_xfb_capture.tStart(false, nullptr);
+        }
+        return m_xfb_capture.updateTexture(image);
+    }
+
+    std::optional<XFBCapture::Source> TaskCommunicator::LocateXFB(DolphinHookManager &manager) {
+        if (!manager.isHooked()) {
+            return std::nullopt;
+        }
+
         u32 application_address = 0x803E9700;
-        u32 display_address     = communicator.read<u32>(application_address + 0x1C).value();
-        u32 xfb_address         = communicator.read<u32>(display_address + 0x8).value();
-        u16 xfb_width           = communicator.read<u16>(display_address + 0x14).value();
-        u16 xfb_height          = communicator.read<u16>(display_address + 0x18).value();
 
-        return communicator.manager().captureXFBAsTexture(width, height, xfb_address, xfb_width,
-                                                          xfb_height);
+        u32 display_address = 0;
+        if (!MemoryReadBatch().read(application_address + 0x1C, display_address).submit() ||
+            display_address == 0) {
+            return std::nullopt;
+        }
+
+        u32 xfb_address = 0;
+        u16 xfb_width   = 0;
+        u16 xfb_height  = 0;
+
+        MemoryReadBatch batch;
+        batch.read(display_address + 0x8, xfb_address)
+            .read(display_address + 0x14, xfb_width)
+            .read(display_address + 0x18, xfb_height);
+        if (!batch.submit()) {
+            return std::nullopt;
+        }
+
+        return XFBCapture::Source{xfb_address, xfb_width, xfb_height};
     }
 
     ScopePtr<Interpreter::SystemDolphin> TaskCommunicator::createInterpreter() {
@@ -1589,22 +1845,26 @@ namespace Toolbox::Game {
     }
 
     ScopePtr<Interpreter::SystemDolphin> TaskCommunicator::createInterpreterUnchecked() {
-        DolphinCommunicator &communicator = MainApplication::instance().getDolphinCommunicator();
-
         auto dolphin_interpreter = Toolbox::make_scoped<Interpreter::SystemDolphin>();
+        ConfigureInterpreter(*dolphin_interpreter);
+        if (!mapLiveMemory(*dolphin_interpreter)) {
+            return nullptr;
+        }
+        return dolphin_interpreter;
+    }
 
-        dolphin_interpreter->onException(
-            [](u32 bad_instr_ptr, Interpreter::ExceptionCause cause,
-               const Interpreter::Register::RegisterSnapshot &snapshot) {
-                TOOLBOX_ERROR_V("[INTERPRETER] {} at PC = 0x{:08X}:", magic_enum::enum_name(cause),
-                                bad_instr_ptr);
-                std::vector<std::string> exception_message = StringifySnapshot(snapshot);
-                for (auto &line : exception_message) {
-                    TOOLBOX_ERROR_V("[INTERPRETER] {}", line);
-                }
-            });
-        dolphin_interpreter->onInvalid([](u32 bad_instr_ptr, const std::string &cause,
-                                          const Interpreter::Register::RegisterSnapshot &snapshot) {
+    void TaskCommunicator::ConfigureInterpreter(Interpreter::SystemDolphin &interpreter) {
+        interpreter.onException([](u32 bad_instr_ptr, Interpreter::ExceptionCause cause,
+                                   const Interpreter::Register::RegisterSnapshot &snapshot) {
+            TOOLBOX_ERROR_V("[INTERPRETER] {} at PC = 0x{:08X}:", magic_enum::enum_name(cause),
+                            bad_instr_ptr);
+            std::vector<std::string> exception_message = StringifySnapshot(snapshot);
+            for (auto &line : exception_message) {
+                TOOLBOX_ERROR_V("[INTERPRETER] {}", line);
+            }
+        });
+        interpreter.onInvalid([](u32 bad_instr_ptr, const std::string &cause,
+                                 const Interpreter::Register::RegisterSnapshot &snapshot) {
             TOOLBOX_ERROR_V("[INTERPRETER] Invalid instruction at PC = 0x{:08X} (Reason: {}):",
                             bad_instr_ptr, cause);
             std::vector<std::string> exception_message = StringifySnapshot(snapshot);
@@ -1615,16 +1875,67 @@ namespace Toolbox::Game {
 
         // Arbitrary based on BSMS allocation
         // TODO: Region unlock using game magic
-        dolphin_interpreter->setStackPointer(0x804277E8);
-        dolphin_interpreter->setGlobalsPointerR(0x80416BA0);
-        dolphin_interpreter->setGlobalsPointerRW(0x804141C0);
+        interpreter.setStackPointer(0x804277E8);
+        interpreter.setGlobalsPointerR(0x80416BA0);
+        interpreter.setGlobalsPointerRW(0x804141C0);
+    }
 
-        // Copy bytes so we only have to check hook status once
-        // m_storage.resize(communicator.manager().getMemorySize());
-        dolphin_interpreter->applyMemory(communicator.manager().getMemoryView(),
-                                         communicator.manager().getMemorySize());
+    bool TaskCommunicator::mapLiveMemory(Interpreter::SystemDolphin &interpreter) {
+        DolphinCommunicator &communicator = MainApplication::instance().getDolphinCommunicator();
 
-        return dolphin_interpreter;
+        // Evaluate over the live view. The lease keeps it mapped until the
+        // interpreter is unmapped or destroyed; pages are copied as they are
+        // first touched and anything the function writes stays private
+        // instead of reaching the game.
+        auto lease = std::make_shared<Dolphin::MemoryViewLease>(
+            communicator.manager().leaseMemoryView());
+        if (!lease->isValid()) {
+            TOOLBOX_ERROR("[INTERPRETER] Dolphin is not hooked!");
+            return false;
+        }
+
+        const void *view = lease->view();
+        const u32 size   = lease->size();
+        interpreter.mapMemory(std::shared_ptr<const void>(std::move(lease), view), size);
+        return true;
+    }
+
+    u32 TaskCommunicator::evaluateNameRefSearch(const std::string &name) {
+        std::scoped_lock lock(m_interpreter_mutex);
+
+        // The lookup interpreter outlives the call so that its decoded blocks
+        // do too; remapping only marks them for a check against the new view.
+        if (!m_lookup_interpreter) {
+            m_lookup_interpreter = Toolbox::make_scoped<Interpreter::SystemDolphin>();
+            ConfigureInterpreter(*m_lookup_interpreter);
+        }
+
+        Interpreter::SystemDolphin &interpreter = *m_lookup_interpreter;
+        if (!mapLiveMemory(interpreter)) {
+            return 0;
+        }
+
+        constexpr u32 request_buffer_address = 0x80000FA0;
+
+        Interpreter::MemoryStorage &interpreter_mem = interpreter.getMemoryStorage();
+
+        interpreter_mem.fill(request_buffer_address - 0x80000000, '\0', 0x200);
+        interpreter_mem.writeBytes(request_buffer_address - 0x80000000, name.c_str(),
+                                   std::min<size_t>(name.size(), 0x200));
+
+        u32 namerefgen_addr = interpreter.read<u32>(0x8040E408);
+        u32 rootref_addr    = interpreter.read<u32>(namerefgen_addr + 0x4);
+
+        // A previous call that faulted may have left the stack anywhere
+        interpreter.setStackPointer(0x804277E8);
+
+        u32 argv[2]   = {rootref_addr, request_buffer_address};
+        auto snapshot = interpreter.evaluateFunction(0x80198D0C, 2, argv, 0, nullptr);
+
+        // Release the lease so the view isn't held between lookups
+        interpreter.unmapMemory();
+
+        return static_cast<u32>(snapshot.m_gpr[3]);
     }
 
 }  // namespace Toolbox::Game
\ No newline at end of file
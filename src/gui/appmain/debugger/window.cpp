@@ -81,6 +81,19 @@ constexpr static void ConvertIntToHexString(char *out, size_t out_size, _T value
 
 namespace Toolbox::UI {
 
+    static void renderRequestStats(const char *label,
+                                   const Game::TaskCommunicator::RequestStats &stats) {
+        ImGui::SeparatorText(label);
+        ImGui::Text("Completed: %llu", static_cast<unsigned long long>(stats.m_count));
+        ImGui::Text("Failed: %llu", static_cast<unsigned long long>(stats.m_failures));
+        if (stats.m_count == 0) {
+            return;
+        }
+        ImGui::Text("Last: %.2f ms", stats.m_last_ms);
+        ImGui::Text("Average: %.2f ms", stats.averageMs());
+        ImGui::Text("Min / Max: %.2f / %.2f ms", stats.m_min_ms, stats.m_max_ms);
+    }
+
     DebuggerWindow::DebuggerWindow(const std::string &name)
         : ImWindow(name), m_address_input(), m_scan_begin_input(), m_scan_end_input(),
           m_scan_value_input_a(), m_scan_value_input_b() {}
@@ -150,6 +163,22 @@ namespace Toolbox::UI {
                 ImGui::EndMenu();
             }
 
+            if (ImGui::BeginMenu("Tasks")) {
+                Game::TaskCommunicator &task_communicator =
+                    MainApplication::instance().getTaskCommunicator();
+
+                renderRequestStats("Queued Tasks", task_communicator.getTaskStats());
+                renderRequestStats("BetterSMS Requests", task_communicator.getRequestStats());
+
+                ImGui::Separator();
+
+                if (ImGui::MenuItem("Reset Statistics")) {
+                    task_communicator.resetRequestStats();
+                }
+
+                ImGui::EndMenu();
+            }
+
             if (ImGui::MenuItem("Help")) {
                 Platform::TryOpenBrowserURL(
                     "https://github.com/JoshuaMKW/JuniorsToolbox/wiki/Memory-Debugger");
@@ -2022,7 +2051,15 @@ namespace Toolbox::UI {
         void *mem_view              = manager.getMemoryView();
         size_t mem_size             = manager.getMemorySize();
 
-        MetaValue meta_value      = m_watch_proxy_model->getWatchValueMeta(watch_idx);
+        WatchPreviewCache &preview_cache = m_watch_preview_cache[watch_idx.getUUID()];
+        const u64 change_tick            = m_watch_proxy_model->getWatchChangeTick(watch_idx);
+        if (preview_cache.m_change_tick != change_tick) {
+            preview_cache.m_value         = m_watch_proxy_model->getWatchValueMeta(watch_idx);
+            preview_cache.m_change_tick   = change_tick;
+            preview_cache.m_preview_valid = false;
+        }
+
+        const MetaValue &meta_value = preview_cache.m_value;
         u32 address               = m_watch_proxy_model->getWatchAddress(watch_idx);
         u32 size                  = m_watch_proxy_model->getWatchSize(watch_idx);
         bool locked               = m_watch_proxy_model->getWatchLock(watch_idx);
@@ -2182,7 +2219,7 @@ namespace Toolbox::UI {
                 ImGui::TextEx("Invalid Watch");
             } else {
                 f32 column_width = ImGui::GetContentRegionAvail().x;
-                renderPreview(column_width, meta_value, value_base);
+                renderPreview(column_width, preview_cache, value_base);
             }
         }
 
@@ -3089,13 +3126,24 @@ namespace Toolbox::UI {
         return result;
     }
 
-    void DebuggerWindow::renderPreview(f32 label_width, const MetaValue &value,
+    void DebuggerWindow::renderPreview(f32 label_width, WatchPreviewCache &cache,
                                        WatchValueBase value_base) {
         ImGuiStyle &style = ImGui::GetStyle();
 
+        const MetaValue &value = cache.m_value;
+
+        auto single_preview = [&]() -> const std::string & {
+            if (!cache.m_preview_valid || cache.m_preview_base != value_base) {
+                cache.m_preview       = calcPreview(value, value_base);
+                cache.m_preview_base  = value_base;
+                cache.m_preview_valid = true;
+            }
+            return cache.m_preview;
+        };
+
         switch (value.type()) {
         default:
-            renderPreviewSingle(label_width, value, value_base);
+            renderPreviewSingle(label_width, value, single_preview());
             break;
         case MetaType::RGB:
             renderPreviewRGB(label_width, value);
@@ -3113,19 +3161,20 @@ namespace Toolbox::UI {
             renderPreviewMatrix34(label_width, value);
             break;
         case MetaType::STRING:
-            renderPreviewSingle(label_width, value, value_base);
+            renderPreviewSingle(label_width, value, single_preview());
             break;
         case MetaType::UNKNOWN:
-            renderPreviewSingle(label_width, value, value_base);
+            renderPreviewSingle(label_width, value, single_preview());
             break;
         }
     }
 
     void DebuggerWindow::renderPreviewSingle(f32 column_width, const MetaValue &value,
-                                             WatchValueBase value_base) {
+                                             const std::string &cached_preview) {
         ImVec2 cursor_pos = ImGui::GetCursorPos();
 
-        std::string preview = calcPreview(value, value_base);
+        // InputText needs a mutable string, even when read only
+        std::string preview = cached_preview;
 
         if (value.computeSize() < 8) {
             ImGui::SetNextItemWidth(200.0f);
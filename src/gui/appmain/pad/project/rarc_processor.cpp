@@ -1,8 +1,7 @@
 #include "gui/appmain/project/rarc_processor.hpp"
 #include "gui/logging/errors.hpp"
 #include "rarc/rarc.hpp"
-
-#include <librii/SZS.hpp>
+#include "szs/yaz0.hpp"
 
 #include <fstream>
 
@@ -96,12 +95,11 @@ namespace Toolbox::UI {
 
                     temp_stream.read((char *)temp_data.data(), temp_size);
 
-                    std::vector<u8> comp_data = librii::szs::encode(temp_data);
-                    if (comp_data.empty()) {
-                        LogError(make_fs_error<void>(std::error_code(),
-                                                     {std::format("COMPILE: {}", librii::szs::getLastError())})
-                                     .error());
+                    auto comp_result = SZS::Yaz0Encode(temp_data, SZS::Yaz0Level::LEVEL_DEFAULT);
+                    if (!comp_result) {
+                        LogError(comp_result.error());
                     } else {
+                        const std::vector<u8> &comp_data = comp_result.value();
                         std::span<const char> span_data((char *)comp_data.data(), comp_data.size());
                         out.writeBytes(span_data);
 
@@ -148,126 +146,45 @@ namespace Toolbox::UI {
     }
 
     void RarcProcessor::processExtractTask() {
-        std::ifstream in_file(m_src_path.string(), std::ios::binary);
-        if (!in_file.is_open()) {
-            LogError(
-                make_fs_error<void>(std::error_code(), {"EXTRACT: Failed to open file for reading"})
-                    .error());
-
-            m_src_path     = "";
-            m_dest_path    = "";
-            m_current_task = TaskType::NONE;
-            return;
-        }
-
-        std::vector<u8> magic_buf(8);
-        in_file.read((char *)magic_buf.data(), magic_buf.size());
-
-        in_file.seekg(0, std::ios::end);
-        size_t in_size = in_file.tellg();
-        in_file.seekg(0, std::ios::beg);
-
-        if (librii::szs::isDataYaz0Compressed(magic_buf)) {
-            std::vector<u8> src_data(in_size);
-            in_file.read((char *)src_data.data(), in_size);
-
-            u32 exp_size = librii::szs::getExpandedSize(magic_buf);
-
-            std::string data_buf;
-            data_buf.resize(exp_size);
-
-            if (!librii::szs::decode(data_buf, src_data)) {
-                LogError(make_fs_error<void>(std::error_code(),
-                                             {"EXTRACT: Failed to decompress file for processing"})
-                             .error());
-
-                m_src_path     = "";
-                m_dest_path    = "";
-                m_current_task = TaskType::NONE;
-                return;
-            }
-
-            std::stringstream str_str(data_buf);
-            Deserializer in(str_str.rdbuf());
-
-            ResourceArchive arc_file = ResourceArchive("_tmp_name");
-            arc_file.deserialize(in)
-                .and_then([this, &arc_file]() {
-                    fs_path dest_folder = m_dest_path;
-
-                    // Special case: Sunshine stage archives all have a root "scene"
-                    // with a unique filename, so extract the archive within a folder
-                    // that matches the original filename.
-                    auto root_it        = arc_file.findNode(0);
-                    if (root_it != arc_file.end()) {
-                        if (root_it->name == "scene") {
-                            dest_folder =
-                                (dest_folder / m_src_path.filename()).replace_extension("");
-                        }
-                    }
-
-                    auto result         = arc_file.extractToPath(dest_folder);
-                    if (!result) {
-                        LogError(result.error());
-                        return Result<void, SerialError>();
-                    }
-
-                    if (m_on_complete_extract) {
-                        const std::string msg = std::format(
-                            "Successfully extracted the archive to '{}'", dest_folder.string());
-                        m_on_complete_extract(msg);
-                        m_on_complete_extract = nullptr;
-                    }
-
-                    return Result<void, SerialError>();
-                })
-                .or_else([&](const SerialError &err) {
-                    LogError(err);
-                    return Result<void, SerialError>();
-                });
-        } else {
-            Deserializer in(in_file.rdbuf());
-
-            ResourceArchive arc_file = ResourceArchive("_tmp_name");
-            arc_file.deserialize(in)
-                .and_then([this, &arc_file]() {
-                    fs_path dest_folder = m_dest_path;
-
-                    // Special case: Sunshine stage archives all have a root "scene"
-                    // with a unique filename, so extract the archive within a folder
-                    // that matches the original filename.
-                    auto root_it = arc_file.findNode(0);
-                    if (root_it != arc_file.end()) {
-                        if (root_it->name == "scene") {
-                            dest_folder =
-                                (dest_folder / m_src_path.filename()).replace_extension("");
-                        }
+        // The archive is mapped rather than read up front, so only the
+        // files being extracted are ever paged in.
+        ResourceArchive::CreateFromArchive(m_src_path)
+            .and_then([this](ResourceArchive &&arc_file) {
+                fs_path dest_folder = m_dest_path;
+
+                // Special case: Sunshine stage archives all have a root "scene"
+                // with a unique filename, so extract the archive within a folder
+                // that matches the original filename.
+                auto root_it = arc_file.findNode(0);
+                if (root_it != arc_file.end()) {
+                    if (root_it->name == "scene") {
+                        dest_folder = (dest_folder / m_src_path.filename()).replace_extension("");
                     }
+                }
 
-                    auto result         = arc_file.extractToPath(dest_folder);
-                    if (!result) {
-                        LogError(result.error());
-                        return Result<void, SerialError>();
-                    }
+                auto result = arc_file.extractToPath(dest_folder);
+                if (!result) {
+                    LogError(result.error());
+                    return Result<void, BaseError>();
+                }
 
-                    if (m_on_complete_extract) {
-                        const std::string msg = std::format(
-                            "Successfully extracted the archive to '{}'", dest_folder.string());
-                        m_on_complete_extract(msg);
-                        m_on_complete_extract = nullptr;
-                    }
+                if (m_on_complete_extract) {
+                    const std::string msg = std::format(
+                        "Successfully extracted the archive to '{}'", dest_folder.string());
+                    m_on_complete_extract(msg);
+                    m_on_complete_extract = nullptr;
+                }
 
-                    return Result<void, SerialError>();
-                })
-                .or_else([&](const SerialError &err) {
-                    LogError(err);
-                    return Result<void, SerialError>();
-                });
-        }
+                return Result<void, BaseError>();
+            })
+            .or_else([](const BaseError &err) {
+                LogError(err);
+                return Result<void, BaseError>();
+            });
 
         m_src_path     = "";
         m_dest_path    = "";
         m_current_task = TaskType::NONE;
     }
 
-}  // namespace Toolbox::UI
\ No newline at end of file
+}  // namespace Toolbox::UI
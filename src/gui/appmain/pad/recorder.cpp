@@ -289,6 +289,12 @@ namespace Toolbox {
     void PadRecorder::stopRecording() {
         m_record_flag.store(false);
 
+        if (m_pad_snapshot_region != 0) {
+            DolphinHookManager::instance().removeSnapshotRegion(m_pad_snapshot_region);
+            m_pad_snapshot_region = 0;
+            m_pad_snapshot_ptr    = 0;
+        }
+
         // std::scoped_lock lock(m_mutex);
 
         applyInputChunk();
@@ -549,10 +555,11 @@ namespace Toolbox {
 
     void PadRecorder::stopPadPlayback() {
         m_play_flag.store(false);
-        m_playback_frame = 0.0f;
-        m_last_frame     = 0;
-        m_current_link   = '*';
-        m_next_link      = '*';
+        m_playback_frame  = 0.0f;
+        m_playback_cursor = {};
+        m_last_frame      = 0;
+        m_current_link    = '*';
+        m_next_link       = '*';
     }
 
     void PadRecorder::clearLink(char from_link, char to_link) {
@@ -593,47 +600,22 @@ namespace Toolbox {
             return {};
         }
 
-        PadFrameData frame_data = {};
-
-        size_t analog_chunk_idx = pad_it->m_data.getPadAnalogMagnitudeIndex(frame);
-        if (analog_chunk_idx != PadData::npos) {
-            const PadInputInfo<float> &analog_chunk =
-                pad_it->m_data.getPadAnalogMagnitudeInput(analog_chunk_idx);
-            frame_data.m_stick_mag = analog_chunk.m_input_state / 32.0f;
-        }
+        return DecodePadFrameInputs(pad_it->m_data.sampleFrame(frame));
+    }
 
-        size_t direction_chunk_idx = pad_it->m_data.getPadAnalogDirectionIndex(frame);
-        if (direction_chunk_idx != PadData::npos) {
-            const PadInputInfo<s16> &direction_chunk =
-                pad_it->m_data.getPadAnalogDirectionInput(direction_chunk_idx);
-            frame_data.m_stick_angle = direction_chunk.m_input_state;
-        }
+    PadRecorder::PadFrameData PadRecorder::DecodePadFrameInputs(const PadFrameInputs &inputs) {
+        PadFrameData frame_data = {};
 
+        frame_data.m_stick_mag   = inputs.m_analog_magnitude / 32.0f;
+        frame_data.m_stick_angle = inputs.m_analog_direction;
         frame_data.m_stick_x =
             std::cos(convertAngleS16ToRadians(frame_data.m_stick_angle)) * frame_data.m_stick_mag;
         frame_data.m_stick_y =
             std::sin(convertAngleS16ToRadians(frame_data.m_stick_angle)) * frame_data.m_stick_mag;
 
-        size_t button_chunk_idx = pad_it->m_data.getPadButtonIndex(frame);
-        if (button_chunk_idx != PadData::npos) {
-            const PadInputInfo<PadButtons> &button_chunk =
-                pad_it->m_data.getPadButtonInput(button_chunk_idx);
-            frame_data.m_held_buttons = button_chunk.m_input_state;
-        }
-
-        size_t trigger_l_chunk_idx = pad_it->m_data.getPadTriggerLIndex(frame);
-        if (trigger_l_chunk_idx != PadData::npos) {
-            const PadInputInfo<u8> &trigger_l_chunk =
-                pad_it->m_data.getPadTriggerLInput(trigger_l_chunk_idx);
-            frame_data.m_trigger_l = trigger_l_chunk.m_input_state;
-        }
-
-        size_t trigger_r_chunk_idx = pad_it->m_data.getPadTriggerRIndex(frame);
-        if (trigger_r_chunk_idx != PadData::npos) {
-            const PadInputInfo<u8> &trigger_r_chunk =
-                pad_it->m_data.getPadTriggerRInput(trigger_r_chunk_idx);
-            frame_data.m_trigger_r = trigger_r_chunk.m_input_state;
-        }
+        frame_data.m_held_buttons = inputs.m_buttons;
+        frame_data.m_trigger_l    = inputs.m_trigger_l;
+        frame_data.m_trigger_r    = inputs.m_trigger_r;
 
         frame_data.m_c_stick_x     = 0.0f;
         frame_data.m_c_stick_y     = 0.0f;
@@ -670,15 +652,27 @@ namespace Toolbox {
 
         DolphinCommunicator &communicator = MainApplication::instance().getDolphinCommunicator();
 
+        auto pad_it =
+            std::find_if(m_pad_datas.begin(), m_pad_datas.end(), [&](const PadDataLinkInfo &info) {
+                return info.m_from_link == m_current_link && info.m_to_link == m_next_link;
+            });
+
+        u32 frame_count = 0;
+        if (pad_it == m_pad_datas.end() || !pad_it->m_data.calcFrameCount(frame_count)) {
+            stopPadPlayback();
+            return;
+        }
+
         m_playback_frame += 4 * delta_time * 30.0f;
-        if (m_playback_frame >= getPadFrameCount(m_current_link, m_next_link)) {
+        if (m_playback_frame >= frame_count) {
             stopPadPlayback();
             return;
         }
 
-        PadFrameData frame_data =
-            getPadFrameData(m_current_link, m_next_link, static_cast<u32>(m_playback_frame));
-        m_playback_frame_cb(frame_data);
+        // Playback only moves forward, so the cursor steps from the last
+        // frame's chunks rather than searching the recording every frame.
+        m_playback_cursor.seek(pad_it->m_data, static_cast<u32>(m_playback_frame));
+        m_playback_frame_cb(DecodePadFrameInputs(m_playback_cursor.inputs(pad_it->m_data)));
     }
 
     void PadRecorder::recordPadData() {
@@ -936,7 +930,47 @@ namespace Toolbox {
         u32 application_ptr = 0x803E9700;
         u32 gamepad_ptr = communicator.read<u32>(application_ptr + 0x20 + (m_port << 2)).value();
 
-        bool is_connected = communicator.read<u8>(gamepad_ptr + 0x7A).value() != 0xFF;
+        // Gather the whole controller state with a single hook validation.
+        u8 connection_state = 0xFF;
+        u32 held_buttons    = 0;
+        u32 pressed_buttons = 0;
+
+        PadFrameData frame_data{};
+        MemoryReadBatch pad_batch;
+        pad_batch.read(gamepad_ptr + 0x7A, connection_state)
+            .read(gamepad_ptr + 0x18, held_buttons)
+            .read(gamepad_ptr + 0x1C, pressed_buttons)
+            .read(gamepad_ptr + 0x26, frame_data.m_trigger_l)
+            .read(gamepad_ptr + 0x27, frame_data.m_trigger_r)
+            .read(gamepad_ptr + 0x48, frame_data.m_stick_x)
+            .read(gamepad_ptr + 0x4C, frame_data.m_stick_y)
+            .read(gamepad_ptr + 0x50, frame_data.m_stick_mag)
+            .read(gamepad_ptr + 0x54, frame_data.m_stick_angle)
+            .read(gamepad_ptr + 0x58, frame_data.m_c_stick_x)
+            .read(gamepad_ptr + 0x5C, frame_data.m_c_stick_y)
+            .read(gamepad_ptr + 0x60, frame_data.m_c_stick_mag)
+            .read(gamepad_ptr + 0x64, frame_data.m_c_stick_angle);
+
+        // Read from the frame snapshot when it has the controller, so the
+        // buttons and sticks always come from the same game frame.
+        DolphinHookManager &manager = communicator.manager();
+        if (m_pad_snapshot_region == 0 || m_pad_snapshot_ptr != gamepad_ptr) {
+            if (m_pad_snapshot_region != 0) {
+                manager.removeSnapshotRegion(m_pad_snapshot_region);
+            }
+            m_pad_snapshot_region = manager.addSnapshotRegion(gamepad_ptr + 0x18, 0x63);
+            m_pad_snapshot_ptr    = gamepad_ptr;
+        }
+        manager.updateSnapshot();
+
+        MemorySnapshot snapshot = manager.acquireSnapshot();
+        auto batch_result = snapshot.contains(gamepad_ptr + 0x18, 0x63) ? pad_batch.submit(snapshot)
+                                                                        : pad_batch.submit();
+        if (!batch_result) {
+            return std::unexpected(batch_result.error());
+        }
+
+        bool is_connected = connection_state != 0xFF;
         if (!is_connected) {
             TOOLBOX_ERROR("[PAD RECORD] Controller is not connected. Please ensure that "
                           "the controller is "
@@ -947,35 +981,18 @@ namespace Toolbox {
                                             "connected and the input is being read by Dolphin.");
         }
 
-        PadFrameData frame_data{};
-        {
-            frame_data.m_held_buttons =
-                static_cast<PadButtons>(communicator.read<u32>(gamepad_ptr + 0x18).value());
-            frame_data.m_pressed_buttons =
-                static_cast<PadButtons>(communicator.read<u32>(gamepad_ptr + 0x1C).value());
-
-            frame_data.m_trigger_l = communicator.read<u8>(gamepad_ptr + 0x26).value();
-            frame_data.m_trigger_r = communicator.read<u8>(gamepad_ptr + 0x27).value();
-
-            frame_data.m_stick_x = communicator.read<f32>(gamepad_ptr + 0x48).value();
-            frame_data.m_stick_y = communicator.read<f32>(gamepad_ptr + 0x4C).value();
-
-            frame_data.m_stick_mag   = communicator.read<f32>(gamepad_ptr + 0x50).value();
-            frame_data.m_stick_angle = communicator.read<s16>(gamepad_ptr + 0x54).value();
+        frame_data.m_held_buttons    = static_cast<PadButtons>(held_buttons);
+        frame_data.m_pressed_buttons = static_cast<PadButtons>(pressed_buttons);
 
-            frame_data.m_c_stick_x = communicator.read<f32>(gamepad_ptr + 0x58).value();
-            frame_data.m_c_stick_y = communicator.read<f32>(gamepad_ptr + 0x5C).value();
-
-            frame_data.m_c_stick_mag   = communicator.read<f32>(gamepad_ptr + 0x60).value();
-            frame_data.m_c_stick_angle = communicator.read<s16>(gamepad_ptr + 0x64).value();
-
-            frame_data.m_rumble_x = 0.0f;
-            frame_data.m_rumble_y = 0.0f;
-            u32 rumble_ptr        = communicator.read<u32>(0x804141C0 - 0x60F0).value();
-            if (rumble_ptr) {
-                u32 data_ptr = communicator.read<u32>(rumble_ptr + 0xC + (m_port << 2)).value();
-                frame_data.m_rumble_x = communicator.read<f32>(data_ptr + 0x0).value();
-                frame_data.m_rumble_y = communicator.read<f32>(data_ptr + 0x4).value();
+        frame_data.m_rumble_x = 0.0f;
+        frame_data.m_rumble_y = 0.0f;
+        u32 rumble_ptr        = communicator.read<u32>(0x804141C0 - 0x60F0).value();
+        if (rumble_ptr) {
+            u32 data_ptr = communicator.read<u32>(rumble_ptr + 0xC + (m_port << 2)).value();
+            f32 rumble[2] = {};
+            if (communicator.readArray<f32>(data_ptr, rumble, 2)) {
+                frame_data.m_rumble_x = rumble[0];
+                frame_data.m_rumble_y = rumble[1];
             }
         }
         return frame_data;
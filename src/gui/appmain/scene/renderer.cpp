@@ -25,11 +25,11 @@ using namespace Toolbox::Scene;
 static std::set<std::string> s_skybox_materials = {"_00_spline", "_01_nyudougumo", "_02_usugumo",
                                                    "_03_sky"};
 
-static const std::unordered_set<std::string> s_selection_blacklist = {
-    "Map",
-    "MapObjWave",
-    "Shimmer",
-    "Sky",
+static const std::unordered_set<Toolbox::Object::SymbolID> s_selection_blacklist = {
+    Toolbox::Object::InternSymbol("Map"),
+    Toolbox::Object::InternSymbol("MapObjWave"),
+    Toolbox::Object::InternSymbol("Shimmer"),
+    Toolbox::Object::InternSymbol("Sky"),
 };
 
 struct OrthonormalBasis {
@@ -463,9 +463,11 @@ namespace Toolbox::UI {
                 glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
             }
 
+            static const SymbolID s_sky_id = InternSymbol("Sky");
+
             auto sky_it = std::find_if(renderables.begin(), renderables.end(),
                                        [](const ISceneObject::RenderInfo &info) {
-                                           return info.m_object->type() == "Sky";
+                                           return info.m_object->typeID() == s_sky_id;
                                        });
             if (sky_it != renderables.end()) {
                 sky_it->m_model->SetTranslation(position);
@@ -478,7 +480,7 @@ namespace Toolbox::UI {
 
             for (auto &renderable : renderables) {
                 models.emplace_back(renderable.m_model);
-                if (!s_selection_blacklist.contains(renderable.m_object->type())) {
+                if (!s_selection_blacklist.contains(renderable.m_object->typeID())) {
                     pick_models.emplace_back(renderable.m_model);
                 }
             }
@@ -843,14 +845,14 @@ namespace Toolbox::UI {
     RefPtr<ISceneObject>
     Renderer::findObjectByJ3DPicking(std::vector<ISceneObject::RenderInfo> renderables,
                                      int selection_x, int selection_y, float &intersection_z,
-                                     const std::unordered_set<std::string> &exclude_set) {
+                                     const std::unordered_set<SymbolID> &exclude_set) {
         TOOLBOX_DEBUG_LOG_V("Selection pt (x: {}, y: {})", selection_x, selection_y);
 
         J3D::Picking::ModelMaterialIdPair query_pair =
             J3D::Picking::Query(selection_x / 4.0f, (m_render_size.y - selection_y) / 4.0f);
 
         for (const ISceneObject::RenderInfo &info : renderables) {
-            if (exclude_set.contains(info.m_object->type())) {
+            if (exclude_set.contains(info.m_object->typeID())) {
                 continue;
             }
             if (info.m_model->GetModelId() == std::get<0>(query_pair)) {
@@ -868,7 +870,7 @@ namespace Toolbox::UI {
     RefPtr<ISceneObject>
     Renderer::findObjectByOBBIntersection(std::vector<ISceneObject::RenderInfo> renderables,
                                           int selection_x, int selection_y, float &intersection_z,
-                                          const std::unordered_set<std::string> &exclude_set) {
+                                          const std::unordered_set<SymbolID> &exclude_set) {
         float nearest_intersection = std::numeric_limits<float>::max();
 
         // Generate ray from mouse position
@@ -881,7 +883,7 @@ namespace Toolbox::UI {
         RefPtr<ISceneObject> selected_obj = nullptr;
 
         for (auto &renderable : renderables) {
-            if (exclude_set.contains(renderable.m_object->type())) {
+            if (exclude_set.contains(renderable.m_object->typeID())) {
                 continue;
             }
 
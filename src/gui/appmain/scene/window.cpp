@@ -252,7 +252,8 @@ private:
 
 namespace Toolbox::UI {
 
-    static std::unordered_set<std::string> s_game_blacklist = {"Map", "Sky"};
+    static const std::unordered_set<SymbolID> s_game_blacklist = {InternSymbol("Map"),
+                                                                  InternSymbol("Sky")};
 
     static std::string getNodeUID(RefPtr<Toolbox::Object::ISceneObject> node) {
         std::string node_name =
@@ -317,13 +318,14 @@ namespace Toolbox::UI {
                 return false;
             }
 
+            // Taken before the old lease goes, so a reload keeps the models
+            // this scene already parsed
+            m_resource_cache = getResourceCache().lease();
+
             SceneInstance::FromPath(path, include_custom_objs)
                 .and_then([&](ScopePtr<SceneInstance> &&scene) {
                     m_current_scene = std::move(scene);
 
-                    m_resource_cache.m_model.clear();
-                    m_resource_cache.m_material.clear();
-
                     if (task_communicator.isSceneLoaded(m_stage, m_scenario)) {
                         reassignAllActorPtrs(0);
                     } else if (task_communicator.isSceneLoaded()) {
@@ -464,7 +466,7 @@ namespace Toolbox::UI {
         m_properties_render_handler = renderEmptyProperties;
 
         m_renderables.clear();
-        m_resource_cache = {};
+        m_resource_cache.release();
 
         m_rail_visible_map.clear();
 
@@ -483,6 +485,7 @@ namespace Toolbox::UI {
             m_history_aggregate_handler->endExplicitFrame();
         }
 
+        updateUndoMemoryBudget();
         calcDolphinVPMatrix();
 
         Game::TaskCommunicator &task_communicator =
@@ -728,7 +731,7 @@ namespace Toolbox::UI {
 
         if (m_is_game_edit_mode) {
             for (auto &renderable : m_renderables) {
-                if (s_game_blacklist.contains(renderable.m_object->type())) {
+                if (s_game_blacklist.contains(renderable.m_object->typeID())) {
                     continue;
                 }
                 task_communicator.setObjectTransform(
@@ -2303,7 +2306,7 @@ namespace Toolbox::UI {
                     RefPtr<ISceneObject> root_obj = m_scene_object_model->getObjectRef(root_index);
                     auto perform_result =
                         root_obj->performScene(delta_time, !settings.m_is_rendering_simple,
-                                               m_renderables, m_resource_cache, lights);
+                                               m_renderables, *m_resource_cache, lights);
                     if (!perform_result) {
                         const ObjectError &error = perform_result.error();
                         LogError(error);
@@ -2518,9 +2521,7 @@ namespace Toolbox::UI {
                 Game::TaskCommunicator &task_communicator =
                     MainApplication::instance().getTaskCommunicator();
 
-                m_dolphin_image = std::move(task_communicator.captureXFBAsTexture(
-                    static_cast<int>(ImGui::GetWindowWidth()),
-                    static_cast<int>(ImGui::GetWindowHeight())));
+                task_communicator.updateXFBTexture(m_dolphin_image);
                 if (!m_dolphin_image) {
                     ImGui::Text(
                         "Start a Dolphin process running\nSuper Mario Sunshine to get started");
@@ -4495,6 +4496,9 @@ namespace Toolbox::UI {
         m_history_aggregate_handler =
             make_referable<ModelHistoryAggregate>(std::move(history_handlers));
 
+        m_undo_memory_budget = -1;
+        updateUndoMemoryBudget();
+
         // Initialize the rail visibility map
         const int64_t rail_count = m_rail_model->getRowCount(ModelIndex());
         for (int64_t i = 0; i < rail_count; ++i) {
@@ -4514,6 +4518,19 @@ namespace Toolbox::UI {
         m_renderer.initializeData(m_rail_model);
     }
 
+    void SceneWindow::updateUndoMemoryBudget() {
+        const AppSettings &settings =
+            MainApplication::instance().getSettingsManager().getCurrentProfile();
+        if (settings.m_undo_memory_budget == m_undo_memory_budget) {
+            return;
+        }
+
+        m_undo_memory_budget = settings.m_undo_memory_budget;
+
+        const size_t budget_bytes = static_cast<size_t>(m_undo_memory_budget) << 20;
+        m_history_aggregate_handler->setMemoryBudget(budget_bytes);
+    }
+
     ImGuiID SceneWindow::onBuildDockspace() {
         ImGuiID dockspace_id = ImGui::GetID(std::to_string(getUUID()).c_str());
         ImGui::DockBuilderAddNode(dockspace_id);
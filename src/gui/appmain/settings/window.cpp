@@ -396,6 +396,12 @@ namespace Toolbox::UI {
         if (ImGui::BeginGroupPanel("Game Scene", nullptr, {})) {
             ImGui::Checkbox("Repack Scenes on Save", &settings.m_repack_scenes_on_save);
             ImGui::Checkbox("Cache Object Templates", &settings.m_is_template_cache_allowed);
+
+            s64 budget_min = AppSettings::UndoMemoryBudgetMin;
+            s64 budget_max = AppSettings::UndoMemoryBudgetMax;
+            ImGui::SliderScalar("Undo Memory Budget (MiB)", ImGuiDataType_S64,
+                                &settings.m_undo_memory_budget, &budget_min, &budget_max, nullptr,
+                                ImGuiSliderFlags_AlwaysClamp);
         }
         ImGui::EndGroupPanel();
 
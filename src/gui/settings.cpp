@@ -4,6 +4,7 @@
 #include "gui/logging/errors.hpp"
 #include "jsonlib.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 #include <imgui.h>
@@ -114,6 +115,9 @@ namespace Toolbox {
                 settings.m_repack_scenes_on_save = JSONValueOr(j, "Repack Scenes on Save", true);
                 settings.m_is_template_cache_allowed =
                     JSONValueOr(j, "Cache Object Templates", true);
+                settings.m_undo_memory_budget =
+                    std::clamp(JSONValueOr(j, "Undo Memory Budget", s64(256)),
+                               AppSettings::UndoMemoryBudgetMin, AppSettings::UndoMemoryBudgetMax);
 
                 settings.m_log_to_cout_cerr = JSONValueOr(j, "Log To Terminal", false);
             });
@@ -249,6 +253,7 @@ namespace Toolbox {
 
             j["Repack Scenes on Save"]  = profile.m_repack_scenes_on_save;
             j["Cache Object Templates"] = profile.m_is_template_cache_allowed;
+            j["Undo Memory Budget"]     = profile.m_undo_memory_budget;
 
             j["Log To Terminal"] = profile.m_log_to_cout_cerr;
         });
@@ -69,6 +69,37 @@ namespace Toolbox {
         loadGL(data, channels, dx, dy);
     }
 
+    void ImageHandle::update(std::span<const u8> data, int channels, int dx, int dy) {
+        GLint format;
+        switch (channels) {
+        case 1:
+            format = GL_RED;
+            break;
+        case 3:
+        default:
+            format = GL_RGB;
+            break;
+        case 4:
+            format = GL_RGBA;
+            break;
+        }
+
+        if (!isValid() || m_image_width != dx || m_image_height != dy ||
+            m_image_format != static_cast<u32>(format)) {
+            unloadGL();
+
+            Buffer data_buf;
+            data_buf.setBuf(data.data(), data.size());
+            loadGL(data_buf, channels, dx, dy);
+            return;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, (GLuint)m_image_handle);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, dx, dy, format, GL_UNSIGNED_BYTE, data.data());
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
     bool ImageHandle::isValid() const noexcept {
         return m_image_handle != std::numeric_limits<u64>::max();
     }
@@ -55,7 +55,9 @@ namespace Toolbox {
         m_model->removeEventListener(getUUID());
     }
 
-    int64_t ModelHistoryHandler::getCurrentFrame() const { return m_history_frame; }
+    int64_t ModelHistoryHandler::getCurrentFrame() const {
+        return m_history_frame + m_evicted_frames;
+    }
 
     void ModelHistoryHandler::handleInputs() {
         if (m_keybind_used) {
@@ -88,6 +90,7 @@ namespace Toolbox {
         for (auto action_it = frame.m_actions.rbegin(); action_it != frame.m_actions.rend();
              ++action_it) {
             const HistoryAction &action = *action_it;
+            ScopePtr<MimeData> undo_data = m_chunk_store.restore(action.m_undo_data);
 
             // We can only undo/redo index modifications, not insertions or resets.
             if ((action.m_action_flags & EVENT_INDEX_MODIFIED) == EVENT_INDEX_MODIFIED) {
@@ -126,7 +129,7 @@ namespace Toolbox {
 
                 const int64_t sibling_count = m_model->getRowCount(action.m_parent);
                 if (sibling_count == 0) {
-                    auto result = m_model->insertMimeData(action.m_parent, *action.m_undo_data,
+                    auto result = m_model->insertMimeData(action.m_parent, *undo_data,
                                                           ModelInsertPolicy::INSERT_CHILD);
                     if (!result) {
                         TOOLBOX_ERROR_V("Failed to insert mime data during undo/redo: {}",
@@ -150,7 +153,7 @@ namespace Toolbox {
                         m_model->getIndex(sibling_row, action.m_column, action.m_parent);
 
                     auto result =
-                        m_model->insertMimeData(sibling_index, *action.m_undo_data, policy);
+                        m_model->insertMimeData(sibling_index, *undo_data, policy);
                     if (!result) {
                         TOOLBOX_ERROR_V("Failed to insert mime data during undo/redo: {}",
                                         result.error().m_message[0]);
@@ -178,7 +181,7 @@ namespace Toolbox {
             if ((action.m_action_flags & EVENT_INDEX_REMOVED) == EVENT_INDEX_REMOVED) {
                 const int64_t sibling_count = m_model->getRowCount(action.m_parent);
                 if (sibling_count == 0) {
-                    auto result = m_model->insertMimeData(action.m_parent, *action.m_undo_data,
+                    auto result = m_model->insertMimeData(action.m_parent, *undo_data,
                                                           ModelInsertPolicy::INSERT_CHILD);
                     if (!result) {
                         TOOLBOX_ERROR_V("Failed to insert mime data during undo/redo: {}",
@@ -202,7 +205,7 @@ namespace Toolbox {
                         m_model->getIndex(sibling_row, action.m_column, action.m_parent);
 
                     auto result =
-                        m_model->insertMimeData(sibling_index, *action.m_undo_data, policy);
+                        m_model->insertMimeData(sibling_index, *undo_data, policy);
                     if (!result) {
                         TOOLBOX_ERROR_V("Failed to insert mime data during undo/redo: {}",
                                         result.error().m_message[0]);
@@ -232,6 +235,7 @@ namespace Toolbox {
         for (auto action_it = frame.m_actions.begin(); action_it != frame.m_actions.end();
              ++action_it) {
             const HistoryAction &action = *action_it;
+            ScopePtr<MimeData> redo_data = m_chunk_store.restore(action.m_redo_data);
 
             // We can only undo/redo index modifications, not insertions or resets.
             if ((action.m_action_flags & EVENT_INDEX_MODIFIED) == EVENT_INDEX_MODIFIED) {
@@ -245,7 +249,7 @@ namespace Toolbox {
 
                 const int64_t sibling_count = m_model->getRowCount(action.m_parent);
                 if (sibling_count == 0) {
-                    auto result = m_model->insertMimeData(action.m_parent, *action.m_redo_data,
+                    auto result = m_model->insertMimeData(action.m_parent, *redo_data,
                                                           ModelInsertPolicy::INSERT_CHILD);
                     if (!result) {
                         TOOLBOX_ERROR_V("Failed to insert mime data during undo/redo: {}",
@@ -269,7 +273,7 @@ namespace Toolbox {
                         m_model->getIndex(sibling_row, action.m_column, action.m_parent);
 
                     auto result =
-                        m_model->insertMimeData(sibling_index, *action.m_redo_data, policy);
+                        m_model->insertMimeData(sibling_index, *redo_data, policy);
                     if (!result) {
                         TOOLBOX_ERROR_V("Failed to insert mime data during undo/redo: {}",
                                         result.error().m_message[0]);
@@ -282,7 +286,7 @@ namespace Toolbox {
             if ((action.m_action_flags & EVENT_INDEX_ADDED) == EVENT_INDEX_ADDED) {
                 const int64_t sibling_count = m_model->getRowCount(action.m_parent);
                 if (sibling_count == 0) {
-                    auto result = m_model->insertMimeData(action.m_parent, *action.m_redo_data,
+                    auto result = m_model->insertMimeData(action.m_parent, *redo_data,
                                                           ModelInsertPolicy::INSERT_CHILD);
                     if (!result) {
                         TOOLBOX_ERROR_V("Failed to insert mime data during undo/redo: {}",
@@ -306,7 +310,7 @@ namespace Toolbox {
                         m_model->getIndex(sibling_row, action.m_column, action.m_parent);
 
                     auto result =
-                        m_model->insertMimeData(sibling_index, *action.m_redo_data, policy);
+                        m_model->insertMimeData(sibling_index, *redo_data, policy);
                     if (!result) {
                         TOOLBOX_ERROR_V("Failed to insert mime data during undo/redo: {}",
                                         result.error().m_message[0]);
@@ -344,7 +348,8 @@ namespace Toolbox {
 
     void ModelHistoryHandler::resetHistory() {
         m_history.clear();
-        m_history_frame = -1;
+        m_history_frame  = -1;
+        m_evicted_frames = 0;
 
         m_keybind_used            = false;
         m_is_performing_undo_redo = false;
@@ -356,6 +361,52 @@ namespace Toolbox {
         m_explicit_finalized  = false;
     }
 
+    void ModelHistoryHandler::setMemoryBudget(size_t bytes) {
+        m_memory_budget = bytes;
+        enforceMemoryBudget();
+    }
+
+    size_t ModelHistoryHandler::getMemoryUsage() const {
+        size_t usage = m_chunk_store.storedBytes();
+        for (const HistoryFrame &frame : m_history) {
+            usage += frame.m_footprint;
+        }
+        return usage;
+    }
+
+    void ModelHistoryHandler::enforceMemoryBudget() {
+        size_t usage = getMemoryUsage();
+        if (usage <= m_memory_budget) {
+            return;
+        }
+
+        // The frame at the undo cursor and any redo frames are kept, as they
+        // are what the next undo or redo acts on
+        int64_t evict_count = 0;
+        while (usage > m_memory_budget && evict_count < m_history_frame) {
+            // Chunks shared with later frames stay alive, so the store is
+            // measured again rather than predicted
+            HistoryFrame &frame = m_history[evict_count];
+            usage -= frame.m_footprint;
+            usage -= m_chunk_store.storedBytes();
+            frame.m_actions.clear();
+            frame.m_footprint = 0;
+            usage += m_chunk_store.storedBytes();
+            evict_count += 1;
+        }
+
+        if (evict_count == 0) {
+            return;
+        }
+
+        m_history.erase(m_history.begin(), m_history.begin() + evict_count);
+        m_history_frame -= evict_count;
+        m_evicted_frames += evict_count;
+
+        TOOLBOX_DEBUG_LOG_V("[MODEL_HISTORY] Discarded {} frames to fit the memory budget",
+                            evict_count);
+    }
+
     TimePoint ModelHistoryHandler::getUndoFrameTimepoint() const {
         if (m_history_frame >= 0 && m_history_frame < m_history.size()) {
             return m_history[m_history_frame].m_timestamp;
@@ -414,6 +465,11 @@ namespace Toolbox {
             }
         }
 
+        frame.m_footprint = 0;
+        for (const HistoryAction &action : frame.m_actions) {
+            frame.m_footprint += action.m_undo_data.footprint() + action.m_redo_data.footprint();
+        }
+
         frame.m_collapsed = true;
         return true;
     }
@@ -495,7 +551,9 @@ namespace Toolbox {
             m_current_action.m_parent = m_model->getParent(index);
 
             if ((flags & EVENT_INDEX_ADDED) == EVENT_NONE) {
-                m_current_action.m_undo_data = m_model->createMimeData({index});
+                if (ScopePtr<MimeData> data = m_model->createMimeData({index})) {
+                    m_current_action.m_undo_data = m_chunk_store.store(*data);
+                }
             }
 
             if (m_trim_cb) {
@@ -591,12 +649,20 @@ namespace Toolbox {
             }
 
             if ((flags & EVENT_INDEX_REMOVED) == EVENT_NONE) {
-                m_current_action.m_redo_data = m_model->createMimeData({index});
+                if (ScopePtr<MimeData> data = m_model->createMimeData({index})) {
+                    m_current_action.m_redo_data =
+                        m_chunk_store.store(*data, m_current_action.m_undo_data);
+                }
             }
 
-            m_history.back().m_actions.push_back(std::move(m_current_action));
+            HistoryFrame &frame = m_history.back();
+            frame.m_footprint += m_current_action.m_undo_data.footprint() +
+                                 m_current_action.m_redo_data.footprint();
+            frame.m_actions.push_back(std::move(m_current_action));
 
             m_current_action = {};
+
+            enforceMemoryBudget();
         }
     }
 
@@ -822,6 +888,25 @@ namespace Toolbox {
         m_frame_timepoint = TimePoint::min();
     }
 
+    void ModelHistoryAggregate::setMemoryBudget(size_t bytes) {
+        if (m_handlers.empty()) {
+            return;
+        }
+
+        const size_t share = bytes / m_handlers.size();
+        for (ScopePtr<ModelHistoryHandler> &handler : m_handlers) {
+            handler->setMemoryBudget(share);
+        }
+    }
+
+    size_t ModelHistoryAggregate::getMemoryUsage() const {
+        size_t usage = 0;
+        for (const ScopePtr<ModelHistoryHandler> &handler : m_handlers) {
+            usage += handler->getMemoryUsage();
+        }
+        return usage;
+    }
+
     TimePoint ModelHistoryAggregate::getUndoFrameTimepoint() const {
         TimePoint most_recent_timepoint = TimePoint::min();
         for (const ScopePtr<ModelHistoryHandler> &handler : m_handlers) {
@@ -0,0 +1,242 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "core/assert.hpp"
+#include "model/historystore.hpp"
+
+namespace Toolbox {
+
+    // Rough cost of a chunk beyond its bytes: the control block, the vector
+    // and the store's index node.
+    static constexpr size_t ChunkOverhead =
+        sizeof(HistoryChunkStore::Chunk) + sizeof(std::weak_ptr<const HistoryChunkStore::Chunk>) +
+        64;
+
+    static u64 HashBytes(std::span<const u8> bytes) {
+        u64 hash = 0xCBF29CE484222325;
+        for (u8 b : bytes) {
+            hash ^= b;
+            hash *= 0x100000001B3;
+        }
+        return hash;
+    }
+
+    static constexpr std::array<u64, 256> MakeGearTable() {
+        std::array<u64, 256> table = {};
+        u64 state                  = 0;
+        for (u64 &entry : table) {
+            state += 0x9E3779B97F4A7C15;
+            u64 z = state;
+            z     = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+            z     = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+            entry = z ^ (z >> 31);
+        }
+        return table;
+    }
+
+    static constexpr std::array<u64, 256> s_gear_table = MakeGearTable();
+
+    // The top bits of the gear hash cover the last 64 bytes, so a boundary
+    // only depends on the bytes just before it. Ten bits average 1 KiB.
+    static constexpr u64 ChunkBoundaryMask = u64(0x3FF) << 54;
+
+    static size_t NextChunkSize(std::span<const u8> bytes) {
+        if (bytes.size() <= HistoryChunkStore::MinChunkSize) {
+            return bytes.size();
+        }
+
+        const size_t limit = std::min(bytes.size(), HistoryChunkStore::MaxChunkSize);
+
+        u64 hash = 0;
+        for (size_t i = HistoryChunkStore::MinChunkSize; i < limit; ++i) {
+            hash = (hash << 1) + s_gear_table[bytes[i]];
+            if ((hash & ChunkBoundaryMask) == 0) {
+                return i + 1;
+            }
+        }
+        return limit;
+    }
+
+    // Copies `size` bytes, starting `offset` bytes into the chunks, to `out`.
+    static u8 *CopyChunkBytes(const std::vector<HistoryChunkStore::ChunkRef> &chunks,
+                              size_t offset, size_t size, u8 *out) {
+        for (const HistoryChunkStore::ChunkRef &chunk : chunks) {
+            if (size == 0) {
+                break;
+            }
+
+            const size_t chunk_size = chunk->m_bytes.size();
+            if (offset >= chunk_size) {
+                offset -= chunk_size;
+                continue;
+            }
+
+            const size_t count = std::min(chunk_size - offset, size);
+            std::memcpy(out, chunk->m_bytes.data() + offset, count);
+            out += count;
+            size -= count;
+            offset = 0;
+        }
+        return out;
+    }
+
+    size_t HistoryChunkStore::Snapshot::footprint() const {
+        size_t size = m_formats.capacity() * sizeof(Format);
+        for (const Format &format : m_formats) {
+            size += format.m_name.capacity() + format.m_chunks.capacity() * sizeof(ChunkRef) +
+                    format.m_delta.capacity();
+        }
+        return size;
+    }
+
+    HistoryChunkStore::~HistoryChunkStore() {
+        TOOLBOX_CORE_ASSERT(m_chunks.empty());
+    }
+
+    HistoryChunkStore::Snapshot HistoryChunkStore::store(const MimeData &data) {
+        Snapshot snapshot;
+        for (const std::string &name : data.get_all_formats()) {
+            std::optional<Buffer> buffer = data.get_data(name);
+            if (!buffer) {
+                continue;
+            }
+
+            Snapshot::Format format;
+            format.m_name = name;
+            format.m_size = buffer->size();
+            storeChunks(format, {buffer->buf<u8>(), format.m_size});
+
+            snapshot.m_formats.emplace_back(std::move(format));
+        }
+        return snapshot;
+    }
+
+    HistoryChunkStore::Snapshot HistoryChunkStore::store(const MimeData &data,
+                                                         const Snapshot &base) {
+        Snapshot snapshot;
+        for (const std::string &name : data.get_all_formats()) {
+            std::optional<Buffer> buffer = data.get_data(name);
+            if (!buffer) {
+                continue;
+            }
+
+            Snapshot::Format format;
+            format.m_name = name;
+            format.m_size = buffer->size();
+
+            std::span<const u8> bytes = {buffer->buf<u8>(), format.m_size};
+
+            auto base_it = std::ranges::find_if(base.m_formats, [&](const Snapshot::Format &f) {
+                return f.m_name == name && !f.m_is_delta;
+            });
+            if (base_it == base.m_formats.end()) {
+                storeChunks(format, bytes);
+                snapshot.m_formats.emplace_back(std::move(format));
+                continue;
+            }
+
+            std::vector<u8> base_bytes(base_it->m_size);
+            CopyChunkBytes(base_it->m_chunks, 0, base_bytes.size(), base_bytes.data());
+
+            // Everything between the common prefix and suffix changed
+            const size_t common = std::min(bytes.size(), base_bytes.size());
+            size_t prefix       = 0;
+            while (prefix < common && bytes[prefix] == base_bytes[prefix]) {
+                prefix += 1;
+            }
+            size_t suffix = 0;
+            while (suffix < common - prefix &&
+                   bytes[bytes.size() - suffix - 1] == base_bytes[base_bytes.size() - suffix - 1]) {
+                suffix += 1;
+            }
+
+            const size_t changed = bytes.size() - prefix - suffix;
+            if (changed * 2 > bytes.size()) {
+                storeChunks(format, bytes);
+                snapshot.m_formats.emplace_back(std::move(format));
+                continue;
+            }
+
+            format.m_chunks         = base_it->m_chunks;
+            format.m_is_delta       = true;
+            format.m_delta_offset   = prefix;
+            format.m_delta_replaced = base_bytes.size() - prefix - suffix;
+            format.m_delta.assign(bytes.begin() + prefix, bytes.begin() + prefix + changed);
+
+            snapshot.m_formats.emplace_back(std::move(format));
+        }
+        return snapshot;
+    }
+
+    ScopePtr<MimeData> HistoryChunkStore::restore(const Snapshot &snapshot) const {
+        ScopePtr<MimeData> data = make_scoped<MimeData>();
+        for (const Snapshot::Format &format : snapshot.m_formats) {
+            Buffer buffer;
+            if (format.m_size > 0) {
+                if (!buffer.alloc(static_cast<u32>(format.m_size))) {
+                    continue;
+                }
+
+                u8 *out = buffer.buf<u8>();
+                if (!format.m_is_delta) {
+                    CopyChunkBytes(format.m_chunks, 0, format.m_size, out);
+                } else {
+                    const size_t suffix =
+                        format.m_size - format.m_delta_offset - format.m_delta.size();
+                    out = CopyChunkBytes(format.m_chunks, 0, format.m_delta_offset, out);
+                    std::memcpy(out, format.m_delta.data(), format.m_delta.size());
+                    out += format.m_delta.size();
+                    CopyChunkBytes(format.m_chunks,
+                                   format.m_delta_offset + format.m_delta_replaced, suffix, out);
+                }
+            }
+            data->set_data(format.m_name, std::move(buffer));
+        }
+        return data;
+    }
+
+    void HistoryChunkStore::storeChunks(Snapshot::Format &format, std::span<const u8> bytes) {
+        size_t offset = 0;
+        while (offset < bytes.size()) {
+            const size_t size = NextChunkSize(bytes.subspan(offset));
+            format.m_chunks.emplace_back(acquire(bytes.subspan(offset, size)));
+            offset += size;
+        }
+    }
+
+    HistoryChunkStore::ChunkRef HistoryChunkStore::acquire(std::span<const u8> bytes) {
+        const u64 hash = HashBytes(bytes);
+
+        auto [begin, end] = m_chunks.equal_range(hash);
+        for (auto it = begin; it != end; ++it) {
+            ChunkRef chunk = it->second.lock();
+            if (chunk && std::ranges::equal(chunk->m_bytes, bytes)) {
+                return chunk;
+            }
+        }
+
+        ChunkRef chunk(new Chunk{hash, {bytes.begin(), bytes.end()}}, [this](const Chunk *chunk) {
+            release(chunk);
+            delete chunk;
+        });
+        m_chunks.emplace(hash, chunk);
+        m_stored_bytes += bytes.size() + ChunkOverhead;
+        return chunk;
+    }
+
+    void HistoryChunkStore::release(const Chunk *chunk) {
+        // The chunk's own entry is the expired one; any other expired entry
+        // under the same hash belongs to a chunk whose release is underway
+        // and is just as valid to remove.
+        auto [begin, end] = m_chunks.equal_range(chunk->m_hash);
+        for (auto it = begin; it != end; ++it) {
+            if (it->second.expired()) {
+                m_chunks.erase(it);
+                break;
+            }
+        }
+        m_stored_bytes -= chunk->m_bytes.size() + ChunkOverhead;
+    }
+
+}  // namespace Toolbox
@@ -0,0 +1,670 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <execution>
+#include <memory>
+#include <mutex>
+#include <numeric>
+
+#include "core/simd.hpp"
+#include "model/memscankernel.hpp"
+
+namespace Toolbox::MemScan {
+
+    // Chunks are the unit of parallel work. They must stay a multiple of
+    // every stride and vector width, and small enough for the bitmap to live in L1.
+    static constexpr u32 s_chunk_size = 0x10000;
+
+    // Rows of an existing result set filtered per parallel work item.
+    static constexpr size_t s_filter_block = 0x4000;
+
+    template <typename T> static T LoadBigEndian(const u8 *ptr) {
+        T value;
+        std::memcpy(&value, ptr, sizeof(T));
+        if constexpr (sizeof(T) == 1) {
+            return value;
+        } else if constexpr (std::is_integral_v<T>) {
+            return std::byteswap(value);
+        } else if constexpr (std::is_same_v<T, f32>) {
+            return std::bit_cast<T>(std::byteswap(std::bit_cast<u32>(value)));
+        } else {
+            return std::bit_cast<T>(std::byteswap(std::bit_cast<u64>(value)));
+        }
+    }
+
+    // Vector masks are produced per byte; only the bit at the start of each lane counts.
+    template <size_t _Width> static constexpr u32 LaneStartMask() {
+        if constexpr (_Width == 1) {
+            return 0xFFFFFFFF;
+        } else if constexpr (_Width == 2) {
+            return 0x55555555;
+        } else if constexpr (_Width == 4) {
+            return 0x11111111;
+        } else {
+            return 0x01010101;
+        }
+    }
+
+    static inline void MarkBits(u64 *bitmap, u32 rel, u64 bits) {
+        const u32 word  = rel / 64;
+        const u32 shift = rel % 64;
+        bitmap[word] |= bits << shift;
+        if (shift != 0) {
+            bitmap[word + 1] |= bits >> (64 - shift);
+        }
+    }
+
+    // Both vector paths below share one shape: a kernel that tests every
+    // lane in one vector, ScanVectors() which walks a phase of a chunk, and
+    // MatchVectors() which tests packed values. Each returns where it
+    // stopped so that a narrower path, then the scalar loop, can finish.
+
+#if defined(TOOLBOX_SIMD_AVX2)
+
+    namespace AVX2 {
+
+        template <typename T> TOOLBOX_SIMD_TARGET_AVX2 static __m256i BroadcastInt(T value) {
+            if constexpr (sizeof(T) == 1) {
+                return _mm256_set1_epi8(static_cast<char>(value));
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm256_set1_epi16(static_cast<short>(value));
+            } else {
+                return _mm256_set1_epi32(static_cast<int>(value));
+            }
+        }
+
+        template <size_t _Width>
+        TOOLBOX_SIMD_TARGET_AVX2 static __m256i CompareGreater(__m256i a, __m256i b) {
+            if constexpr (_Width == 1) {
+                return _mm256_cmpgt_epi8(a, b);
+            } else if constexpr (_Width == 2) {
+                return _mm256_cmpgt_epi16(a, b);
+            } else {
+                return _mm256_cmpgt_epi32(a, b);
+            }
+        }
+
+        template <typename T> class VectorKernel {
+        public:
+            static constexpr u32 width = 32;
+
+            TOOLBOX_SIMD_TARGET_AVX2 VectorKernel(const RangePredicate<T> &pred) {
+                using signed_t = std::make_signed_t<T>;
+                m_bias         = std::is_signed_v<T>
+                                     ? _mm256_setzero_si256()
+                                     : BroadcastInt<signed_t>(std::numeric_limits<signed_t>::min());
+                m_lo = _mm256_xor_si256(BroadcastInt<T>(pred.m_lo), m_bias);
+                m_hi = _mm256_xor_si256(BroadcastInt<T>(pred.m_hi), m_bias);
+            }
+
+            TOOLBOX_SIMD_TARGET_AVX2 u32 operator()(const u8 *ptr) const {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+                v         = _mm256_xor_si256(SIMD::ByteSwapLanes<sizeof(T)>(v), m_bias);
+                __m256i outside = _mm256_or_si256(CompareGreater<sizeof(T)>(m_lo, v),
+                                                  CompareGreater<sizeof(T)>(v, m_hi));
+                return ~static_cast<u32>(_mm256_movemask_epi8(outside));
+            }
+
+        private:
+            __m256i m_bias;
+            __m256i m_lo;
+            __m256i m_hi;
+        };
+
+        template <> class VectorKernel<f32> {
+        public:
+            static constexpr u32 width = 32;
+
+            TOOLBOX_SIMD_TARGET_AVX2 VectorKernel(const RangePredicate<f32> &pred)
+                : m_lo(_mm256_set1_ps(pred.m_lo)), m_hi(_mm256_set1_ps(pred.m_hi)) {}
+
+            TOOLBOX_SIMD_TARGET_AVX2 u32 operator()(const u8 *ptr) const {
+                __m256i raw   = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+                __m256 v      = _mm256_castsi256_ps(SIMD::ByteSwapLanes<4>(raw));
+                __m256 inside = _mm256_and_ps(_mm256_cmp_ps(v, m_lo, _CMP_GE_OQ),
+                                              _mm256_cmp_ps(v, m_hi, _CMP_LE_OQ));
+                return static_cast<u32>(_mm256_movemask_epi8(_mm256_castps_si256(inside)));
+            }
+
+        private:
+            __m256 m_lo;
+            __m256 m_hi;
+        };
+
+        template <> class VectorKernel<f64> {
+        public:
+            static constexpr u32 width = 32;
+
+            TOOLBOX_SIMD_TARGET_AVX2 VectorKernel(const RangePredicate<f64> &pred)
+                : m_lo(_mm256_set1_pd(pred.m_lo)), m_hi(_mm256_set1_pd(pred.m_hi)) {}
+
+            TOOLBOX_SIMD_TARGET_AVX2 u32 operator()(const u8 *ptr) const {
+                __m256i raw    = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr));
+                __m256d v      = _mm256_castsi256_pd(SIMD::ByteSwapLanes<8>(raw));
+                __m256d inside = _mm256_and_pd(_mm256_cmp_pd(v, m_lo, _CMP_GE_OQ),
+                                               _mm256_cmp_pd(v, m_hi, _CMP_LE_OQ));
+                return static_cast<u32>(_mm256_movemask_epi8(_mm256_castpd_si256(inside)));
+            }
+
+        private:
+            __m256d m_lo;
+            __m256d m_hi;
+        };
+
+        template <typename T>
+        TOOLBOX_SIMD_TARGET_AVX2 static u32
+        ScanVectors(const u8 *mem, u32 mem_size, u32 ofs, u32 chunk_begin, u32 chunk_end,
+                    const RangePredicate<T> &pred, u64 *bitmap) {
+            const VectorKernel<T> kernel(pred);
+            constexpr u32 lane_mask = LaneStartMask<sizeof(T)>() >> (32 - VectorKernel<T>::width);
+
+            for (; ofs < chunk_end && ofs + VectorKernel<T>::width <= mem_size;
+                 ofs += VectorKernel<T>::width) {
+                u32 bits = kernel(mem + ofs);
+                if (pred.m_invert) {
+                    bits = ~bits;
+                }
+                bits &= lane_mask;
+                if (bits != 0) {
+                    MarkBits(bitmap, ofs - chunk_begin, bits);
+                }
+            }
+            return ofs;
+        }
+
+        template <typename T>
+        TOOLBOX_SIMD_TARGET_AVX2 static size_t MatchVectors(const u8 *values, size_t count,
+                                                            const RangePredicate<T> &pred,
+                                                            u8 *keep) {
+            const VectorKernel<T> kernel(pred);
+            constexpr size_t lanes = VectorKernel<T>::width / sizeof(T);
+
+            size_t i = 0;
+            for (; i + lanes <= count; i += lanes) {
+                u32 bits = kernel(values + i * sizeof(T));
+                if (pred.m_invert) {
+                    bits = ~bits;
+                }
+                for (size_t j = 0; j < lanes; ++j) {
+                    keep[i + j] = (bits >> (j * sizeof(T))) & 1;
+                }
+            }
+            return i;
+        }
+
+    }  // namespace AVX2
+
+#endif
+
+#if defined(TOOLBOX_SIMD_SSE2)
+
+    namespace SSE2 {
+
+        template <typename T> static __m128i BroadcastInt(T value) {
+            if constexpr (sizeof(T) == 1) {
+                return _mm_set1_epi8(static_cast<char>(value));
+            } else if constexpr (sizeof(T) == 2) {
+                return _mm_set1_epi16(static_cast<short>(value));
+            } else {
+                return _mm_set1_epi32(static_cast<int>(value));
+            }
+        }
+
+        template <size_t _Width> static __m128i CompareGreater(__m128i a, __m128i b) {
+            if constexpr (_Width == 1) {
+                return _mm_cmpgt_epi8(a, b);
+            } else if constexpr (_Width == 2) {
+                return _mm_cmpgt_epi16(a, b);
+            } else {
+                return _mm_cmpgt_epi32(a, b);
+            }
+        }
+
+        template <typename T> class VectorKernel {
+        public:
+            static constexpr u32 width = 16;
+
+            // Unsigned lanes are biased into signed space since SSE2 only compares signed.
+            VectorKernel(const RangePredicate<T> &pred) {
+                using signed_t = std::make_signed_t<T>;
+                m_bias         = std::is_signed_v<T>
+                                     ? _mm_setzero_si128()
+                                     : BroadcastInt<signed_t>(std::numeric_limits<signed_t>::min());
+                m_lo = _mm_xor_si128(BroadcastInt<T>(pred.m_lo), m_bias);
+                m_hi = _mm_xor_si128(BroadcastInt<T>(pred.m_hi), m_bias);
+            }
+
+            u32 operator()(const u8 *ptr) const {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+                v         = _mm_xor_si128(SIMD::ByteSwapLanes<sizeof(T)>(v), m_bias);
+                __m128i outside = _mm_or_si128(CompareGreater<sizeof(T)>(m_lo, v),
+                                               CompareGreater<sizeof(T)>(v, m_hi));
+                return ~static_cast<u32>(_mm_movemask_epi8(outside)) & 0xFFFF;
+            }
+
+        private:
+            __m128i m_bias;
+            __m128i m_lo;
+            __m128i m_hi;
+        };
+
+        template <> class VectorKernel<f32> {
+        public:
+            static constexpr u32 width = 16;
+
+            VectorKernel(const RangePredicate<f32> &pred)
+                : m_lo(_mm_set1_ps(pred.m_lo)), m_hi(_mm_set1_ps(pred.m_hi)) {}
+
+            u32 operator()(const u8 *ptr) const {
+                __m128i raw   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+                __m128 v      = _mm_castsi128_ps(SIMD::ByteSwapLanes<4>(raw));
+                __m128 inside = _mm_and_ps(_mm_cmpge_ps(v, m_lo), _mm_cmple_ps(v, m_hi));
+                return static_cast<u32>(_mm_movemask_epi8(_mm_castps_si128(inside)));
+            }
+
+        private:
+            __m128 m_lo;
+            __m128 m_hi;
+        };
+
+        template <> class VectorKernel<f64> {
+        public:
+            static constexpr u32 width = 16;
+
+            VectorKernel(const RangePredicate<f64> &pred)
+                : m_lo(_mm_set1_pd(pred.m_lo)), m_hi(_mm_set1_pd(pred.m_hi)) {}
+
+            u32 operator()(const u8 *ptr) const {
+                __m128i raw    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+                __m128d v      = _mm_castsi128_pd(SIMD::ByteSwapLanes<8>(raw));
+                __m128d inside = _mm_and_pd(_mm_cmpge_pd(v, m_lo), _mm_cmple_pd(v, m_hi));
+                return static_cast<u32>(_mm_movemask_epi8(_mm_castpd_si128(inside)));
+            }
+
+        private:
+            __m128d m_lo;
+            __m128d m_hi;
+        };
+
+        template <typename T>
+        static u32 ScanVectors(const u8 *mem, u32 mem_size, u32 ofs, u32 chunk_begin,
+                               u32 chunk_end, const RangePredicate<T> &pred, u64 *bitmap) {
+            const VectorKernel<T> kernel(pred);
+            constexpr u32 lane_mask = LaneStartMask<sizeof(T)>() >> (32 - VectorKernel<T>::width);
+
+            for (; ofs < chunk_end && ofs + VectorKernel<T>::width <= mem_size;
+                 ofs += VectorKernel<T>::width) {
+                u32 bits = kernel(mem + ofs);
+                if (pred.m_invert) {
+                    bits = ~bits;
+                }
+                bits &= lane_mask;
+                if (bits != 0) {
+                    MarkBits(bitmap, ofs - chunk_begin, bits);
+                }
+            }
+            return ofs;
+        }
+
+        template <typename T>
+        static size_t MatchVectors(const u8 *values, size_t count, const RangePredicate<T> &pred,
+                                   u8 *keep) {
+            const VectorKernel<T> kernel(pred);
+            constexpr size_t lanes = VectorKernel<T>::width / sizeof(T);
+
+            size_t i = 0;
+            for (; i + lanes <= count; i += lanes) {
+                u32 bits = kernel(values + i * sizeof(T));
+                if (pred.m_invert) {
+                    bits = ~bits;
+                }
+                for (size_t j = 0; j < lanes; ++j) {
+                    keep[i + j] = (bits >> (j * sizeof(T))) & 1;
+                }
+            }
+            return i;
+        }
+
+    }  // namespace SSE2
+
+#endif
+
+    // Tests every lane start in [chunk_begin, chunk_end) and appends the matches to `out`.
+    //
+    // Each phase walks the chunk at a different byte offset so unaligned scans reuse the
+    // same lane layout; matches are collected in a per-chunk bitmap so the output stays
+    // sorted regardless of which phase found them.
+    template <typename T>
+    static void ScanChunk(const u8 *mem, u32 mem_size, u32 chunk_begin, u32 chunk_end, u32 stride,
+                          const RangePredicate<T> &pred, std::vector<u32> &out) {
+        constexpr u32 lane_width = sizeof(T);
+
+        if (pred.m_none) {
+            return;
+        }
+
+        if (pred.m_all) {
+            for (u32 ofs = chunk_begin; ofs < chunk_end && ofs + lane_width <= mem_size;
+                 ofs += stride) {
+                out.push_back(ofs);
+            }
+            return;
+        }
+
+        // One trailing word of slack for vectors that straddle the chunk end.
+        std::array<u64, s_chunk_size / 64 + 1> bitmap = {};
+
+        for (u32 phase = 0; phase < lane_width; phase += stride) {
+            u32 ofs = chunk_begin + phase;
+
+#if defined(TOOLBOX_SIMD_AVX2)
+            if (SIMD::HasAVX2()) {
+                ofs = AVX2::ScanVectors<T>(mem, mem_size, ofs, chunk_begin, chunk_end, pred,
+                                           bitmap.data());
+            }
+#endif
+#if defined(TOOLBOX_SIMD_SSE2)
+            ofs = SSE2::ScanVectors<T>(mem, mem_size, ofs, chunk_begin, chunk_end, pred,
+                                       bitmap.data());
+#endif
+
+            // Scalar tail (or the whole phase when no vector unit is available)
+            for (; ofs < chunk_end && ofs + lane_width <= mem_size; ofs += lane_width) {
+                if (pred.test(LoadBigEndian<T>(mem + ofs))) {
+                    MarkBits(bitmap.data(), ofs - chunk_begin, 1);
+                }
+            }
+        }
+
+        const u32 chunk_len = chunk_end - chunk_begin;
+        for (u32 word = 0; word < bitmap.size(); ++word) {
+            u64 bits = bitmap[word];
+            while (bits != 0) {
+                const u32 rel = word * 64 + static_cast<u32>(std::countr_zero(bits));
+                if (rel >= chunk_len) {
+                    return;
+                }
+                out.push_back(chunk_begin + rel);
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    template <typename T>
+    std::vector<u32> FindAll(const u8 *mem, u32 mem_size, u32 begin_ofs, u32 end_ofs, u32 stride,
+                             const RangePredicate<scan_storage_t<T>> &pred,
+                             std::function<void(double)> prog_setter) {
+        using storage_t = scan_storage_t<T>;
+
+        end_ofs = std::min(end_ofs, mem_size);
+        if (!mem || begin_ofs >= end_ofs || stride == 0 || pred.m_none) {
+            return {};
+        }
+
+        // Phases must tile the lane exactly; anything else
+        // would skip or repeat lane starts.
+        if (sizeof(storage_t) % stride != 0 && stride % sizeof(storage_t) != 0) {
+            return {};
+        }
+
+        const u32 chunk_count = (end_ofs - begin_ofs + s_chunk_size - 1) / s_chunk_size;
+
+        std::vector<std::vector<u32>> chunk_results(chunk_count);
+        std::vector<u32> chunk_indices(chunk_count);
+        std::iota(chunk_indices.begin(), chunk_indices.end(), 0);
+
+        std::atomic<u32> chunks_done = 0;
+        std::mutex prog_mutex;
+
+        std::for_each(std::execution::par, chunk_indices.begin(), chunk_indices.end(),
+                      [&](u32 chunk) {
+                          const u32 chunk_begin = begin_ofs + chunk * s_chunk_size;
+                          const u32 chunk_end = std::min(chunk_begin + s_chunk_size, end_ofs);
+
+                          if (stride > sizeof(storage_t)) {
+                              // Sparse grid, no lane packing to exploit
+                              for (u32 ofs = chunk_begin;
+                                   ofs < chunk_end && ofs + sizeof(storage_t) <= mem_size;
+                                   ofs += stride) {
+                                  if (pred.test(LoadBigEndian<storage_t>(mem + ofs))) {
+                                      chunk_results[chunk].push_back(ofs);
+                                  }
+                              }
+                          } else {
+                              ScanChunk<storage_t>(mem, mem_size, chunk_begin, chunk_end, stride,
+                                                   pred, chunk_results[chunk]);
+                          }
+
+                          const u32 done = ++chunks_done;
+                          if (prog_setter) {
+                              std::unique_lock lock(prog_mutex, std::try_to_lock);
+                              if (lock.owns_lock()) {
+                                  prog_setter((double)done / (double)chunk_count);
+                              }
+                          }
+                      });
+
+        size_t total = 0;
+        for (const std::vector<u32> &results : chunk_results) {
+            total += results.size();
+        }
+
+        std::vector<u32> merged;
+        merged.reserve(total);
+        for (const std::vector<u32> &results : chunk_results) {
+            merged.insert(merged.end(), results.begin(), results.end());
+        }
+
+        if (prog_setter) {
+            prog_setter(1.0);
+        }
+
+        return merged;
+    }
+
+    // Tests `count` packed big endian values, writing one keep flag per value.
+    template <typename T>
+    static void MatchContiguous(const u8 *values, size_t count, const RangePredicate<T> &pred,
+                                u8 *keep) {
+        if (pred.m_all || pred.m_none) {
+            std::memset(keep, pred.m_all ? 1 : 0, count);
+            return;
+        }
+
+        size_t i = 0;
+
+#if defined(TOOLBOX_SIMD_AVX2)
+        if (SIMD::HasAVX2()) {
+            i = AVX2::MatchVectors<T>(values, count, pred, keep);
+        }
+#endif
+#if defined(TOOLBOX_SIMD_SSE2)
+        i += SSE2::MatchVectors<T>(values + i * sizeof(T), count - i, pred, keep + i);
+#endif
+
+        for (; i < count; ++i) {
+            keep[i] = pred.test(LoadBigEndian<T>(values + i * sizeof(T)));
+        }
+    }
+
+    // Kept branch free over plain arrays so the compiler can vectorize each operator.
+    template <typename T, typename _Cmp>
+    static void MatchRelative(const T *current, const T *last, size_t count, u8 *keep,
+                              _Cmp cmp) {
+        for (size_t i = 0; i < count; ++i) {
+            keep[i] = static_cast<u8>(cmp(current[i], last[i]));
+        }
+    }
+
+    template <typename T>
+    static void MatchRelative(const T *current, const T *last, size_t count, ScanOperator op,
+                              T a, u8 *keep) {
+        switch (op) {
+        case ScanOperator::OP_INCREASED_BY:
+            MatchRelative(current, last, count, keep,
+                          [a](T cur, T prev) { return cur == static_cast<T>(prev + a); });
+            break;
+        case ScanOperator::OP_DECREASED_BY:
+            MatchRelative(current, last, count, keep,
+                          [a](T cur, T prev) { return cur == static_cast<T>(prev - a); });
+            break;
+        case ScanOperator::OP_INCREASED:
+            MatchRelative(current, last, count, keep, [](T cur, T prev) { return cur > prev; });
+            break;
+        case ScanOperator::OP_DECREASED:
+            MatchRelative(current, last, count, keep, [](T cur, T prev) { return cur < prev; });
+            break;
+        case ScanOperator::OP_CHANGED:
+            MatchRelative(current, last, count, keep, [](T cur, T prev) { return cur != prev; });
+            break;
+        case ScanOperator::OP_UNCHANGED:
+            MatchRelative(current, last, count, keep, [](T cur, T prev) { return cur == prev; });
+            break;
+        default:
+            std::memset(keep, 0, count);
+            break;
+        }
+    }
+
+    static bool IsRelativeOperator(ScanOperator op) {
+        switch (op) {
+        case ScanOperator::OP_INCREASED_BY:
+        case ScanOperator::OP_DECREASED_BY:
+        case ScanOperator::OP_INCREASED:
+        case ScanOperator::OP_DECREASED:
+        case ScanOperator::OP_CHANGED:
+        case ScanOperator::OP_UNCHANGED:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    template <typename T>
+    std::vector<u32> FilterAll(const u8 *mem, u32 mem_size, const MemScanResultSet &previous,
+                               ScanOperator op, T a, T b,
+                               std::function<void(double)> prog_setter) {
+        using storage_t = scan_storage_t<T>;
+
+        const size_t row_count = previous.size();
+        if (!mem || row_count == 0) {
+            return {};
+        }
+
+        // The previous scan may have been of a different width,
+        // in which case there is no meaningful last value.
+        const bool has_last    = previous.valueSize() == sizeof(storage_t);
+        const bool is_relative = IsRelativeOperator(op);
+
+        RangePredicate<storage_t> range;
+        if (!is_relative) {
+            range = MakeRangePredicate<T>(op, a, b, T());
+        }
+
+        const size_t block_count = (row_count + s_filter_block - 1) / s_filter_block;
+
+        std::vector<std::vector<u32>> block_results(block_count);
+        std::vector<size_t> block_indices(block_count);
+        std::iota(block_indices.begin(), block_indices.end(), 0);
+
+        std::atomic<size_t> blocks_done = 0;
+        std::mutex prog_mutex;
+
+        std::for_each(
+            std::execution::par, block_indices.begin(), block_indices.end(), [&](size_t block) {
+                const size_t row_begin = block * s_filter_block;
+                const size_t row_end   = std::min(row_begin + s_filter_block, row_count);
+                const size_t count     = row_end - row_begin;
+
+                std::vector<u32> addresses(count);
+                previous.gatherAddresses(row_begin, row_end, addresses.data());
+
+                // Gather the current values into the same packed layout
+                // the previous values are stored in.
+                std::vector<u8> gathered(count * sizeof(storage_t));
+                std::vector<u8> in_bounds(count);
+                for (size_t i = 0; i < count; ++i) {
+                    const u32 ofs = addresses[i] & 0x7FFFFFFF;
+                    in_bounds[i]  = ofs + sizeof(storage_t) <= mem_size;
+                    if (in_bounds[i]) {
+                        std::memcpy(&gathered[i * sizeof(storage_t)], mem + ofs,
+                                    sizeof(storage_t));
+                    }
+                }
+
+                std::vector<u8> keep(count);
+                if (!is_relative) {
+                    MatchContiguous<storage_t>(gathered.data(), count, range, keep.data());
+                } else {
+                    // Not std::vector, which would pack bools into bits
+                    std::unique_ptr<T[]> current = std::make_unique<T[]>(count);
+                    std::unique_ptr<T[]> last    = std::make_unique<T[]>(count);
+                    const u8 *last_values = previous.valueAt(row_begin);
+                    for (size_t i = 0; i < count; ++i) {
+                        current[i] = static_cast<T>(
+                            LoadBigEndian<storage_t>(&gathered[i * sizeof(storage_t)]));
+                        if (has_last) {
+                            last[i] = static_cast<T>(
+                                LoadBigEndian<storage_t>(last_values + i * sizeof(storage_t)));
+                        }
+                    }
+                    MatchRelative<T>(current.get(), last.get(), count, op, a, keep.data());
+                }
+
+                std::vector<u32> &results = block_results[block];
+                for (size_t i = 0; i < count; ++i) {
+                    if (keep[i] && in_bounds[i]) {
+                        results.push_back(addresses[i]);
+                    }
+                }
+
+                const size_t done = ++blocks_done;
+                if (prog_setter) {
+                    std::unique_lock lock(prog_mutex, std::try_to_lock);
+                    if (lock.owns_lock()) {
+                        prog_setter((double)done / (double)block_count);
+                    }
+                }
+            });
+
+        size_t total = 0;
+        for (const std::vector<u32> &results : block_results) {
+            total += results.size();
+        }
+
+        std::vector<u32> merged;
+        merged.reserve(total);
+        for (const std::vector<u32> &results : block_results) {
+            merged.insert(merged.end(), results.begin(), results.end());
+        }
+
+        if (prog_setter) {
+            prog_setter(1.0);
+        }
+
+        return merged;
+    }
+
+#define TOOLBOX_MEMSCAN_INSTANTIATE(type)                                                          \
+    template std::vector<u32> FindAll<type>(const u8 *, u32, u32, u32, u32,                      \
+                                            const RangePredicate<scan_storage_t<type>> &,          \
+                                            std::function<void(double)>);                      \
+    template std::vector<u32> FilterAll<type>(const u8 *, u32, const MemScanResultSet &,           \
+                                              ScanOperator, type, type,                            \
+                                              std::function<void(double)>);
+
+    TOOLBOX_MEMSCAN_INSTANTIATE(bool)
+    TOOLBOX_MEMSCAN_INSTANTIATE(s8)
+    TOOLBOX_MEMSCAN_INSTANTIATE(u8)
+    TOOLBOX_MEMSCAN_INSTANTIATE(s16)
+    TOOLBOX_MEMSCAN_INSTANTIATE(u16)
+    TOOLBOX_MEMSCAN_INSTANTIATE(s32)
+    TOOLBOX_MEMSCAN_INSTANTIATE(u32)
+    TOOLBOX_MEMSCAN_INSTANTIATE(f32)
+    TOOLBOX_MEMSCAN_INSTANTIATE(f64)
+
+#undef TOOLBOX_MEMSCAN_INSTANTIATE
+
+}  // namespace Toolbox::MemScan
@@ -5,6 +5,7 @@
 
 #include "dolphin/watch.hpp"
 #include "gui/appmain/application.hpp"
+#include "model/memscankernel.hpp"
 #include "model/memscanmodel.hpp"
 
 using namespace Toolbox::Object;
@@ -75,97 +76,61 @@ namespace Toolbox {
         return buf;
     }
 
+    template <typename T> static T decodeSingle(const u8 *value) {
+        T mem_val;
+        std::memcpy(&mem_val, value, sizeof(T));
+
+        if constexpr (std::is_same_v<T, bool>) {
+            return mem_val;
+        } else if constexpr (std::is_integral_v<T>) {
+            return std::byteswap(mem_val);
+        } else if constexpr (std::is_same_v<T, f32>) {
+            return std::bit_cast<T>(std::byteswap(std::bit_cast<u32>(mem_val)));
+        } else if constexpr (std::is_same_v<T, f64>) {
+            return std::bit_cast<T>(std::byteswap(std::bit_cast<u64>(mem_val)));
+        }
+    }
+
     static MetaValue GetMetaValueFromMemCache(const MemScanModel::ScanHistoryEntry &entry,
                                               const MemScanResult &result) {
-        u32 address = result.getAddress();
+        std::optional<size_t> row = entry.m_scan_results.find(result.getAddress());
+        if (!row) {
+            return MetaValue(MetaType::UNKNOWN);
+        }
+
+        const u8 *value = entry.m_scan_results.valueAt(row.value());
         switch (entry.m_scan_type) {
         case MetaType::BOOL:
-            return MetaValue(readSingle<bool>(entry.m_scan_buffer, address));
+            return MetaValue(decodeSingle<bool>(value));
         case MetaType::S8:
-            return MetaValue(readSingle<s8>(entry.m_scan_buffer, address));
+            return MetaValue(decodeSingle<s8>(value));
         case MetaType::U8:
-            return MetaValue(readSingle<u8>(entry.m_scan_buffer, address));
+            return MetaValue(decodeSingle<u8>(value));
         case MetaType::S16:
-            return MetaValue(readSingle<s16>(entry.m_scan_buffer, address));
+            return MetaValue(decodeSingle<s16>(value));
         case MetaType::U16:
-            return MetaValue(readSingle<u16>(entry.m_scan_buffer, address));
+            return MetaValue(decodeSingle<u16>(value));
         case MetaType::S32:
-            return MetaValue(readSingle<s32>(entry.m_scan_buffer, address));
+            return MetaValue(decodeSingle<s32>(value));
         case MetaType::U32:
-            return MetaValue(readSingle<u32>(entry.m_scan_buffer, address));
+            return MetaValue(decodeSingle<u32>(value));
         case MetaType::F32:
-            return MetaValue(readSingle<f32>(entry.m_scan_buffer, address));
+            return MetaValue(decodeSingle<f32>(value));
         case MetaType::F64:
-            return MetaValue(readSingle<f64>(entry.m_scan_buffer, address));
+            return MetaValue(decodeSingle<f64>(value));
         case MetaType::STRING:
-            return MetaValue(readString(entry.m_scan_buffer, address, entry.m_scan_size));
-        case MetaType::UNKNOWN:
-            return MetaValue(readBytes(entry.m_scan_buffer, address, entry.m_scan_size));
+            return MetaValue(std::string(reinterpret_cast<const char *>(value), entry.m_scan_size));
+        case MetaType::UNKNOWN: {
+            Buffer buf;
+            buf.alloc(entry.m_scan_size);
+            std::memcpy(buf.buf(), value, entry.m_scan_size);
+            return MetaValue(buf);
+        }
         default:
             return MetaValue(MetaType::UNKNOWN);
         }
     }
 
-    template <typename T>
-    static bool compareSingle(const Buffer &mem_buf, u32 address, const T &a, const T &b,
-                              const T &last, MemScanModel::ScanOperator op, T *out) {
-        static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>,
-                      "This method requires simple data");
-
-        DolphinHookManager &manager = DolphinHookManager::instance();
-        u32 addr_ofs                = manager.getAddressAsOffset(address);
-
-        const char *mem_handle = mem_buf.buf<char>() + addr_ofs;
-        uint32_t mem_size      = mem_buf.size();
-
-        // Bounds check
-        if (addr_ofs + sizeof(a) >= mem_size) {
-            return false;
-        }
-
-        T mem_val;
-        std::memcpy(&mem_val, mem_handle, sizeof(a));
-
-        if constexpr (std::is_integral_v<T>) {
-            mem_val = std::byteswap(mem_val);
-        } else if constexpr (std::is_same_v<T, f32>) {
-            mem_val = std::bit_cast<T>(std::byteswap(std::bit_cast<u32>(mem_val)));
-        } else if constexpr (std::is_same_v<T, f64>) {
-            mem_val = std::bit_cast<T>(std::byteswap(std::bit_cast<u64>(mem_val)));
-        }
-
-        if (out) {
-            *out = mem_val;
-        }
-
-        switch (op) {
-        case MemScanModel::ScanOperator::OP_EXACT:
-            return a == mem_val;
-        case MemScanModel::ScanOperator::OP_INCREASED_BY:
-            return mem_val == last + a;
-        case MemScanModel::ScanOperator::OP_DECREASED_BY:
-            return mem_val == last - a;
-        case MemScanModel::ScanOperator::OP_BETWEEN:
-            return a <= mem_val && mem_val <= b;
-        case MemScanModel::ScanOperator::OP_BIGGER_THAN:
-            return mem_val > a;
-        case MemScanModel::ScanOperator::OP_SMALLER_THAN:
-            return mem_val < a;
-        case MemScanModel::ScanOperator::OP_INCREASED:
-            return mem_val > last;
-        case MemScanModel::ScanOperator::OP_DECREASED:
-            return mem_val < last;
-        case MemScanModel::ScanOperator::OP_CHANGED:
-            return mem_val != last;
-        case MemScanModel::ScanOperator::OP_UNCHANGED:
-            return mem_val == last;
-        case MemScanModel::ScanOperator::OP_UNKNOWN_INITIAL:
-            return true;
-        }
-
-        return false;
-    }
-
     static bool compareString(const Buffer &mem_buf, u32 address, const std::string &a,
                               MemScanModel::ScanOperator op, std::string *out) {
         if (op != MemScanModel::ScanOperator::OP_EXACT) {
@@ -261,102 +226,59 @@ namespace Toolbox {
                 val_width;  // Since alignment is forced, each entry has to be n bytes apart.
         }
 
-        if (!model.reserveScan(profile.m_scan_type, sizeof(T), O_estimate)) {
+        Buffer mem_image;
+        if (!model.captureMemory(mem_image)) {
             return 0;
         }
 
-        if (!model.captureMemForCache()) {
+        if (!model.reserveScan(profile.m_scan_type, sizeof(T), O_estimate)) {
             return 0;
         }
 
-        const MemScanModel::ScanHistoryEntry &entry = model.getScanHistory();
-
         T val_a = profile.m_scan_a.get<T>().value_or(T());
         T val_b = profile.m_scan_b.get<T>().value_or(T());
 
-        u32 address = begin_address;
-
-        size_t match_counter = 0;
-        size_t sleep_counter = 0;
-        while (address < end_address) {
-            address &= addr_mask;
+        // The first scan has no previous values, so relative operators compare against T()
+        auto predicate = MemScan::MakeRangePredicate<T>(profile.m_scan_op, val_a, val_b, T());
 
-            T mem_val;
-            bool is_match =
-                compareSingle<T>(entry.m_scan_buffer, address, val_a, val_b,
-                                 T() /*this is the previous scan*/, profile.m_scan_op, &mem_val);
-            if (is_match) {
-                model.makeScanIndex(address);
-                match_counter += 1;
-            }
-
-            address += addr_inc;
+        DolphinHookManager &manager = DolphinHookManager::instance();
+        const u32 begin_ofs         = manager.getAddressAsOffset(begin_address) & addr_mask;
+        const u32 end_ofs           = manager.getAddressAsOffset(end_address - 1) + 1;
 
-            prog_setter((double)(address - begin_address) / (double)profile.m_search_size);
+        std::vector<u32> matches =
+            MemScan::FindAll<T>(mem_image.buf<u8>(), mem_image.size(), begin_ofs, end_ofs,
+                                addr_inc, predicate, prog_setter);
 
-            // if (sleep_counter++ >= profile.m_sleep_granularity) {
-            //     sleep_counter = 0;
-            //     std::this_thread::sleep_for(std::chrono::milliseconds(profile.m_sleep_duration));
-            // }
-        }
-
-        return match_counter;
+        model.makeScanIndexes(matches, mem_image);
+        return matches.size();
     }
 
     template <typename T>
     static size_t scanExistingSingles(MemScanModel &model,
                                       const MemScanModel::MemScanProfile &profile,
                                       std::function<void(double)> prog_setter) {
-        const u32 val_width = profile.m_scan_a.computeSize();
-
         T val_a = profile.m_scan_a.get<T>().value_or(T());
         T val_b = profile.m_scan_b.get<T>().value_or(T());
 
-        size_t match_counter = 0;
-        size_t sleep_counter = 0;
-
         const MemScanModel::ScanHistoryEntry &recent_scan = model.getScanHistory();
 
         size_t row_count = recent_scan.m_scan_results.size();
 
-        if (!model.reserveScan(profile.m_scan_type, sizeof(T), row_count)) {
+        Buffer mem_image;
+        if (!model.captureMemory(mem_image)) {
             return 0;
         }
 
-        if (!model.captureMemForCache()) {
+        if (!model.reserveScan(profile.m_scan_type, sizeof(T), row_count)) {
             return 0;
         }
 
-        const MemScanModel::ScanHistoryEntry &current_scan = model.getScanHistory();
-
-        size_t i = 0;
-        while (i < row_count) {
-            const MemScanResult &result = recent_scan.m_scan_results[i];
-            u32 address                 = result.getAddress();
-
-            MetaValue value = GetMetaValueFromMemCache(recent_scan, result);
-
-            T val = value.get<T>().value_or(T());
-            T mem_val;
-
-            bool is_match = compareSingle<T>(current_scan.m_scan_buffer, address, val_a, val_b, val,
-                                             profile.m_scan_op, &mem_val);
-            if (is_match) {
-                model.makeScanIndex(address);
-                match_counter += 1;
-            }
-
-            // if (sleep_counter++ >= profile.m_sleep_granularity) {
-            //     sleep_counter = 0;
-            //     std::this_thread::sleep_for(std::chrono::milliseconds(profile.m_sleep_duration));
-            // }
-
-            i += 1;
+        std::vector<u32> matches =
+            MemScan::FilterAll<T>(mem_image.buf<u8>(), mem_image.size(), recent_scan.m_scan_results,
+                                  profile.m_scan_op, val_a, val_b, prog_setter);
 
-            prog_setter((double)i / (double)row_count);
-        }
-
-        return match_counter;
+        model.makeScanIndexes(matches, mem_image);
+        return matches.size();
     }
 
     static bool _MemScanResultCompareByAddress(const MemScanResult &lhs, const MemScanResult &rhs,
@@ -480,8 +402,6 @@ namespace Toolbox {
         for (size_t i = 0; i < m_history_size; ++i) {
             m_index_map_history[i].m_scan_type = MetaType::UNKNOWN;
             m_index_map_history[i].m_scan_results.clear();
-            m_index_map_history[i].m_scan_results.shrink_to_fit();
-            m_index_map_history[i].m_scan_buffer.free();
         }
 
         m_history_size = 0;
@@ -600,8 +520,6 @@ namespace Toolbox {
 
         ScanHistoryEntry &entry = m_index_map_history[m_history_size - 1];
         entry.m_scan_results.clear();
-        entry.m_scan_results.shrink_to_fit();
-        entry.m_scan_buffer.free();
         m_history_size--;
         return true;
     }
@@ -627,9 +545,8 @@ namespace Toolbox {
         ScanHistoryEntry &newest_scan = m_index_map_history[m_history_size - 1];
 
         out.write<u32>(static_cast<u32>(newest_scan.m_scan_results.size()));
-        for (const MemScanResult &result : newest_scan.m_scan_results) {
-            out.write<u32>(result.getAddress());
-        }
+        newest_scan.m_scan_results.forEach(
+            [&](size_t row, u32 address, const u8 *value) { out.write<u32>(address); });
 
         return Result<void, SerialError>();
     }
@@ -647,19 +564,23 @@ namespace Toolbox {
             return Result<void, SerialError>();
         }
 
+        Buffer mem_image;
+        if (!captureMemory(mem_image)) {
+            return make_serial_error<void>(in, "Failed to capture the current memory frame.");
+        }
+
         if (!reserveScan(m_scan_type, m_scan_size, count)) {
             return make_serial_error<void>(in, "Failed to reserve memory for the scan data.");
         }
 
-        if (!captureMemForCache()) {
-            reset();
-            return make_serial_error<void>(in, "Failed to capture the current memory frame.");
+        std::vector<u32> addresses;
+        addresses.reserve(count);
+        for (u32 i = 0; i < count; ++i) {
+            addresses.push_back(in.read<u32>());
         }
+        std::sort(addresses.begin(), addresses.end());
 
-        for (int i = 0; i < count; ++i) {
-            u32 address = in.read<u32>();
-            makeScanIndex(address);
-        }
+        makeScanIndexes(addresses, mem_image);
 
         return Result<void, SerialError>();
     }
@@ -752,20 +673,12 @@ namespace Toolbox {
 
         const ScanHistoryEntry &recent_scan = m_index_map_history[m_history_size - 1];
 
-        auto it = std::lower_bound(
-            recent_scan.m_scan_results.begin(), recent_scan.m_scan_results.end(), address,
-            [](const MemScanResult &it, u32 address) { return it.getAddress() < address; });
-        if (it == recent_scan.m_scan_results.end()) {
-            return ModelIndex();
-        }
-
-        MemScanResult &lhs = *it;
-        if (lhs.getAddress() != address) {
+        if (!recent_scan.m_scan_results.find(address)) {
             return ModelIndex();
         }
 
         ModelIndex index(getUUID());
-        index.setInlineData(SCAN_IDX_MAKE_PAIR(lhs.getAddress(), lhs.getHistoryIndex()));
+        index.setInlineData(SCAN_IDX_MAKE_PAIR(0x80000000 | address, m_history_size - 1));
         return index;
     }
 
@@ -789,10 +702,9 @@ namespace Toolbox {
             return ModelIndex();
         }
 
-        const MemScanResult &result = recent_scan.m_scan_results[row];
-
         ModelIndex index(getUUID());
-        index.setInlineData(SCAN_IDX_MAKE_PAIR(result.getAddress(), result.getHistoryIndex()));
+        index.setInlineData(
+            SCAN_IDX_MAKE_PAIR(recent_scan.m_scan_results.addressAt(row), m_history_size - 1));
         return index;
     }
 
@@ -805,10 +717,12 @@ namespace Toolbox {
         u32 address     = SCAN_IDX_GET_ADDRESS(pair);
         u32 history_idx = SCAN_IDX_GET_HISTORY_IDX(pair);
 
+        if (history_idx != m_history_size - 1) {
+            return false;
+        }
+
         ScanHistoryEntry &recent_scan = m_index_map_history[m_history_size - 1];
-        return std::erase_if(recent_scan.m_scan_results, [&](const MemScanResult &result) {
-            return result.getAddress() == address && result.getHistoryIndex() == history_idx;
-        }) > 0;
+        return recent_scan.m_scan_results.erase(address);
     }
 
     ModelIndex MemScanModel::getParent_(const ModelIndex &index) const { return ModelIndex(); }
@@ -861,23 +775,12 @@ namespace Toolbox {
         u32 address     = SCAN_IDX_GET_ADDRESS(pair);
         u32 history_idx = SCAN_IDX_GET_HISTORY_IDX(pair);
 
-        auto it =
-            std::lower_bound(recent_scan.m_scan_results.begin(), recent_scan.m_scan_results.end(),
-                             address, [](const MemScanResult &it, u32 val) {
-                                 return it.getAddress() < val;
-                             });
-        if (it == recent_scan.m_scan_results.end()) {
+        std::optional<size_t> row = recent_scan.m_scan_results.find(address);
+        if (!row) {
             return -1;
         }
 
-        // Make sure we have a real match, since lower_bound may return the closest element.
-        const MemScanResult &lhs = *it;
-        if (lhs.getAddress() != address) {
-            return -1;
-        }
-
-        int64_t row = std::distance(recent_scan.m_scan_results.begin(), it);
-        return row;
+        return static_cast<int64_t>(row.value());
     }
 
     bool MemScanModel::hasChildren_(const ModelIndex &parent) const { return false; }
@@ -941,32 +844,58 @@ namespace Toolbox {
         }
     }
 
-    void MemScanModel::makeScanIndex(u32 address) {
+    void MemScanModel::makeScanIndex(u32 address, const Buffer &mem_image) {
         if (m_history_size == 0) {
             return;
         }
 
         ScanHistoryEntry &recent_scan = m_index_map_history[m_history_size - 1];
 
+        const u32 addr_ofs = DolphinHookManager::instance().getAddressAsOffset(address);
+        if (addr_ofs + recent_scan.m_scan_size > mem_image.size()) {
+            return;
+        }
+
         {
             std::scoped_lock lock(m_mutex);
-            recent_scan.m_scan_results.emplace_back(address, m_history_size - 1);
+            recent_scan.m_scan_results.push_back(address, mem_image.buf<u8>() + addr_ofs);
         }
     }
 
-    bool MemScanModel::captureMemForCache() {
+    void MemScanModel::makeScanIndexes(std::span<const u32> addresses, const Buffer &mem_image) {
         if (m_history_size == 0) {
-            return false;
+            return;
         }
 
+        ScanHistoryEntry &recent_scan = m_index_map_history[m_history_size - 1];
+
         DolphinHookManager &manager = DolphinHookManager::instance();
+        const u8 *mem_handle        = mem_image.buf<u8>();
 
-        ScanHistoryEntry &entry = m_index_map_history[m_history_size - 1];
+        {
+            std::scoped_lock lock(m_mutex);
+            recent_scan.m_scan_results.reserve(recent_scan.m_scan_results.size() +
+                                               addresses.size());
+            for (u32 address : addresses) {
+                const u32 addr_ofs = manager.getAddressAsOffset(address);
+                if (addr_ofs + recent_scan.m_scan_size > mem_image.size()) {
+                    break;
+                }
+                recent_scan.m_scan_results.push_back(address, mem_handle + addr_ofs);
+            }
+        }
+    }
+
+    bool MemScanModel::captureMemory(Buffer &out) const {
+        DolphinHookManager &manager = DolphinHookManager::instance();
 
         Buffer the_buf;
         the_buf.setBuf(manager.getMemoryView(), manager.getMemorySize());
+        if (!the_buf) {
+            return false;
+        }
 
-        return the_buf.copyTo(entry.m_scan_buffer);
+        return the_buf.copyTo(out);
     }
 
     const MemScanModel::ScanHistoryEntry &MemScanModel::getScanHistory() const {
@@ -1139,16 +1068,15 @@ namespace Toolbox {
         // Reserve an estimate allocation that should be sane.
         size_t O_estimate = profile.m_search_size / 1000;
 
-        if (!model.reserveScan(profile.m_scan_type, val_a.size(), O_estimate)) {
+        Buffer mem_image;
+        if (!model.captureMemory(mem_image)) {
             return 0;
         }
 
-        if (!model.captureMemForCache()) {
+        if (!model.reserveScan(profile.m_scan_type, val_a.size(), O_estimate)) {
             return 0;
         }
 
-        const MemScanModel::ScanHistoryEntry &entry = model.getScanHistory();
-
         u32 address = begin_address;
 
         size_t match_counter = 0;
@@ -1156,10 +1084,9 @@ namespace Toolbox {
         while (address < end_address) {
             std::string mem_val;
 
-            bool is_match =
-                compareString(entry.m_scan_buffer, address, val_a, profile.m_scan_op, &mem_val);
+            bool is_match = compareString(mem_image, address, val_a, profile.m_scan_op, &mem_val);
             if (is_match) {
-                model.makeScanIndex(address);
+                model.makeScanIndex(address, mem_image);
                 match_counter += 1;
             }
 
@@ -1196,16 +1123,15 @@ namespace Toolbox {
         // Reserve an estimate allocation that should be sane.
         size_t O_estimate = profile.m_search_size / 1000;
 
-        if (!model.reserveScan(profile.m_scan_type, val_a.size(), O_estimate)) {
+        Buffer mem_image;
+        if (!model.captureMemory(mem_image)) {
             return 0;
         }
 
-        if (!model.captureMemForCache()) {
+        if (!model.reserveScan(profile.m_scan_type, val_a.size(), O_estimate)) {
             return 0;
         }
 
-        const MemScanModel::ScanHistoryEntry &entry = model.getScanHistory();
-
         u32 address = begin_address;
 
         size_t match_counter = 0;
@@ -1213,10 +1139,9 @@ namespace Toolbox {
         while (address < end_address) {
             Buffer mem_val;
 
-            bool is_match =
-                compareBytes(entry.m_scan_buffer, address, val_a, profile.m_scan_op, &mem_val);
+            bool is_match = compareBytes(mem_image, address, val_a, profile.m_scan_op, &mem_val);
             if (is_match) {
-                model.makeScanIndex(address);
+                model.makeScanIndex(address, mem_image);
                 match_counter += 1;
             }
 
@@ -1293,8 +1218,6 @@ namespace Toolbox {
             return {};
         }
 
-        u32 address = begin_address;
-
         size_t match_counter = 0;
         size_t sleep_counter = 0;
 
@@ -1302,29 +1225,22 @@ namespace Toolbox {
 
         size_t row_count = recent_scan.m_scan_results.size();
 
-        if (!model.reserveScan(profile.m_scan_type, val_a.size(), row_count)) {
+        Buffer mem_image;
+        if (!model.captureMemory(mem_image)) {
             return 0;
         }
 
-        if (!model.captureMemForCache()) {
+        if (!model.reserveScan(profile.m_scan_type, val_a.size(), row_count)) {
             return 0;
         }
 
-        const MemScanModel::ScanHistoryEntry &current_scan = model.getScanHistory();
-
-        size_t i = 0;
-        while (i < row_count) {
-            const MemScanResult &result = recent_scan.m_scan_results[i];
-            u32 address                 = result.getAddress();
-
-            MetaValue value = GetMetaValueFromMemCache(recent_scan, result);
-
+        recent_scan.m_scan_results.forEach([&](size_t row, u32 address, const u8 *value) {
             std::string mem_val;
 
-            bool is_match = compareString(current_scan.m_scan_buffer, address, val_a,
+            bool is_match = compareString(mem_image, address, val_a,
                                           profile.m_scan_op, &mem_val);
             if (is_match) {
-                model.makeScanIndex(address);
+                model.makeScanIndex(address, mem_image);
                 match_counter += 1;
             }
 
@@ -1333,10 +1249,8 @@ namespace Toolbox {
             //     std::this_thread::sleep_for(std::chrono::milliseconds(profile.m_sleep_duration));
             // }
 
-            i += 1;
-
-            setProgress((double)i / (double)row_count);
-        }
+            setProgress((double)(row + 1) / (double)row_count);
+        });
 
         return match_counter;
     }
@@ -1358,8 +1272,6 @@ namespace Toolbox {
 
         const Buffer &val_a = result.value();
 
-        u32 address = begin_address;
-
         size_t match_counter = 0;
         size_t sleep_counter = 0;
 
@@ -1367,29 +1279,22 @@ namespace Toolbox {
 
         size_t row_count = recent_scan.m_scan_results.size();
 
-        if (!model.reserveScan(profile.m_scan_type, val_a.size(), row_count)) {
+        Buffer mem_image;
+        if (!model.captureMemory(mem_image)) {
             return 0;
         }
 
-        if (!model.captureMemForCache()) {
+        if (!model.reserveScan(profile.m_scan_type, val_a.size(), row_count)) {
             return 0;
         }
 
-        const MemScanModel::ScanHistoryEntry &current_scan = model.getScanHistory();
-
-        size_t i = 0;
-        while (i < row_count) {
-            const MemScanResult &result = recent_scan.m_scan_results[i];
-            u32 address                 = result.getAddress();
-
-            MetaValue value = GetMetaValueFromMemCache(recent_scan, result);
-
+        recent_scan.m_scan_results.forEach([&](size_t row, u32 address, const u8 *value) {
             Buffer mem_val;
 
-            bool is_match = compareBytes(current_scan.m_scan_buffer, address, val_a,
+            bool is_match = compareBytes(mem_image, address, val_a,
                                          profile.m_scan_op, &mem_val);
             if (is_match) {
-                model.makeScanIndex(address);
+                model.makeScanIndex(address, mem_image);
                 match_counter += 1;
             }
 
@@ -1398,10 +1303,8 @@ namespace Toolbox {
                 std::this_thread::sleep_for(std::chrono::milliseconds(profile.m_sleep_duration));
             }
 
-            i += 1;
-
-            setProgress((double)i / (double)row_count);
-        }
+            setProgress((double)(row + 1) / (double)row_count);
+        });
 
         return match_counter;
     }
@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <iterator>
+
+#include "model/memscanresults.hpp"
+
+namespace Toolbox {
+
+    void MemScanResultSet::reserve(size_t results) {
+        m_values.reserve(results * m_value_size);
+    }
+
+    void MemScanResultSet::clear() {
+        m_runs.clear();
+        m_runs.shrink_to_fit();
+        m_values.clear();
+        m_values.shrink_to_fit();
+        m_size = 0;
+    }
+
+    bool MemScanResultSet::push_back(u32 address, const u8 *value) {
+        address |= 0x80000000;
+
+        if (!m_runs.empty()) {
+            Run &run          = m_runs.back();
+            const size_t count = m_size - run.m_first_row;
+            const u32 last     = run.m_address + static_cast<u32>(count - 1) * run.m_stride;
+            if (address <= last) {
+                return false;
+            }
+
+            // A lone address adopts whatever spacing follows it
+            if (count == 1) {
+                run.m_stride = address - last;
+            }
+
+            if (address - last != run.m_stride) {
+                m_runs.push_back({address, 1, m_size});
+            }
+        } else {
+            m_runs.push_back({address, 1, m_size});
+        }
+
+        m_values.insert(m_values.end(), value, value + m_value_size);
+        m_size += 1;
+        return true;
+    }
+
+    bool MemScanResultSet::erase(u32 address) {
+        std::optional<size_t> row = find(address);
+        if (!row) {
+            return false;
+        }
+
+        const size_t run_idx = runOfRow(row.value());
+        const Run run        = m_runs[run_idx];
+        const size_t end     = runEnd(run_idx);
+
+        // Split the run around the erased address
+        std::vector<Run> replacement;
+        if (row.value() > run.m_first_row) {
+            replacement.push_back(run);
+        }
+        if (row.value() + 1 < end) {
+            replacement.push_back({address + run.m_stride, run.m_stride, row.value()});
+        }
+
+        m_runs.erase(m_runs.begin() + run_idx);
+        m_runs.insert(m_runs.begin() + run_idx, replacement.begin(), replacement.end());
+        for (size_t i = run_idx + replacement.size(); i < m_runs.size(); ++i) {
+            m_runs[i].m_first_row -= 1;
+        }
+
+        auto value_it = m_values.begin() + row.value() * m_value_size;
+        m_values.erase(value_it, value_it + m_value_size);
+        m_size -= 1;
+        return true;
+    }
+
+    u32 MemScanResultSet::addressAt(size_t row) const {
+        if (row >= m_size) {
+            return 0;
+        }
+        const Run &run = m_runs[runOfRow(row)];
+        return run.m_address + static_cast<u32>(row - run.m_first_row) * run.m_stride;
+    }
+
+    const u8 *MemScanResultSet::valueAt(size_t row) const {
+        if (row >= m_size) {
+            return nullptr;
+        }
+        return m_values.data() + row * m_value_size;
+    }
+
+    std::optional<size_t> MemScanResultSet::find(u32 address) const {
+        address |= 0x80000000;
+
+        auto it = std::upper_bound(m_runs.begin(), m_runs.end(), address,
+                                   [](u32 address, const Run &run) { return address < run.m_address; });
+        if (it == m_runs.begin()) {
+            return std::nullopt;
+        }
+        --it;
+
+        const size_t run_idx = std::distance(m_runs.begin(), it);
+        const u32 delta      = address - it->m_address;
+        if (delta % it->m_stride != 0) {
+            return std::nullopt;
+        }
+
+        const size_t row = it->m_first_row + delta / it->m_stride;
+        if (row >= runEnd(run_idx)) {
+            return std::nullopt;
+        }
+
+        return row;
+    }
+
+    void MemScanResultSet::gatherAddresses(size_t row_begin, size_t row_end, u32 *out) const {
+        row_end = std::min(row_end, m_size);
+        if (row_begin >= row_end) {
+            return;
+        }
+
+        size_t run_idx = runOfRow(row_begin);
+        size_t row     = row_begin;
+        while (row < row_end) {
+            const Run &run     = m_runs[run_idx];
+            const size_t end   = std::min(runEnd(run_idx), row_end);
+            u32 address        = run.m_address + static_cast<u32>(row - run.m_first_row) * run.m_stride;
+            for (; row < end; ++row) {
+                *out++ = address;
+                address += run.m_stride;
+            }
+            run_idx += 1;
+        }
+    }
+
+    size_t MemScanResultSet::runOfRow(size_t row) const {
+        auto it = std::upper_bound(m_runs.begin(), m_runs.end(), row,
+                                   [](size_t row, const Run &run) { return row < run.m_first_row; });
+        return std::distance(m_runs.begin(), it) - 1;
+    }
+
+}  // namespace Toolbox
@@ -1278,8 +1278,8 @@ namespace Toolbox {
             return {};
         };
 
-        std::stringstream outstr;
-        Serializer out(outstr.rdbuf());
+        GrowableStreamBuf outbuf;
+        Serializer out(&outbuf);
 
         out.write<u32>(static_cast<u32>(pruned_indexes.size()));
 
@@ -1292,7 +1292,7 @@ namespace Toolbox {
             serialize_index(index, out);
         }
 
-        std::string_view data_view = outstr.view();
+        std::span<const char> data_view = outbuf.data();
 
         Buffer mime_data;
         mime_data.alloc(data_view.size());
@@ -1313,8 +1313,7 @@ namespace Toolbox {
 
         Buffer mime_data = data.get_data("toolbox/scene/rail_model").value();
 
-        std::stringstream instr(std::string(mime_data.buf<char>(), mime_data.size()));
-        Deserializer in(instr.rdbuf());
+        Deserializer in(std::span<const char>(mime_data.buf<char>(), mime_data.size()));
 
         std::vector<ModelIndex> inserted_indexes;
         int64_t spill_row = -1;
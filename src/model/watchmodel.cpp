@@ -690,6 +690,9 @@ namespace Toolbox {
             }
             return {};
         }
+        case WatchDataRole::WATCH_DATA_ROLE_CHANGE_TICK: {
+            return data.m_change_tick;
+        }
         default:
             return {};
         }
@@ -1393,9 +1396,32 @@ namespace Toolbox {
     void WatchDataModel::processWatches() {
         std::scoped_lock lock(m_mutex);
 
-        for (_WatchIndexData &data : m_index_map) {
-            if (!_WatchIndexDataIsGroup(data)) {
-                data.m_watch->processWatch();
+        Dolphin::DolphinHookManager &manager = Dolphin::DolphinHookManager::instance();
+
+        // Capture every watched range once for this frame before the watches read it.
+        manager.updateSnapshot();
+
+        m_plan_watches.clear();
+        m_plan_rows.clear();
+        for (size_t i = 0; i < m_index_map.size(); ++i) {
+            if (!_WatchIndexDataIsGroup(m_index_map[i])) {
+                m_plan_watches.push_back(&m_index_map[i].m_watch->getMemoryWatch());
+                m_plan_rows.push_back(i);
+            }
+        }
+
+        if (!m_watch_plan.matches(m_plan_watches)) {
+            m_watch_plan.compile(m_plan_watches);
+        }
+
+        m_watch_tick += 1;
+        if (m_watch_plan.execute(manager) == 0) {
+            return;
+        }
+
+        for (size_t slot = 0; slot < m_plan_rows.size(); ++slot) {
+            if (m_watch_plan.isChanged(slot)) {
+                m_index_map[m_plan_rows[slot]].m_change_tick = m_watch_tick;
             }
         }
     }
@@ -0,0 +1,132 @@
+#include "objlib/meta/layout.hpp"
+#include "objlib/meta/enum.hpp"
+#include "objlib/meta/member.hpp"
+#include "objlib/meta/struct.hpp"
+
+#include <bit>
+#include <format>
+#include <mutex>
+#include <unordered_map>
+
+namespace Toolbox::Object {
+
+    static u32 FixedElementGameSize(const MetaMember &member);
+
+    // Game size of every value of `member`, or VARIABLE if it can differ
+    // between instances.
+    static u32 FixedMemberGameSize(const MetaMember &member) {
+        if (!std::holds_alternative<u32>(member.arraysize_())) {
+            return MemberLayout::VARIABLE;
+        }
+        const u32 stride = FixedElementGameSize(member);
+        if (stride == MemberLayout::VARIABLE) {
+            return MemberLayout::VARIABLE;
+        }
+        return stride * member.arraysize();
+    }
+
+    static u32 FixedElementGameSize(const MetaMember &member) {
+        MetaMember::value_type default_ = member.defaultValue();
+        if (member.isTypeStruct()) {
+            RefPtr<MetaStruct> struct_ = std::get<RefPtr<MetaStruct>>(default_);
+            if (!struct_) {
+                return MemberLayout::VARIABLE;
+            }
+            u32 size = 0;
+            for (const RefPtr<MetaMember> &child : struct_->members()) {
+                const u32 child_size = FixedMemberGameSize(*child);
+                if (child_size == MemberLayout::VARIABLE) {
+                    return MemberLayout::VARIABLE;
+                }
+                size += child_size;
+            }
+            return size;
+        }
+        if (member.isTypeEnum()) {
+            RefPtr<MetaEnum> enum_ = std::get<RefPtr<MetaEnum>>(default_);
+            return enum_ ? static_cast<u32>(enum_->computeGameSize()) : MemberLayout::VARIABLE;
+        }
+        RefPtr<MetaValue> value = std::get<RefPtr<MetaValue>>(default_);
+        if (!value || value->type() == MetaType::STRING) {
+            return MemberLayout::VARIABLE;
+        }
+        return static_cast<u32>(value->computeGameSize());
+    }
+
+    static inline u32 HashSymbol(SymbolID id) { return id * 2654435761u; }
+
+    MemberLayout::MemberLayout(const std::vector<RefPtr<MetaMember>> &members) {
+        m_entries.reserve(members.size());
+
+        u32 offset = 0;
+        for (size_t i = 0; i < members.size(); ++i) {
+            const MetaMember &member = *members[i];
+
+            Entry entry;
+            entry.m_id     = member.nameID();
+            entry.m_index  = static_cast<u32>(i);
+            entry.m_offset = offset;
+            entry.m_stride = FixedElementGameSize(member);
+            m_entries.push_back(entry);
+
+            if (offset != VARIABLE) {
+                const u32 size = FixedMemberGameSize(member);
+                offset         = size == VARIABLE ? VARIABLE : offset + size;
+            }
+        }
+
+        const size_t slot_count = std::bit_ceil(std::max<size_t>(members.size() * 2, 4));
+        m_slots.assign(slot_count, 0);
+        m_slot_mask = static_cast<u32>(slot_count - 1);
+
+        for (size_t i = 0; i < m_entries.size(); ++i) {
+            u32 slot = HashSymbol(m_entries[i].m_id) & m_slot_mask;
+            while (m_slots[slot] != 0) {
+                // Keep the first of any duplicate names, like a linear search would
+                if (m_entries[m_slots[slot] - 1].m_id == m_entries[i].m_id) {
+                    break;
+                }
+                slot = (slot + 1) & m_slot_mask;
+            }
+            if (m_slots[slot] == 0) {
+                m_slots[slot] = static_cast<u32>(i + 1);
+            }
+        }
+    }
+
+    const MemberLayout::Entry *MemberLayout::find(SymbolID id) const {
+        if (id == INVALID_SYMBOL || m_slots.empty()) {
+            return nullptr;
+        }
+        u32 slot = HashSymbol(id) & m_slot_mask;
+        while (m_slots[slot] != 0) {
+            const Entry &entry = m_entries[m_slots[slot] - 1];
+            if (entry.m_id == id) {
+                return &entry;
+            }
+            slot = (slot + 1) & m_slot_mask;
+        }
+        return nullptr;
+    }
+
+    RefPtr<const MemberLayout> MemberLayout::Get(std::string_view type, std::string_view wizard,
+                                                 const std::vector<RefPtr<MetaMember>> &members) {
+        static std::mutex s_mutex;
+        static std::unordered_map<std::string, RefPtr<const MemberLayout>> s_layouts;
+
+        // Deserialization can stop short of the wizard's full member list
+        const std::string key = std::format("{}\n{}\n{}", type, wizard, members.size());
+
+        std::scoped_lock lock(s_mutex);
+
+        auto it = s_layouts.find(key);
+        if (it != s_layouts.end()) {
+            return it->second;
+        }
+
+        RefPtr<const MemberLayout> layout = make_referable<MemberLayout>(members);
+        s_layouts.emplace(key, layout);
+        return layout;
+    }
+
+}  // namespace Toolbox::Object
@@ -26,6 +26,40 @@ namespace Toolbox::Object {
                m_arraysize == other.m_arraysize && m_parent == other.m_parent;
     }
 
+    u64 MetaMember::lastEditEpoch() const {
+        u64 epoch = m_edit_stamp.epoch();
+        for (const value_type &value : m_values) {
+            if (std::holds_alternative<RefPtr<MetaValue>>(value)) {
+                epoch = std::max(epoch, std::get<RefPtr<MetaValue>>(value)->lastEditEpoch());
+            } else if (std::holds_alternative<RefPtr<MetaEnum>>(value)) {
+                epoch = std::max(epoch,
+                                 std::get<RefPtr<MetaEnum>>(value)->value()->lastEditEpoch());
+            } else {
+                for (const RefPtr<MetaMember> &member :
+                     std::get<RefPtr<MetaStruct>>(value)->members()) {
+                    epoch = std::max(epoch, member->lastEditEpoch());
+                }
+            }
+        }
+        return epoch;
+    }
+
+    void MetaMember::bindEditSink(const RefPtr<MetaEditSink> &sink) {
+        m_edit_stamp.bind(sink);
+        for (const value_type &value : m_values) {
+            if (std::holds_alternative<RefPtr<MetaValue>>(value)) {
+                std::get<RefPtr<MetaValue>>(value)->bindEditSink(sink);
+            } else if (std::holds_alternative<RefPtr<MetaEnum>>(value)) {
+                std::get<RefPtr<MetaEnum>>(value)->value()->bindEditSink(sink);
+            } else {
+                for (const RefPtr<MetaMember> &member :
+                     std::get<RefPtr<MetaStruct>>(value)->members()) {
+                    member->bindEditSink(sink);
+                }
+            }
+        }
+    }
+
     void MetaMember::updateReferenceToList(const std::vector<RefPtr<MetaMember>> &list) {
         if (!std::holds_alternative<ReferenceInfo>(m_arraysize))
             return;
@@ -120,6 +154,22 @@ namespace Toolbox::Object {
         return gameDeserialize(in);
     }
 
+    size_t MetaMember::computeGameSize() const {
+        const size_t count = std::min<size_t>(arraysize(), m_values.size());
+
+        size_t size = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (isTypeStruct()) {
+                size += std::get<RefPtr<MetaStruct>>(m_values[i])->computeGameSize();
+            } else if (isTypeEnum()) {
+                size += std::get<RefPtr<MetaEnum>>(m_values[i])->computeGameSize();
+            } else if (isTypeValue()) {
+                size += std::get<RefPtr<MetaValue>>(m_values[i])->computeGameSize();
+            }
+        }
+        return size;
+    }
+
     Result<void, SerialError> MetaMember::gameSerialize(Serializer &out) const {
         for (u32 i = 0; i < arraysize(); ++i) {
             if (isTypeStruct()) {
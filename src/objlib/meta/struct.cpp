@@ -16,48 +16,56 @@ namespace Toolbox::Object {
         }
     }
 
+    MetaStruct::GetMemberT MetaStruct::getMember(SymbolID name) const {
+        for (const MemberT &m : m_members) {
+            if (m->nameID() == name) {
+                return m;
+            }
+        }
+        return {};
+    }
+
     MetaStruct::GetMemberT MetaStruct::getMember(std::string_view name) const {
-        return getMember(QualifiedName(name));
+        if (name.find('[') != std::string_view::npos) {
+            return getMember(QualifiedName(name));
+        }
+        return getMember(FindSymbol(name));
     }
 
     MetaStruct::GetMemberT MetaStruct::getMember(const QualifiedName &name) const {
-        if (name.empty())
-            return {};
-
-        const auto name_str = name.toString();
+        return getMember(name.begin(), name.end());
+    }
 
-        if (m_member_cache.contains(name_str))
-            return m_member_cache.at(name_str);
+    MetaStruct::GetMemberT MetaStruct::getMember(QualifiedName::const_iterator begin,
+                                                 QualifiedName::const_iterator end) const {
+        if (begin == end)
+            return {};
 
-        auto current_scope = name[0];
-        auto array_result  = getArrayIndex(name, 0);
+        std::string_view current_scope = *begin;
+        auto array_result              = getArrayIndex(current_scope);
         if (!array_result) {
             return std::unexpected(array_result.error());
         }
 
-        size_t array_index = array_result.value();
-        if (array_index != std::string_view::npos) {
-            current_scope = current_scope.substr(0, current_scope.find_first_of('['));
-        } else {
-            array_index = 0;
+        const SymbolID scope_id = FindSymbol(getArrayName(current_scope));
+        if (scope_id == INVALID_SYMBOL) {
+            return {};
         }
 
-        for (auto m : m_members) {
-            if (m->name() != current_scope)
+        for (const MemberT &m : m_members) {
+            if (m->nameID() != scope_id)
                 continue;
 
-            if (name.depth() == 1) {
-                m_member_cache[name_str] = m;
+            if (std::next(begin) == end) {
                 return m;
             }
 
             if (m->isTypeStruct()) {
-                auto s      = m->value<MetaStruct>(array_index).value();
-                auto member = s->getMember(QualifiedName(name.begin() + 1, name.end()));
-                if (member.has_value()) {
-                    m_member_cache[name_str] = member.value();
+                auto s = m->value<MetaStruct>(array_result.value());
+                if (!s) {
+                    return {};
                 }
-                return member;
+                return s.value()->getMember(std::next(begin), end);
             }
         }
 
@@ -70,6 +78,14 @@ namespace Toolbox::Object {
             [](size_t value, RefPtr<MetaMember> m) { return value + m->computeSize(); });
     }
 
+    size_t MetaStruct::computeGameSize() const {
+        size_t size = 0;
+        for (const RefPtr<MetaMember> &m : m_members) {
+            size += m->computeGameSize();
+        }
+        return size;
+    }
+
     void MetaStruct::dump(std::ostream &out, size_t indention, size_t indention_width,
                           bool naked) const {
         indention_width          = std::min(indention_width, size_t(8));
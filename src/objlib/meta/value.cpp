@@ -2,12 +2,21 @@
 #include "color.hpp"
 #include "objlib/transform.hpp"
 #include "strutil.hpp"
+#include <atomic>
 #include <format>
 #include <glm/glm.hpp>
 #include <string>
 
 namespace Toolbox::Object {
 
+    static std::atomic<u64> s_meta_edit_epoch = 0;
+
+    u64 GetMetaEditEpoch() { return s_meta_edit_epoch.load(std::memory_order_relaxed); }
+
+    u64 BumpMetaEditEpoch() {
+        return s_meta_edit_epoch.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
     size_t MetaValue::computeSize() const {
         switch (m_type) {
         case MetaType::BOOL:
@@ -25,7 +34,7 @@ namespace Toolbox::Object {
         case MetaType::F64:
             return 8;
         case MetaType::STRING:
-            return strnlen(m_value_buf.buf<const char>(), m_value_buf.size());
+            return strnlen(reinterpret_cast<const char *>(m_value_buf.data()), m_value_buf.size());
         case MetaType::VEC3:
             return 12;
         case MetaType::TRANSFORM:
@@ -47,6 +56,24 @@ namespace Toolbox::Object {
         }
     }
 
+    size_t MetaValue::computeGameSize() const {
+        switch (m_type) {
+        case MetaType::STRING: {
+            // Strings are stored SJIS encoded behind a u16 length
+            auto str_result = String::toGameEncoding(get<std::string>().value());
+            if (!str_result) {
+                return sizeof(u16) + computeSize();
+            }
+            return sizeof(u16) + str_result.value().size();
+        }
+        case MetaType::MTX34:
+        case MetaType::UNKNOWN:
+            return 0;  // Not written by gameSerialize
+        default:
+            return computeSize();
+        }
+    }
+
     void MetaValue::restoreMinMax() {
         switch (m_type) {
         case MetaType::S8:
@@ -299,7 +326,7 @@ namespace Toolbox::Object {
         case MetaType::RGBA32:
             return std::format("{}", get<Color::RGBA32>().value());
         case MetaType::UNKNOWN: {
-            const uint8_t *byte_buf = buf().buf<uint8_t>();
+            const uint8_t *byte_buf = bytes().data();
             size_t byte_len      = computeSize();
 
             std::string out_str;
@@ -7,10 +7,17 @@
 #include <J3D/Material/J3DMaterialTableLoader.hpp>
 #include <J3D/Texture/J3DTextureLoader.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <bstream.h>
+#include <execution>
 #include <expected>
 #include <gui/modelcache.hpp>
 #include <include/decode.h>
+#include <numeric>
+#include <optional>
+#include <spanstream>
+#include <stack>
 #include <string>
 #include <unordered_set>
 
@@ -51,6 +58,80 @@ namespace Toolbox::Object {
         }
     }
 
+    // Nonzero while objects are parsed through the fan out loader, which may
+    // run on worker threads that must not touch the caches above.
+    static thread_local int t_defer_render_data = 0;
+
+    // ID of the SourceImage being parsed on this thread, if any, so objects
+    // read from it can record their SourceRange.
+    static thread_local u64 t_source_image_id = 0;
+
+    static std::atomic<u64> s_next_source_image_id = 1;
+
+    u64 NewSourceImageID() {
+        return s_next_source_image_id.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void RecordSourceRange(ISceneObject &object, Deserializer &in, size_t start) {
+        if (t_source_image_id == 0) {
+            return;
+        }
+        const size_t end = static_cast<size_t>(in.tell());
+        object.setSourceRange({t_source_image_id, start, end - start, GetMetaEditEpoch()});
+    }
+
+    static bool AreMembersUnchangedSince(const std::vector<RefPtr<MetaMember>> &members,
+                                         u64 epoch) {
+        return std::all_of(members.begin(), members.end(), [epoch](const RefPtr<MetaMember> &m) {
+            return m->lastEditEpoch() <= epoch;
+        });
+    }
+
+    // Objects write their size marker up front from getDataSize(). Should
+    // the bytes that follow disagree, say for a member whose computeGameSize()
+    // is off, the marker is patched to the size actually written, as the
+    // measuring writer always did, rather than failing the save. Returns true
+    // if the marker had to be patched.
+    static bool PatchSizeMarker(Serializer &out, std::streampos start, size_t claimed) {
+        const std::streampos end = out.tell();
+        if (!out.stream().good() || static_cast<size_t>(end - start) == claimed) {
+            return false;
+        }
+        out.seek(start, std::ios::beg);
+        out.write<u32, std::endian::big>(static_cast<u32>(end - start));
+        out.seek(end, std::ios::beg);
+        return true;
+    }
+
+    // Serializes `object` straight into `data`, sized from getDataSize(). If
+    // the computed size turns out wrong, the object is written again into a
+    // buffer that grows as it goes.
+    static void SerializeObjectData(const ISceneObject &object, std::vector<u8> &data) {
+        data.resize(object.getDataSize());
+        {
+            std::ospanstream ostr(
+                std::span<char>(reinterpret_cast<char *>(data.data()), data.size()));
+            Serializer out(ostr.rdbuf());
+
+            auto result = object.gameSerialize(out);
+            if (result && out.stream().good() && static_cast<size_t>(out.tell()) == data.size()) {
+                return;
+            }
+        }
+
+        GrowableStreamBuf buffer(data.size());
+        Serializer out(&buffer);
+
+        auto result = object.gameSerialize(out);
+        if (!result) {
+            data.clear();
+            return;
+        }
+
+        std::span<const char> bytes = buffer.data();
+        data.assign(bytes.begin(), bytes.end());
+    }
+
     /* INTERFACE */
 
     QualifiedName ISceneObject::getQualifiedName() const {
@@ -63,23 +144,32 @@ namespace Toolbox::Object {
     /* VIRTUAL SCENE OBJECT */
 
     std::span<u8> VirtualSceneObject::getData() const {
-        std::stringstream ostr;
-
-        // Lol
-        Serializer out(ostr.rdbuf());
-        Deserializer in(ostr.rdbuf());
+        SerializeObjectData(*this, m_data);
+        return {m_data.data(), m_data.size()};
+    }
 
-        serialize(out);
+    size_t VirtualSceneObject::getDataSize() const {
+        if (isDataSizeCached()) {
+            return m_data_size;
+        }
 
-        m_data.resize(in.size());
-        in.seek(0);
+        const RefPtr<MetaEditSink> &sink = m_edit_binding.sink(this);
 
-        in.readBytes({reinterpret_cast<char *>(&m_data[0]), m_data.size()});
+        size_t size = sizeof(u32) + NameRef(m_type).computeSize() + m_nameref.computeSize();
+        for (auto &member : m_members) {
+            member->bindEditSink(sink);
+            size += member->computeGameSize();
+        }
 
-        return {m_data.data(), m_data.size()};
+        return cacheDataSize(size);
     }
 
-    size_t VirtualSceneObject::getDataSize() const { return getData().size(); }
+    bool VirtualSceneObject::isUnchangedSinceRead() const {
+        if (!m_source.isValid() || m_source_dirty) {
+            return false;
+        }
+        return AreMembersUnchangedSince(m_members, m_source.m_epoch);
+    }
 
     bool VirtualSceneObject::hasMember(const QualifiedName &name) const {
         return getMember(name).has_value();
@@ -89,47 +179,84 @@ namespace Toolbox::Object {
         if (name.empty())
             return {};
 
-        const auto name_str = name.toString();
-
-        if (m_member_cache.contains(name_str))
-            return m_member_cache.at(name_str);
-
-        auto current_scope = name[0];
-        auto array_index   = getArrayIndex(name, 0);
+        std::string_view current_scope = name[0];
+        auto array_index               = getArrayIndex(name, 0);
         if (!array_index) {
             return std::unexpected(array_index.error());
         }
 
-        for (auto m : m_members) {
-            if (m->name() != current_scope)
-                continue;
+        auto member = getMember(FindSymbol(getArrayName(current_scope)));
+        if (!member || !member.value()) {
+            return member;
+        }
 
-            if (name.depth() == 1) {
-                m_member_cache[name_str] = m;
-                return m;
+        if (name.depth() == 1) {
+            return member;
+        }
+
+        if (member.value()->isTypeStruct()) {
+            auto s = member.value()->value<MetaStruct>(*array_index);
+            if (!s) {
+                return {};
             }
+            return s.value()->getMember(name.begin() + 1, name.end());
+        }
+
+        return {};
+    }
 
-            if (m->isTypeStruct()) {
-                auto s      = m->value<MetaStruct>(*array_index).value();
-                auto member = s->getMember(QualifiedName(name.begin() + 1, name.end()));
-                if (member.has_value()) {
-                    m_member_cache[name_str] = member.value();
+    MetaStruct::GetMemberT VirtualSceneObject::getMember(SymbolID name) const {
+        const MemberLayout::Entry *entry = memberLayout().find(name);
+        if (!entry) {
+            return {};
+        }
+        return m_members[entry->m_index];
+    }
+
+    const MemberLayout &VirtualSceneObject::memberLayout() const {
+        if (!m_member_layout || m_member_layout->size() != m_members.size()) {
+            m_member_layout = MemberLayout::Get(m_type, m_wizard, m_members);
+
+            const std::vector<MemberLayout::Entry> &entries = m_member_layout->entries();
+            for (size_t i = 0; i < m_members.size(); ++i) {
+                if (entries[i].m_id != m_members[i]->nameID()) {
+                    m_member_layout = make_referable<MemberLayout>(m_members);
+                    break;
                 }
-                return member;
             }
         }
+        return *m_member_layout;
+    }
 
-        return {};
+    size_t VirtualSceneObject::getMemberDataOffset() const {
+        return sizeof(u32) + NameRef(m_type).computeSize() + m_nameref.computeSize();
     }
 
     size_t VirtualSceneObject::getMemberOffset(const QualifiedName &name, int index) const {
-        size_t offset = 0;
-        return offset;
+        if (name.depth() != 1 || index < 0) {
+            return 0;
+        }
+
+        const MemberLayout::Entry *entry = memberLayout().find(FindSymbol(getArrayName(name[0])));
+        if (!entry || entry->m_offset == MemberLayout::VARIABLE ||
+            entry->m_stride == MemberLayout::VARIABLE) {
+            return 0;
+        }
+
+        return getMemberDataOffset() + entry->m_offset + entry->m_stride * static_cast<size_t>(index);
     }
 
     size_t VirtualSceneObject::getMemberSize(const QualifiedName &name, int index) const {
-        size_t size = 0;
-        return size;
+        if (name.depth() != 1 || index < 0) {
+            return 0;
+        }
+
+        const MemberLayout::Entry *entry = memberLayout().find(FindSymbol(getArrayName(name[0])));
+        if (!entry || entry->m_stride == MemberLayout::VARIABLE) {
+            return 0;
+        }
+
+        return entry->m_stride;
     }
 
     Result<void, BaseError> VirtualSceneObject::loadDependencies(const fs_path &dependencies_path) {
@@ -164,6 +291,7 @@ namespace Toolbox::Object {
             new_member->updateReferenceToList(m_members);
             m_members.emplace_back(new_member);
         }
+        invalidateDataSize();
     }
 
     Result<void, SerialError> VirtualSceneObject::serialize(Serializer &out) const {
@@ -177,10 +305,9 @@ namespace Toolbox::Object {
     Result<void, SerialError> VirtualSceneObject::gameSerialize(Serializer &out) const {
         std::streampos start = out.tell();
 
-        out.pushBreakpoint();
+        const size_t obj_size = getDataSize();
         {
-            // Write the size marker for now
-            out.write<u32>(0);
+            out.write<u32, std::endian::big>(static_cast<u32>(obj_size));
 
             NameRef type_ref(m_type);
             type_ref.serialize(out);
@@ -195,13 +322,9 @@ namespace Toolbox::Object {
             }
         }
 
-        u32 obj_size = static_cast<u32>(out.size() - start);
-
-        out.popBreakpoint();
-
-        // Write the size marker
-        out.write<u32, std::endian::big>(obj_size);
-        out.seek(0, std::ios::end);
+        if (PatchSizeMarker(out, start, obj_size)) {
+            m_data_size_dirty = true;
+        }
         return {};
     }
 
@@ -228,7 +351,7 @@ namespace Toolbox::Object {
             }
         }
 
-        m_type = type.name();
+        setTypeName(type.name());
         setNameRef(name);
 
         const char *debug_name = name.name().data();
@@ -286,30 +409,38 @@ namespace Toolbox::Object {
         }
 
         in.seek(endpos, std::ios::beg);
+        invalidateDataSize();
         return {};
     }
 
     /* GROUP SCENE OBJECT */
 
     std::span<u8> GroupSceneObject::getData() const {
-        std::stringstream ostr;
-
-        // Lol
-        Serializer out(ostr.rdbuf());
-        Deserializer in(ostr.rdbuf());
+        SerializeObjectData(*this, m_data);
+        return {m_data.data(), m_data.size()};
+    }
 
-        serialize(out);
+    size_t GroupSceneObject::getDataSize() const {
+        if (isDataSizeCached()) {
+            return m_data_size;
+        }
 
-        m_data.resize(in.size());
-        in.seek(0);
+        const RefPtr<MetaEditSink> &sink = m_edit_binding.sink(this);
 
-        in.readBytes({reinterpret_cast<char *>(&m_data[0]), m_data.size()});
+        size_t size = sizeof(u32) + NameRef(m_type).computeSize() + m_nameref.computeSize();
+        m_group_size->bindEditSink(sink);
+        size += m_group_size->computeGameSize();
+        for (auto &member : m_members) {
+            member->bindEditSink(sink);
+            size += member->computeGameSize();
+        }
+        for (auto &child : m_children) {
+            size += child->getDataSize();
+        }
 
-        return {m_data.data(), m_data.size()};
+        return cacheDataSize(size);
     }
 
-    size_t GroupSceneObject::getDataSize() const { return getData().size(); }
-
     Result<void, ObjectGroupError> GroupSceneObject::addChild(RefPtr<ISceneObject> child) {
         return insertChild(m_children.size(), std::move(child));
     }
@@ -505,10 +636,9 @@ namespace Toolbox::Object {
 
         std::streampos start = out.tell();
 
-        out.pushBreakpoint();
+        const size_t obj_size = getDataSize();
         {
-            // Write the size marker for now
-            out.write<u32>(0);
+            out.write<u32, std::endian::big>(static_cast<u32>(obj_size));
 
             NameRef type_ref(m_type);
             type_ref.serialize(out);
@@ -546,13 +676,9 @@ namespace Toolbox::Object {
             }
         }
 
-        u32 obj_size = static_cast<u32>(out.size() - start);
-
-        out.popBreakpoint();
-
-        // Write the size marker
-        out.write<u32, std::endian::big>(obj_size);
-        out.seek(0, std::ios::end);
+        if (PatchSizeMarker(out, start, obj_size)) {
+            m_data_size_dirty = true;
+        }
         return {};
     }
 
@@ -581,7 +707,7 @@ namespace Toolbox::Object {
             }
         }
 
-        m_type = obj_type.name();
+        setTypeName(obj_type.name());
         setNameRef(obj_name);
 
         auto template_result = TemplateFactory::create(m_type, m_include_custom);
@@ -665,64 +791,165 @@ namespace Toolbox::Object {
         }
 
         in.seek(endpos, std::ios::beg);
+        invalidateDataSize();
         return {};
     }
 
     Result<void, SerialError> GroupSceneObject::gameSerialize(Serializer &out) const {
         std::streampos start = out.tell();
 
-        out.pushBreakpoint();
+        const size_t obj_size = getDataSize();
         {
-            // Write the size marker for now
-            out.write<u32>(0);
-
-            NameRef type_ref(m_type);
-            type_ref.serialize(out);
+            out.write<u32, std::endian::big>(static_cast<u32>(obj_size));
 
-            m_nameref.serialize(out);
-
-            // Members
-            bool late_group_size = (type_ref.code() == 15406 || type_ref.code() == 9858);
-            if (!late_group_size) {
-                auto result = m_group_size->gameSerialize(out);
-                if (!result) {
-                    return result;
-                }
+            auto result = gameSerializeHeader(out);
+            if (!result) {
+                return result;
             }
 
-            for (auto &member : m_members) {
-                auto result = member->gameSerialize(out);
+            for (auto &child : m_children) {
+                auto result = child->gameSerialize(out);
                 if (!result) {
                     return std::unexpected(result.error());
                 }
             }
+        }
 
-            if (late_group_size) {
-                auto result = m_group_size->gameSerialize(out);
-                if (!result) {
-                    return std::unexpected(result.error());
-                }
+        if (PatchSizeMarker(out, start, obj_size)) {
+            m_data_size_dirty = true;
+        }
+        return {};
+    }
+
+    Result<void, SerialError> GroupSceneObject::gameSerializeHeader(Serializer &out) const {
+        NameRef type_ref(m_type);
+        type_ref.serialize(out);
+
+        m_nameref.serialize(out);
+
+        // Members
+        bool late_group_size = (type_ref.code() == 15406 || type_ref.code() == 9858);
+        if (!late_group_size) {
+            auto result = m_group_size->gameSerialize(out);
+            if (!result) {
+                return result;
             }
+        }
 
-            for (auto &child : m_children) {
-                auto result = child->gameSerialize(out);
+        for (auto &member : m_members) {
+            auto result = member->gameSerialize(out);
+            if (!result) {
+                return std::unexpected(result.error());
+            }
+        }
+
+        if (late_group_size) {
+            auto result = m_group_size->gameSerialize(out);
+            if (!result) {
+                return std::unexpected(result.error());
+            }
+        }
+
+        return {};
+    }
+
+    // Only subtrees that are unchanged, and whose bytes are still where
+    // they were read from, may be copied.
+    static bool CanSpliceFrom(const ISceneObject &object, const SourceImage &source) {
+        const SourceRange &range = object.getSourceRange();
+        return range.m_image_id == source.m_id && range.m_offset <= source.m_data.size() &&
+               range.m_size <= source.m_data.size() - range.m_offset &&
+               object.isUnchangedSinceRead();
+    }
+
+    // Moves the ranges of a copied subtree to where the copy now lies.
+    static void RebaseSplicedRanges(
+        ISceneObject &object, const SourceImage &source, ptrdiff_t delta, u64 written_id,
+        u64 epoch, std::vector<std::pair<ISceneObject *, SourceRange>> &written_ranges) {
+        const SourceRange &range = object.getSourceRange();
+        if (range.m_image_id == source.m_id) {
+            written_ranges.emplace_back(
+                &object, SourceRange{written_id, static_cast<size_t>(range.m_offset + delta),
+                                     range.m_size, epoch});
+        }
+        for (const RefPtr<ISceneObject> &child : object.getChildren()) {
+            RebaseSplicedRanges(*child, source, delta, written_id, epoch, written_ranges);
+        }
+    }
+
+    Result<void, SerialError> GroupSceneObject::gameSerializeSpliced(
+        Serializer &out, const SourceImage &source,
+        std::vector<std::pair<ISceneObject *, SourceRange>> &written_ranges, u64 written_id) {
+        const u64 epoch    = GetMetaEditEpoch();
+        const size_t start = static_cast<size_t>(out.tell());
+
+        // Children spliced from the source may not match what getDataSize()
+        // would compute for them, so the size marker is patched afterwards.
+        out.write<u32, std::endian::big>(0);
+
+        auto result = gameSerializeHeader(out);
+        if (!result) {
+            return result;
+        }
+
+        for (const RefPtr<ISceneObject> &child : m_children) {
+            const size_t child_start = static_cast<size_t>(out.tell());
+
+            if (CanSpliceFrom(*child, source)) {
+                const SourceRange &range = child->getSourceRange();
+                out.writeBytes(source.m_data.subspan(range.m_offset, range.m_size));
+                RebaseSplicedRanges(*child, source,
+                                    static_cast<ptrdiff_t>(child_start) -
+                                        static_cast<ptrdiff_t>(range.m_offset),
+                                    written_id, epoch, written_ranges);
+                continue;
+            }
+
+            if (child->isGroupObject()) {
+                result = static_cast<GroupSceneObject &>(*child).gameSerializeSpliced(
+                    out, source, written_ranges, written_id);
                 if (!result) {
-                    return std::unexpected(result.error());
+                    return result;
                 }
+                continue;
             }
-        }
 
-        u32 obj_size = static_cast<u32>(out.size() - start);
+            result = child->gameSerialize(out);
+            if (!result) {
+                return result;
+            }
+            written_ranges.emplace_back(
+                child.get(), SourceRange{written_id, child_start,
+                                         static_cast<size_t>(out.tell()) - child_start, epoch});
+        }
 
-        out.popBreakpoint();
+        const size_t end = static_cast<size_t>(out.tell());
+        out.seek(start, std::ios::beg);
+        out.write<u32, std::endian::big>(static_cast<u32>(end - start));
+        out.seek(end, std::ios::beg);
 
-        // Write the size marker
-        out.write<u32, std::endian::big>(obj_size);
-        out.seek(0, std::ios::end);
+        written_ranges.emplace_back(this, SourceRange{written_id, start, end - start, epoch});
         return {};
     }
 
+    bool GroupSceneObject::isUnchangedSinceRead() const {
+        if (!VirtualSceneObject::isUnchangedSinceRead() ||
+            m_group_size->lastEditEpoch() > m_source.m_epoch) {
+            return false;
+        }
+        return std::all_of(m_children.begin(), m_children.end(),
+                           [](const RefPtr<ISceneObject> &child) {
+                               return child->isUnchangedSinceRead();
+                           });
+    }
+
     Result<void, SerialError> GroupSceneObject::gameDeserialize(Deserializer &in) {
+        return gameDeserializeFanOut(in, {}, 0);
+    }
+
+    Result<void, SerialError> GroupSceneObject::gameDeserializeFanOut(Deserializer &in,
+                                                                      const SourceImage &image,
+                                                                      size_t fan_out_depth) {
         // Metadata
         auto length           = in.read<u32, std::endian::big>();
         std::streampos endpos = static_cast<std::size_t>(in.tell()) + length - 4;
@@ -745,7 +972,7 @@ namespace Toolbox::Object {
             }
         }
 
-        m_type = obj_type.name();
+        setTypeName(obj_type.name());
         setNameRef(obj_name);
 
         auto template_result = TemplateFactory::create(m_type, m_include_custom);
@@ -812,23 +1039,72 @@ namespace Toolbox::Object {
         size_t num_children = getGroupSize();
 
         // Children
-        for (size_t i = 0; i < num_children; ++i) {
-            if (in.tell() >= endpos) {
-                return make_serial_error<void>(
-                    in,
-                    std::format(
-                        "Unexpected end of file. {} ({}) expected {} children but only found {}",
-                        m_type, m_nameref.name(), num_children, i + 1));
+        if (fan_out_depth == 0 || image.m_data.empty()) {
+            for (size_t i = 0; i < num_children; ++i) {
+                if (in.tell() >= endpos) {
+                    return make_serial_error<void>(
+                        in, std::format("Unexpected end of file. {} ({}) expected {} children but "
+                                        "only found {}",
+                                        m_type, m_nameref.name(), num_children, i + 1));
+                }
+                ObjectFactory::create_t result =
+                    ObjectFactory::create(ObjectFactory::game_io_tag{}, in, m_include_custom);
+                if (!result) {
+                    return std::unexpected(result.error());
+                }
+                addChild(std::move(result.value()));
             }
-            ObjectFactory::create_t result =
-                ObjectFactory::create(ObjectFactory::game_io_tag{}, in, m_include_custom);
-            if (!result) {
-                return std::unexpected(result.error());
+        } else {
+            // Every object leads with its byte length, so the children can be
+            // split up front without parsing them.
+            const std::string file_path(in.filepath());
+            const bool include_custom = m_include_custom;
+
+            std::vector<size_t> child_positions;
+            child_positions.reserve(num_children);
+            for (size_t i = 0; i < num_children; ++i) {
+                const size_t child_pos = static_cast<size_t>(in.tell());
+                if (in.tell() >= endpos) {
+                    return make_serial_error<void>(
+                        in, std::format("Unexpected end of file. {} ({}) expected {} children but "
+                                        "only found {}",
+                                        m_type, m_nameref.name(), num_children, i + 1));
+                }
+
+                const u32 child_len = in.read<u32, std::endian::big>();
+                if (child_len < 4 || child_pos + child_len > static_cast<size_t>(endpos)) {
+                    return make_serial_error<void>(
+                        in, std::format("{} ({}) has a child of {} bytes that overruns the group",
+                                        m_type, m_nameref.name(), child_len),
+                        -4);
+                }
+                in.seek(child_pos + child_len, std::ios::beg);
+                child_positions.push_back(child_pos);
+            }
+
+            // The parallel algorithms share the runtime's fixed worker pool,
+            // so a large group, and the groups nested in it, never take more
+            // threads than the machine has, however many children there are.
+            std::vector<ObjectFactory::create_t> children(num_children);
+            std::vector<size_t> child_indices(num_children);
+            std::iota(child_indices.begin(), child_indices.end(), 0);
+            std::for_each(std::execution::par, child_indices.begin(), child_indices.end(),
+                          [&](size_t i) {
+                              children[i] = ObjectFactory::create(
+                                  ObjectFactory::game_io_tag{}, image, child_positions[i],
+                                  file_path, include_custom, fan_out_depth - 1);
+                          });
+
+            for (ObjectFactory::create_t &result : children) {
+                if (!result) {
+                    return std::unexpected(std::move(result.error()));
+                }
+                addChild(std::move(result.value()));
             }
-            addChild(std::move(result.value()));
         }
 
         in.seek(endpos, std::ios::beg);
+        invalidateDataSize();
         return {};
     }
 
@@ -848,36 +1124,69 @@ namespace Toolbox::Object {
         group_size.value()->set(static_cast<u32>(size));
     }
 
-    void GroupSceneObject::updateGroupSize() { setGroupSize(m_children.size()); }
+    size_t GroupSceneObject::getMemberDataOffset() const {
+        size_t offset = VirtualSceneObject::getMemberDataOffset();
+
+        NameRef type_ref(m_type);
+        bool late_group_size = (type_ref.code() == 15406 || type_ref.code() == 9858);
+        if (!late_group_size) {
+            offset += m_group_size->computeGameSize();
+        }
+
+        return offset;
+    }
+
+    void GroupSceneObject::updateGroupSize() {
+        setGroupSize(m_children.size());
+        invalidateDataSize();
+    }
 
     /* PHYSICAL SCENE OBJECT */
 
     PhysicalSceneObject::~PhysicalSceneObject() {
         m_data.clear();
         m_members.clear();
-        m_member_cache.clear();
+        m_member_layout.reset();
         m_model_data.reset();
         m_render_controller.reset();
     }
 
     std::span<u8> PhysicalSceneObject::getData() const {
-        std::stringstream ostr;
+        SerializeObjectData(*this, m_data);
+        return {m_data.data(), m_data.size()};
+    }
 
-        // Lol
-        Serializer out(ostr.rdbuf());
-        Deserializer in(ostr.rdbuf());
+    size_t PhysicalSceneObject::getDataSize() const {
+        if (isDataSizeCached()) {
+            return m_data_size;
+        }
 
-        serialize(out);
+        const RefPtr<MetaEditSink> &sink = m_edit_binding.sink(this);
 
-        m_data.resize(in.size());
-        in.seek(0, std::ios::beg);
+        size_t size = sizeof(u32) + m_type.computeSize() + m_nameref.computeSize();
 
-        in.readBytes({reinterpret_cast<char *>(&m_data[0]), m_data.size()});
+        static const SymbolID s_map_obj_base_id = InternSymbol("MapObjBase");
+        bool is_map_obj_base                    = m_type == s_map_obj_base_id;
 
-        return {m_data.data(), m_data.size()};
+        for (auto &member : m_members) {
+            member->bindEditSink(sink);
+            if (is_map_obj_base) {
+                if (member->name() == "PoleLength" && getMetaValue<f32>(member, 0) == 0.0f) {
+                    continue;
+                }
+            }
+            size += member->computeGameSize();
+        }
+
+        return cacheDataSize(size);
     }
 
-    size_t PhysicalSceneObject::getDataSize() const { return getData().size(); }
+    bool PhysicalSceneObject::isUnchangedSinceRead() const {
+        if (!m_source.isValid() || m_source_dirty) {
+            return false;
+        }
+        return AreMembersUnchangedSince(m_members, m_source.m_epoch);
+    }
 
     bool PhysicalSceneObject::hasMember(const QualifiedName &name) const {
         auto member = getMember(name);
@@ -888,49 +1197,100 @@ namespace Toolbox::Object {
         if (name.empty())
             return make_meta_error<MetaStruct::MemberT>(name, 0, "Empty name for getMember");
 
-        const auto name_str = name.toString();
-
-        if (m_member_cache.contains(name_str))
-            return m_member_cache.at(name_str);
-
         std::string_view current_scope = name[0];
         auto array_index               = getArrayIndex(name, 0);
         if (!array_index) {
             return std::unexpected(array_index.error());
         }
 
-        std::string_view member_name = getArrayName(current_scope);
+        const MemberLayout::Entry *entry =
+            memberLayout().find(FindSymbol(getArrayName(current_scope)));
+        if (!entry) {
+            return make_meta_error<MetaStruct::MemberT>(name, 0, "Failed to find member");
+        }
 
-        for (RefPtr<MetaMember> member : m_members) {
-            if (member->name() != member_name)
-                continue;
+        RefPtr<MetaMember> member = m_members[entry->m_index];
+        if (name.depth() == 1) {
+            return member;
+        }
 
-            if (name.depth() == 1) {
-                m_member_cache[name_str] = member;
-                return member;
+        if (member->isTypeStruct()) {
+            auto struct_ = member->value<MetaStruct>(*array_index);
+            if (!struct_) {
+                return make_meta_error<MetaStruct::MemberT>(name, 0, "Failed to find member");
             }
+            return struct_.value()->getMember(name.begin() + 1, name.end());
+        }
+
+        return make_meta_error<MetaStruct::MemberT>(name, 0, "Failed to find member");
+    }
+
+    MetaStruct::GetMemberT PhysicalSceneObject::getMember(SymbolID name) const {
+        const MemberLayout::Entry *entry = memberLayout().find(name);
+        if (!entry) {
+            return make_meta_error<MetaStruct::MemberT>(QualifiedName(GetSymbolName(name)), 0,
+                                                        "Failed to find member");
+        }
+        return m_members[entry->m_index];
+    }
+
+    const MemberLayout &PhysicalSceneObject::memberLayout() const {
+        if (!m_member_layout || m_member_layout->size() != m_members.size()) {
+            m_member_layout = MemberLayout::Get(m_type.name(), m_wizard, m_members);
 
-            if (member->isTypeStruct()) {
-                RefPtr<MetaStruct> struct_ = member->value<MetaStruct>(*array_index).value();
-                auto member = struct_->getMember(QualifiedName(name.begin() + 1, name.end()));
-                if (member.has_value()) {
-                    m_member_cache[name_str] = member.value();
+            const std::vector<MemberLayout::Entry> &entries = m_member_layout->entries();
+            for (size_t i = 0; i < m_members.size(); ++i) {
+                if (entries[i].m_id != m_members[i]->nameID()) {
+                    m_member_layout = make_referable<MemberLayout>(m_members);
+                    break;
                 }
-                return member;
             }
         }
-
-        return make_meta_error<MetaStruct::MemberT>(name, 0, "Failed to find member");
+        return *m_member_layout;
     }
 
     size_t PhysicalSceneObject::getMemberOffset(const QualifiedName &name, int index) const {
-        size_t offset = 0;
-        return offset;
+        if (name.depth() != 1 || index < 0) {
+            return 0;
+        }
+
+        const MemberLayout &layout       = memberLayout();
+        const MemberLayout::Entry *entry = layout.find(FindSymbol(getArrayName(name[0])));
+        if (!entry || entry->m_offset == MemberLayout::VARIABLE ||
+            entry->m_stride == MemberLayout::VARIABLE) {
+            return 0;
+        }
+
+        size_t offset = entry->m_offset;
+
+        // gameSerialize leaves out a zero PoleLength
+        static const SymbolID s_map_obj_base_id = InternSymbol("MapObjBase");
+        if (m_type == s_map_obj_base_id) {
+            static const SymbolID s_pole_length_id = InternSymbol("PoleLength");
+
+            const MemberLayout::Entry *pole = layout.find(s_pole_length_id);
+            if (pole && pole->m_index < entry->m_index &&
+                getMetaValue<f32>(m_members[pole->m_index], 0) == 0.0f) {
+                offset -= pole->m_stride;
+            }
+        }
+
+        const size_t data_offset =
+            sizeof(u32) + m_type.computeSize() + m_nameref.computeSize();
+        return data_offset + offset + entry->m_stride * static_cast<size_t>(index);
     }
 
     size_t PhysicalSceneObject::getMemberSize(const QualifiedName &name, int index) const {
-        size_t size = 0;
-        return size;
+        if (name.depth() != 1 || index < 0) {
+            return 0;
+        }
+
+        const MemberLayout::Entry *entry = memberLayout().find(FindSymbol(getArrayName(name[0])));
+        if (!entry || entry->m_stride == MemberLayout::VARIABLE) {
+            return 0;
+        }
+
+        return entry->m_stride;
     }
 
     Result<void, BaseError>
@@ -964,17 +1324,24 @@ namespace Toolbox::Object {
             return {};
         }
 
-        if (m_type == "Light") {
-            auto position_value_ptr  = getMember("Position").value();
+        static const SymbolID s_light_id     = InternSymbol("Light");
+        static const SymbolID s_sun_model_id = InternSymbol("SunModel");
+
+        if (m_type == s_light_id) {
+            static const SymbolID s_position_id  = InternSymbol("Position");
+            static const SymbolID s_color_id     = InternSymbol("Color");
+            static const SymbolID s_intensity_id = InternSymbol("Unknown1");
+
+            auto position_value_ptr  = getMember(s_position_id).value();
             glm::vec3 position_value = getMetaValue<glm::vec3>(position_value_ptr).value();
 
-            auto color_value_ptr     = getMember("Color").value();
+            auto color_value_ptr     = getMember(s_color_id).value();
             Color::RGBA8 color_value = getMetaValue<Color::RGBA8>(color_value_ptr).value();
 
             f32 r, g, b, a;
             color_value.getColor(r, g, b, a);
 
-            auto intensity_value_ptr = getMember("Unknown1").value();  // Intensity (?)
+            auto intensity_value_ptr = getMember(s_intensity_id).value();  // Intensity (?)
             f32 intensity_value      = getMetaValue<f32>(intensity_value_ptr).value();
 
             J3DLight light  = DEFAULT_LIGHT;
@@ -985,6 +1352,10 @@ namespace Toolbox::Object {
             scene_lights.push_back(light);
         }
 
+        if (m_pending_model.ready()) {
+            loadRenderData(m_scene_resource_path, getResourceCache());
+        }
+
         RefPtr<J3DModelInstance> selected_model = m_render_controller->getRenderModel();
         if (!selected_model) {
             return {};
@@ -1000,7 +1371,7 @@ namespace Toolbox::Object {
             render_transform = m_transform.value();
         }
 
-        if (m_type == "SunModel") {
+        if (m_type == s_sun_model_id) {
             selected_model->SetScale({1, 1, 1});
         }
 
@@ -1040,14 +1411,21 @@ namespace Toolbox::Object {
                     }
                 }
                 m_members = std::move(filtered_members);
+                invalidateDataSize();
             }
         }
 
-        auto transform_value_ptr = getMember("Transform").value_or(nullptr);
+        static const SymbolID s_transform_id = InternSymbol("Transform");
+
+        auto transform_value_ptr = getMember(s_transform_id).value_or(nullptr);
         if (transform_value_ptr) {
             m_transform = getMetaValue<Transform>(transform_value_ptr).value();
         }
 
+        if (t_defer_render_data > 0) {
+            return;
+        }
+
         std::filesystem::path asset_path = m_scene_resource_path;
         auto load_result                 = loadRenderData(asset_path, getResourceCache());
         if (!load_result) {
@@ -1077,6 +1455,7 @@ namespace Toolbox::Object {
             new_member->updateReferenceToList(m_members);
             m_members.emplace_back(new_member);
         }
+        invalidateDataSize();
     }
 
     bool PhysicalSceneObject::reassignWizardBasedOnFields() {
@@ -1153,7 +1532,6 @@ namespace Toolbox::Object {
 
         J3DModelLoader bmdLoader;
         J3DMaterialTableLoader bmtLoader;
-        J3DTextureLoader btiLoader;
 
         RefPtr<J3DModelData> model_data;
         RefPtr<J3DMaterialTable> mat_table;
@@ -1169,7 +1547,10 @@ namespace Toolbox::Object {
                                         .parent_path();  // files/data/scene/X/scene -> files/
 
         // Special Better Sunshine Engine object that has dynamic render paths
-        if (type() == "GenericRailObj") {
+        static const SymbolID s_generic_rail_obj_id = InternSymbol("GenericRailObj");
+        static const SymbolID s_sky_id              = InternSymbol("Sky");
+
+        if (m_type == s_generic_rail_obj_id) {
             auto model_member_result = getMember("Model");
             if (model_member_result.value_or(nullptr)) {
                 const std::string model_field =
@@ -1213,27 +1594,29 @@ namespace Toolbox::Object {
             return {};
         }
 
-        //static const std::unordered_set<std::string> optimization_blacklist = {
-        //    // Helpers in loadRenderData
-        //    "nozzlebox",
-        //    "NozzleBox",  // Included both just in case m_type differs from model_name
-        //    "Sky",        // Modifies SortBias and Material table dynamically
+        // These objects recolor their materials or edit their model after
+        // loading, so they must not share parsed data with other objects.
+        static const std::unordered_set<std::string> s_private_data_types = {
+            // Helpers in loadRenderData
+            "nozzlebox",
+            "NozzleBox",  // Included both just in case m_type differs from model_name
+            "Sky",        // Modifies SortBias and Material table dynamically
 
-        //    // Helpers in bareRefreshRenderState_
-        //    "HideObjPictureTwin", "WaterHitPictureHideObj", "WoodBlock",
+            // Helpers in bareRefreshRenderState_
+            "HideObjPictureTwin", "WaterHitPictureHideObj", "WoodBlock",
 
-        //    // NPCs - Toads
-        //    "NPCKinojii", "NPCKinopio",
+            // NPCs - Toads
+            "NPCKinojii", "NPCKinopio",
 
-        //    // NPCs - Nokis (Mares)
-        //    "NPCMareM", "NPCMareMA", "NPCMareMB", "NPCMareMC",
+            // NPCs - Nokis (Mares)
+            "NPCMareM", "NPCMareMA", "NPCMareMB", "NPCMareMC",
 
-        //    // NPCs - Piantas (Montes)
-        //    "NPCMonteM", "NPCMonteMA", "NPCMonteMB", "NPCMonteMC", "NPCMonteMD", "NPCMonteME",
-        //    "NPCMonteMF", "NPCMonteMG", "NPCMonteMH", "NPCMonteW", "NPCMonteWA", "NPCMonteWB",
-        //    "NPCMonteWC",
+            // NPCs - Piantas (Montes)
+            "NPCMonteM", "NPCMonteMA", "NPCMonteMB", "NPCMonteMC", "NPCMonteMD", "NPCMonteME",
+            "NPCMonteMF", "NPCMonteMG", "NPCMonteMH", "NPCMonteW", "NPCMonteWA", "NPCMonteWB",
+            "NPCMonteWC",
 
-        //    "Woodbox"};
+            "Woodbox"};
 
         if (RefPtr<ObjectRenderController> controller = GetControllerFromParameters(m_UUID64)) {
             m_render_controller = controller;
@@ -1251,7 +1634,11 @@ namespace Toolbox::Object {
         std::string model_name = model_path.stem().string();
         std::transform(model_name.begin(), model_name.end(), model_name.begin(), ::tolower);
 
-        if (resource_cache.m_model.count(model_name) == 0) {
+        const bool is_private_data = s_private_data_types.contains(m_type.name()) ||
+                                     s_private_data_types.contains(model_name) ||
+                                     !render_info->m_texture_swap_map.empty();
+
+        if (is_private_data) {
             auto model_path_exists_res = Toolbox::Filesystem::is_regular_file(model_path);
             if (!model_path_exists_res || !model_path_exists_res.value()) {
                 return {};
@@ -1261,9 +1648,20 @@ namespace Toolbox::Object {
                                               bStream::OpenMode::In);
 
             model_data = bmdLoader.Load(&model_stream, 0);
-            // resource_cache.m_model.insert({model_name, *model_data});
         } else {
-            model_data = make_referable<J3DModelData>(resource_cache.m_model[model_name]);
+            // Shared models are read in on the cache's workers. Until one is
+            // ready the object keeps its empty controller as a placeholder.
+            m_pending_model = resource_cache.requestModel(model_path);
+            if (!m_pending_model.ready()) {
+                return {};
+            }
+
+            model_data      = resource_cache.loadModel(m_pending_model);
+            m_pending_model = {};
+
+            if (!model_data) {
+                return {};
+            }
         }
 
         m_model_data = model_data;
@@ -1283,8 +1681,9 @@ namespace Toolbox::Object {
         std::string mat_name = mat_path.stem().string();
         std::transform(mat_name.begin(), mat_name.end(), mat_name.begin(), ::tolower);
 
-        auto mat_path_exists_res = Toolbox::Filesystem::is_regular_file(mat_path);
-        if (mat_path_exists_res.value_or(false)) {
+        if (!is_private_data) {
+            mat_table = resource_cache.loadMaterialTable(mat_path, model_data);
+        } else if (Toolbox::Filesystem::is_regular_file(mat_path).value_or(false)) {
             bStream::CFileStream mat_stream(mat_path.string(), bStream::Endianess::Big,
                                             bStream::OpenMode::In);
 
@@ -1330,7 +1729,7 @@ namespace Toolbox::Object {
             render_model->SetUseInstanceMaterialTable(true);
         }
 
-        if (type() == "Sky") {
+        if (m_type == s_sky_id) {
             // Force render behind everything
             render_model->SetSortBias(255);
             render_model->SetInstanceMaterialTable(mat_table);
@@ -1343,11 +1742,9 @@ namespace Toolbox::Object {
             std::string tex_name_lower = tex_name;
             std::transform(tex_name_lower.begin(), tex_name_lower.end(), tex_name_lower.begin(),
                            ::tolower);
-            bool tex_path_exists = Filesystem::is_regular_file(tex_path).value_or(false);
-            if (tex_path_exists) {
-                bStream::CFileStream tex_stream(tex_path.string(), bStream::Endianess::Big,
-                                                bStream::OpenMode::In);
-                RefPtr<J3DTexture> new_texture = btiLoader.Load(tex_name, &tex_stream);
+            // The model is private here, but the swapped texture itself is not
+            RefPtr<J3DTexture> new_texture = resource_cache.loadTexture(tex_path, tex_name);
+            if (new_texture) {
                 model_data->SetTexture(tex_name, new_texture);
             }
         }
@@ -1412,22 +1809,28 @@ namespace Toolbox::Object {
             selected_model->SetScale(m_transform.value().m_scale);
         }
 
-        if (m_type == "HideObjPictureTwin") {
+        static const SymbolID s_hide_obj_picture_twin_id = InternSymbol("HideObjPictureTwin");
+        static const SymbolID s_water_hit_picture_hide_obj_id =
+            InternSymbol("WaterHitPictureHideObj");
+        static const SymbolID s_wood_block_id  = InternSymbol("WoodBlock");
+        static const SymbolID s_npc_kinopio_id = InternSymbol("NPCKinopio");
+
+        if (m_type == s_hide_obj_picture_twin_id) {
             HelperUpdateHideObjPictureTwinRender();
             return;
         }
 
-        if (m_type == "WaterHitPictureHideObj") {
+        if (m_type == s_water_hit_picture_hide_obj_id) {
             HelperUpdateWaterHitPictureHideObjRender();
             return;
         }
 
-        if (m_type == "WoodBlock") {
+        if (m_type == s_wood_block_id) {
             HelperUpdateWoodblockRender();
             return;
         }
 
-        if (m_type == "NPCKinopio") {
+        if (m_type == s_npc_kinopio_id) {
             HelperUpdateKinopioRender();
             return;
         }
@@ -1449,17 +1852,17 @@ namespace Toolbox::Object {
     Result<void, SerialError> PhysicalSceneObject::gameSerialize(Serializer &out) const {
         std::streampos start = out.tell();
 
-        out.pushBreakpoint();
+        const size_t obj_size = getDataSize();
         {
-            // Write the size marker for now
-            out.write<u32>(0);
+            out.write<u32, std::endian::big>(static_cast<u32>(obj_size));
 
             NameRef type_ref(m_type);
             type_ref.serialize(out);
 
             m_nameref.serialize(out);
 
-            bool is_map_obj_base = m_type == "MapObjBase";
+            static const SymbolID s_map_obj_base_id = InternSymbol("MapObjBase");
+            bool is_map_obj_base                    = m_type == s_map_obj_base_id;
 
             for (auto &member : m_members) {
                 if (is_map_obj_base) {
@@ -1474,13 +1877,9 @@ namespace Toolbox::Object {
             }
         }
 
-        u32 obj_size = static_cast<u32>(out.size() - start);
-
-        out.popBreakpoint();
-
-        // Write the size marker
-        out.write<u32, std::endian::big>(obj_size);
-        out.seek(0, std::ios::end);
+        if (PatchSizeMarker(out, start, obj_size)) {
+            m_data_size_dirty = true;
+        }
         return {};
     }
 
@@ -1567,6 +1966,7 @@ namespace Toolbox::Object {
 
         // Skip padding/unknown data
         in.seek(endpos, std::ios::beg);
+        invalidateDataSize();
 
         sync();
         return {};
@@ -1603,6 +2003,7 @@ namespace Toolbox::Object {
 
     ObjectFactory::create_t ObjectFactory::create(game_io_tag, Deserializer &in, bool include_custom,
                                                   std::optional<UUID64> obj_uuid) {
+        const size_t start = static_cast<size_t>(in.tell());
         if (isGroupObject(in)) {
             auto obj = make_scoped<GroupSceneObject>();
             if (obj_uuid) {
@@ -1613,6 +2014,7 @@ namespace Toolbox::Object {
             if (!result) {
                 return std::unexpected(result.error());
             }
+            RecordSourceRange(*obj, in, start);
             return obj;
         } else {
             auto obj = make_scoped<PhysicalSceneObject>();
@@ -1624,10 +2026,59 @@ namespace Toolbox::Object {
             if (!result) {
                 return std::unexpected(result.error());
             }
+            RecordSourceRange(*obj, in, start);
             return obj;
         }
     }
 
+    ObjectFactory::create_t ObjectFactory::create(game_io_tag, const SourceImage &image,
+                                                  size_t offset, std::string_view file_path,
+                                                  bool include_custom, size_t fan_out_depth) {
+        Deserializer in(std::span<const char>(image.m_data), file_path);
+        in.seek(offset, std::ios::beg);
+
+        ++t_defer_render_data;
+        const u64 prev_image_id = std::exchange(t_source_image_id, image.m_id);
+        create_t result;
+        if (fan_out_depth > 0 && isGroupObject(in)) {
+            auto obj              = make_scoped<GroupSceneObject>();
+            obj->m_include_custom = include_custom;
+            auto group_result     = obj->gameDeserializeFanOut(in, image, fan_out_depth);
+            if (group_result) {
+                RecordSourceRange(*obj, in, offset);
+                result = std::move(obj);
+            } else {
+                result = std::unexpected(group_result.error());
+            }
+        } else {
+            result = create(game_io_tag{}, in, include_custom);
+        }
+        t_source_image_id = prev_image_id;
+        --t_defer_render_data;
+
+        return result;
+    }
+
+    void ObjectFactory::loadDeferredRenderData(RefPtr<ISceneObject> root) {
+        std::stack<RefPtr<ISceneObject>> objects;
+        objects.push(std::move(root));
+        while (!objects.empty()) {
+            RefPtr<ISceneObject> object = objects.top();
+            objects.pop();
+
+            if (isPhysicalObject(object->type())) {
+                auto physical = ref_cast<PhysicalSceneObject>(object);
+                (void)physical->loadRenderData(physical->m_scene_resource_path,
+                                               getResourceCache());
+            }
+
+            const std::vector<RefPtr<ISceneObject>> &children = object->getChildren();
+            for (auto it = children.rbegin(); it != children.rend(); ++it) {
+                objects.push(*it);
+            }
+        }
+    }
+
     ObjectFactory::create_t ObjectFactory::create(project_io_tag, Deserializer &in,
                                                   bool include_custom,
                                                   std::optional<UUID64> obj_uuid) {
@@ -1962,7 +2413,7 @@ namespace Toolbox::Object {
     }
 
     bool IsObjectMonte(ISceneObject *object) {
-        const u16 type_code = NameRef(object->type()).code();
+        const u16 type_code = NameRef::calcKeyCode(GetSymbolName(object->typeID()));
         return std::any_of(s_monte_types.begin(), s_monte_types.end(),
                            [&](u16 code) { return code == type_code; });
     }
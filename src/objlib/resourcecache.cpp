@@ -0,0 +1,244 @@
+#include <J3D/J3DModelLoader.hpp>
+#include <J3D/Material/J3DMaterialTableLoader.hpp>
+#include <J3D/Texture/J3DTextureLoader.hpp>
+
+#include <algorithm>
+#include <bstream.h>
+#include <format>
+#include <fstream>
+
+#include "objlib/resourcecache.hpp"
+
+namespace Toolbox::Object {
+
+    ResourceCache::ResourceCache() {
+        // Leave a core for the render thread that consumes the results
+        const size_t worker_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+        m_workers.reserve(worker_count);
+        for (size_t i = 0; i < worker_count; ++i) {
+            m_workers.emplace_back([this](std::stop_token stop) { workerRun(stop); });
+        }
+    }
+
+    ResourceCache::~ResourceCache() {
+        for (std::jthread &worker : m_workers) {
+            worker.request_stop();
+        }
+        m_queue_cv.notify_all();
+        m_workers.clear();
+    }
+
+    ResourceCache::ModelRequest ResourceCache::requestModel(const fs_path &path) {
+        ModelRequest request;
+        request.m_key = makeKey(path);
+
+        std::unique_lock lock(m_cache_mutex);
+
+        auto model_it = m_models.find(request.m_key);
+        if (model_it != m_models.end()) {
+            // Already parsed, so the request carries the model itself
+            request.m_model = model_it->second;
+            return request;
+        }
+
+        auto it = m_sources.find(request.m_key);
+        if (it != m_sources.end()) {
+            request.m_source = it->second;
+            return request;
+        }
+
+        auto task = make_referable<std::packaged_task<source_t()>>([path]() -> source_t {
+            auto size_result = Filesystem::file_size(path);
+            if (!size_result) {
+                return nullptr;
+            }
+
+            std::ifstream in(path, std::ios::in | std::ios::binary);
+            if (!in) {
+                return nullptr;
+            }
+
+            source_t source = make_referable<std::vector<u8>>(size_result.value());
+            in.read(reinterpret_cast<char *>(source->data()), source->size());
+            if (!in) {
+                return nullptr;
+            }
+            return source;
+        });
+
+        request.m_source = task->get_future().share();
+        m_sources.emplace(request.m_key, request.m_source);
+        lock.unlock();
+
+        enqueue([task]() { (*task)(); });
+        return request;
+    }
+
+    RefPtr<J3DModelData> ResourceCache::loadModel(const ModelRequest &request) {
+        if (request.m_model) {
+            return request.m_model;
+        }
+
+        {
+            std::scoped_lock lock(m_cache_mutex);
+            auto it = m_models.find(request.m_key);
+            if (it != m_models.end()) {
+                return it->second;
+            }
+        }
+
+        if (!request.m_source.valid()) {
+            return nullptr;
+        }
+
+        source_t source = request.m_source.get();
+        if (!source) {
+            return nullptr;
+        }
+
+        bStream::CMemoryStream model_stream(source->data(), source->size(),
+                                            bStream::Endianess::Big, bStream::OpenMode::In);
+
+        J3DModelLoader bmdLoader;
+        RefPtr<J3DModelData> model_data = bmdLoader.Load(&model_stream, 0);
+
+        // The source is only needed until the model is parsed
+        std::scoped_lock lock(m_cache_mutex);
+        m_sources.erase(request.m_key);
+        m_models[request.m_key] = model_data;
+        return model_data;
+    }
+
+    RefPtr<J3DMaterialTable> ResourceCache::loadMaterialTable(const fs_path &path,
+                                                              RefPtr<J3DModelData> model_data) {
+        if (!model_data) {
+            return nullptr;
+        }
+
+        // A material table is resolved against the model it was loaded for
+        const std::string key =
+            std::format("{}\n{}", makeKey(path), reinterpret_cast<uintptr_t>(model_data.get()));
+
+        {
+            std::scoped_lock lock(m_cache_mutex);
+            auto it = m_materials.find(key);
+            if (it != m_materials.end()) {
+                return it->second;
+            }
+        }
+
+        if (!Filesystem::is_regular_file(path).value_or(false)) {
+            return nullptr;
+        }
+
+        bStream::CFileStream mat_stream(path.string(), bStream::Endianess::Big,
+                                        bStream::OpenMode::In);
+
+        J3DMaterialTableLoader bmtLoader;
+        RefPtr<J3DMaterialTable> mat_table = bmtLoader.Load(&mat_stream, model_data);
+
+        std::scoped_lock lock(m_cache_mutex);
+        m_materials[key] = mat_table;
+        return mat_table;
+    }
+
+    RefPtr<J3DTexture> ResourceCache::loadTexture(const fs_path &path, std::string_view name) {
+        const std::string key = std::format("{}\n{}", makeKey(path), name);
+
+        {
+            std::scoped_lock lock(m_cache_mutex);
+            auto it = m_textures.find(key);
+            if (it != m_textures.end()) {
+                return it->second;
+            }
+        }
+
+        if (!Filesystem::is_regular_file(path).value_or(false)) {
+            return nullptr;
+        }
+
+        bStream::CFileStream tex_stream(path.string(), bStream::Endianess::Big,
+                                        bStream::OpenMode::In);
+
+        J3DTextureLoader btiLoader;
+        RefPtr<J3DTexture> texture = btiLoader.Load(std::string(name), &tex_stream);
+
+        std::scoped_lock lock(m_cache_mutex);
+        m_textures[key] = texture;
+        return texture;
+    }
+
+    void ResourceCache::clear() {
+        std::scoped_lock lock(m_cache_mutex);
+        clearEntries();
+    }
+
+    void ResourceCache::clearEntries() {
+        m_sources.clear();
+        m_models.clear();
+        m_materials.clear();
+        m_textures.clear();
+    }
+
+    ResourceCacheLease ResourceCache::lease() {
+        std::scoped_lock lock(m_cache_mutex);
+        m_lease_count += 1;
+        return ResourceCacheLease(this);
+    }
+
+    void ResourceCache::releaseLease() {
+        std::scoped_lock lock(m_cache_mutex);
+        m_lease_count -= 1;
+        if (m_lease_count == 0) {
+            clearEntries();
+        }
+    }
+
+    void ResourceCacheLease::release() {
+        if (m_cache) {
+            std::exchange(m_cache, nullptr)->releaseLease();
+        }
+    }
+
+    std::string ResourceCache::makeKey(const fs_path &path) {
+        const fs_path resolved = Filesystem::weakly_canonical(path).value_or(path);
+
+        // Missing files key on the path alone, and miss again once they exist
+        auto mtime_result = Filesystem::last_write_time(resolved);
+        if (!mtime_result) {
+            return resolved.string();
+        }
+
+        return std::format("{}\n{}", resolved.string(),
+                           mtime_result.value().time_since_epoch().count());
+    }
+
+    void ResourceCache::enqueue(std::function<void()> job) {
+        {
+            std::scoped_lock lock(m_queue_mutex);
+            m_queue.emplace_back(std::move(job));
+        }
+        m_queue_cv.notify_one();
+    }
+
+    void ResourceCache::workerRun(std::stop_token stop) {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock lock(m_queue_mutex);
+                if (!m_queue_cv.wait(lock, stop, [this]() { return !m_queue.empty(); })) {
+                    return;
+                }
+                job = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+            job();
+        }
+    }
+
+    ResourceCache &getResourceCache() {
+        static ResourceCache s_resource_cache;
+        return s_resource_cache;
+    }
+
+}  // namespace Toolbox::Object
@@ -0,0 +1,69 @@
+#include "objlib/symbol.hpp"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Toolbox::Object {
+
+    namespace {
+
+        struct SymbolTable {
+            std::shared_mutex m_mutex;
+            // Deque elements never move, so the map can key on views of them
+            std::deque<std::string> m_names = {std::string()};
+            std::unordered_map<std::string_view, SymbolID> m_ids;
+        };
+
+        SymbolTable &GetSymbolTable() {
+            static SymbolTable s_table;
+            return s_table;
+        }
+
+    }  // namespace
+
+    SymbolID InternSymbol(std::string_view name) {
+        if (name.empty()) {
+            return INVALID_SYMBOL;
+        }
+
+        SymbolTable &table = GetSymbolTable();
+        {
+            std::shared_lock lock(table.m_mutex);
+            auto it = table.m_ids.find(name);
+            if (it != table.m_ids.end()) {
+                return it->second;
+            }
+        }
+
+        std::unique_lock lock(table.m_mutex);
+        auto it = table.m_ids.find(name);
+        if (it != table.m_ids.end()) {
+            return it->second;
+        }
+
+        const SymbolID id           = static_cast<SymbolID>(table.m_names.size());
+        const std::string &interned = table.m_names.emplace_back(name);
+        table.m_ids.emplace(std::string_view(interned), id);
+        return id;
+    }
+
+    SymbolID FindSymbol(std::string_view name) {
+        SymbolTable &table = GetSymbolTable();
+        std::shared_lock lock(table.m_mutex);
+        auto it = table.m_ids.find(name);
+        return it != table.m_ids.end() ? it->second : INVALID_SYMBOL;
+    }
+
+    std::string_view GetSymbolName(SymbolID id) {
+        SymbolTable &table = GetSymbolTable();
+        std::shared_lock lock(table.m_mutex);
+        if (id >= table.m_names.size()) {
+            return {};
+        }
+        return table.m_names[id];
+    }
+
+}  // namespace Toolbox::Object
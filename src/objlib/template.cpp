@@ -4,6 +4,7 @@
 #include <fstream>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <thread>
 #include <unordered_map>
 
@@ -19,6 +20,7 @@
 #include "objlib/meta/member.hpp"
 #include "objlib/meta/struct.hpp"
 #include "objlib/template.hpp"
+#include "objlib/templateimage.hpp"
 #include "objlib/transform.hpp"
 #include "smart_resource.hpp"
 
@@ -943,13 +945,17 @@ namespace Toolbox::Object {
         return {};
     }
 
-    static std::mutex s_templates_mutex;
+    static std::shared_mutex s_templates_mutex;
     static fs_path s_cache_path = "./Templates/.cache/";
 
     std::unordered_map<std::string, Template> g_template_cache_base;
     std::unordered_map<std::string, Template> g_template_cache_custom;
     std::unordered_map<std::string, TemplateRenderInfo> g_object_render_infos;
 
+    // Templates compiled by a previous run, decoded on first use. Guarded by
+    // s_templates_mutex like the caches above.
+    static RefPtr<TemplateImage> s_template_image;
+
     void Template::threadLoadTemplate(const std::string &type, bool is_custom) {
         Template template_;
         try {
@@ -968,24 +974,27 @@ namespace Toolbox::Object {
         return;
     }
 
-    void Template::threadLoadTemplateBlob(const std::string &type, const json_t &the_json,
-                                          bool is_custom) {
-        Template template_;
-        try {
-            template_.m_type = type;
-            template_.loadFromJSON(the_json);
-        } catch (std::runtime_error &e) {
-            TOOLBOX_ERROR(e.what());
-            return;
+    // Maps the compiled template image, first rebuilding it if any template
+    // JSON was added, removed or modified since it was written.
+    static Result<RefPtr<TemplateImage>, FSError> OpenTemplateImage(const fs_path &base_path,
+                                                                    const fs_path &custom_path) {
+        std::vector<TemplateImage::Source> sources;
+        sources.reserve(1024);
+        TemplateImage::CollectSources(base_path, false, sources);
+        TemplateImage::CollectSources(custom_path, true, sources);
+
+        const fs_path image_path = s_cache_path / "templates.bin";
+
+        RefPtr<TemplateImage> image = TemplateImage::Open(image_path).value_or(nullptr);
+        if (image && image->isUpToDate(sources)) {
+            return image;
         }
-        s_templates_mutex.lock();
-        if (is_custom) {
-            g_template_cache_custom[type] = template_;
-        } else {
-            g_template_cache_base[type] = template_;
+
+        auto result = TemplateImage::Build(image_path, sources, std::move(image));
+        if (!result) {
+            return std::unexpected(result.error());
         }
-        s_templates_mutex.unlock();
-        return;
+        return TemplateImage::Open(image_path);
     }
 
     Result<void, FSError> TemplateFactory::initialize(const fs_path &cache_path) {
@@ -996,16 +1005,28 @@ namespace Toolbox::Object {
             return std::unexpected(cwd_result.error());
         }
 
-        bool templates_preloaded = false;
-        if (isCacheMode()) {
-            templates_preloaded |= loadFromCacheBlob(false).has_value();
-            templates_preloaded |= loadFromCacheBlob(true).has_value();
-        }
-
         const fs_path cwd              = cwd_result.value();
         const fs_path load_base_path   = cwd / "Templates/Vanilla";
         const fs_path load_custom_path = cwd / "Templates/Custom";
 
+        bool templates_preloaded = false;
+        if (isCacheMode()) {
+            // Drop the mapping of an earlier initialize so the image can be rebuilt
+            {
+                std::unique_lock lock(s_templates_mutex);
+                s_template_image.reset();
+            }
+
+            auto image_result = OpenTemplateImage(load_base_path, load_custom_path);
+            if (image_result) {
+                std::unique_lock lock(s_templates_mutex);
+                s_template_image    = image_result.value();
+                templates_preloaded = true;
+            } else {
+                Toolbox::UI::LogError(image_result.error());
+            }
+        }
+
         if (!templates_preloaded) {
             struct TemplateLoadInfo {
                 std::string m_type;
@@ -1037,18 +1058,6 @@ namespace Toolbox::Object {
                           [](const TemplateLoadInfo &info) {
                               Template::threadLoadTemplate(info.m_type, info.m_is_custom);
                           });
-
-            if (isCacheMode()) {
-                auto res = saveToCacheBlob(false);  // Base templates
-                if (!res) {
-                    return std::unexpected(res.error());
-                }
-
-                res = saveToCacheBlob(true);  // Custom templates
-                if (!res) {
-                    return std::unexpected(res.error());
-                }
-            }
         }
 
         const fs_path obj_render_infos_path = cwd / "Templates/object_info_map.json";
@@ -1121,163 +1130,67 @@ namespace Toolbox::Object {
         return {};
     }
 
-    Result<void, FSError> TemplateFactory::loadFromCacheBlob(bool is_custom) {
-        auto blob_path = s_cache_path / (is_custom ? "blob_custom.json" : "blob.json");
-
-        auto path_result = Toolbox::Filesystem::is_regular_file(blob_path);
-        if (!path_result) {
-            return std::unexpected(path_result.error());
-        }
-
-        if (!path_result.value()) {
-            return make_fs_error<void>(std::error_code(),
-                                       {"[TEMPLATE_FACTORY] blob.json not found!"});
-        }
-
-        std::ifstream file(blob_path, std::ios::in);
-        if (!file.is_open()) {
-            return make_fs_error<void>(std::error_code(),
-                                       {"[TEMPLATE_FACTORY] Failed to open cache blob!"});
-        }
+    static bool s_cache_mode = false;
 
-        Deserializer in(file.rdbuf());
-        Template::json_t blob_json;
-        in.stream() >> blob_json;
+    bool TemplateFactory::isCacheMode() { return s_cache_mode; }
 
-        std::vector<Template::json_t::iterator> json_iters;
-        json_iters.reserve(blob_json.size());
+    void TemplateFactory::setCacheMode(bool mode) { s_cache_mode = mode; }
 
-        // 2. Populate the vector (Standard iterators are bidirectional)
-        for (auto it = blob_json.begin(); it != blob_json.end(); ++it) {
-            json_iters.emplace_back(it);
+    // Decodes a template from the image into its cache, keeping whatever
+    // another thread may have cached first.
+    static std::optional<Template> LoadFromImage(const TemplateImage &image,
+                                                 const TemplateImage::Entry &entry) {
+        auto result = image.load(entry);
+        if (!result) {
+            Toolbox::UI::LogError(result.error());
+            return std::nullopt;
         }
 
-        std::for_each(std::execution::par, json_iters.begin(), json_iters.end(),
-                      [is_custom](const Template::json_t::iterator &info) {
-                          Template::threadLoadTemplateBlob(info.key(), info.value(), is_custom);
-                      });
-
-        return {};
+        std::unique_lock lock(s_templates_mutex);
+        auto &cache = entry.m_is_custom ? g_template_cache_custom : g_template_cache_base;
+        auto it     = cache.try_emplace(std::string(image.type(entry)), std::move(result.value()));
+        return it.first->second;
     }
 
-    Result<void, FSError> TemplateFactory::saveToCacheBlob(bool is_custom) {
-        auto cwd_result = Toolbox::Filesystem::current_path();
-        if (!cwd_result) {
-            return std::unexpected(cwd_result.error());
-        }
+    TemplateFactory::create_t TemplateFactory::create(std::string_view type, bool include_custom) {
+        auto type_str = std::string(type);
 
-        Template::json_t blob_json;
+        RefPtr<TemplateImage> image;
 
+        // Scene objects may be parsed from several threads at once
         {
-            const fs_path &cwd = cwd_result.value();
-            const fs_path load_from_path =
-                cwd / (is_custom ? "Templates/Custom" : "Templates/Vanilla");
-
-            std::vector<fs_path> save_infos;
-            save_infos.reserve(1024);
+            std::shared_lock lock(s_templates_mutex);
+            image = s_template_image;
 
-            for (auto &subpath : std::filesystem::directory_iterator{load_from_path}) {
-                if (!Filesystem::is_regular_file(subpath.path()).value_or(false)) {
-                    continue;
+            if (include_custom) {
+                auto it = g_template_cache_custom.find(type_str);
+                if (it != g_template_cache_custom.end()) {
+                    return make_scoped<Template>(it->second);
                 }
-
-                save_infos.emplace_back(subpath.path());
             }
 
-            std::vector<std::optional<Template::json_t>> parsed_jsons(save_infos.size());
-
-            std::transform(
-                std::execution::par_unseq, save_infos.begin(), save_infos.end(),
-                parsed_jsons.begin(), [](const fs_path &path) -> std::optional<Template::json_t> {
-                    std::ifstream file(path, std::ios::in);
-                    if (!file.is_open()) {
-                        TOOLBOX_ERROR_V("[TEMPLATE_FACTORY] Failed to open template json {}",
-                                        path.filename().string());
-                        return std::nullopt;
-                    }
-
-                    Deserializer in(file.rdbuf());
-                    Template::json_t t_json;
-
-                    try {
-                        in.stream() >> t_json;
-                    } catch (std::exception e) {
-                        TOOLBOX_ERROR_V("[TEMPLATE_FACTORY] Failed to load template json {}: {}",
-                                        path.filename().string(), std::string_view(e.what()));
-                        return std::nullopt;
-                    }
-
-                    // Return the parsed JSON. Move semantics handle this efficiently
-                    // behind the scenes without heavy copying.
-                    return t_json;
-                });
-
-            for (auto &parsed_opt : parsed_jsons) {
-                if (parsed_opt.has_value()) {
-                    blob_json.update(std::move(parsed_opt.value()));
-                }
+            auto it = g_template_cache_base.find(type_str);
+            if (it != g_template_cache_base.end()) {
+                return make_scoped<Template>(it->second);
             }
         }
 
-        const fs_path blob_path = s_cache_path / (is_custom ? "blob_custom.json" : "blob.json");
-
-        if (!Filesystem::exists(blob_path.parent_path()).value_or(false)) {
-            auto result = Filesystem::create_directories(blob_path.parent_path());
-            if (!result) {
-                return std::unexpected(result.error());
+        if (image) {
+            const TemplateImage::Entry *entry = nullptr;
+            if (include_custom) {
+                entry = image->find(type, true);
             }
-            if (!result.value()) {
-                TOOLBOX_ERROR("[TEMPLATE_FACTORY] Failed to create cache directory!");
+            if (!entry) {
+                entry = image->find(type, false);
             }
-        }
-
-        Filesystem::is_directory(blob_path.parent_path())
-            .and_then([&](bool is_dir) {
-                if (!is_dir) {
-                    return Filesystem::create_directory(blob_path.parent_path());
-                }
-                return Result<bool, FSError>();
-            })
-            .and_then([&](bool result) {
-                std::ofstream file(blob_path, std::ios::out);
-                if (!file.is_open()) {
-                    return make_fs_error<bool>(std::error_code(),
-                                               {"[TEMPLATE_FACTORY] Failed to open cache blob!"});
+            if (entry) {
+                std::optional<Template> template_ = LoadFromImage(*image, *entry);
+                if (template_) {
+                    return make_scoped<Template>(std::move(template_.value()));
                 }
-
-                Serializer out(file.rdbuf());
-                out.stream() << blob_json;
-
-                file.close();
-                return Result<bool, FSError>();
-            })
-            .or_else([](const FSError &error) {
-                Toolbox::UI::LogError(error);
-                return Result<bool, FSError>();
-            });
-
-        return {};
-    }
-
-    static bool s_cache_mode = false;
-
-    bool TemplateFactory::isCacheMode() { return s_cache_mode; }
-
-    void TemplateFactory::setCacheMode(bool mode) { s_cache_mode = mode; }
-
-    TemplateFactory::create_t TemplateFactory::create(std::string_view type, bool include_custom) {
-        auto type_str = std::string(type);
-
-        if (include_custom) {
-            if (g_template_cache_custom.contains(type_str)) {
-                return make_scoped<Template>(g_template_cache_custom[type_str]);
             }
         }
 
-        if (g_template_cache_base.contains(type_str)) {
-            return make_scoped<Template>(g_template_cache_base[type_str]);
-        }
-
         Template template_;
         try {
             template_ = Template(type, include_custom);
@@ -1300,6 +1213,36 @@ namespace Toolbox::Object {
     }
 
     std::vector<TemplateFactory::create_ret_t> TemplateFactory::createAll(bool include_custom) {
+        RefPtr<TemplateImage> image;
+        {
+            std::shared_lock lock(s_templates_mutex);
+            image = s_template_image;
+        }
+
+        if (image) {
+            std::vector<const TemplateImage::Entry *> uncached;
+            {
+                std::shared_lock lock(s_templates_mutex);
+                for (const TemplateImage::Entry &entry : image->entries()) {
+                    // Empty entries failed to compile and are left to the JSON path
+                    if ((entry.m_is_custom && !include_custom) || entry.m_data_size == 0) {
+                        continue;
+                    }
+                    auto &cache = entry.m_is_custom ? g_template_cache_custom : g_template_cache_base;
+                    if (!cache.contains(std::string(image->type(entry)))) {
+                        uncached.push_back(&entry);
+                    }
+                }
+            }
+
+            std::for_each(std::execution::par, uncached.begin(), uncached.end(),
+                          [&image](const TemplateImage::Entry *entry) {
+                              (void)LoadFromImage(*image, *entry);
+                          });
+        }
+
+        std::shared_lock lock(s_templates_mutex);
+
         std::vector<TemplateFactory::create_ret_t> ret;
         ret.reserve(include_custom ? g_template_cache_base.size() + g_template_cache_custom.size()
                                    : g_template_cache_base.size());
@@ -0,0 +1,830 @@
+#include <algorithm>
+#include <cstring>
+#include <execution>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <utility>
+
+#include "core/log.hpp"
+#include "objlib/meta/enum.hpp"
+#include "objlib/meta/member.hpp"
+#include "objlib/meta/struct.hpp"
+#include "objlib/templateimage.hpp"
+
+namespace Toolbox::Object {
+
+    static u64 HashBytes(std::span<const char> bytes) {
+        u64 hash = 0xCBF29CE484222325;
+        for (char c : bytes) {
+            hash ^= static_cast<u8>(c);
+            hash *= 0x100000001B3;
+        }
+        return hash;
+    }
+
+    // Invokes f.template operator()<T>() with the C++ type of a numeric
+    // MetaType; returns false for types that carry no range.
+    template <typename _Fn> static bool VisitNumericType(MetaType type, _Fn &&f) {
+        switch (type) {
+        case MetaType::S8:
+            f.template operator()<s8>();
+            return true;
+        case MetaType::U8:
+            f.template operator()<u8>();
+            return true;
+        case MetaType::S16:
+            f.template operator()<s16>();
+            return true;
+        case MetaType::U16:
+            f.template operator()<u16>();
+            return true;
+        case MetaType::S32:
+            f.template operator()<s32>();
+            return true;
+        case MetaType::U32:
+            f.template operator()<u32>();
+            return true;
+        case MetaType::F32:
+            f.template operator()<f32>();
+            return true;
+        case MetaType::F64:
+            f.template operator()<f64>();
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    enum class MemberKind : u8 {
+        VALUE,
+        ENUM,
+        STRUCT,
+    };
+
+    // ------------------------------------------------------------------ //
+    // Encoding
+    // ------------------------------------------------------------------ //
+
+    static void EncodeStrings(const std::vector<std::string> &strings, Serializer &out) {
+        out.write<u32>(static_cast<u32>(strings.size()));
+        for (const std::string &str : strings) {
+            out.writeString(str);
+        }
+    }
+
+    static void EncodeOptional(const std::optional<std::string> &str, Serializer &out) {
+        out.write<u8>(str.has_value());
+        if (str) {
+            out.writeString(*str);
+        }
+    }
+
+    static void EncodeValue(const MetaValue &value, Serializer &out) {
+        std::span<const u8> bytes = value.bytes();
+        out.write<u8>(static_cast<u8>(value.type()));
+        out.write<u32>(static_cast<u32>(bytes.size()));
+        out.writeBytes({reinterpret_cast<const char *>(bytes.data()), bytes.size()});
+        VisitNumericType(value.type(), [&]<typename T>() {
+            out.write<T>(value.min<T>().value());
+            out.write<T>(value.max<T>().value());
+        });
+    }
+
+    static Result<void, SerialError> EncodeMembers(const std::vector<RefPtr<MetaMember>> &members,
+                                                   Serializer &out);
+
+    static void EncodeEnum(const MetaEnum &enum_, Serializer &out) {
+        out.writeString(enum_.name());
+        out.write<u8>(static_cast<u8>(enum_.type()));
+        out.write<u8>(enum_.isBitMasked());
+
+        const std::vector<MetaEnum::enum_type> enums = enum_.enums();
+        out.write<u32>(static_cast<u32>(enums.size()));
+        for (const auto &[name, value] : enums) {
+            out.writeString(name);
+            EncodeValue(value, out);
+        }
+        EncodeValue(*enum_.value(), out);
+    }
+
+    static Result<void, SerialError> EncodeStruct(const MetaStruct &struct_, Serializer &out) {
+        out.writeString(struct_.name());
+        return EncodeMembers(struct_.members(), out);
+    }
+
+    static Result<void, SerialError> EncodeMember(const MetaMember &member, Serializer &out) {
+        out.writeString(member.name());
+
+        MetaMember::size_type size = member.arraysize_();
+        if (std::holds_alternative<MetaMember::ReferenceInfo>(size)) {
+            out.write<u8>(1);
+            out.writeString(std::get<MetaMember::ReferenceInfo>(size).m_name);
+        } else {
+            out.write<u8>(0);
+        }
+
+        const u32 count = member.arraysize();
+        out.write<u32>(count);
+
+        if (member.isTypeStruct()) {
+            out.write<u8>(static_cast<u8>(MemberKind::STRUCT));
+            for (u32 i = 0; i < count; ++i) {
+                auto struct_ = member.value<MetaStruct>(i);
+                if (!struct_) {
+                    return make_serial_error<void>(out, "Struct member is missing a value");
+                }
+                auto result = EncodeStruct(*struct_.value(), out);
+                if (!result) {
+                    return result;
+                }
+            }
+            return EncodeStruct(*std::get<RefPtr<MetaStruct>>(member.defaultValue()), out);
+        }
+
+        if (member.isTypeEnum()) {
+            out.write<u8>(static_cast<u8>(MemberKind::ENUM));
+            for (u32 i = 0; i < count; ++i) {
+                auto enum_ = member.value<MetaEnum>(i);
+                if (!enum_) {
+                    return make_serial_error<void>(out, "Enum member is missing a value");
+                }
+                EncodeEnum(*enum_.value(), out);
+            }
+            EncodeEnum(*std::get<RefPtr<MetaEnum>>(member.defaultValue()), out);
+            return {};
+        }
+
+        out.write<u8>(static_cast<u8>(MemberKind::VALUE));
+        for (u32 i = 0; i < count; ++i) {
+            auto value = member.value<MetaValue>(i);
+            if (!value) {
+                return make_serial_error<void>(out, "Value member is missing a value");
+            }
+            EncodeValue(*value.value(), out);
+        }
+        EncodeValue(*std::get<RefPtr<MetaValue>>(member.defaultValue()), out);
+        return {};
+    }
+
+    static Result<void, SerialError> EncodeMembers(const std::vector<RefPtr<MetaMember>> &members,
+                                                   Serializer &out) {
+        out.write<u32>(static_cast<u32>(members.size()));
+        for (const RefPtr<MetaMember> &member : members) {
+            auto result = EncodeMember(*member, out);
+            if (!result) {
+                return result;
+            }
+        }
+        return {};
+    }
+
+    static void EncodeObjectInfos(const std::vector<TemplateDependencies::ObjectInfo> &infos,
+                                  Serializer &out) {
+        out.write<u32>(static_cast<u32>(infos.size()));
+        for (const TemplateDependencies::ObjectInfo &info : infos) {
+            out.writeString(info.m_type);
+            out.writeString(info.m_name);
+            EncodeStrings({info.m_ancestry.begin(), info.m_ancestry.end()}, out);
+        }
+    }
+
+    Result<void, SerialError> TemplateImage::EncodeTemplate(const Template &template_,
+                                                            Serializer &out) {
+        out.write<u32>(static_cast<u32>(template_.m_wizards.size()));
+        for (const TemplateWizard &wizard : template_.m_wizards) {
+            out.writeString(wizard.m_name);
+            EncodeOptional(wizard.m_obj_name, out);
+
+            auto result = EncodeMembers(wizard.m_init_members, out);
+            if (!result) {
+                return result;
+            }
+
+            EncodeObjectInfos(wizard.m_dependencies.m_managers, out);
+            EncodeStrings(wizard.m_dependencies.m_asset_paths, out);
+            EncodeObjectInfos(wizard.m_dependencies.m_table_objs, out);
+
+            const TemplateRenderInfo &render_info = wizard.m_render_info;
+            EncodeOptional(render_info.m_file_model, out);
+            EncodeOptional(render_info.m_file_materials, out);
+            EncodeStrings(render_info.m_file_animations, out);
+            out.write<u32>(static_cast<u32>(render_info.m_texture_swap_map.size()));
+            for (const auto &[from, to] : render_info.m_texture_swap_map) {
+                out.writeString(from);
+                out.writeString(to);
+            }
+        }
+
+        if (!out.good()) {
+            return make_serial_error<void>(out, "Failed to encode the template");
+        }
+        return {};
+    }
+
+    // ------------------------------------------------------------------ //
+    // Decoding
+    // ------------------------------------------------------------------ //
+
+    // Every encoded element takes at least one byte, so no count can exceed
+    // the payload size; anything larger means the image is corrupt.
+    static Result<u32, SerialError> DecodeCount(Deserializer &in, size_t limit) {
+        const u32 count = in.read<u32>();
+        if (!in.good() || count > limit) {
+            return make_serial_error<u32>(in, "Element count exceeds the template data", -4);
+        }
+        return count;
+    }
+
+    static Result<std::vector<std::string>, SerialError> DecodeStrings(Deserializer &in,
+                                                                       size_t limit) {
+        auto count = DecodeCount(in, limit);
+        if (!count) {
+            return std::unexpected(count.error());
+        }
+
+        std::vector<std::string> strings;
+        strings.reserve(count.value());
+        for (u32 i = 0; i < count.value(); ++i) {
+            strings.emplace_back(in.readString());
+        }
+        return strings;
+    }
+
+    static std::optional<std::string> DecodeOptional(Deserializer &in) {
+        if (in.read<u8>() == 0) {
+            return std::nullopt;
+        }
+        return in.readString();
+    }
+
+    static Result<MetaValue, SerialError> DecodeValue(Deserializer &in, size_t limit) {
+        const MetaType type = static_cast<MetaType>(in.read<u8>());
+
+        auto size = DecodeCount(in, limit);
+        if (!size) {
+            return std::unexpected(size.error());
+        }
+
+        Buffer buf;
+        if (size.value() > 0) {
+            if (!buf.alloc(size.value())) {
+                return make_serial_error<MetaValue>(in, "Failed to allocate the value buffer");
+            }
+            in.readBytes({buf.buf<char>(), size.value()});
+        }
+
+        MetaValue value(type, buf);
+        VisitNumericType(type, [&]<typename T>() {
+            const T v_min = in.read<T>();
+            const T v_max = in.read<T>();
+            (void)value.setMin<T>(v_min);
+            (void)value.setMax<T>(v_max);
+        });
+        return value;
+    }
+
+    static Result<std::vector<RefPtr<MetaMember>>, SerialError> DecodeMembers(Deserializer &in,
+                                                                              size_t limit);
+
+    static Result<RefPtr<MetaEnum>, SerialError> DecodeEnum(Deserializer &in, size_t limit) {
+        const std::string name = in.readString();
+        const MetaType type    = static_cast<MetaType>(in.read<u8>());
+        const bool bit_mask    = in.read<u8>() != 0;
+
+        auto count = DecodeCount(in, limit);
+        if (!count) {
+            return std::unexpected(count.error());
+        }
+
+        std::vector<MetaEnum::enum_type> enums;
+        enums.reserve(count.value());
+        for (u32 i = 0; i < count.value(); ++i) {
+            std::string enum_name = in.readString();
+            auto value            = DecodeValue(in, limit);
+            if (!value) {
+                return std::unexpected(value.error());
+            }
+            enums.emplace_back(std::move(enum_name), std::move(value.value()));
+        }
+
+        auto current = DecodeValue(in, limit);
+        if (!current) {
+            return std::unexpected(current.error());
+        }
+
+        auto enum_ = make_referable<MetaEnum>(name, type, std::move(enums), bit_mask);
+        // A non-const MetaValue lvalue would pick the forwarding operator=
+        *enum_->value() = std::as_const(current.value());
+        return enum_;
+    }
+
+    static Result<RefPtr<MetaStruct>, SerialError> DecodeStruct(Deserializer &in, size_t limit) {
+        const std::string name = in.readString();
+
+        auto members = DecodeMembers(in, limit);
+        if (!members) {
+            return std::unexpected(members.error());
+        }
+        return make_referable<MetaStruct>(name, members.value());
+    }
+
+    template <typename T, typename _DecodeFn>
+    static Result<void, SerialError> DecodeMemberValues(Deserializer &in, u32 count,
+                                                        MetaMemberBuilder &builder,
+                                                        _DecodeFn &&decode) {
+        std::vector<RefPtr<T>> values;
+        values.reserve(count);
+        for (u32 i = 0; i < count + 1; ++i) {
+            auto value = decode();
+            if (!value) {
+                return std::unexpected(value.error());
+            }
+            values.emplace_back(std::move(value.value()));
+        }
+
+        RefPtr<T> default_ = std::move(values.back());
+        values.pop_back();
+
+        if constexpr (std::is_same_v<T, MetaStruct>) {
+            builder.setStructs(values, default_);
+        } else if constexpr (std::is_same_v<T, MetaEnum>) {
+            builder.setEnums(values, default_);
+        } else {
+            builder.setValues(values, default_);
+        }
+        return {};
+    }
+
+    static Result<RefPtr<MetaMember>, SerialError>
+    DecodeMember(Deserializer &in, size_t limit, const std::vector<RefPtr<MetaMember>> &siblings) {
+        const std::string name = in.readString();
+
+        std::optional<std::string> reference;
+        if (in.read<u8>() != 0) {
+            reference = in.readString();
+        }
+
+        auto count = DecodeCount(in, limit);
+        if (!count) {
+            return std::unexpected(count.error());
+        }
+
+        // References resolve against the members decoded before this one,
+        // the same way Template::loadMembers resolves them from JSON. Should
+        // the referenced value not agree with the stored count, the count is
+        // kept fixed so the member still holds every value it was built with.
+        MetaMember::size_type size = count.value();
+        if (reference) {
+            auto sibling_it =
+                std::find_if(siblings.begin(), siblings.end(),
+                             [&](const RefPtr<MetaMember> &m) { return m->name() == *reference; });
+            if (sibling_it != siblings.end()) {
+                auto ref = (*sibling_it)->value<MetaValue>(0);
+                if (ref && ref.value()->get<u32>().value_or(0) == count.value()) {
+                    size = MetaMember::ReferenceInfo(ref.value(), *reference);
+                }
+            }
+        }
+
+        MetaMemberBuilder builder;
+        builder.setName(name).setArraySize(size);
+
+        Result<void, SerialError> result;
+        switch (static_cast<MemberKind>(in.read<u8>())) {
+        case MemberKind::VALUE:
+            result = DecodeMemberValues<MetaValue>(
+                in, count.value(), builder,
+                [&]() -> Result<RefPtr<MetaValue>, SerialError> {
+                    auto value = DecodeValue(in, limit);
+                    if (!value) {
+                        return std::unexpected(value.error());
+                    }
+                    return make_referable<MetaValue>(std::move(value.value()));
+                });
+            break;
+        case MemberKind::ENUM:
+            result = DecodeMemberValues<MetaEnum>(in, count.value(), builder,
+                                                  [&]() { return DecodeEnum(in, limit); });
+            break;
+        case MemberKind::STRUCT:
+            result = DecodeMemberValues<MetaStruct>(in, count.value(), builder,
+                                                    [&]() { return DecodeStruct(in, limit); });
+            break;
+        default:
+            return make_serial_error<RefPtr<MetaMember>>(in, "Unknown member kind", -1);
+        }
+
+        if (!result) {
+            return std::unexpected(result.error());
+        }
+        return builder.finalize();
+    }
+
+    static Result<std::vector<RefPtr<MetaMember>>, SerialError> DecodeMembers(Deserializer &in,
+                                                                              size_t limit) {
+        auto count = DecodeCount(in, limit);
+        if (!count) {
+            return std::unexpected(count.error());
+        }
+
+        std::vector<RefPtr<MetaMember>> members;
+        members.reserve(count.value());
+        for (u32 i = 0; i < count.value(); ++i) {
+            auto member = DecodeMember(in, limit, members);
+            if (!member) {
+                return std::unexpected(member.error());
+            }
+            members.emplace_back(std::move(member.value()));
+        }
+        return members;
+    }
+
+    static Result<std::vector<TemplateDependencies::ObjectInfo>, SerialError>
+    DecodeObjectInfos(Deserializer &in, size_t limit) {
+        auto count = DecodeCount(in, limit);
+        if (!count) {
+            return std::unexpected(count.error());
+        }
+
+        std::vector<TemplateDependencies::ObjectInfo> infos;
+        infos.reserve(count.value());
+        for (u32 i = 0; i < count.value(); ++i) {
+            TemplateDependencies::ObjectInfo info;
+            info.m_type = in.readString();
+            info.m_name = in.readString();
+
+            auto ancestry = DecodeStrings(in, limit);
+            if (!ancestry) {
+                return std::unexpected(ancestry.error());
+            }
+            info.m_ancestry = QualifiedName(ancestry.value());
+            infos.emplace_back(std::move(info));
+        }
+        return infos;
+    }
+
+    Result<Template, SerialError> TemplateImage::DecodeTemplate(std::string_view type,
+                                                                std::span<const char> data) {
+        Deserializer in(data);
+
+        const size_t limit = data.size();
+
+        Template template_;
+        template_.m_type = type;
+
+        auto wizard_count = DecodeCount(in, limit);
+        if (!wizard_count) {
+            return std::unexpected(wizard_count.error());
+        }
+
+        template_.m_wizards.reserve(wizard_count.value());
+        for (u32 i = 0; i < wizard_count.value(); ++i) {
+            TemplateWizard wizard;
+            wizard.m_name     = in.readString();
+            wizard.m_obj_name = DecodeOptional(in);
+
+            auto members = DecodeMembers(in, limit);
+            if (!members) {
+                return std::unexpected(members.error());
+            }
+            wizard.m_init_members = std::move(members.value());
+            for (RefPtr<MetaMember> &member : wizard.m_init_members) {
+                member->updateParentRefs();
+            }
+
+            auto managers = DecodeObjectInfos(in, limit);
+            if (!managers) {
+                return std::unexpected(managers.error());
+            }
+            wizard.m_dependencies.m_managers = std::move(managers.value());
+
+            auto asset_paths = DecodeStrings(in, limit);
+            if (!asset_paths) {
+                return std::unexpected(asset_paths.error());
+            }
+            wizard.m_dependencies.m_asset_paths = std::move(asset_paths.value());
+
+            auto table_objs = DecodeObjectInfos(in, limit);
+            if (!table_objs) {
+                return std::unexpected(table_objs.error());
+            }
+            wizard.m_dependencies.m_table_objs = std::move(table_objs.value());
+
+            TemplateRenderInfo &render_info = wizard.m_render_info;
+            render_info.m_file_model        = DecodeOptional(in);
+            render_info.m_file_materials    = DecodeOptional(in);
+
+            auto animations = DecodeStrings(in, limit);
+            if (!animations) {
+                return std::unexpected(animations.error());
+            }
+            render_info.m_file_animations = std::move(animations.value());
+
+            auto texture_count = DecodeCount(in, limit);
+            if (!texture_count) {
+                return std::unexpected(texture_count.error());
+            }
+            for (u32 j = 0; j < texture_count.value(); ++j) {
+                std::string from                      = in.readString();
+                render_info.m_texture_swap_map[from] = in.readString();
+            }
+            render_info.m_hash = TemplateRenderInfo::RecalculateHash(render_info);
+
+            template_.m_wizards.emplace_back(std::move(wizard));
+        }
+
+        if (!in.good() || static_cast<size_t>(in.tell()) != data.size()) {
+            return make_serial_error<Template>(in, "Template data is truncated or malformed");
+        }
+        return template_;
+    }
+
+    // ------------------------------------------------------------------ //
+    // Image
+    // ------------------------------------------------------------------ //
+
+    static bool EntryLess(std::string_view a_type, bool a_custom, std::string_view b_type,
+                          bool b_custom) {
+        if (a_custom != b_custom) {
+            return !a_custom;
+        }
+        return a_type < b_type;
+    }
+
+    Result<RefPtr<TemplateImage>, FSError> TemplateImage::Open(const fs_path &path) {
+        auto file_result = Platform::MappedFile::Open(path);
+        if (!file_result) {
+            return std::unexpected(file_result.error());
+        }
+
+        RefPtr<Platform::MappedFile> file = file_result.value();
+        std::span<const char> data        = file->span();
+
+        auto invalid = [&path](std::string_view reason) {
+            return make_fs_error<RefPtr<TemplateImage>>(
+                std::error_code(), {std::format("[TemplateImage] {}: {}", path.string(), reason)});
+        };
+
+        Header header;
+        if (data.size() < sizeof(Header)) {
+            return invalid("File is too small to be a template image");
+        }
+        std::memcpy(&header, data.data(), sizeof(Header));
+
+        if (header.m_magic != MAGIC || header.m_version != VERSION) {
+            return invalid("Unknown image format or version");
+        }
+
+        const size_t entries_size  = static_cast<size_t>(header.m_entry_count) * sizeof(Entry);
+        const size_t strings_begin = sizeof(Header) + entries_size;
+        if (data.size() < strings_begin || data.size() - strings_begin < header.m_strings_size) {
+            return invalid("Entry or string table exceeds the file");
+        }
+
+        auto image     = make_referable<TemplateImage>();
+        image->m_file  = file;
+        image->m_entries = {reinterpret_cast<const Entry *>(data.data() + sizeof(Header)),
+                            header.m_entry_count};
+        image->m_strings = data.subspan(strings_begin, header.m_strings_size);
+
+        for (const Entry &entry : image->m_entries) {
+            if (static_cast<size_t>(entry.m_type_offset) + entry.m_type_size >
+                    image->m_strings.size() ||
+                static_cast<size_t>(entry.m_data_offset) + entry.m_data_size > data.size()) {
+                return invalid("Entry points outside of the file");
+            }
+        }
+
+        // find() binary searches the table in place
+        const bool sorted = std::is_sorted(
+            image->m_entries.begin(), image->m_entries.end(),
+            [&](const Entry &a, const Entry &b) {
+                return EntryLess(image->type(a), a.m_is_custom, image->type(b), b.m_is_custom);
+            });
+        if (!sorted) {
+            return invalid("Entry table is not sorted");
+        }
+
+        return image;
+    }
+
+    std::string_view TemplateImage::type(const Entry &entry) const {
+        return {m_strings.data() + entry.m_type_offset, entry.m_type_size};
+    }
+
+    const TemplateImage::Entry *TemplateImage::find(std::string_view type,
+                                                    bool is_custom) const {
+        auto it = std::lower_bound(m_entries.begin(), m_entries.end(), type,
+                                   [&](const Entry &entry, std::string_view key) {
+                                       return EntryLess(this->type(entry), entry.m_is_custom, key,
+                                                        is_custom);
+                                   });
+        if (it == m_entries.end() || static_cast<bool>(it->m_is_custom) != is_custom ||
+            this->type(*it) != type) {
+            return nullptr;
+        }
+        return &*it;
+    }
+
+    const TemplateImage::Entry *TemplateImage::findSource(const Source &source) const {
+        const Entry *entry = find(source.m_type, source.m_is_custom);
+        if (!entry || entry->m_source_size != source.m_size ||
+            entry->m_source_mtime != source.m_mtime) {
+            return nullptr;
+        }
+        return entry;
+    }
+
+    bool TemplateImage::isUpToDate(std::span<const Source> sources) const {
+        if (sources.size() != m_entries.size()) {
+            return false;
+        }
+        return std::all_of(sources.begin(), sources.end(),
+                           [this](const Source &source) { return findSource(source) != nullptr; });
+    }
+
+    Result<Template, SerialError> TemplateImage::load(const Entry &entry) const {
+        // Templates that failed to compile keep an empty entry, so the image
+        // still validates and the JSON is not parsed again at every startup
+        if (entry.m_data_size == 0) {
+            return make_serial_error<Template>("[TemplateImage]",
+                                               "Template failed to compile from its JSON", 0,
+                                               std::string(type(entry)));
+        }
+        return DecodeTemplate(type(entry), m_file->span().subspan(entry.m_data_offset,
+                                                                  entry.m_data_size));
+    }
+
+    void TemplateImage::CollectSources(const fs_path &directory, bool is_custom,
+                                       std::vector<Source> &out) {
+        std::error_code ec;
+        for (auto &subpath : std::filesystem::directory_iterator{directory, ec}) {
+            if (!subpath.is_regular_file() || subpath.path().extension() != ".json") {
+                continue;
+            }
+
+            auto size  = Filesystem::file_size(subpath.path());
+            auto mtime = Filesystem::last_write_time(subpath.path());
+            if (!size || !mtime) {
+                continue;
+            }
+
+            out.emplace_back(subpath.path().stem().string(), subpath.path(), is_custom,
+                             static_cast<u64>(size.value()),
+                             static_cast<s64>(mtime.value().time_since_epoch().count()));
+        }
+    }
+
+    Result<void, FSError> TemplateImage::Build(const fs_path &path,
+                                               std::span<const Source> sources,
+                                               RefPtr<TemplateImage> previous) {
+        struct Compiled {
+            u64 m_hash = 0;
+            std::string m_data;  // Empty if the template failed to compile
+        };
+
+        std::vector<Compiled> compiled(sources.size());
+
+        std::vector<size_t> indices(sources.size());
+        std::iota(indices.begin(), indices.end(), 0);
+
+        std::for_each(std::execution::par, indices.begin(), indices.end(), [&](size_t i) {
+            const Source &source = sources[i];
+            Compiled &out        = compiled[i];
+
+            // Unchanged on disk since the previous build
+            if (previous) {
+                if (const Entry *entry = previous->findSource(source)) {
+                    out.m_hash = entry->m_source_hash;
+                    out.m_data.assign(previous->m_file->data() + entry->m_data_offset,
+                                      entry->m_data_size);
+                    return;
+                }
+            }
+
+            std::ifstream file(source.m_path, std::ios::in | std::ios::binary);
+            if (!file.is_open()) {
+                TOOLBOX_ERROR_V("[TemplateImage] Failed to open template json {}",
+                                source.m_path.string());
+                return;
+            }
+            std::string json_data{std::istreambuf_iterator<char>(file),
+                                  std::istreambuf_iterator<char>()};
+            out.m_hash = HashBytes(json_data);
+
+            // Touched but not modified, e.g. by a checkout
+            if (previous) {
+                const Entry *entry = previous->find(source.m_type, source.m_is_custom);
+                if (entry && entry->m_source_hash == out.m_hash) {
+                    out.m_data.assign(previous->m_file->data() + entry->m_data_offset,
+                                      entry->m_data_size);
+                    return;
+                }
+            }
+
+            Deserializer in(std::span<const char>(json_data.data(), json_data.size()),
+                            source.m_path.string());
+
+            Template template_;
+            template_.m_type = source.m_type;
+            auto result      = template_.deserialize(in);
+            if (!result) {
+                TOOLBOX_ERROR_V("[TemplateImage] Failed to load template json {}: {}",
+                                source.m_path.string(), result.error().m_message.front());
+                return;
+            }
+
+            std::stringbuf buffer(std::ios::out | std::ios::binary);
+            Serializer data_out(&buffer);
+            auto encode_result = EncodeTemplate(template_, data_out);
+            if (!encode_result) {
+                TOOLBOX_ERROR_V("[TemplateImage] Failed to encode template {}: {}",
+                                source.m_type, encode_result.error().m_message.front());
+                return;
+            }
+            out.m_data = std::move(buffer).str();
+        });
+
+        // Payloads were copied out, and the mapping must be gone before the
+        // file can be replaced
+        previous.reset();
+
+        std::sort(indices.begin(), indices.end(), [&](size_t a, size_t b) {
+            return EntryLess(sources[a].m_type, sources[a].m_is_custom, sources[b].m_type,
+                             sources[b].m_is_custom);
+        });
+
+        std::string strings;
+        std::vector<Entry> entries(sources.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            const Source &source = sources[indices[i]];
+
+            Entry &entry         = entries[i];
+            entry                = {};
+            entry.m_source_hash  = compiled[indices[i]].m_hash;
+            entry.m_source_mtime = source.m_mtime;
+            entry.m_source_size  = source.m_size;
+            entry.m_type_offset  = static_cast<u32>(strings.size());
+            entry.m_type_size    = static_cast<u32>(source.m_type.size());
+            entry.m_is_custom    = source.m_is_custom;
+            strings += source.m_type;
+        }
+
+        size_t data_offset = sizeof(Header) + entries.size() * sizeof(Entry) + strings.size();
+        for (size_t i = 0; i < indices.size(); ++i) {
+            entries[i].m_data_offset = static_cast<u32>(data_offset);
+            entries[i].m_data_size   = static_cast<u32>(compiled[indices[i]].m_data.size());
+            data_offset += compiled[indices[i]].m_data.size();
+        }
+
+        if (data_offset > std::numeric_limits<u32>::max()) {
+            return make_fs_error<void>(std::error_code(),
+                                       {"[TemplateImage] Templates exceed the image size limit"});
+        }
+
+        Header header;
+        header.m_magic        = MAGIC;
+        header.m_version      = VERSION;
+        header.m_entry_count  = static_cast<u32>(entries.size());
+        header.m_strings_size = static_cast<u32>(strings.size());
+
+        if (!Filesystem::exists(path.parent_path()).value_or(false)) {
+            auto result = Filesystem::create_directories(path.parent_path());
+            if (!result) {
+                return std::unexpected(result.error());
+            }
+        }
+
+        fs_path temp_path = path;
+        temp_path += ".tmp";
+        {
+            std::ofstream file(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+            file.write(reinterpret_cast<const char *>(entries.data()),
+                       entries.size() * sizeof(Entry));
+            file.write(strings.data(), strings.size());
+            for (size_t index : indices) {
+                file.write(compiled[index].m_data.data(), compiled[index].m_data.size());
+            }
+            file.close();
+            if (!file) {
+                (void)Filesystem::remove(temp_path);
+                return make_fs_error<void>(std::error_code(),
+                                           {"[TemplateImage] Failed to write the template image"});
+            }
+        }
+
+        // Renaming over the old image means a failed build never leaves a
+        // truncated one behind
+        auto result = Filesystem::rename(temp_path, path);
+        if (!result) {
+            (void)Filesystem::remove(temp_path);
+            return std::unexpected(result.error());
+        }
+        return {};
+    }
+
+}  // namespace Toolbox::Object
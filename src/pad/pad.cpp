@@ -1,6 +1,7 @@
 #include "pad/pad.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <magic_enum.hpp>
 #include <numeric>
@@ -58,6 +59,37 @@ namespace Toolbox {
         return pad_info;
     }
 
+    // Drawn from one counter for every PadData, so a copy or move assigned
+    // over another object can never reuse a generation its cursors saw.
+    static u64 NextGeneration() {
+        static std::atomic<u64> s_generation = 0;
+        return ++s_generation;
+    }
+
+    template <typename T>
+    static void BuildFrameEnds(const std::vector<PadInputInfo<T>> &infos, std::vector<u32> &ends) {
+        ends.resize(infos.size());
+        u32 frame = 0;
+        for (size_t i = 0; i < infos.size(); ++i) {
+            frame += infos[i].m_frames_active;
+            ends[i] = frame;
+        }
+    }
+
+    static u32 StartFrameOf(const std::vector<u32> &ends, size_t index) {
+        index = std::min(index, ends.size());
+        return index == 0 ? 0 : ends[index - 1];
+    }
+
+    // The first chunk whose end is at or past `frame`, or npos past the last
+    // chunk. A frame on a boundary belongs to the chunk that ends there; this
+    // is the `>=` scan the lookups have always done, so playback lines up
+    // with recordings made by earlier versions.
+    static size_t ChunkAt(const std::vector<u32> &ends, u32 frame) {
+        auto it = std::lower_bound(ends.begin(), ends.end(), frame);
+        return it == ends.end() ? PadData::npos : static_cast<size_t>(it - ends.begin());
+    }
+
     Result<void, SerialError> PadData::serialize(Serializer &out) const {
         out.writeBytes({m_metatag.c_str(), 0x10});
         out.write<u32, std::endian::big>(m_frame_count);
@@ -167,6 +199,8 @@ namespace Toolbox {
         m_trigger_r =
             deserializeInputAnalog<u8>(in, trigger_r_frames, trigger_r_data, trigger_r_frames_size);
 
+        rebuildFrameIndex();
+
         return {};
     }
 
@@ -241,40 +275,16 @@ namespace Toolbox {
     bool PadData::calcFrameCount(u32 &frame_count) {
         frame_count = 0;
 
-        u32 buttons_frame_count = std::accumulate(
-            m_buttons.begin(), m_buttons.end(), 0,
-            [](u32 val, const PadInputInfo<PadButtons> &info) { return val + info.m_frames_active; });
-
-        u32 analog_magnitude_frame_count = std::accumulate(
-            m_analog_magnitude.begin(), m_analog_magnitude.end(), 0,
-            [](u32 val, const PadInputInfo<float> &info) { return val + info.m_frames_active; });
-
-        if (buttons_frame_count != analog_magnitude_frame_count) {
-            return false;
-        }
-
-        u32 analog_direction_frame_count = std::accumulate(
-            m_analog_direction.begin(), m_analog_direction.end(), 0,
-            [](u32 val, const PadInputInfo<s16> &info) { return val + info.m_frames_active; });
-
-        if (analog_magnitude_frame_count != analog_direction_frame_count) {
-            return false;
-        }
-
-        u32 trigger_l_frame_count = std::accumulate(
-            m_trigger_l.begin(), m_trigger_l.end(), 0,
-            [](u32 val, const PadInputInfo<u8> &info) { return val + info.m_frames_active; });
-
-        if (analog_direction_frame_count != trigger_l_frame_count) {
-            return false;
-        }
-
-        u32 trigger_r_frame_count = std::accumulate(
-            m_trigger_r.begin(), m_trigger_r.end(), 0,
-            [](u32 val, const PadInputInfo<u8> &info) { return val + info.m_frames_active; });
+        auto channel_frame_count = [this](PadChannel channel) -> u32 {
+            const std::vector<u32> &ends = getFrameEnds(channel);
+            return ends.empty() ? 0 : ends.back();
+        };
 
-        if (trigger_l_frame_count != trigger_r_frame_count) {
-            return false;
+        const u32 buttons_frame_count = channel_frame_count(CHANNEL_BUTTONS);
+        for (size_t channel = 0; channel < CHANNEL_COUNT; ++channel) {
+            if (channel_frame_count(static_cast<PadChannel>(channel)) != buttons_frame_count) {
+                return false;
+            }
         }
 
         m_frame_count = buttons_frame_count;
@@ -283,98 +293,121 @@ namespace Toolbox {
     }
 
     u32 PadData::getPadAnalogMagnitudeStartFrame(size_t index) const {
-        u32 start_frame = 0;
-        for (size_t i = 0; i < index; ++i) {
-            start_frame += m_analog_magnitude[i].m_frames_active;
-        }
-        return start_frame;
+        return StartFrameOf(getFrameEnds(CHANNEL_ANALOG_MAGNITUDE), index);
     }
 
     size_t PadData::getPadAnalogMagnitudeIndex(u32 start_frame) const {
-        u32 frame = 0;
-        for (size_t i = 0; i < m_analog_magnitude.size(); ++i) {
-            frame += m_analog_magnitude[i].m_frames_active;
-            if (frame >= start_frame) {
-                return i;
-            }
-        }
-        return npos;
+        return ChunkAt(getFrameEnds(CHANNEL_ANALOG_MAGNITUDE), start_frame);
     }
 
     u32 PadData::getPadAnalogDirectionStartFrame(size_t index) const {
-        u32 start_frame = 0;
-        for (size_t i = 0; i < index; ++i) {
-            start_frame += m_analog_direction[i].m_frames_active;
-        }
-        return start_frame;
+        return StartFrameOf(getFrameEnds(CHANNEL_ANALOG_DIRECTION), index);
     }
 
     size_t PadData::getPadAnalogDirectionIndex(u32 start_frame) const {
-        u32 frame = 0;
-        for (size_t i = 0; i < m_analog_direction.size(); ++i) {
-            frame += m_analog_direction[i].m_frames_active;
-            if (frame >= start_frame) {
-                return i;
-            }
-        }
-        return npos;
+        return ChunkAt(getFrameEnds(CHANNEL_ANALOG_DIRECTION), start_frame);
     }
 
     u32 PadData::getPadButtonStartFrame(size_t index) const {
-        u32 start_frame = 0;
-        for (size_t i = 0; i < index; ++i) {
-            start_frame += m_buttons[i].m_frames_active;
-        }
-        return start_frame;
+        return StartFrameOf(getFrameEnds(CHANNEL_BUTTONS), index);
     }
 
     size_t PadData::getPadButtonIndex(u32 start_frame) const {
-        u32 frame = 0;
-        for (size_t i = 0; i < m_buttons.size(); ++i) {
-            frame += m_buttons[i].m_frames_active;
-            if (frame >= start_frame) {
-                return i;
-            }
-        }
-        return npos;
+        return ChunkAt(getFrameEnds(CHANNEL_BUTTONS), start_frame);
     }
 
     u32 PadData::getPadTriggerLStartFrame(size_t index) const {
-        u32 start_frame = 0;
-        for (size_t i = 0; i < index; ++i) {
-            start_frame += m_trigger_l[i].m_frames_active;
-        }
-        return start_frame;
+        return StartFrameOf(getFrameEnds(CHANNEL_TRIGGER_L), index);
     }
 
     size_t PadData::getPadTriggerLIndex(u32 start_frame) const {
-        u32 frame = 0;
-        for (size_t i = 0; i < m_trigger_l.size(); ++i) {
-            frame += m_trigger_l[i].m_frames_active;
-            if (frame >= start_frame) {
-                return i;
-            }
-        }
-        return npos;
+        return ChunkAt(getFrameEnds(CHANNEL_TRIGGER_L), start_frame);
     }
 
     u32 PadData::getPadTriggerRStartFrame(size_t index) const {
-        u32 start_frame = 0;
-        for (size_t i = 0; i < index; ++i) {
-            start_frame += m_trigger_r[i].m_frames_active;
-        }
-        return start_frame;
+        return StartFrameOf(getFrameEnds(CHANNEL_TRIGGER_R), index);
     }
 
     size_t PadData::getPadTriggerRIndex(u32 start_frame) const {
-        u32 frame = 0;
-        for (size_t i = 0; i < m_trigger_r.size(); ++i) {
-            frame += m_trigger_r[i].m_frames_active;
-            if (frame >= start_frame) {
-                return i;
+        return ChunkAt(getFrameEnds(CHANNEL_TRIGGER_R), start_frame);
+    }
+
+    PadFrameInputs PadData::sampleFrame(u32 frame) const { return cursor(frame).inputs(*this); }
+
+    PadData::Cursor PadData::cursor(u32 frame) const {
+        Cursor cursor;
+        cursor.seek(*this, frame);
+        return cursor;
+    }
+
+    const std::vector<u32> &PadData::getFrameEnds(PadChannel channel) const {
+        return m_frame_ends[channel];
+    }
+
+    void PadData::rebuildFrameIndex() {
+        BuildFrameEnds(m_analog_magnitude, m_frame_ends[CHANNEL_ANALOG_MAGNITUDE]);
+        BuildFrameEnds(m_analog_direction, m_frame_ends[CHANNEL_ANALOG_DIRECTION]);
+        BuildFrameEnds(m_buttons, m_frame_ends[CHANNEL_BUTTONS]);
+        BuildFrameEnds(m_trigger_l, m_frame_ends[CHANNEL_TRIGGER_L]);
+        BuildFrameEnds(m_trigger_r, m_frame_ends[CHANNEL_TRIGGER_R]);
+        m_generation = NextGeneration();
+    }
+
+    void PadData::extendFrameIndex(PadChannel channel, u32 frames_held) {
+        // Chunks before the new one keep their indices, so cursors stay valid.
+        std::vector<u32> &ends = m_frame_ends[channel];
+        ends.push_back((ends.empty() ? 0 : ends.back()) + frames_held);
+    }
+
+    void PadData::Cursor::seek(const PadData &data, u32 frame) {
+        if (m_data != &data || m_generation != data.m_generation || frame < m_frame) {
+            m_data       = &data;
+            m_generation = data.m_generation;
+            m_indices    = {};
+        }
+        m_frame = frame;
+
+        for (size_t channel = 0; channel < PadData::CHANNEL_COUNT; ++channel) {
+            const std::vector<u32> &ends = data.getFrameEnds(static_cast<PadChannel>(channel));
+            size_t &index                = m_indices[channel];
+
+            // Playback moves a frame or so at a time, so the chunk is almost
+            // always within a few steps; search only when it is not. Matches
+            // ChunkAt() on boundaries.
+            for (size_t steps = 0; steps < 8 && index < ends.size() && ends[index] < frame;
+                 ++steps) {
+                ++index;
+            }
+            if (index < ends.size() && ends[index] < frame) {
+                index = std::lower_bound(ends.begin() + index, ends.end(), frame) - ends.begin();
             }
         }
-        return npos;
+    }
+
+    PadFrameInputs PadData::Cursor::inputs(const PadData &data) const {
+        if (m_data != &data || m_generation != data.m_generation) {
+            return data.cursor(m_frame).inputs(data);
+        }
+
+        PadFrameInputs inputs;
+        if (m_indices[CHANNEL_ANALOG_MAGNITUDE] < data.m_analog_magnitude.size()) {
+            inputs.m_analog_magnitude =
+                data.m_analog_magnitude[m_indices[CHANNEL_ANALOG_MAGNITUDE]].m_input_state;
+        }
+        if (m_indices[CHANNEL_ANALOG_DIRECTION] < data.m_analog_direction.size()) {
+            inputs.m_analog_direction =
+                data.m_analog_direction[m_indices[CHANNEL_ANALOG_DIRECTION]].m_input_state;
+        }
+        if (m_indices[CHANNEL_BUTTONS] < data.m_buttons.size()) {
+            inputs.m_buttons = data.m_buttons[m_indices[CHANNEL_BUTTONS]].m_input_state;
+        }
+        if (m_indices[CHANNEL_TRIGGER_L] < data.m_trigger_l.size()) {
+            inputs.m_trigger_l = data.m_trigger_l[m_indices[CHANNEL_TRIGGER_L]].m_input_state;
+        }
+        if (m_indices[CHANNEL_TRIGGER_R] < data.m_trigger_r.size()) {
+            inputs.m_trigger_r = data.m_trigger_r[m_indices[CHANNEL_TRIGGER_R]].m_input_state;
+        }
+        return inputs;
     }
 
     size_t PadData::addPadAnalogMagnitudeInput(u32 start_frame, u32 frames_held, float magnitude) {
@@ -409,42 +442,50 @@ namespace Toolbox {
         return index;
 #else
         m_analog_magnitude.emplace_back(frames_held, magnitude);
+        extendFrameIndex(CHANNEL_ANALOG_MAGNITUDE, frames_held);
         return m_analog_magnitude.size() - 1;
 #endif
     }
 
     size_t PadData::addPadAnalogDirectionInput(u32 start_frame, u32 frames_held, float direction) {
         m_analog_direction.emplace_back(frames_held, convertAngleFloatToS16(direction));
+        extendFrameIndex(CHANNEL_ANALOG_DIRECTION, frames_held);
         return m_analog_direction.size() - 1;
     }
 
     size_t PadData::addPadAnalogDirectionInput(u32 start_frame, u32 frames_held, s16 direction) {
         m_analog_direction.emplace_back(frames_held, direction);
+        extendFrameIndex(CHANNEL_ANALOG_DIRECTION, frames_held);
         return m_analog_direction.size() - 1;
     }
 
     size_t PadData::addPadButtonInput(u32 start_frame, u32 frames_held, PadButtons buttons) {
         m_buttons.emplace_back(frames_held, buttons);
+        extendFrameIndex(CHANNEL_BUTTONS, frames_held);
         return m_buttons.size() - 1;
     }
 
     size_t PadData::addPadTriggerLInput(u32 start_frame, u32 frames_held, float intensity) {
         m_trigger_l.emplace_back(frames_held, static_cast<u8>(intensity * 150.0f));
+        extendFrameIndex(CHANNEL_TRIGGER_L, frames_held);
         return m_trigger_l.size() - 1;
     }
 
     size_t PadData::addPadTriggerLInput(u32 start_frame, u32 frames_held, u8 intensity) {
         m_trigger_l.emplace_back(frames_held, intensity);
+        extendFrameIndex(CHANNEL_TRIGGER_L, frames_held);
         return m_trigger_l.size() - 1;
     }
 
     size_t PadData::addPadTriggerRInput(u32 start_frame, u32 frames_held, float intensity) {
         m_trigger_r.emplace_back(frames_held, static_cast<u8>(intensity * 150.0f));
+        extendFrameIndex(CHANNEL_TRIGGER_R, frames_held);
         return m_trigger_r.size() - 1;
     }
 
     size_t PadData::addPadTriggerRInput(u32 start_frame, u32 frames_held, u8 intensity) {
         m_trigger_r.emplace_back(frames_held, intensity);
+        extendFrameIndex(CHANNEL_TRIGGER_R, frames_held);
         return m_trigger_r.size() - 1;
     }
 
@@ -458,6 +499,7 @@ namespace Toolbox {
         } else {
             m_analog_magnitude[0].m_input_state = 0.0f;
         }
+        rebuildFrameIndex();
         return {};
     }
 
@@ -471,6 +513,7 @@ namespace Toolbox {
         } else {
             m_analog_direction[0].m_input_state = 0;
         }
+        rebuildFrameIndex();
         return {};
     }
 
@@ -484,6 +527,7 @@ namespace Toolbox {
         } else {
             m_buttons[0].m_input_state = PadButtons::BUTTON_NONE;
         }
+        rebuildFrameIndex();
         return {};
     }
 
@@ -497,6 +541,7 @@ namespace Toolbox {
         } else {
             m_trigger_l[0].m_input_state = 0;
         }
+        rebuildFrameIndex();
         return {};
     }
 
@@ -510,6 +555,7 @@ namespace Toolbox {
         } else {
             m_trigger_r[0].m_input_state = 0;
         }
+        rebuildFrameIndex();
         return {};
     }
 
@@ -613,6 +659,8 @@ namespace Toolbox {
                 }
             }
         }
+
+        rebuildFrameIndex();
     }
 
 }  // namespace Toolbox
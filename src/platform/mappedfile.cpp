@@ -0,0 +1,122 @@
+#include "platform/mappedfile.hpp"
+
+#ifdef TOOLBOX_PLATFORM_WINDOWS
+#include <Windows.h>
+#elif defined(TOOLBOX_PLATFORM_LINUX)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Toolbox::Platform {
+
+#ifdef TOOLBOX_PLATFORM_WINDOWS
+
+    Result<RefPtr<MappedFile>, FSError> MappedFile::Open(const fs_path &path) {
+        HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return make_fs_error<RefPtr<MappedFile>>(
+                std::error_code(GetLastError(), std::system_category()),
+                {std::format("MAP: Failed to open file \"{}\"", path.string())});
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size)) {
+            const DWORD err = GetLastError();
+            CloseHandle(file);
+            return make_fs_error<RefPtr<MappedFile>>(
+                std::error_code(err, std::system_category()),
+                {std::format("MAP: Failed to query size of \"{}\"", path.string())});
+        }
+
+        auto mapped    = make_referable<MappedFile>();
+        mapped->m_size = static_cast<size_t>(file_size.QuadPart);
+
+        // Empty files cannot be mapped, but are valid (empty) views
+        if (mapped->m_size == 0) {
+            CloseHandle(file);
+            return mapped;
+        }
+
+        mapped->m_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const DWORD map_err = GetLastError();
+        CloseHandle(file);
+        if (!mapped->m_mapping) {
+            return make_fs_error<RefPtr<MappedFile>>(
+                std::error_code(map_err, std::system_category()),
+                {std::format("MAP: Failed to create mapping of \"{}\"", path.string())});
+        }
+
+        mapped->m_data = MapViewOfFile(mapped->m_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!mapped->m_data) {
+            return make_fs_error<RefPtr<MappedFile>>(
+                std::error_code(GetLastError(), std::system_category()),
+                {std::format("MAP: Failed to map view of \"{}\"", path.string())});
+        }
+
+        return mapped;
+    }
+
+    MappedFile::~MappedFile() {
+        if (m_data) {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+        }
+    }
+
+#elif defined(TOOLBOX_PLATFORM_LINUX)
+
+    Result<RefPtr<MappedFile>, FSError> MappedFile::Open(const fs_path &path) {
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            return make_fs_error<RefPtr<MappedFile>>(
+                std::error_code(errno, std::generic_category()),
+                {std::format("MAP: Failed to open file \"{}\"", path.string())});
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) == -1) {
+            const int err = errno;
+            close(fd);
+            return make_fs_error<RefPtr<MappedFile>>(
+                std::error_code(err, std::generic_category()),
+                {std::format("MAP: Failed to query size of \"{}\"", path.string())});
+        }
+
+        auto mapped    = make_referable<MappedFile>();
+        mapped->m_size = static_cast<size_t>(st.st_size);
+
+        // Empty files cannot be mapped, but are valid (empty) views
+        if (mapped->m_size == 0) {
+            close(fd);
+            return mapped;
+        }
+
+        void *ptr     = mmap(nullptr, mapped->m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        const int err = errno;
+        close(fd);
+        if (ptr == MAP_FAILED) {
+            mapped->m_size = 0;
+            return make_fs_error<RefPtr<MappedFile>>(
+                std::error_code(err, std::generic_category()),
+                {std::format("MAP: Failed to map \"{}\"", path.string())});
+        }
+
+        mapped->m_data = ptr;
+        return mapped;
+    }
+
+    MappedFile::~MappedFile() {
+        if (m_data) {
+            munmap(m_data, m_size);
+        }
+    }
+
+#endif
+
+}  // namespace Toolbox::Platform
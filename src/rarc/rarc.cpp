@@ -1,11 +1,14 @@
 #include "rarc/rarc.hpp"
-#include "librii/SZS.hpp"
 #include "objlib/nameref.hpp"
+#include "platform/mappedfile.hpp"
 #include "serial.hpp"
+#include "szs/yaz0.hpp"
 
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <unordered_map>
+#include <utility>
 
 using namespace Toolbox::Object;
 
@@ -88,6 +91,11 @@ namespace Toolbox::RARC {
         std::vector<FSNode> fs_nodes;
         std::vector<char> string_data;  // One giant buffer
         std::vector<char> file_data;    // One giant buffer
+
+        // On load the file data is not copied into file_data, but viewed
+        // in place so that every file node can share it.
+        RefPtr<const void> file_backing;
+        std::span<const char> file_view;
     };
 
     static bool isLowNodeFolder(const FSNode &node) {
@@ -95,8 +103,11 @@ namespace Toolbox::RARC {
     }
     static bool isSpecialPath(std::string_view name) { return name == "." || name == ".."; }
 
+    // When `backing` is given, `image` must hold the entire archive and file
+    // data is viewed within it instead of being read from `in`.
     static Result<ScopePtr<LowResourceArchive>, SerialError>
-    loadLowResourceArchive(Deserializer &in);
+    loadLowResourceArchive(Deserializer &in, std::span<const char> image = {},
+                           RefPtr<const void> backing = {});
 
     static Result<void, SerialError> saveLowResourceArchive(const LowResourceArchive &low_archive,
                                                             Serializer &out);
@@ -141,6 +152,116 @@ namespace Toolbox::RARC {
 
     static void getSortedDirectoryListR(const fs_path &path, std::vector<fs_path> &out);
 
+    // Archive paths are matched case-insensitively, with '/' separators.
+    static std::string toIndexPath(const fs_path &path) {
+        std::string key;
+        for (const fs_path &part : path) {
+            std::string part_str = part.string();
+            if (part_str.empty() || part_str == "." || part_str == "/" || part_str == "\\") {
+                continue;
+            }
+            if (!key.empty()) {
+                key += '/';
+            }
+            key += part_str;
+        }
+        std::transform(key.begin(), key.end(), key.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return key;
+    }
+
+    static size_t folderEnd(const ResourceArchive::Node &node, size_t index) {
+        return node.folder.sibling_next > static_cast<s32>(index)
+                   ? static_cast<size_t>(node.folder.sibling_next)
+                   : index + 1;
+    }
+
+    // Calls `fn(index, path)` for each node in [first, last). Nodes are stored
+    // in DFS order, where each folder's sibling_next marks the end of its
+    // subtree, so the folders enclosing `first` are the ones before it whose
+    // subtree reaches past it.
+    template <typename _Fn>
+    static void forEachIndexPath(const std::vector<ResourceArchive::Node> &nodes, size_t first,
+                                 size_t last, _Fn &&fn) {
+        struct OpenFolder {
+            size_t end;
+            std::string path;
+        };
+        std::vector<OpenFolder> folder_stack;
+
+        std::vector<size_t> ancestors;
+        for (size_t i = first; i-- > 0;) {
+            if (nodes[i].is_folder() && folderEnd(nodes[i], i) > first) {
+                ancestors.push_back(i);
+            }
+        }
+        for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+            std::string path = toIndexPath(nodes[*it].name);
+            if (!folder_stack.empty()) {
+                path = folder_stack.back().path + '/' + path;
+            }
+            folder_stack.push_back({folderEnd(nodes[*it], *it), std::move(path)});
+        }
+
+        for (size_t i = first; i < last; ++i) {
+            const ResourceArchive::Node &node = nodes[i];
+
+            while (!folder_stack.empty() && folder_stack.back().end <= i) {
+                folder_stack.pop_back();
+            }
+
+            std::string path = toIndexPath(node.name);
+            if (!folder_stack.empty()) {
+                path = folder_stack.back().path + '/' + path;
+            }
+
+            if (node.is_folder()) {
+                folder_stack.push_back({folderEnd(node, i), path});
+            }
+
+            fn(i, std::move(path));
+        }
+    }
+
+    static constexpr size_t s_unresolved_index = std::numeric_limits<size_t>::max();
+
+    template <typename _Index, typename _Key>
+    static void addIndexKey(_Index &index, _Key &&key, size_t i) {
+        // Lookups historically resolved to the first match in node order
+        auto &entry = index[std::forward<_Key>(key)];
+        if (entry.count++ == 0 || i < entry.first) {
+            entry.first = i;
+        }
+    }
+
+    // Returns true when other nodes still carry `key` but its first match
+    // was in [first, last), so the entry has to be pointed at a later node.
+    template <typename _Index, typename _Key>
+    static bool removeIndexKey(_Index &index, const _Key &key, size_t first, size_t last) {
+        auto it = index.find(key);
+        if (it == index.end()) {
+            return false;
+        }
+        if (--it->second.count == 0) {
+            index.erase(it);
+            return false;
+        }
+        if (it->second.first >= first && it->second.first < last) {
+            it->second.first = s_unresolved_index;
+            return true;
+        }
+        return false;
+    }
+
+    template <typename _Index>
+    static void shiftIndex(_Index &index, size_t old_last, size_t new_last) {
+        for (auto &[key, entry] : index) {
+            if (entry.first != s_unresolved_index && entry.first >= old_last) {
+                entry.first = entry.first - old_last + new_last;
+            }
+        }
+    }
+
     // ---------- //
 
     bool ResourceArchive::IsMagicValid(u32 magic) { return magic == 'RARC'; }
@@ -162,7 +283,6 @@ namespace Toolbox::RARC {
             return IsMagicValid(std::byteswap(magic));
         }
 
-        // TODO: Implement Yaz0 compression algorithm
         if (path.extension() == ".szs") {
             std::ifstream in_test(path, std::ios::binary);
             if (!in_test.is_open()) {
@@ -177,7 +297,7 @@ namespace Toolbox::RARC {
 
             in_test.seekg(0, std::ios::beg);
 
-            if (!librii::szs::isDataYaz0Compressed(magic_buf)) {
+            if (!SZS::IsYaz0Compressed(magic_buf)) {
                 u32 magic = (magic_buf[0] << 24) | (magic_buf[1] << 16) | (magic_buf[2] << 8) |
                             (magic_buf[3]);
                 return IsMagicValid(magic);
@@ -186,8 +306,10 @@ namespace Toolbox::RARC {
             std::vector<u8> file_chunk(std::min<size_t>(file_size, 1024));
             in_test.read((char *)file_chunk.data(), file_chunk.size());
 
-            std::vector<u8> decomp_out;
-            if (!librii::szs::decodeFirstChunk(decomp_out, file_chunk)) {
+            // Only the archive magic is needed, so stop decoding after 4 bytes
+            u8 decomp_out[4];
+            auto decode_result = SZS::Yaz0Decode(file_chunk, decomp_out);
+            if (!decode_result || decode_result.value() < sizeof(decomp_out)) {
                 return false;
             }
 
@@ -343,12 +465,14 @@ namespace Toolbox::RARC {
                     node.flags |= ResourceAttribute::YAZ0_COMPRESSED;
                 }*/
 
-                node.data = p.data;
+                node.data = std::move(p.data);
             }
             node.name = p.name;
             result.m_nodes.push_back(node);
         }
 
+        result.rebuildIndex();
+
         if (!result.recalculateIDs()) {
             return make_fs_error<ResourceArchive>(std::error_code(),
                                                   {"Failed to calculate the IDs"});
@@ -357,104 +481,207 @@ namespace Toolbox::RARC {
         return result;
     }
 
+    Result<ResourceArchive, BaseError>
+    ResourceArchive::CreateFromArchive(const fs_path &archive_path) {
+        auto map_result = Platform::MappedFile::Open(archive_path);
+        if (!map_result) {
+            return std::unexpected(map_result.error());
+        }
+
+        RefPtr<Platform::MappedFile> mapped = std::move(map_result.value());
+
+        RefPtr<const void> backing  = mapped;
+        std::span<const char> image = mapped->span();
+
+        // Compressed archives are decoded once; the mapping is released as
+        // soon as the decoded buffer takes over as the backing store.
+        const std::span<const u8> raw(reinterpret_cast<const u8 *>(image.data()), image.size());
+        if (SZS::IsYaz0Compressed(raw)) {
+            auto decoded = make_referable<std::vector<char>>(SZS::GetYaz0ExpandedSize(raw));
+            auto decode_result = SZS::Yaz0Decode(
+                raw, std::span<u8>(reinterpret_cast<u8 *>(decoded->data()), decoded->size()));
+            if (!decode_result) {
+                return std::unexpected(decode_result.error());
+            }
+            image   = {decoded->data(), decoded->size()};
+            backing = std::move(decoded);
+            mapped.reset();
+        }
+
+        Deserializer in(image, archive_path.string());
+
+        ResourceArchive archive(archive_path.filename().string());
+        auto result = archive.deserializeFrom(in, image, std::move(backing));
+        if (!result) {
+            return std::unexpected(result.error());
+        }
+
+        return archive;
+    }
+
     ResourceArchive::node_it ResourceArchive::findNode(std::string_view name) {
-        return std::find_if(m_nodes.begin(), m_nodes.end(),
-                            [&](const Node &node) { return node.name == name; });
+        return toMutableIt(std::as_const(*this).findNode(name));
     }
 
     ResourceArchive::const_node_it ResourceArchive::findNode(std::string_view name) const {
-        return std::find_if(m_nodes.begin(), m_nodes.end(),
-                            [&](const Node &node) { return node.name == name; });
+        auto it = m_name_index.find(std::string(name));
+        if (it == m_name_index.end()) {
+            return m_nodes.end();
+        }
+        return m_nodes.begin() + it->second.first;
     }
 
     ResourceArchive::node_it ResourceArchive::findNode(s32 id) {
-        return std::find_if(m_nodes.begin(), m_nodes.end(),
-                            [&](const Node &node) { return node.id == id; });
+        return toMutableIt(std::as_const(*this).findNode(id));
     }
 
     ResourceArchive::const_node_it ResourceArchive::findNode(s32 id) const {
-        return std::find_if(m_nodes.begin(), m_nodes.end(),
-                            [&](const Node &node) { return node.id == id; });
+        auto it = m_id_index.find(id);
+        if (it == m_id_index.end()) {
+            return m_nodes.end();
+        }
+        return m_nodes.begin() + it->second.first;
     }
 
     ResourceArchive::node_it ResourceArchive::findNode(const fs_path &path) {
+        return toMutableIt(std::as_const(*this).findNode(path));
+    }
+
+    ResourceArchive::const_node_it ResourceArchive::findNode(const fs_path &path) const {
         if (path.empty() || m_nodes.empty()) {
             return m_nodes.end();
         }
 
-        std::vector<std::string> paths;
+        const std::string key = toIndexPath(path);
 
-        fs_path it_path = path;
-        while (!it_path.empty()) {
-            paths.push_back(it_path.filename().string());
-            it_path = path.parent_path();
+        auto it = m_path_index.find(key);
+        if (it == m_path_index.end()) {
+            // Also accept paths relative to the root folder
+            it = m_path_index.find(toIndexPath(fs_path(m_nodes[0].name) / path));
+            if (it == m_path_index.end()) {
+                return m_nodes.end();
+            }
         }
+        return m_nodes.begin() + it->second.first;
+    }
 
-        QualifiedName qual_path = QualifiedName(paths.rbegin(), paths.rend());
+    void ResourceArchive::rebuildIndex() {
+        m_path_index.clear();
+        m_name_index.clear();
 
-        auto insert_index    = m_nodes.size();
-        auto dir_files_start = m_nodes.begin();
-        auto dir_files_end   = m_nodes.end();
+        m_path_index.reserve(m_nodes.size());
+        m_name_index.reserve(m_nodes.size());
 
-        auto current_node = dir_files_start;
-        while (dir_files_start != dir_files_end) {
-            if (qual_path[0] != current_node->name) {
-                if (current_node->is_folder())
-                    current_node = dir_files_start + current_node->folder.sibling_next;
-                else
-                    current_node++;
-                continue;
-            }
-            if (qual_path.depth() > 1) {
-                if (!current_node->is_folder())
-                    return m_nodes.end();
-                current_node++;
-                continue;
-            }
-            return current_node;
-        }
+        forEachIndexPath(m_nodes, 0, m_nodes.size(), [this](size_t i, std::string &&path) {
+            addIndexKey(m_path_index, std::move(path), i);
+            addIndexKey(m_name_index, m_nodes[i].name, i);
+        });
 
-        return m_nodes.end();
+        rebuildIdIndex();
     }
 
-    ResourceArchive::const_node_it ResourceArchive::findNode(const fs_path &path) const {
-        if (path.empty() || m_nodes.empty()) {
-            return m_nodes.end();
+    void ResourceArchive::rebuildIdIndex() {
+        m_id_index.clear();
+        m_id_index.reserve(m_nodes.size());
+
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            addIndexKey(m_id_index, m_nodes[i].id, i);
         }
+    }
 
-        std::vector<std::string> paths;
+    ResourceArchive::IndexKeys ResourceArchive::collectIndexKeys(size_t first,
+                                                                 size_t last) const {
+        IndexKeys keys;
+        keys.paths.reserve(last - first);
+        keys.names.reserve(last - first);
+        keys.ids.reserve(last - first);
+
+        forEachIndexPath(m_nodes, first, last, [&](size_t i, std::string &&path) {
+            keys.paths.push_back(std::move(path));
+            keys.names.push_back(m_nodes[i].name);
+            keys.ids.push_back(m_nodes[i].id);
+        });
+        return keys;
+    }
 
-        fs_path it_path = path;
-        while (!it_path.empty()) {
-            paths.push_back(it_path.filename().string());
-            it_path = path.parent_path();
+    void ResourceArchive::spliceIndex(size_t first, const IndexKeys &removed, size_t old_last,
+                                      size_t new_last) {
+        std::vector<std::string> lost_paths;
+        std::vector<std::string> lost_names;
+        std::vector<s32> lost_ids;
+
+        for (const std::string &path : removed.paths) {
+            if (removeIndexKey(m_path_index, path, first, old_last)) {
+                lost_paths.push_back(path);
+            }
+        }
+        for (const std::string &name : removed.names) {
+            if (removeIndexKey(m_name_index, name, first, old_last)) {
+                lost_names.push_back(name);
+            }
+        }
+        for (s32 id : removed.ids) {
+            if (removeIndexKey(m_id_index, id, first, old_last)) {
+                lost_ids.push_back(id);
+            }
         }
 
-        QualifiedName qual_path = QualifiedName(paths.rbegin(), paths.rend());
+        if (old_last != new_last) {
+            shiftIndex(m_path_index, old_last, new_last);
+            shiftIndex(m_name_index, old_last, new_last);
+            shiftIndex(m_id_index, old_last, new_last);
+        }
 
-        auto insert_index    = m_nodes.size();
-        auto dir_files_start = m_nodes.begin();
-        auto dir_files_end   = m_nodes.end();
+        forEachIndexPath(m_nodes, first, new_last, [this](size_t i, std::string &&path) {
+            addIndexKey(m_path_index, std::move(path), i);
+            addIndexKey(m_name_index, m_nodes[i].name, i);
+            addIndexKey(m_id_index, m_nodes[i].id, i);
+        });
 
-        auto current_node = dir_files_start;
-        while (dir_files_start != dir_files_end) {
-            if (qual_path[0] != current_node->name) {
-                if (current_node->is_folder())
-                    current_node = dir_files_start + current_node->folder.sibling_next;
-                else
-                    current_node++;
-                continue;
-            }
-            if (qual_path.depth() > 1) {
-                if (!current_node->is_folder())
-                    return m_nodes.end();
-                current_node++;
-                continue;
+        // Nothing before `first` carried the lost keys, and the new run has
+        // been added, so their next match is the first one after it.
+        auto is_resolved = [](const auto &index, const auto &key) {
+            auto it = index.find(key);
+            return it == index.end() || it->second.first != s_unresolved_index;
+        };
+        std::erase_if(lost_names, [&](const std::string &name) {
+            return is_resolved(m_name_index, name);
+        });
+        std::erase_if(lost_ids, [&](s32 id) { return is_resolved(m_id_index, id); });
+        std::erase_if(lost_paths, [&](const std::string &path) {
+            return is_resolved(m_path_index, path);
+        });
+
+        for (size_t i = new_last; i < m_nodes.size(); ++i) {
+            if (lost_names.empty() && lost_ids.empty()) {
+                break;
             }
-            return current_node;
+            std::erase_if(lost_names, [&](const std::string &name) {
+                if (m_nodes[i].name != name) {
+                    return false;
+                }
+                m_name_index.at(name).first = i;
+                return true;
+            });
+            std::erase_if(lost_ids, [&](s32 id) {
+                if (m_nodes[i].id != id) {
+                    return false;
+                }
+                m_id_index.at(id).first = i;
+                return true;
+            });
         }
 
-        return m_nodes.end();
+        if (!lost_paths.empty()) {
+            forEachIndexPath(m_nodes, new_last, m_nodes.size(),
+                             [&](size_t i, std::string &&path) {
+                                 auto it = m_path_index.find(path);
+                                 if (it != m_path_index.end() &&
+                                     it->second.first == s_unresolved_index) {
+                                     it->second.first = i;
+                                 }
+                             });
+        }
     }
 
     Result<void, FSError> ResourceArchive::extractToPath(const fs_path &path) const {
@@ -516,6 +743,15 @@ namespace Toolbox::RARC {
 
         auto parent_index = std::distance(m_nodes.begin(), parent);
 
+        // New files land among the parent's leading files, before its folders
+        const size_t files_first = static_cast<size_t>(parent_index) + 1;
+        const size_t parent_end  = folderEnd(*parent, static_cast<size_t>(parent_index));
+        size_t files_last        = files_first;
+        while (files_last < parent_end && !m_nodes[files_last].is_folder()) {
+            ++files_last;
+        }
+        const IndexKeys old_files = collectIndexKeys(files_first, files_last);
+
         // Manual sort is probably better because we can dodge DFS nonsense
         // effectively Even with O(n^2) because there typically aren't many nodes
         // anyway.
@@ -549,6 +785,8 @@ namespace Toolbox::RARC {
             node.folder.sibling_next += static_cast<s32>(files.size());
         }
 
+        spliceIndex(files_first, old_files, files_last, files_last + files.size());
+
         return {};
     }
 
@@ -625,6 +863,8 @@ namespace Toolbox::RARC {
             node++;
         }
 
+        spliceIndex(insert_index, {}, insert_index, insert_index + tmp_rarc.m_nodes.size());
+
         return {};
     }
 
@@ -699,6 +939,8 @@ namespace Toolbox::RARC {
             node++;
         }
 
+        spliceIndex(insert_index, {}, insert_index, insert_index + 1);
+
         return {};
     }
 
@@ -725,6 +967,8 @@ namespace Toolbox::RARC {
                             if (parent.folder.sibling_next > i)
                                 break;
                         }
+                        const IndexKeys removed = collectIndexKeys(i, i + 1);
+
                         auto deleted_at =
                             std::distance(m_nodes.begin(), m_nodes.erase(m_nodes.begin() + i));
 
@@ -735,11 +979,15 @@ namespace Toolbox::RARC {
                                 continue;
                             node.folder.sibling_next--;
                         }
+
+                        spliceIndex(i, removed, i + 1, i);
                     } else {
                         auto begin = m_nodes.begin() + i;
                         auto end   = m_nodes.begin() + to_delete.folder.sibling_next;
                         auto size  = std::distance(begin, end);
 
+                        const IndexKeys removed = collectIndexKeys(i, i + size);
+
                         auto deleted_at = std::distance(m_nodes.begin(), m_nodes.erase(begin, end));
 
                         for (auto &node : m_nodes) {
@@ -751,6 +999,8 @@ namespace Toolbox::RARC {
                                 node.folder.parent -= 1;
                             node.folder.sibling_next -= static_cast<s32>(size);
                         }
+
+                        spliceIndex(i, removed, i + size, i);
                     }
                 }
             }
@@ -785,11 +1035,15 @@ namespace Toolbox::RARC {
             auto end      = m_nodes.begin() + old_node->folder.sibling_next;
             auto old_size = std::distance(begin, end);
 
+            const size_t replaced_at = std::distance(m_nodes.begin(), begin);
+            const IndexKeys removed  = collectIndexKeys(replaced_at, replaced_at + old_size);
+
             auto deleted_at = std::distance(m_nodes.begin(), m_nodes.erase(begin, end));
 
             // Generate an archive so we can steal the DFS structure.
             auto rarc_result = CreateFromPath(path);
             if (!rarc_result) {
+                spliceIndex(replaced_at, removed, replaced_at + old_size, replaced_at);
                 return std::unexpected(rarc_result.error());
             }
 
@@ -840,6 +1094,9 @@ namespace Toolbox::RARC {
                 }
             }
 
+            spliceIndex(replaced_at, removed, replaced_at + old_size,
+                        replaced_at + tmp_rarc.m_nodes.size());
+
             return {};
         }
 
@@ -860,8 +1117,9 @@ namespace Toolbox::RARC {
         }
         auto fsize = size_result.value();
 
-        old_node->data.resize(fsize);
-        in.read((char *)old_node->data.data(), fsize);
+        std::vector<char> new_data(fsize);
+        in.read(new_data.data(), fsize);
+        old_node->data = std::move(new_data);
 
         return {};
     }
@@ -1127,7 +1385,13 @@ namespace Toolbox::RARC {
     }
 
     Result<void, SerialError> ResourceArchive::deserialize(Deserializer &in) {
-        auto result = loadLowResourceArchive(in);
+        return deserializeFrom(in, {}, {});
+    }
+
+    Result<void, SerialError> ResourceArchive::deserializeFrom(Deserializer &in,
+                                                               std::span<const char> image,
+                                                               RefPtr<const void> backing) {
+        auto result = loadLowResourceArchive(in, image, std::move(backing));
         if (!result) {
             return std::unexpected(result.error());
         }
@@ -1144,6 +1408,8 @@ namespace Toolbox::RARC {
 
         m_name = m_nodes[0].name;
 
+        rebuildIndex();
+
         return {};
     }
 
@@ -1198,11 +1464,15 @@ namespace Toolbox::RARC {
             }
         }
 
+        // Only IDs change here; paths and names keep their positions
+        rebuildIdIndex();
+
         return {};
     }
 
     static Result<ScopePtr<LowResourceArchive>, SerialError>
-    loadLowResourceArchive(Deserializer &in) {
+    loadLowResourceArchive(Deserializer &in, std::span<const char> image,
+                           RefPtr<const void> backing) {
         auto low_archive = make_scoped<LowResourceArchive>();
 
         // Metaheader
@@ -1294,11 +1564,23 @@ namespace Toolbox::RARC {
             in.readBytes(low_archive->string_data);
         }
 
-        low_archive->file_data.resize(low_archive->meta_header.files.size);
-        {
-            in.seek(low_archive->meta_header.nodes.offset + low_archive->meta_header.files.offset,
-                    std::ios::beg);
-            in.readBytes(low_archive->file_data);
+        const size_t files_begin =
+            low_archive->meta_header.nodes.offset + low_archive->meta_header.files.offset;
+        const size_t files_size = low_archive->meta_header.files.size;
+        if (backing) {
+            if (files_begin + files_size > image.size()) {
+                return make_serial_error<ScopePtr<LowResourceArchive>>(
+                    in, "File data extends past the end of the archive");
+            }
+            low_archive->file_backing = std::move(backing);
+            low_archive->file_view    = image.subspan(files_begin, files_size);
+        } else {
+            // Read the file data once and let every node view it
+            auto file_blob = make_referable<std::vector<char>>(files_size);
+            in.seek(files_begin, std::ios::beg);
+            in.readBytes(*file_blob);
+            low_archive->file_view    = {file_blob->data(), file_blob->size()};
+            low_archive->file_backing = std::move(file_blob);
         }
 
         return low_archive;
@@ -1659,8 +1941,15 @@ namespace Toolbox::RARC {
                                                .flags = static_cast<u16>(fs_node->type >> 8),
                                                .name  = low.string_data.data() + fs_node->name};
 
-                auto data_begin = low.file_data.begin() + fs_node->file.offset;
-                tmp_f.data.insert(tmp_f.data.end(), data_begin, data_begin + fs_node->file.size);
+                const size_t data_offset = fs_node->file.offset;
+                const size_t data_size   = fs_node->file.size;
+                if (data_offset + data_size <= low.file_view.size()) {
+                    tmp_f.data =
+                        NodeData(low.file_backing, low.file_view.subspan(data_offset, data_size));
+                } else {
+                    TOOLBOX_WARN("Encountered a file whose data lies outside of the archive! "
+                                 "The file will be loaded as empty.");
+                }
                 out.push_back(tmp_f);
             }
         }
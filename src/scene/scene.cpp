@@ -1,8 +1,14 @@
-﻿#include <fstream>
+﻿#include <algorithm>
+#include <array>
+#include <execution>
+#include <fstream>
+#include <functional>
+#include <sstream>
 #include <stack>
 
 #include "model/objmodel.hpp"
 #include "objlib/utf8_to_sjis.hpp"
+#include "platform/mappedfile.hpp"
 #include "scene/scene.hpp"
 
 namespace Toolbox::Scene {
@@ -32,52 +38,103 @@ namespace Toolbox::Scene {
         fs_path rail_bin    = root / "map/scene.ral";
         fs_path message_bin = root / "map/message.bmg";
 
-        // Load the scene data
-        {
-            std::ifstream file(scene_bin, std::ios::in | std::ios::binary);
-            Deserializer in(file.rdbuf(), scene_bin.string());
-
-            Result<void, SerialError> result = scene->m_map_objects->gameDeserialize(in);
+        auto map_file =
+            [](const fs_path &path) -> Result<RefPtr<Platform::MappedFile>, SerialError> {
+            auto result = Platform::MappedFile::Open(path);
             if (!result) {
-                return std::unexpected(result.error());
+                return make_serial_error<RefPtr<Platform::MappedFile>>(
+                    "[SceneInstance]", result.error().m_message.front(), 0, path.string());
             }
+            return result.value();
+        };
+
+        auto scene_map = map_file(scene_bin);
+        if (!scene_map) {
+            return std::unexpected(scene_map.error());
         }
 
-        // Load the table data
-        {
-            std::ifstream file(tables_bin, std::ios::in | std::ios::binary);
-            Deserializer in(file.rdbuf());
+        auto tables_map = map_file(tables_bin);
+        if (!tables_map) {
+            return std::unexpected(tables_map.error());
+        }
 
-            Result<void, SerialError> result = scene->m_table_objects->gameDeserialize(in);
+        // scene.ral and message.bmg are optional; a scene without them loads
+        // with no rails or messages, as the stream based loader did.
+        RefPtr<Platform::MappedFile> rail_map    = map_file(rail_bin).value_or(nullptr);
+        RefPtr<Platform::MappedFile> message_map = map_file(message_bin).value_or(nullptr);
+
+        // The files are independent, so they are parsed side by side. The
+        // object hierarchies further split their groups across the same
+        // worker pool, and have their render data loaded on this thread after.
+        auto load_hierarchy = [include_custom_objs](Object::SourceImage image, const fs_path &path,
+                                                    size_t fan_out_depth)
+            -> Result<RefPtr<Object::GroupSceneObject>, SerialError> {
+            auto result = Object::ObjectFactory::create(Object::ObjectFactory::game_io_tag{},
+                                                        image, 0, path.string(),
+                                                        include_custom_objs, fan_out_depth);
             if (!result) {
                 return std::unexpected(result.error());
             }
+            return std::static_pointer_cast<Object::GroupSceneObject, Object::ISceneObject>(
+                std::move(result.value()));
+        };
+
+        scene->m_map_source   = {scene_map.value(), Object::NewSourceImageID()};
+        scene->m_table_source = {tables_map.value(), Object::NewSourceImageID()};
+
+        Result<RefPtr<Object::GroupSceneObject>, SerialError> map_result;
+        Result<RefPtr<Object::GroupSceneObject>, SerialError> tables_result;
+        Result<void, SerialError> rail_result;
+        Result<void, SerialError> message_result;
+
+        const std::array<std::function<void()>, 4> loaders = {
+            [&]() { map_result = load_hierarchy(scene->m_map_source.image(), scene_bin, 2); },
+            [&]() {
+                tables_result = load_hierarchy(scene->m_table_source.image(), fs_path(), 1);
+            },
+            [&]() {
+                if (!rail_map) {
+                    return;
+                }
+                std::span<const char> image = rail_map->span();
+                Deserializer in(image, rail_bin.string());
+                rail_result = scene->m_rail_info->gameDeserialize(in);
+            },
+            [&]() {
+                if (!message_map) {
+                    return;
+                }
+                std::span<const char> image = message_map->span();
+                Deserializer in(image, message_bin.string());
+                message_result = scene->m_message_data->deserialize(in);
+            },
+        };
+        std::for_each(std::execution::par, loaders.begin(), loaders.end(),
+                      [](const std::function<void()> &loader) { loader(); });
+
+        if (!map_result) {
+            return std::unexpected(map_result.error());
         }
 
-        // Load the rail data
-        {
-            std::ifstream file(rail_bin, std::ios::in | std::ios::binary);
-            Deserializer in(file.rdbuf());
-
-            Result<void, SerialError> result = scene->m_rail_info->gameDeserialize(in);
-            if (!result) {
-                return std::unexpected(result.error());
-            }
+        if (!tables_result) {
+            return std::unexpected(tables_result.error());
         }
 
-        // Load the message data
-        {
-            std::ifstream file(message_bin, std::ios::in | std::ios::binary);
-            if (file.is_open()) {  // scene.bmg is optional
-                Deserializer in(file.rdbuf());
+        if (!rail_result) {
+            return std::unexpected(rail_result.error());
+        }
 
-                Result<void, SerialError> result = scene->m_message_data->deserialize(in);
-                if (!result) {
-                    return std::unexpected(result.error());
-                }
-            }
+        if (!message_result) {
+            return std::unexpected(message_result.error());
         }
 
+        scene->m_map_objects->setRoot(map_result.value());
+        scene->m_table_objects->setRoot(tables_result.value());
+
+        // Load the render data in file order, as the sequential loader did
+        Object::ObjectFactory::loadDeferredRenderData(scene->m_map_objects->getRoot());
+        Object::ObjectFactory::loadDeferredRenderData(scene->m_table_objects->getRoot());
+
         return scene;
     }
 
@@ -87,6 +144,89 @@ namespace Toolbox::Scene {
 
     SceneInstance::~SceneInstance() {}
 
+    static fs_path TempPathFor(const fs_path &path) {
+        fs_path temp_path = path;
+        temp_path += ".tmp";
+        return temp_path;
+    }
+
+    static Result<void, SerialError> WriteTempFile(const fs_path &path, std::string_view bytes) {
+        std::ofstream file(TempPathFor(path), std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), bytes.size());
+        file.close();
+        if (!file) {
+            return make_serial_error<void>("[SceneInstance]", "Failed to write the temporary file",
+                                           0, TempPathFor(path).string());
+        }
+        return {};
+    }
+
+    // Renaming over the old file means a failed save never leaves a
+    // truncated one behind for the game to load.
+    static Result<void, SerialError> ReplaceWithTempFile(const fs_path &path) {
+        auto result = Filesystem::rename(TempPathFor(path), path);
+        if (!result) {
+            (void)Filesystem::remove(TempPathFor(path));
+            return make_serial_error<void>("[SceneInstance]", result.error().m_message.front(), 0,
+                                           path.string());
+        }
+        return {};
+    }
+
+    Result<void, SerialError> SceneInstance::saveObjectFile(const fs_path &path,
+                                                            const ObjectHierarchy &hierarchy,
+                                                            ObjectFileSource &source) {
+        RefPtr<Object::GroupSceneObject> root = hierarchy.getRoot();
+        if (!root) {
+            return make_serial_error<void>("[SceneInstance]", "Root object is null", 0,
+                                           path.string());
+        }
+
+        const u64 written_id = Object::NewSourceImageID();
+        std::vector<std::pair<Object::ISceneObject *, Object::SourceRange>> written_ranges;
+
+        std::stringbuf buffer(std::ios::out | std::ios::binary);
+        {
+            Serializer out(&buffer, path.string());
+            auto result = root->gameSerializeSpliced(out, source.image(), written_ranges,
+                                                     written_id);
+            if (!result) {
+                return result;
+            }
+        }
+
+        const std::string_view bytes = buffer.view();
+        {
+            auto result = WriteTempFile(path, bytes);
+            if (!result) {
+                return result;
+            }
+        }
+
+        // A mapped file cannot be replaced on Windows, so the old image goes
+        // first. Objects that still point into it are serialized in full.
+        source = {};
+        {
+            auto result = ReplaceWithTempFile(path);
+            if (!result) {
+                return result;
+            }
+        }
+
+        // The new file becomes the source of the next save. Should it fail
+        // to map, that save simply writes every object again.
+        auto mapped = Platform::MappedFile::Open(path);
+        if (!mapped || mapped.value()->size() != bytes.size()) {
+            return {};
+        }
+
+        source = {mapped.value(), written_id};
+        for (auto &[object, range] : written_ranges) {
+            object->setSourceRange(range);
+        }
+        return {};
+    }
+
     Result<void, SerialError> SceneInstance::saveToPath(const fs_path &root) {
         auto scene_bin   = root / "map/scene.bin";
         auto tables_bin  = root / "map/tables.bin";
@@ -94,33 +234,37 @@ namespace Toolbox::Scene {
         auto message_bin = root / "map/message.bmg";
 
         {
-            std::ofstream file(scene_bin, std::ios::out | std::ios::binary);
-            Serializer out(file.rdbuf(), scene_bin.string());
-
-            auto result = m_map_objects->gameSerialize(out);
+            auto result = saveObjectFile(scene_bin, *m_map_objects, m_map_source);
             if (!result) {
                 return std::unexpected(result.error());
             }
         }
 
         {
-            std::ofstream file(tables_bin, std::ios::out | std::ios::binary);
-            Serializer out(file.rdbuf(), scene_bin.string());
-
-            auto result = m_table_objects->gameSerialize(out);
+            auto result = saveObjectFile(tables_bin, *m_table_objects, m_table_source);
             if (!result) {
                 return std::unexpected(result.error());
             }
         }
 
         {
-            std::ofstream file(rail_bin, std::ios::out | std::ios::binary);
-            Serializer out(file.rdbuf(), scene_bin.string());
+            std::stringbuf buffer(std::ios::out | std::ios::binary);
+            Serializer out(&buffer, rail_bin.string());
 
             auto result = m_rail_info->gameSerialize(out);
             if (!result) {
                 return std::unexpected(result.error());
             }
+
+            result = WriteTempFile(rail_bin, buffer.view());
+            if (!result) {
+                return std::unexpected(result.error());
+            }
+
+            result = ReplaceWithTempFile(rail_bin);
+            if (!result) {
+                return std::unexpected(result.error());
+            }
         }
 
         #if 0
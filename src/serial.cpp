@@ -25,4 +25,33 @@ namespace Toolbox {
         return {};
     }
 
+    void Deserializer::readCStringFast(std::string &str, size_t limit) {
+        if (!m_in.good()) {
+            m_in.setstate(std::ios::failbit);
+            return;
+        }
+
+        // Matches the stream path, which always consumes at least one char
+        const size_t max_chars =
+            limit == std::string::npos ? std::string::npos : std::max<size_t>(limit, 1);
+
+        const char *begin    = m_span_buf->current();
+        const size_t avail   = m_span_buf->remaining();
+        const size_t scanned = std::min(avail, max_chars);
+
+        const char *terminator = static_cast<const char *>(std::memchr(begin, '\0', scanned));
+        if (terminator) {
+            const size_t length = static_cast<size_t>(terminator - begin);
+            str.append(begin, length);
+            m_span_buf->advance(length + 1);
+            return;
+        }
+
+        str.append(begin, scanned);
+        m_span_buf->advance(scanned);
+        if (scanned < max_chars) {
+            m_in.setstate(std::ios::eofbit | std::ios::failbit);
+        }
+    }
+
 }  // namespace Toolbox
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include "serialbuf.hpp"
+
+namespace Toolbox {
+
+    SpanStreamBuf::pos_type SpanStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir,
+                                                   std::ios_base::openmode which) {
+        if ((which & std::ios_base::in) == 0) {
+            return pos_type(off_type(-1));
+        }
+
+        off_type base;
+        switch (dir) {
+        case std::ios_base::beg:
+            base = 0;
+            break;
+        case std::ios_base::cur:
+            base = static_cast<off_type>(tell());
+            break;
+        case std::ios_base::end:
+            base = static_cast<off_type>(size());
+            break;
+        default:
+            return pos_type(off_type(-1));
+        }
+
+        const off_type target = base + off;
+        if (target < 0 || target > static_cast<off_type>(size())) {
+            return pos_type(off_type(-1));
+        }
+
+        setg(eback(), eback() + target, egptr());
+        return pos_type(target);
+    }
+
+    SpanStreamBuf::pos_type SpanStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which) {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    GrowableStreamBuf::int_type GrowableStreamBuf::overflow(int_type ch) {
+        if (traits_type::eq_int_type(ch, traits_type::eof())) {
+            return traits_type::not_eof(ch);
+        }
+        const char c = traits_type::to_char_type(ch);
+        write(&c, 1);
+        return ch;
+    }
+
+    std::streamsize GrowableStreamBuf::xsputn(const char *s, std::streamsize count) {
+        write(s, static_cast<size_t>(count));
+        return count;
+    }
+
+    GrowableStreamBuf::pos_type GrowableStreamBuf::seekoff(off_type off,
+                                                           std::ios_base::seekdir dir,
+                                                           std::ios_base::openmode which) {
+        if ((which & std::ios_base::out) == 0) {
+            return pos_type(off_type(-1));
+        }
+
+        m_high_water = size();
+
+        off_type base;
+        switch (dir) {
+        case std::ios_base::beg:
+            base = 0;
+            break;
+        case std::ios_base::cur:
+            base = static_cast<off_type>(tell());
+            break;
+        case std::ios_base::end:
+            base = static_cast<off_type>(m_high_water);
+            break;
+        default:
+            return pos_type(off_type(-1));
+        }
+
+        const off_type target = base + off;
+        if (target < 0 || target > static_cast<off_type>(m_high_water)) {
+            return pos_type(off_type(-1));
+        }
+
+        setPutPosition(static_cast<size_t>(target));
+        return pos_type(target);
+    }
+
+    GrowableStreamBuf::pos_type GrowableStreamBuf::seekpos(pos_type pos,
+                                                           std::ios_base::openmode which) {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+    void GrowableStreamBuf::grow(size_t min_capacity) {
+        const size_t pos = tell();
+        m_high_water     = size();
+
+        size_t capacity = std::max<size_t>(m_storage.size(), 256);
+        while (capacity < min_capacity) {
+            capacity *= 2;
+        }
+
+        m_storage.resize(capacity);
+        setp(m_storage.data(), m_storage.data() + m_storage.size());
+        setPutPosition(pos);
+    }
+
+    void GrowableStreamBuf::setPutPosition(size_t pos) {
+        // pbump only takes an int, so the pointer is rebased instead
+        char *begin = m_storage.data();
+        setp(begin, begin + m_storage.size());
+        while (pos > 0) {
+            const int step = static_cast<int>(std::min<size_t>(pos, INT_MAX));
+            pbump(step);
+            pos -= step;
+        }
+    }
+
+}  // namespace Toolbox
@@ -0,0 +1,166 @@
+#include <algorithm>
+
+#include "core/simd.hpp"
+#include "sjis_table.hpp"
+#include "strutil.hpp"
+
+namespace Toolbox::String {
+
+    static_assert(std::is_sorted(SJIS::s_unicode_to_sjis.begin(), SJIS::s_unicode_to_sjis.end(),
+                                 [](const SJIS::UnicodeMapping &a, const SJIS::UnicodeMapping &b) {
+                                     return a.m_unicode < b.m_unicode;
+                                 }),
+                  "gen_sjis.py must emit the reverse table in code point order");
+
+    static constexpr char32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+    static void AppendUTF8(std::string &out, char32_t cp) {
+        if (cp < 0x80) {
+            out.push_back(static_cast<char>(cp));
+        } else if (cp < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    // Decodes one UTF-8 sequence starting at data[i], advancing i past it.
+    // Malformed sequences consume a single byte and yield U+FFFD.
+    static char32_t ReadUTF8(const u8 *data, size_t size, size_t &i) {
+        const u8 lead = data[i++];
+
+        size_t extra;
+        char32_t cp;
+        char32_t min_cp;
+        if ((lead & 0xE0) == 0xC0) {
+            extra  = 1;
+            cp     = lead & 0x1F;
+            min_cp = 0x80;
+        } else if ((lead & 0xF0) == 0xE0) {
+            extra  = 2;
+            cp     = lead & 0x0F;
+            min_cp = 0x800;
+        } else if ((lead & 0xF8) == 0xF0) {
+            extra  = 3;
+            cp     = lead & 0x07;
+            min_cp = 0x10000;
+        } else {
+            return REPLACEMENT_CHARACTER;
+        }
+
+        if (size - i < extra) {
+            return REPLACEMENT_CHARACTER;
+        }
+
+        for (size_t j = 0; j < extra; ++j) {
+            const u8 byte = data[i + j];
+            if ((byte & 0xC0) != 0x80) {
+                return REPLACEMENT_CHARACTER;
+            }
+            cp = (cp << 6) | (byte & 0x3F);
+        }
+
+        if (cp < min_cp || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            return REPLACEMENT_CHARACTER;
+        }
+
+        i += extra;
+        return cp;
+    }
+
+    std::string SJISToUTF8(std::string_view value) {
+        const u8 *data    = reinterpret_cast<const u8 *>(value.data());
+        const size_t size = value.size();
+
+        std::string out;
+        out.reserve(size + size / 2);
+
+        size_t i = 0;
+        while (i < size) {
+            // ASCII is shared by both encodings, so runs of it copy straight over
+            const size_t ascii_len = SIMD::CountASCIIPrefix(data + i, size - i);
+            out.append(value.data() + i, ascii_len);
+            i += ascii_len;
+            if (i == size) {
+                break;
+            }
+
+            const u8 byte        = data[i];
+            const int lead_index = SJIS::LeadIndex(byte);
+            if (lead_index < 0) {
+                const char16_t cp = SJIS::s_single_to_unicode[byte - 0x80];
+                AppendUTF8(out, cp != 0 ? cp : REPLACEMENT_CHARACTER);
+                i += 1;
+                continue;
+            }
+
+            if (i + 1 == size) {
+                AppendUTF8(out, REPLACEMENT_CHARACTER);
+                break;
+            }
+
+            const u8 trail = data[i + 1];
+            if (trail < SJIS::TRAIL_FIRST || trail > SJIS::TRAIL_LAST) {
+                // The trail byte may start the next character
+                AppendUTF8(out, REPLACEMENT_CHARACTER);
+                i += 1;
+                continue;
+            }
+
+            const size_t index = lead_index * SJIS::TRAIL_COUNT + (trail - SJIS::TRAIL_FIRST);
+            const char16_t cp  = SJIS::s_double_to_unicode[index];
+            AppendUTF8(out, cp != 0 ? cp : REPLACEMENT_CHARACTER);
+            i += 2;
+        }
+
+        return out;
+    }
+
+    std::string UTF8ToSJIS(std::string_view value) {
+        const u8 *data    = reinterpret_cast<const u8 *>(value.data());
+        const size_t size = value.size();
+
+        std::string out;
+        out.reserve(size);
+
+        size_t i = 0;
+        while (i < size) {
+            const size_t ascii_len = SIMD::CountASCIIPrefix(data + i, size - i);
+            out.append(value.data() + i, ascii_len);
+            i += ascii_len;
+            if (i == size) {
+                break;
+            }
+
+            const char32_t cp = ReadUTF8(data, size, i);
+            if (cp > 0xFFFF) {
+                out.push_back('?');
+                continue;
+            }
+
+            auto it = std::lower_bound(
+                SJIS::s_unicode_to_sjis.begin(), SJIS::s_unicode_to_sjis.end(), cp,
+                [](const SJIS::UnicodeMapping &m, char32_t c) { return m.m_unicode < c; });
+            if (it == SJIS::s_unicode_to_sjis.end() || it->m_unicode != cp) {
+                out.push_back('?');
+                continue;
+            }
+
+            if (it->m_sjis > 0xFF) {
+                out.push_back(static_cast<char>(it->m_sjis >> 8));
+            }
+            out.push_back(static_cast<char>(it->m_sjis & 0xFF));
+        }
+
+        return out;
+    }
+
+}  // namespace Toolbox::String
@@ -0,0 +1,494 @@
+#include "szs/yaz0.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <execution>
+#include <limits>
+#include <numeric>
+
+namespace Toolbox::SZS {
+
+    namespace {
+
+        constexpr size_t s_block_size        = 0x40000;
+        constexpr size_t s_hash_bits         = 15;
+        constexpr size_t s_hash_size         = size_t(1) << s_hash_bits;
+        constexpr size_t s_stream_flush_size = 0x10000;
+
+        // Cost in bits of each token kind, flag bit included
+        constexpr u32 s_literal_cost     = 9;
+        constexpr u32 s_short_match_cost = 17;
+        constexpr u32 s_long_match_cost  = 25;
+        constexpr size_t s_long_match    = 0x12;
+
+        struct Token {
+            u16 m_length;  // 0 for a literal
+            u16 m_distance;
+        };
+
+        struct LevelParams {
+            size_t m_chain_depth;
+            size_t m_nice_length;
+            bool m_lazy;
+            bool m_optimal;
+        };
+
+        LevelParams GetLevelParams(Yaz0Level level) {
+            switch (level) {
+            case Yaz0Level::LEVEL_FAST:
+                return {8, 32, false, false};
+            case Yaz0Level::LEVEL_DEFAULT:
+                return {64, 128, true, false};
+            case Yaz0Level::LEVEL_MAX:
+            default:
+                return {YAZ0_WINDOW_SIZE, YAZ0_MAX_MATCH, false, true};
+            }
+        }
+
+        inline u32 Hash3(const u8 *p) {
+            const u32 v = (u32(p[0]) << 16) | (u32(p[1]) << 8) | u32(p[2]);
+            return (v * 2654435761u) >> (32 - s_hash_bits);
+        }
+
+        // Hash chains over the positions [base, end) of the source, where base
+        // is up to one window ahead of the block being matched.
+        class MatchFinder {
+        public:
+            MatchFinder(std::span<const u8> src, size_t base, size_t end,
+                        const LevelParams &params)
+                : m_src(src), m_base(base), m_end(end), m_next(base),
+                  m_chain_depth(params.m_chain_depth), m_nice_length(params.m_nice_length),
+                  m_head(s_hash_size, -1), m_prev(end - base, -1) {}
+
+            // Makes every position before `pos` available as a match source.
+            void advance(size_t pos) {
+                pos = std::min(pos, m_end);
+                for (; m_next < pos; ++m_next) {
+                    if (m_next + YAZ0_MIN_MATCH > m_src.size()) {
+                        continue;
+                    }
+                    const u32 h            = Hash3(m_src.data() + m_next);
+                    m_prev[m_next - m_base] = m_head[h];
+                    m_head[h]              = static_cast<s32>(m_next);
+                }
+            }
+
+            // Longest match for `pos` that does not extend to or past `limit`.
+            Token find(size_t pos, size_t limit) const {
+                Token best = {0, 0};
+
+                const size_t max_len = std::min(YAZ0_MAX_MATCH, limit - pos);
+                if (max_len < YAZ0_MIN_MATCH) {
+                    return best;
+                }
+
+                const u8 *cur        = m_src.data() + pos;
+                const size_t min_pos = pos > YAZ0_WINDOW_SIZE ? pos - YAZ0_WINDOW_SIZE : 0;
+
+                size_t best_len = 0;
+                size_t depth    = m_chain_depth;
+                s32 cand        = m_head[Hash3(cur)];
+                while (cand >= 0 && depth > 0) {
+                    const size_t cand_pos = static_cast<size_t>(cand);
+                    if (cand_pos >= pos) {
+                        cand = m_prev[cand_pos - m_base];
+                        continue;
+                    }
+                    if (cand_pos < min_pos) {
+                        break;
+                    }
+                    depth -= 1;
+
+                    const u8 *ref = m_src.data() + cand_pos;
+                    if (ref[best_len] == cur[best_len]) {
+                        size_t len = 0;
+                        while (len < max_len && ref[len] == cur[len]) {
+                            ++len;
+                        }
+                        if (len > best_len) {
+                            best_len        = len;
+                            best.m_distance = static_cast<u16>(pos - cand_pos);
+                            if (len >= m_nice_length || len == max_len) {
+                                break;
+                            }
+                        }
+                    }
+                    cand = m_prev[cand_pos - m_base];
+                }
+
+                if (best_len >= YAZ0_MIN_MATCH) {
+                    best.m_length = static_cast<u16>(best_len);
+                } else {
+                    best.m_distance = 0;
+                }
+                return best;
+            }
+
+        private:
+            std::span<const u8> m_src;
+            size_t m_base;
+            size_t m_end;
+            size_t m_next;
+            size_t m_chain_depth;
+            size_t m_nice_length;
+            std::vector<s32> m_head;
+            std::vector<s32> m_prev;
+        };
+
+        void TokenizeGreedy(std::span<const u8> src, size_t begin, size_t end,
+                            const LevelParams &params, std::vector<Token> &tokens) {
+            const size_t base = begin - std::min(begin, YAZ0_WINDOW_SIZE);
+            MatchFinder finder(src, base, end, params);
+
+            Token next       = {0, 0};
+            size_t next_pos  = std::numeric_limits<size_t>::max();
+
+            size_t pos = begin;
+            while (pos < end) {
+                finder.advance(pos);
+                Token match = next_pos == pos ? next : finder.find(pos, end);
+
+                if (params.m_lazy && match.m_length != 0 && match.m_length < params.m_nice_length &&
+                    pos + 1 < end) {
+                    finder.advance(pos + 1);
+                    next     = finder.find(pos + 1, end);
+                    next_pos = pos + 1;
+                    if (next.m_length > match.m_length) {
+                        tokens.push_back({0, 0});
+                        pos += 1;
+                        continue;
+                    }
+                }
+
+                if (match.m_length == 0) {
+                    tokens.push_back({0, 0});
+                    pos += 1;
+                } else {
+                    tokens.push_back(match);
+                    pos += match.m_length;
+                }
+            }
+        }
+
+        // Every match costs the same regardless of distance, so knowing the
+        // longest match at each position is enough to find the cheapest parse.
+        void TokenizeOptimal(std::span<const u8> src, size_t begin, size_t end,
+                             const LevelParams &params, std::vector<Token> &tokens) {
+            const size_t base = begin - std::min(begin, YAZ0_WINDOW_SIZE);
+            MatchFinder finder(src, base, end, params);
+
+            const size_t count = end - begin;
+
+            std::vector<Token> longest(count);
+            for (size_t i = 0; i < count; ++i) {
+                finder.advance(begin + i);
+                longest[i] = finder.find(begin + i, end);
+            }
+
+            std::vector<u32> cost(count + 1, 0);
+            std::vector<u16> choice(count + 1, 0);
+            for (size_t i = count; i-- > 0;) {
+                u32 best_cost = cost[i + 1] + s_literal_cost;
+                u16 best_len  = 0;
+                for (size_t len = YAZ0_MIN_MATCH; len <= longest[i].m_length; ++len) {
+                    const u32 c = cost[i + len] +
+                                  (len < s_long_match ? s_short_match_cost : s_long_match_cost);
+                    if (c <= best_cost) {
+                        best_cost = c;
+                        best_len  = static_cast<u16>(len);
+                    }
+                }
+                cost[i]   = best_cost;
+                choice[i] = best_len;
+            }
+
+            for (size_t i = 0; i < count;) {
+                if (choice[i] == 0) {
+                    tokens.push_back({0, 0});
+                    i += 1;
+                } else {
+                    tokens.push_back({choice[i], longest[i].m_distance});
+                    i += choice[i];
+                }
+            }
+        }
+
+        inline void WriteBE32(u8 *dst, u32 value) {
+            dst[0] = static_cast<u8>(value >> 24);
+            dst[1] = static_cast<u8>(value >> 16);
+            dst[2] = static_cast<u8>(value >> 8);
+            dst[3] = static_cast<u8>(value);
+        }
+
+    }  // namespace
+
+    bool IsYaz0Compressed(std::span<const u8> data) {
+        return data.size() >= 4 && std::memcmp(data.data(), "Yaz0", 4) == 0;
+    }
+
+    u32 GetYaz0ExpandedSize(std::span<const u8> data) {
+        if (data.size() < 8 || !IsYaz0Compressed(data)) {
+            return 0;
+        }
+        return (u32(data[4]) << 24) | (u32(data[5]) << 16) | (u32(data[6]) << 8) | u32(data[7]);
+    }
+
+    size_t GetYaz0WorstEncodingSize(size_t src_size) {
+        return YAZ0_HEADER_SIZE + src_size + (src_size + 7) / 8;
+    }
+
+    Result<size_t> Yaz0Decode(std::span<const u8> src, std::span<u8> dst) {
+        if (!IsYaz0Compressed(src) || src.size() < YAZ0_HEADER_SIZE) {
+            return make_error<size_t>("YAZ0", "Data is not Yaz0 compressed");
+        }
+
+        const size_t out_size = std::min<size_t>(dst.size(), GetYaz0ExpandedSize(src));
+        const size_t in_size  = src.size();
+
+        const u8 *in = src.data();
+        u8 *out      = dst.data();
+
+        size_t in_pos  = YAZ0_HEADER_SIZE;
+        size_t out_pos = 0;
+        u8 flags       = 0;
+        u8 flag_count  = 0;
+
+        while (out_pos < out_size) {
+            if (flag_count == 0) {
+                if (in_pos >= in_size) {
+                    return make_error<size_t>("YAZ0", "Compressed data is truncated");
+                }
+                flags      = in[in_pos++];
+                flag_count = 8;
+            }
+
+            if ((flags & 0x80) != 0) {
+                if (in_pos >= in_size) {
+                    return make_error<size_t>("YAZ0", "Compressed data is truncated");
+                }
+                out[out_pos++] = in[in_pos++];
+            } else {
+                if (in_pos + 2 > in_size) {
+                    return make_error<size_t>("YAZ0", "Compressed data is truncated");
+                }
+                const u8 b0 = in[in_pos++];
+                const u8 b1 = in[in_pos++];
+
+                const size_t distance = ((size_t(b0 & 0xF) << 8) | b1) + 1;
+                size_t length         = b0 >> 4;
+                if (length == 0) {
+                    if (in_pos >= in_size) {
+                        return make_error<size_t>("YAZ0", "Compressed data is truncated");
+                    }
+                    length = size_t(in[in_pos++]) + s_long_match;
+                } else {
+                    length += 2;
+                }
+
+                if (distance > out_pos) {
+                    return make_error<size_t>("YAZ0",
+                                              "Back reference precedes the start of the output");
+                }
+
+                length        = std::min(length, out_size - out_pos);
+                u8 *d         = out + out_pos;
+                const u8 *s   = d - distance;
+                if (distance >= length) {
+                    std::memcpy(d, s, length);
+                } else {
+                    // Overlapping runs repeat the last `distance` bytes
+                    for (size_t i = 0; i < length; ++i) {
+                        d[i] = s[i];
+                    }
+                }
+                out_pos += length;
+            }
+
+            flags <<= 1;
+            flag_count -= 1;
+        }
+
+        return out_pos;
+    }
+
+    Result<std::vector<u8>> Yaz0Decode(std::span<const u8> src) {
+        std::vector<u8> out(GetYaz0ExpandedSize(src));
+        auto result = Yaz0Decode(src, out);
+        if (!result) {
+            return std::unexpected(result.error());
+        }
+        return out;
+    }
+
+    Result<std::vector<u8>> Yaz0Encode(std::span<const u8> src, Yaz0Level level) {
+        if (src.size() > std::numeric_limits<u32>::max()) {
+            return make_error<std::vector<u8>>("YAZ0", "Data is too large to be Yaz0 compressed");
+        }
+
+        const LevelParams params = GetLevelParams(level);
+
+        const size_t block_count = (src.size() + s_block_size - 1) / s_block_size;
+        std::vector<std::vector<Token>> block_tokens(block_count);
+
+        std::vector<size_t> block_indices(block_count);
+        std::iota(block_indices.begin(), block_indices.end(), 0);
+
+        std::for_each(std::execution::par, block_indices.begin(), block_indices.end(),
+                      [&](size_t block) {
+                          const size_t begin = block * s_block_size;
+                          const size_t end   = std::min(begin + s_block_size, src.size());
+
+                          std::vector<Token> &tokens = block_tokens[block];
+                          tokens.reserve((end - begin) / 2);
+                          if (params.m_optimal) {
+                              TokenizeOptimal(src, begin, end, params, tokens);
+                          } else {
+                              TokenizeGreedy(src, begin, end, params, tokens);
+                          }
+                      });
+
+        std::vector<u8> out;
+        out.reserve(GetYaz0WorstEncodingSize(src.size()));
+        out.resize(YAZ0_HEADER_SIZE, 0);
+        std::memcpy(out.data(), "Yaz0", 4);
+        WriteBE32(out.data() + 4, static_cast<u32>(src.size()));
+
+        size_t flag_pos  = 0;
+        u8 flag_count    = 0;
+        size_t src_pos   = 0;
+        for (const std::vector<Token> &tokens : block_tokens) {
+            for (const Token &token : tokens) {
+                if (flag_count == 0) {
+                    flag_pos = out.size();
+                    out.push_back(0);
+                }
+
+                if (token.m_length == 0) {
+                    out[flag_pos] |= static_cast<u8>(0x80 >> flag_count);
+                    out.push_back(src[src_pos]);
+                    src_pos += 1;
+                } else {
+                    const u32 distance = token.m_distance - 1;
+                    if (token.m_length < s_long_match) {
+                        out.push_back(static_cast<u8>(((token.m_length - 2) << 4) | (distance >> 8)));
+                        out.push_back(static_cast<u8>(distance));
+                    } else {
+                        out.push_back(static_cast<u8>(distance >> 8));
+                        out.push_back(static_cast<u8>(distance));
+                        out.push_back(static_cast<u8>(token.m_length - s_long_match));
+                    }
+                    src_pos += token.m_length;
+                }
+
+                flag_count = (flag_count + 1) & 7;
+            }
+        }
+
+        return out;
+    }
+
+    Result<void> Yaz0StreamDecoder::feed(std::span<const u8> chunk) {
+        m_input.insert(m_input.end(), chunk.begin(), chunk.end());
+
+        if (!m_has_header) {
+            if (m_input.size() < YAZ0_HEADER_SIZE) {
+                return {};
+            }
+            if (!IsYaz0Compressed(m_input)) {
+                return make_error<void>("YAZ0", "Stream is not Yaz0 compressed");
+            }
+            m_expanded_size = GetYaz0ExpandedSize(m_input);
+            m_input_pos     = YAZ0_HEADER_SIZE;
+            m_has_header    = true;
+        }
+
+        auto result = decodeAvailable();
+
+        m_input.erase(m_input.begin(), m_input.begin() + m_input_pos);
+        m_input_pos = 0;
+
+        return result;
+    }
+
+    Result<void> Yaz0StreamDecoder::decodeAvailable() {
+        while (m_decoded_size < m_expanded_size) {
+            const size_t avail = m_input.size() - m_input_pos;
+
+            if (m_flag_count == 0) {
+                if (avail < 1) {
+                    break;
+                }
+                m_flags      = m_input[m_input_pos++];
+                m_flag_count = 8;
+                continue;
+            }
+
+            if ((m_flags & 0x80) != 0) {
+                if (avail < 1) {
+                    break;
+                }
+                m_history.push_back(m_input[m_input_pos++]);
+                m_decoded_size += 1;
+            } else {
+                if (avail < 2) {
+                    break;
+                }
+                const u8 b0 = m_input[m_input_pos];
+                const u8 b1 = m_input[m_input_pos + 1];
+                if ((b0 >> 4) == 0 && avail < 3) {
+                    break;
+                }
+
+                const size_t distance = ((size_t(b0 & 0xF) << 8) | b1) + 1;
+                size_t length;
+                if ((b0 >> 4) == 0) {
+                    length = size_t(m_input[m_input_pos + 2]) + s_long_match;
+                    m_input_pos += 3;
+                } else {
+                    length = size_t(b0 >> 4) + 2;
+                    m_input_pos += 2;
+                }
+
+                if (distance > m_decoded_size) {
+                    return make_error<void>("YAZ0",
+                                            "Back reference precedes the start of the output");
+                }
+
+                length = std::min<size_t>(length, m_expanded_size - m_decoded_size);
+
+                size_t src_pos = m_history.size() - distance;
+                for (size_t i = 0; i < length; ++i) {
+                    const u8 value = m_history[src_pos++];
+                    m_history.push_back(value);
+                }
+                m_decoded_size += length;
+            }
+
+            m_flags <<= 1;
+            m_flag_count -= 1;
+
+            if (m_history.size() - m_history_flushed >= s_stream_flush_size) {
+                flush();
+            }
+        }
+
+        if (isFinished()) {
+            flush();
+        }
+        return {};
+    }
+
+    void Yaz0StreamDecoder::flush() {
+        if (m_history.size() > m_history_flushed && m_sink) {
+            m_sink(std::span<const u8>(m_history.data() + m_history_flushed,
+                                       m_history.size() - m_history_flushed));
+        }
+
+        // Keep one window of output around for back references
+        if (m_history.size() > YAZ0_WINDOW_SIZE) {
+            m_history.erase(m_history.begin(), m_history.end() - YAZ0_WINDOW_SIZE);
+        }
+        m_history_flushed = m_history.size();
+    }
+
+}  // namespace Toolbox::SZS
@@ -4,9 +4,10 @@
 
 namespace Toolbox {
 
-    static UUID64::device s_random_device;
-    static UUID64::engine s_engine(s_random_device());
-    static UUID64::distributor s_distributor;
+    // Objects are created from worker threads while loading scenes, so each
+    // thread draws from its own engine.
+    static thread_local UUID64::engine s_engine(UUID64::device{}());
+    static thread_local UUID64::distributor s_distributor;
 
     u64 UUID64::_generate() { return m_UUID64 = s_distributor(s_engine); }
 
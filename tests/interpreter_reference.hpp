@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+
+#include "dolphin/interpreter/system.hpp"
+
+namespace Toolbox::Interpreter {
+
+    // The switch dispatcher SystemDolphin ran before instructions were decoded
+    // into its block cache, kept as it was (quirks included) so the decoded
+    // handlers can be checked against it. step() evaluates the word at the PC
+    // of the wrapped system the way evaluateInstruction() used to.
+    class ReferenceDispatcher {
+    public:
+        explicit ReferenceDispatcher(SystemDolphin &system)
+            : m_system(system), m_storage(system.m_storage), m_branch_proc(system.m_branch_proc),
+              m_fixed_proc(system.m_fixed_proc), m_float_proc(system.m_float_proc),
+              m_system_proc(system.m_system_proc) {}
+
+        void step();
+
+        // Evaluates the word at the PC through its decoded handler instead,
+        // moving the PC on the way SystemDolphin::evaluateBlock() does.
+        void stepDecoded() {
+            DecodedInstruction op;
+            SystemDolphin::decodeInstruction(m_system.read<u32>((u32)m_system_proc.m_pc), op);
+
+            Register::PC next_instruction = m_system_proc.m_pc + 4;
+            (m_system.*op.m_handler)(op, next_instruction);
+
+            m_system_proc.m_last_pc = m_system_proc.m_pc;
+            m_system_proc.m_pc      = next_instruction;
+        }
+
+        // SystemDolphin::evaluateFunction() as it was, stepping one word at a
+        // time until the return sentinel or a raised exception.
+        Register::RegisterSnapshot evaluateFunction(u32 function_ptr, u8 gpr_argc,
+                                                    u32 *gpr_argv) {
+            m_system_proc.m_pc = function_ptr;
+            m_branch_proc.m_lr = 0xDEADBEEF;
+
+            for (u8 gpr_arg = 0; gpr_arg < gpr_argc; ++gpr_arg) {
+                m_fixed_proc.m_gpr[gpr_arg + 3] = gpr_argv[gpr_arg];
+            }
+
+            m_system.m_evaluating = true;
+            while (m_system.m_evaluating) {
+                if (m_system_proc.m_pc == (0xdeadbeef & ~0b11)) {
+                    m_system.m_evaluating = false;
+                    break;
+                }
+                step();
+            }
+
+            return m_system.createSnapshot();
+        }
+
+        [[nodiscard]] Register::RegisterSnapshot snapshot() const {
+            return m_system.createSnapshot();
+        }
+
+        void restore(const Register::RegisterSnapshot &snapshot) {
+            m_branch_proc.m_cr  = snapshot.m_cr;
+            m_branch_proc.m_ctr = snapshot.m_ctr;
+            m_branch_proc.m_lr  = snapshot.m_lr;
+
+            m_system_proc.m_pc      = snapshot.m_pc;
+            m_system_proc.m_last_pc = snapshot.m_last_pc;
+            m_system_proc.m_dar     = snapshot.m_dar;
+            m_system_proc.m_dsisr   = snapshot.m_dsisr;
+            m_system_proc.m_msr     = snapshot.m_msr;
+            m_system_proc.m_srr0    = snapshot.m_srr0;
+            m_system_proc.m_srr1    = snapshot.m_srr1;
+            m_system_proc.m_tb      = snapshot.m_tb;
+
+            std::memcpy(m_fixed_proc.m_gpr, snapshot.m_gpr, sizeof(Register::GPR) * 32);
+            m_fixed_proc.m_xer = snapshot.m_xer;
+
+            std::memcpy(m_float_proc.m_fpr, snapshot.m_fpr, sizeof(Register::FPR) * 32);
+            m_float_proc.m_fpscr = snapshot.m_fpscr;
+        }
+
+        [[nodiscard]] Register::GQR *gqr() { return m_float_proc.m_gqr; }
+
+    protected:
+        Register::PC evaluatePairedSingleSubOp(u32 inst);
+        Register::PC evaluateControlFlowSubOp(u32 inst);
+        Register::PC evaluateFixedSubOp(u32 inst);
+        Register::PC evaluateFloatSingleSubOp(u32 inst);
+        Register::PC evaluateFloatSubOp(u32 inst);
+
+        void internalInvalidCB(const std::string &reason) { m_system.internalInvalidCB(reason); }
+
+    private:
+        SystemDolphin &m_system;
+
+        MemoryStorage &m_storage;
+        BranchProcessor &m_branch_proc;
+        FixedPointProcessor &m_fixed_proc;
+        FloatingPointProcessor &m_float_proc;
+        SystemProcessor &m_system_proc;
+    };
+
+}  // namespace Toolbox::Interpreter
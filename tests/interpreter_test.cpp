@@ -0,0 +1,411 @@
+// Checks the decoded handlers SystemDolphin runs from its block cache against
+// the switch dispatcher they replaced (interpreter_reference.cpp).
+//
+// usage: interpreter_test [--seed N] [--words N]
+//
+// Every primary opcode, and every extended opcode of the 4/19/31/59/63
+// tables, is evaluated over random operands and random register state by
+// both, one word at a time, comparing the registers, the next PC, any raised
+// exception and all of memory afterwards. Then a few whole routines
+// (branches, calls, code that rewrites itself, a fault partway through a
+// block) are run through evaluateFunction() against the reference stepping
+// the same code.
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "interpreter_reference.hpp"
+
+using namespace Toolbox;
+using namespace Toolbox::Interpreter;
+
+namespace {
+
+    constexpr u32 s_memory_size = 0x20000;
+    constexpr u32 s_code_ofs    = 0x1000;
+    constexpr u32 s_data_ofs    = 0x10000;
+
+    struct Outcome {
+        enum Kind { NONE, EXCEPTION, INVALID } m_kind = NONE;
+        u32 m_pc                                     = 0;
+        ExceptionCause m_cause{};
+
+        bool operator==(const Outcome &) const = default;
+    };
+
+    // One side of a comparison: a system whose callbacks record what it raised.
+    struct Side {
+        SystemDolphin m_system;
+        ReferenceDispatcher m_dispatcher;
+        Outcome m_outcome;
+
+        explicit Side(const SystemDolphin &base) : m_system(base), m_dispatcher(m_system) {
+            m_system.onException(
+                [this](u32 pc, ExceptionCause cause, const Register::RegisterSnapshot &) {
+                    m_outcome = {Outcome::EXCEPTION, pc, cause};
+                });
+            m_system.onInvalid(
+                [this](u32 pc, const std::string &, const Register::RegisterSnapshot &) {
+                    m_outcome = {Outcome::INVALID, pc, {}};
+                });
+        }
+
+        std::vector<u8> memory() {
+            std::vector<u8> out(s_memory_size);
+            m_system.getMemoryStorage().readBytes(0, out.data(), out.size());
+            return out;
+        }
+    };
+
+    // Returns the name of the first register that differs, or nullptr.
+    const char *Difference(const Register::RegisterSnapshot &a,
+                           const Register::RegisterSnapshot &b) {
+        if (a.m_pc != b.m_pc)
+            return "pc";
+        if (a.m_last_pc != b.m_last_pc)
+            return "last pc";
+        if (std::memcmp(a.m_gpr, b.m_gpr, sizeof(a.m_gpr)) != 0)
+            return "gpr";
+        for (int i = 0; i < 32; ++i) {
+            if (a.m_fpr[i].m_ps0 != b.m_fpr[i].m_ps0 || a.m_fpr[i].m_ps1 != b.m_fpr[i].m_ps1)
+                return "fpr";
+        }
+        if (a.m_cr.m_crf != b.m_cr.m_crf)
+            return "cr";
+        if (a.m_lr != b.m_lr)
+            return "lr";
+        if (a.m_ctr != b.m_ctr)
+            return "ctr";
+        if (a.m_xer != b.m_xer)
+            return "xer";
+        if (a.m_fpscr != b.m_fpscr)
+            return "fpscr";
+        if (a.m_msr != b.m_msr)
+            return "msr";
+        if (a.m_tb != b.m_tb)
+            return "tb";
+        if (a.m_dar != b.m_dar)
+            return "dar";
+        if (a.m_dsisr != b.m_dsisr)
+            return "dsisr";
+        if (a.m_srr0 != b.m_srr0)
+            return "srr0";
+        if (a.m_srr1 != b.m_srr1)
+            return "srr1";
+        return nullptr;
+    }
+
+    // Compares everything the two sides can observe, printing the first
+    // difference under `what` and `id` (the word, or the pass).
+    bool Matches(Side &reference, Side &decoded, const char *what, u32 id) {
+        const char *diff = Difference(reference.m_dispatcher.snapshot(),
+                                      decoded.m_dispatcher.snapshot());
+        if (!diff && reference.m_outcome != decoded.m_outcome) {
+            diff = "raised exception";
+        }
+        if (!diff && std::memcmp(reference.m_dispatcher.gqr(), decoded.m_dispatcher.gqr(),
+                                 sizeof(Register::GQR) * 8) != 0) {
+            diff = "gqr";
+        }
+        if (!diff && reference.memory() != decoded.memory()) {
+            diff = "memory";
+        }
+        if (diff) {
+            std::fprintf(stderr, "%s %08X: %s differs\n", what, id, diff);
+            return false;
+        }
+        return true;
+    }
+
+    class StateGenerator {
+    public:
+        explicit StateGenerator(u32 seed) : m_rng(seed) {}
+
+        u32 next() { return static_cast<u32>(m_rng()); }
+
+        // Mostly pointers into the data region, so that loads and stores
+        // land, plus small and arbitrary values for everything else.
+        u32 gpr() {
+            switch (next() % 4) {
+            case 0:
+            case 1:
+                return 0x80000000 + s_data_ofs + (next() % (s_memory_size - s_data_ofs));
+            case 2:
+                return static_cast<u32>(static_cast<s32>(next() % 64) - 32);
+            default:
+                return next();
+            }
+        }
+
+        u64 fpr() {
+            switch (next() % 6) {
+            case 0:
+                return std::bit_cast<u64>(0.0);
+            case 1:
+                return std::bit_cast<u64>(-1.5);
+            case 2:
+                return std::bit_cast<u64>(std::numeric_limits<f64>::infinity());
+            case 3:
+                return std::bit_cast<u64>(std::numeric_limits<f64>::quiet_NaN());
+            case 4:
+                return std::bit_cast<u64>(static_cast<f64>(static_cast<f32>(
+                    static_cast<s32>(next()) / 65536.0)));
+            default:
+                return (static_cast<u64>(next()) << 32) | next();
+            }
+        }
+
+        void randomize(ReferenceDispatcher &dispatcher) {
+            Register::RegisterSnapshot state = dispatcher.snapshot();
+            for (auto &gpr : state.m_gpr) {
+                gpr = this->gpr();
+            }
+            for (auto &fpr : state.m_fpr) {
+                fpr.setBoth(this->fpr(), this->fpr());
+            }
+            state.m_cr.m_crf = next();
+            state.m_lr       = next() & ~3;
+            state.m_ctr      = next() % 4 == 0 ? 1 : next();
+            state.m_xer      = next() & 0xE000007F;
+            state.m_fpscr    = next();
+            state.m_msr      = next();
+            state.m_pc       = 0x80000000 + s_code_ofs;
+            state.m_last_pc  = state.m_pc - 4;
+            dispatcher.restore(state);
+            for (int i = 0; i < 8; ++i) {
+                dispatcher.gqr()[i] = next();
+            }
+        }
+
+        // The fields below the opcode are random, except for the extended
+        // opcode in the table forms.
+        u32 word(u32 opcode, int xo) {
+            u32 inst = (opcode << 26) | (next() & 0x03FFFFFF);
+            if (xo >= 0) {
+                inst = (inst & ~(0x3FFu << 1)) | (static_cast<u32>(xo) << 1);
+            }
+            return inst;
+        }
+
+    private:
+        std::mt19937 m_rng;
+    };
+
+    SystemDolphin MakeBase(StateGenerator &gen) {
+        SystemDolphin base;
+        MemoryStorage &storage = base.getMemoryStorage();
+        storage.initialize(s_memory_size);
+
+        std::vector<u32> data((s_memory_size - s_data_ofs) / 4);
+        for (auto &word : data) {
+            word = gen.next();
+        }
+        storage.writeBytes(s_data_ofs, data.data(), data.size() * 4);
+        return base;
+    }
+
+    bool CheckWord(const SystemDolphin &base, StateGenerator &gen, u32 inst) {
+        Side reference(base);
+        gen.randomize(reference.m_dispatcher);
+        reference.m_system.getMemoryStorage().set<u32>(s_code_ofs, std::byteswap(inst));
+
+        Side decoded(reference.m_system);
+        reference.m_dispatcher.step();
+        decoded.m_dispatcher.stepDecoded();
+
+        return Matches(reference, decoded, "word", inst);
+    }
+
+    bool IsTableOpcode(u32 opcode) {
+        return opcode == 4 || opcode == 19 || opcode == 31 || opcode == 59 || opcode == 63;
+    }
+
+    int CheckWords(u32 seed, int words) {
+        StateGenerator gen(seed);
+        const SystemDolphin base = MakeBase(gen);
+
+        int failures = 0;
+        for (u32 opcode = 0; opcode < 64; ++opcode) {
+            if (IsTableOpcode(opcode)) {
+                for (int xo = 0; xo < 1024; ++xo) {
+                    for (int i = 0; i < std::max(1, words / 64); ++i) {
+                        failures += !CheckWord(base, gen, gen.word(opcode, xo));
+                    }
+                }
+            } else {
+                for (int i = 0; i < words; ++i) {
+                    failures += !CheckWord(base, gen, gen.word(opcode, -1));
+                }
+            }
+        }
+        return failures;
+    }
+
+    // Canned routines, assembled by hand. Each returns through the LR.
+    struct Routine {
+        const char *m_name;
+        std::vector<u32> m_code;
+        std::vector<u32> m_args;
+    };
+
+    constexpr u32 Addi(u32 rd, u32 ra, s16 si) {
+        return (14u << 26) | (rd << 21) | (ra << 16) | static_cast<u16>(si);
+    }
+    constexpr u32 Lis(u32 rd, u16 ui) { return (15u << 26) | (rd << 21) | ui; }
+    constexpr u32 Ori(u32 ra, u32 rs, u16 ui) { return (24u << 26) | (rs << 21) | (ra << 16) | ui; }
+    constexpr u32 Lwz(u32 rd, s16 d, u32 ra) {
+        return (32u << 26) | (rd << 21) | (ra << 16) | static_cast<u16>(d);
+    }
+    constexpr u32 Stw(u32 rs, s16 d, u32 ra) {
+        return (36u << 26) | (rs << 21) | (ra << 16) | static_cast<u16>(d);
+    }
+    constexpr u32 Stwu(u32 rs, s16 d, u32 ra) {
+        return (37u << 26) | (rs << 21) | (ra << 16) | static_cast<u16>(d);
+    }
+    constexpr u32 X31(u32 d, u32 a, u32 b, u32 xo) {
+        return (31u << 26) | (d << 21) | (a << 16) | (b << 11) | (xo << 1);
+    }
+    constexpr u32 Add(u32 rd, u32 ra, u32 rb) { return X31(rd, ra, rb, 266); }
+    constexpr u32 Xor(u32 ra, u32 rs, u32 rb) { return X31(rs, ra, rb, 316); }
+    constexpr u32 Mr(u32 ra, u32 rs) { return X31(rs, ra, rs, 444); }
+    constexpr u32 Cmpw(u32 ra, u32 rb) { return X31(0, ra, rb, 0); }
+    constexpr u32 Mflr(u32 rd) { return X31(rd, 8, 0, 339); }
+    constexpr u32 Mtlr(u32 rs) { return X31(rs, 8, 0, 467); }
+    constexpr u32 Mtctr(u32 rs) { return X31(rs, 9, 0, 467); }
+    constexpr u32 Rlwinm(u32 ra, u32 rs, u32 sh, u32 mb, u32 me) {
+        return (21u << 26) | (rs << 21) | (ra << 16) | (sh << 11) | (mb << 6) | (me << 1);
+    }
+    // Branches take the displacement in words from the branch itself
+    constexpr u32 Blt(s32 words) { return (16u << 26) | (12 << 21) | ((words * 4) & 0xFFFC); }
+    constexpr u32 Bdnz(s32 words) { return (16u << 26) | (16 << 21) | ((words * 4) & 0xFFFC); }
+    constexpr u32 Bl(s32 words) { return (18u << 26) | ((words * 4) & 0x03FFFFFC) | 1; }
+    constexpr u32 Blr() { return 0x4E800020; }
+
+    std::vector<Routine> Routines() {
+        constexpr u32 data = 0x80000000 + s_data_ofs;
+
+        // clang-format off
+        return {
+            {"integer loop",
+             {Addi(4, 0, 0), Addi(6, 0, 0), Addi(5, 0, 500), Lis(7, 0x8001),
+              Addi(4, 4, 1), Add(6, 6, 4), Rlwinm(8, 6, 3, 0, 28), Stw(8, 0, 7),
+              Lwz(9, 0, 7), Xor(6, 6, 9), Cmpw(4, 5), Blt(-7),
+              Mr(3, 6), Blr()},
+             {}},
+            {"call with a stack frame",
+             {Stwu(1, -16, 1), Mflr(0), Stw(0, 20, 1), Addi(3, 3, 1),
+              Bl(6), Bl(5), Lwz(0, 20, 1), Mtlr(0),
+              Addi(1, 1, 16), Blr(), Addi(3, 3, 3), Blr()},
+             {5}},
+            {"counted loop",
+             {Mtctr(3), Addi(3, 0, 0), Addi(3, 3, 7), Bdnz(-1), Blr()},
+             {100}},
+            // Rewrites the word after the store, in the same block
+            {"self modifying",
+             {Lis(4, 0x8000), Ori(4, 4, s_code_ofs), Lwz(5, 24, 4), Addi(3, 0, 1),
+              Stw(5, 20, 4), Addi(3, 3, 1), Addi(3, 3, 100), Blr()},
+             {}},
+            // Faults on the load in the middle of the block
+            {"fault in a block",
+             {Addi(3, 0, 1), Lis(4, 0x7000), Addi(3, 3, 1), Lwz(5, 0, 4),
+              Addi(3, 3, 1), Blr()},
+             {}},
+            {"runs into an unknown word",
+             {Addi(3, 0, 1), Addi(3, 3, 1), 0x00000000, Addi(3, 3, 1), Blr()},
+             {}},
+            {"stores over the data",
+             {Lis(4, data >> 16), Addi(5, 0, 64), Mtctr(5), Stwu(5, 4, 4), Bdnz(-1),
+              Blr()},
+             {}},
+        };
+        // clang-format on
+    }
+
+    int CheckRoutines(u32 seed) {
+        StateGenerator gen(seed);
+        const SystemDolphin base = MakeBase(gen);
+
+        int failures = 0;
+        for (const Routine &routine : Routines()) {
+            Side reference(base);
+            reference.m_system.setStackPointer(0x80000000 + s_data_ofs + 0x8000);
+            std::vector<u32> code(routine.m_code.size());
+            std::transform(routine.m_code.begin(), routine.m_code.end(), code.begin(),
+                           [](u32 inst) { return std::byteswap(inst); });
+            reference.m_system.getMemoryStorage().writeBytes(s_code_ofs, code.data(),
+                                                             code.size() * 4);
+
+            std::vector<u32> args = routine.m_args;
+            Side decoded(reference.m_system);
+
+            // Twice over the same system, so the second run is served from
+            // blocks decoded by the first.
+            for (int pass = 0; pass < 2; ++pass) {
+                reference.m_dispatcher.evaluateFunction(0x80000000 + s_code_ofs,
+                                                        static_cast<u8>(args.size()), args.data());
+                decoded.m_system.evaluateFunction(0x80000000 + s_code_ofs,
+                                                  static_cast<u8>(args.size()), args.data(), 0,
+                                                  nullptr);
+                failures += !Matches(reference, decoded, routine.m_name, pass);
+            }
+        }
+        return failures;
+    }
+
+    // The lookup interpreter in TaskCommunicator keeps its blocks across
+    // calls and maps a fresh view of the game each time; code that changed in
+    // between must not run from the old blocks.
+    int CheckRemap() {
+        auto image = std::shared_ptr<u32[]>(new u32[s_memory_size / 4]());
+        image[s_code_ofs / 4]     = std::byteswap(Addi(3, 0, 1));
+        image[s_code_ofs / 4 + 1] = std::byteswap(Blr());
+
+        SystemDolphin system;
+        int failures = 0;
+        for (u32 expected = 1; expected <= 3; ++expected) {
+            image[s_code_ofs / 4] = std::byteswap(Addi(3, 0, static_cast<s16>(expected)));
+            system.mapMemory(image, s_memory_size);
+
+            auto snapshot = system.evaluateFunction(0x80000000 + s_code_ofs, 0, nullptr, 0,
+                                                    nullptr);
+            if (snapshot.m_gpr[3] != expected) {
+                std::fprintf(stderr, "remap %u: returned %u\n", expected,
+                             static_cast<u32>(snapshot.m_gpr[3]));
+                ++failures;
+            }
+            system.unmapMemory();
+        }
+        return failures;
+    }
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    u32 seed  = 0x5EED;
+    int words = 256;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--seed" && i + 1 < argc) {
+            seed = static_cast<u32>(std::strtoul(argv[++i], nullptr, 0));
+        } else if (arg == "--words" && i + 1 < argc) {
+            words = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "usage: %s [--seed N] [--words N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const int word_failures    = CheckWords(seed, words);
+    const int routine_failures = CheckRoutines(seed) + CheckRemap();
+    std::printf("seed %u: %d word and %d routine mismatches\n", seed, word_failures,
+                routine_failures);
+    return word_failures + routine_failures == 0 ? 0 : 1;
+}